@@ -45,6 +45,31 @@ hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle);
 //! @returns HIPTENSOR_STATUS_SUCCESS on success and an error code otherwise
 hiptensorStatus_t hiptensorDestroy(hiptensorHandle_t* handle);
 
+//! @brief Sets where the alpha and beta scalars of the operations run on the handle are read
+//! @details In HIPTENSOR_POINTER_MODE_DEVICE, the alpha and beta arguments of
+//! hiptensorContraction, hiptensorContractionBatched, hiptensorContractionBatchedPointers,
+//! hiptensorPermutation, hiptensorReduction, hiptensorTensorNetwork and hiptensorEinsum are
+//! device pointers, read by the kernels in stream order, so that scalars computed on the
+//! device need no synchronization. The alpha and beta of the result are applied by an
+//! extra pass over the output. Device scalars are not supported by grouped contractions,
+//! contraction epilogues, planar complex contractions, or permutations with a unary
+//! operator on B. The mode applies to the calls made after it is set, and defaults to
+//! HIPTENSOR_POINTER_MODE_HOST.
+//! @param[in,out] handle Opaque handle holding hipTensor's library context.
+//! @param[in] mode Pointer mode of the scalars.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the mode is not a pointer mode.
+hiptensorStatus_t hiptensorSetPointerMode(hiptensorHandle_t* handle, hiptensorPointerMode_t mode);
+
+//! @brief Gets the pointer mode of the alpha and beta scalars of the handle
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] mode Pointer mode of the scalars.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or mode is nullptr.
+hiptensorStatus_t hiptensorGetPointerMode(const hiptensorHandle_t* handle,
+                                          hiptensorPointerMode_t*  mode);
+
 //! @brief Initializes a tensor descriptor
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[out] desc Pointer to the allocated tensor descriptor object.
@@ -65,6 +90,39 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
                                                 hipDataType                  dataType,
                                                 hiptensorOperator_t          unaryOp);
 
+//! @brief Initializes a tensor descriptor for a planar (split) complex tensor
+//!
+//! @details The real and imaginary parts of a planar complex tensor are stored in
+//! two planes of real elements, each laid out with the given lengths and strides.
+//! The imaginary plane starts planeStride real elements past the real plane, whose
+//! address is the one passed to the operations. Contractions, permutations and
+//! reductions consume and produce planar tensors without converting them to the
+//! interleaved layout. Planar reductions sum each plane on its own, so their alpha and beta
+//! must be real.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] desc Pointer to the allocated tensor descriptor object.
+//! @param[in] numModes Number of modes.
+//! @param[in] lens Extent of each mode(lengths) (must be larger than zero).
+//! @param[in] strides stride[i] denotes the displacement (stride) between two consecutive
+//! elements of each plane in the ith-mode. If stride is NULL, generalized packed column-major
+//! memory layout is assumed (i.e., the strides increase monotonically from left to right).
+//! @param[in] dataType Complex data type of the stored entries (HIP_C_32F or HIP_C_64F).
+//! @param[in] unaryOp Unary operator that will be applied to the tensor.
+//! @param[in] planeStride Distance, in real elements, from the real plane to the imaginary
+//! plane. If zero, the imaginary plane immediately follows the real plane.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the data type is not complex, or planeStride is
+//! negative or places the imaginary plane inside the real plane.
+hiptensorStatus_t hiptensorInitPlanarTensorDescriptor(const hiptensorHandle_t*     handle,
+                                                      hiptensorTensorDescriptor_t* desc,
+                                                      const uint32_t               numModes,
+                                                      const int64_t                lens[],
+                                                      const int64_t                strides[],
+                                                      hipDataType                  dataType,
+                                                      hiptensorOperator_t          unaryOp,
+                                                      const int64_t                planeStride);
+
 //! @brief Returns the description string for an error code
 //! @param[in] error Error code to convert to string.
 //! @retval the error string.
@@ -111,6 +169,12 @@ hiptensorStatus_t hiptensorGetAlignmentRequirement(const hiptensorHandle_t*
                                                    uint32_t* alignmentRequirement);
 
 //! @brief Initializes a contraction descriptor for the tensor contraction problem.
+//! A mode repeated in A or B selects the diagonal of that tensor. Modes of A or B found in no
+//! other tensor are summed out of it by a reduction into the workspace before the contraction,
+//! which hiptensorContractionGetWorkspaceSize accounts for.
+//! The unary operators of descA and descB are applied to A and B as they are read:
+//! HIPTENSOR_OP_SQRT on single precision tensors and HIPTENSOR_OP_CONJ on single precision
+//! complex tensors. They are not supported on tensors with summed out modes.
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[out] desc Tensor contraction problem descriptor.
 //! @param[in] descA A descriptor that holds information about tensor A.
@@ -128,6 +192,9 @@ hiptensorStatus_t hiptensorGetAlignmentRequirement(const hiptensorHandle_t*
 //! @param[in] typeCompute Datatype for the intermediate computation  T = A * B.
 //! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
 //! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or tensor descriptors are not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if a repeated mode has different lengths.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if modes are summed out of a planar tensor, or of a
+//! tensor with a unary operator.
 hiptensorStatus_t hiptensorInitContractionDescriptor(const hiptensorHandle_t*           handle,
                                                      hiptensorContractionDescriptor_t*  desc,
                                                      const hiptensorTensorDescriptor_t* descA,
@@ -144,6 +211,36 @@ hiptensorStatus_t hiptensorInitContractionDescriptor(const hiptensorHandle_t*
                                                      const uint32_t         alignmentRequirementD,
                                                      hiptensorComputeType_t typeCompute);
 
+//! @brief Sets the epilogue of a contraction descriptor, fused into the contraction kernel:
+//! D = activation(alpha * A * B + beta * C + bias), converted to the data type of D.
+//! @details The bias is broadcast over the modes of D that it does not have. Epilogues are
+//! supported on HIP_R_32F A and B with HIPTENSOR_COMPUTE_32F, and D of HIP_R_32F, HIP_R_16F
+//! or HIP_R_16BF. They are not supported by batched or grouped contractions.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in,out] desc Tensor contraction descriptor initialized by
+//! @ref hiptensorInitContractionDescriptor.
+//! @param[in] bias Device pointer of a HIP_R_32F bias, or nullptr for no bias.
+//! @param[in] descBias A descriptor of the bias, or nullptr for no bias.
+//! @param[in] modeBias Array of the modes of the bias, each a mode of D, or nullptr for no bias.
+//! @param[in] activation Activation applied to the result.
+//! @param[in] lower Lower bound of HIPTENSOR_ACTIVATION_CLAMP.
+//! @param[in] upper Upper bound of HIPTENSOR_ACTIVATION_CLAMP.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or descriptor is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the bias is only partly given, a bias mode is not
+//! a mode of D or differs in length, or lower > upper.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the data types, planar or batch modes of the
+//! contraction are not supported by epilogues.
+hiptensorStatus_t
+    hiptensorContractionDescriptorSetEpilogue(const hiptensorHandle_t*           handle,
+                                              hiptensorContractionDescriptor_t*  desc,
+                                              const void*                        bias,
+                                              const hiptensorTensorDescriptor_t* descBias,
+                                              const int32_t                      modeBias[],
+                                              hiptensorActivation_t              activation,
+                                              float                              lower,
+                                              float                              upper);
+
 //! @brief Narrows down the candidates for the contraction problem.
 //! @details This function gives the user finer control over the candidates that
 //! the subsequent call to @ref hiptensorInitContractionPlan is allowed to
@@ -207,8 +304,9 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
 //! @param[in] beta Scaling parameter for C of data type 'typeCompute'.
 //! @param[in] C Pointer to C's data in device memory.
 //! @param[out] D Pointer to D's data in device memory.
-//! @param[out] workspace Workspace pointer in device memory
-//! @param[in] workspaceSize Available workspace size.
+//! @param[out] workspace Workspace pointer in device memory. If nullptr, the workspace required
+//! by the plan is provided by the handle's stream-ordered memory arena.
+//! @param[in] workspaceSize Available workspace size. Ignored if workspace is nullptr.
 //! @param[in] stream HIP stream to perform all operations.
 //! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
 //! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or pointers are not
@@ -227,6 +325,428 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
                                        uint64_t                          workspaceSize,
                                        hipStream_t                       stream);
 
+//! @brief Initializes the contraction plan of a single batch, and ranks the batched kernels
+//! for a strided batch of it
+//! @details The plan is initialized as by hiptensorInitContractionPlan. The batched kernels
+//! that run the whole batch in a single launch are then timed on the batch shape, and the
+//! fastest one within workspaceSize is kept in the plan for hiptensorContractionBatched.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] plan Opaque handle holding the contraction plan of a single batch.
+//! @param[in] desc Tensor contraction descriptor of a single batch.
+//! @param[in] find Narrows down the candidates for the contraction problem.
+//! @param[in] workspaceSize Available workspace size (in bytes).
+//! @param[in] batchCount Number of batches.
+//! @param[in] strideA Distance (in elements) between consecutive batches of A.
+//! @param[in] strideB Distance (in elements) between consecutive batches of B.
+//! @param[in] strideC Distance (in elements) between consecutive batches of C.
+//! @param[in] strideD Distance (in elements) between consecutive batches of D.
+//! @retval HIPTENSOR_STATUS_SUCCESS If a viable candidate has been found.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or find or desc is not
+//! initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if batchCount < 1, or batches of D overlap.
+hiptensorStatus_t hiptensorInitContractionPlanBatched(const hiptensorHandle_t*    handle,
+                                                      hiptensorContractionPlan_t* plan,
+                                                      const hiptensorContractionDescriptor_t* desc,
+                                                      const hiptensorContractionFind_t*       find,
+                                                      const uint64_t workspaceSize,
+                                                      int64_t        batchCount,
+                                                      int64_t        strideA,
+                                                      int64_t        strideB,
+                                                      int64_t        strideC,
+                                                      int64_t        strideD);
+
+//! @brief Computes a batch of tensor contractions \f[ D_i = alpha * A_i * B_i + beta * C_i \f]
+//! with the same plan, where the operands of batch i are offset by i times their batch stride.
+//! @details The whole batch is run in a single launch when a batched kernel supports the
+//! problem, otherwise the plan is executed once per batch. The batched kernel ranked by
+//! hiptensorInitContractionPlanBatched is run for the batch shape of the plan; other batch
+//! shapes, or executions given less workspace than the plan, run the first batched kernel
+//! that supports them. Execution does not modify the plan.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] plan Opaque handle holding the contraction plan of a single batch.
+//! @param[in] alpha Scaling parameter for A*B of data type 'typeCompute'.
+//! @param[in] A Pointer to the first batch of A's data in device memory.
+//! @param[in] B Pointer to the first batch of B's data in device memory.
+//! @param[in] beta Scaling parameter for C of data type 'typeCompute'.
+//! @param[in] C Pointer to the first batch of C's data in device memory.
+//! @param[out] D Pointer to the first batch of D's data in device memory.
+//! @param[in] batchCount Number of batches.
+//! @param[in] strideA Distance (in elements) between consecutive batches of A.
+//! @param[in] strideB Distance (in elements) between consecutive batches of B.
+//! @param[in] strideC Distance (in elements) between consecutive batches of C.
+//! @param[in] strideD Distance (in elements) between consecutive batches of D.
+//! @param[out] workspace Workspace pointer in device memory. If nullptr, the workspace required
+//! is provided by the handle's stream-ordered memory arena.
+//! @param[in] workspaceSize Available workspace size. Ignored if workspace is nullptr.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or pointers are not
+//! initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if batchCount < 1, or batches of D overlap.
+//! @retval HIPTENSOR_STATUS_CK_ERROR if some unknown composable_kernel (CK)
+//! error has occurred (e.g., no instance supported by inputs).
+hiptensorStatus_t hiptensorContractionBatched(const hiptensorHandle_t*          handle,
+                                              const hiptensorContractionPlan_t* plan,
+                                              const void*                       alpha,
+                                              const void*                       A,
+                                              const void*                       B,
+                                              const void*                       beta,
+                                              const void*                       C,
+                                              void*                             D,
+                                              int64_t                           batchCount,
+                                              int64_t                           strideA,
+                                              int64_t                           strideB,
+                                              int64_t                           strideC,
+                                              int64_t                           strideD,
+                                              void*                             workspace,
+                                              uint64_t                          workspaceSize,
+                                              hipStream_t                       stream);
+
+//! @brief Computes a batch of tensor contractions \f[ D_i = alpha * A_i * B_i + beta * C_i \f]
+//! with the same plan, where the operands of batch i are given by pointer arrays.
+//! @details Pointer arrays with a constant distance between consecutive batches are run as a
+//! strided batch (see hiptensorContractionBatched), otherwise the plan is executed once per batch.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] plan Opaque handle holding the contraction plan of a single batch.
+//! @param[in] alpha Scaling parameter for A*B of data type 'typeCompute'.
+//! @param[in] A Host array of batchCount pointers to A's data in device memory.
+//! @param[in] B Host array of batchCount pointers to B's data in device memory.
+//! @param[in] beta Scaling parameter for C of data type 'typeCompute'.
+//! @param[in] C Host array of batchCount pointers to C's data in device memory. May be nullptr
+//! if the plan has no C.
+//! @param[out] D Host array of batchCount pointers to D's data in device memory.
+//! @param[in] batchCount Number of batches.
+//! @param[out] workspace Workspace pointer in device memory. If nullptr, the workspace required
+//! is provided by the handle's stream-ordered memory arena.
+//! @param[in] workspaceSize Available workspace size. Ignored if workspace is nullptr.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or pointers are not
+//! initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if batchCount < 1.
+//! @retval HIPTENSOR_STATUS_CK_ERROR if some unknown composable_kernel (CK)
+//! error has occurred (e.g., no instance supported by inputs).
+hiptensorStatus_t hiptensorContractionBatchedPointers(const hiptensorHandle_t*          handle,
+                                                      const hiptensorContractionPlan_t* plan,
+                                                      const void*                       alpha,
+                                                      const void* const                 A[],
+                                                      const void* const                 B[],
+                                                      const void*                       beta,
+                                                      const void* const                 C[],
+                                                      void* const                       D[],
+                                                      int64_t                           batchCount,
+                                                      void*                             workspace,
+                                                      uint64_t    workspaceSize,
+                                                      hipStream_t stream);
+
+//! @brief Computes a group of tensor contractions \f[ D_i = alpha * A_i * B_i + beta * C_i \f]
+//! with different extents and strides, in a single kernel launch where possible.
+//! @details Every group is described by its own contraction descriptor, and all descriptors
+//! must share the operation, data types and compute type. The grouped kernel is selected on
+//! the padded tile work of all groups. Problems without a grouped kernel are contracted one
+//! group at a time.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] descs Host array of groupCount contraction descriptors.
+//! @param[in] alpha Scaling parameter for A*B of data type 'typeCompute'.
+//! @param[in] A Host array of groupCount pointers to A's data in device memory.
+//! @param[in] B Host array of groupCount pointers to B's data in device memory.
+//! @param[in] beta Scaling parameter for C of data type 'typeCompute'.
+//! @param[in] C Host array of groupCount pointers to C's data in device memory. May be
+//! nullptr if the descriptors have no C.
+//! @param[out] D Host array of groupCount pointers to D's data in device memory.
+//! @param[in] groupCount Number of groups.
+//! @param[out] workspace Workspace pointer in device memory. If nullptr, the workspace required
+//! is provided by the handle's stream-ordered memory arena.
+//! @param[in] workspaceSize Available workspace size. Ignored if workspace is nullptr.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or descs are not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if groupCount is 0, an operand is missing, or the
+//! descriptors differ in operation or data types.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if no kernel supports a group.
+hiptensorStatus_t hiptensorContractionGrouped(const hiptensorHandle_t*                      handle,
+                                              const hiptensorContractionDescriptor_t* const descs[],
+                                              const void*                                   alpha,
+                                              const void* const                             A[],
+                                              const void* const                             B[],
+                                              const void*                                   beta,
+                                              const void* const                             C[],
+                                              void* const                                   D[],
+                                              uint32_t    groupCount,
+                                              void*       workspace,
+                                              uint64_t    workspaceSize,
+                                              hipStream_t stream);
+
+//! @brief Initializes a plan contracting a network of tensors into one output tensor
+//! \f[ D_{modeOutput} = alpha * \prod_{i} X^{i}_{modeInputs[i]} \f]
+//! The inputs are contracted pairwise in the order found by the path search, each pair with
+//! its own contraction plan. The intermediates have the data type of the output and share a
+//! workspace where buffers are reused once their last consumer has run.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] plan The tensor network plan to be initialized.
+//! @param[in] numInputs Number of input tensors, at least 2.
+//! @param[in] descInputs Host array of numInputs input tensor descriptors.
+//! @param[in] modeInputs Host array of numInputs arrays with the modes of each input. A mode
+//! appears at most once per tensor and in at least two tensors, counting the output.
+//! @param[in] descOutput The output tensor descriptor. All inputs must have its data type.
+//! @param[in] modeOutput Array with the modes of the output.
+//! @param[in] typeCompute Datatype for the intermediate computation.
+//! @param[in] pathAlgo HIPTENSOR_PATH_GREEDY for a fast greedy search, or
+//! HIPTENSOR_PATH_OPTIMAL for the path with the fewest FLOPs (up to 12 inputs, greedy beyond).
+//! @param[in] find Algorithm selection for every pairwise contraction. May be nullptr.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or plan is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the network is malformed.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if a data type or pairwise contraction is not supported.
+hiptensorStatus_t
+    hiptensorInitTensorNetworkPlan(const hiptensorHandle_t*                 handle,
+                                   hiptensorTensorNetworkPlan_t*            plan,
+                                   uint32_t                                 numInputs,
+                                   const hiptensorTensorDescriptor_t* const descInputs[],
+                                   const int32_t* const                     modeInputs[],
+                                   const hiptensorTensorDescriptor_t*       descOutput,
+                                   const int32_t                            modeOutput[],
+                                   hiptensorComputeType_t                   typeCompute,
+                                   hiptensorContractionPathAlgo_t           pathAlgo,
+                                   const hiptensorContractionFind_t*        find);
+
+//! @brief Contracts a network of tensors with a plan from hiptensorInitTensorNetworkPlan
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] plan The tensor network plan.
+//! @param[in] alpha Scaling for the result; its data type is determined by 'typeCompute'.
+//! @param[in] inputs Host array of plan->mNumInputs pointers to the inputs in device memory.
+//! @param[out] output Pointer to the output data in device memory.
+//! @param[out] workspace Workspace pointer in device memory, of at least plan->mWorkspaceSize
+//! bytes. If nullptr, the workspace is provided by the handle's stream-ordered memory arena.
+//! @param[in] workspaceSize Available workspace size. Ignored if workspace is nullptr.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or plan is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if a pointer is missing.
+//! @retval HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE if the workspace is too small.
+hiptensorStatus_t hiptensorTensorNetwork(const hiptensorHandle_t*            handle,
+                                         const hiptensorTensorNetworkPlan_t* plan,
+                                         const void*                         alpha,
+                                         const void* const                   inputs[],
+                                         void*                               output,
+                                         void*                               workspace,
+                                         uint64_t                            workspaceSize,
+                                         hipStream_t                         stream);
+
+//! @brief Determines the workspace size of an einsum expression (see \ref hiptensorEinsum)
+//! and caches its plan in the handle.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] expression same as in hiptensorEinsum
+//! @param[in] numInputs same as in hiptensorEinsum
+//! @param[in] descInputs same as in hiptensorEinsum
+//! @param[in] descOutput same as in hiptensorEinsum
+//! @param[in] typeCompute same as in hiptensorEinsum
+//! @param[out] workspaceSize The workspace size (in bytes) of the expression.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the expression is malformed or does not match the
+//! descriptors.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the expression or data types are not supported.
+hiptensorStatus_t
+    hiptensorEinsumGetWorkspaceSize(const hiptensorHandle_t*                 handle,
+                                    const char*                              expression,
+                                    uint32_t                                 numInputs,
+                                    const hiptensorTensorDescriptor_t* const descInputs[],
+                                    const hiptensorTensorDescriptor_t*       descOutput,
+                                    hiptensorComputeType_t                   typeCompute,
+                                    uint64_t*                                workspaceSize);
+
+//! @brief Computes an einsum expression such as "abcd,bdef->acef", overwriting the output
+//! \f[ D = alpha * einsum(inputs) \f]
+//! Labels are ASCII letters, inputs are separated by commas and spaces are ignored. Without
+//! "->", the output holds the labels used once, in alphabetical order. A relabeling of one
+//! input runs as a permutation, a sum over modes of one input as a reduction, a product of two
+//! inputs as a contraction and a product of more inputs as a tensor network. A label repeated
+//! in one input of at most two inputs selects the diagonal of that input.
+//! The plan of the expression is cached in the handle, keyed by the expression up to a
+//! renaming of its labels, the descriptors and the compute type, so later calls of the same
+//! problem skip the parsing and planning. Planning times kernels, so an expression must be
+//! planned, by hiptensorEinsumGetWorkspaceSize or an earlier call, before its stream is
+//! captured into a HIP graph.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] expression The einsum expression, with one label per mode of each descriptor.
+//! @param[in] alpha Scaling for the result; its data type is determined by 'typeCompute'.
+//! Pointer to the host memory.
+//! @param[in] numInputs Number of inputs of the expression.
+//! @param[in] inputs Host array of numInputs pointers to the inputs in device memory.
+//! @param[in] descInputs Host array of numInputs input tensor descriptors.
+//! @param[out] output Pointer to the output data in device memory.
+//! @param[in] descOutput The output tensor descriptor.
+//! @param[in] typeCompute Datatype for the intermediate computation.
+//! @param[out] workspace Workspace pointer in device memory. If nullptr, contractions take the
+//! workspace from the handle's stream-ordered memory arena.
+//! @param[in] workspaceSize Available workspace size.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the expression is malformed or does not match the
+//! descriptors, or a pointer is missing.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the expression or data types are not supported,
+//! or the expression is not planned and the stream is captured.
+hiptensorStatus_t hiptensorEinsum(const hiptensorHandle_t*                 handle,
+                                  const char*                              expression,
+                                  const void*                              alpha,
+                                  uint32_t                                 numInputs,
+                                  const void* const                        inputs[],
+                                  const hiptensorTensorDescriptor_t* const descInputs[],
+                                  void*                                    output,
+                                  const hiptensorTensorDescriptor_t*       descOutput,
+                                  hiptensorComputeType_t                   typeCompute,
+                                  void*                                    workspace,
+                                  uint64_t                                 workspaceSize,
+                                  hipStream_t                              stream);
+
+//! @brief Creates an operation graph: contractions, permutations and reductions over the
+//! tensors added to the graph, run concurrently on a pool of streams.
+//! @details Nodes are ordered by the tensors they use, as if run in the order they were
+//! added: a node runs after the last node writing a tensor it reads, and a node writing a
+//! tensor after the nodes reading or writing it before. Independent nodes run on different
+//! streams of the pool and dependent nodes are ordered with events. Intermediate tensors are
+//! placed in the workspace of the graph, where tensors that are not live at the same time
+//! share memory.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] graph Pointer to the new graph.
+//! @param[in] numStreams Size of the stream pool, or 0 for the default of 4 streams.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or graph is nullptr.
+hiptensorStatus_t hiptensorCreateOperationGraph(const hiptensorHandle_t*    handle,
+                                                hiptensorOperationGraph_t** graph,
+                                                uint32_t                    numStreams);
+
+//! @brief Destroys an operation graph, after the work of its streams has completed
+//! @param[in] graph The graph to destroy.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the graph is nullptr.
+hiptensorStatus_t hiptensorDestroyOperationGraph(hiptensorOperationGraph_t* graph);
+
+//! @brief Adds a tensor to an operation graph
+//! @param[in,out] graph The operation graph.
+//! @param[in] desc The tensor descriptor, copied into the graph.
+//! @param[in] data Pointer to the tensor data in device memory, or nullptr for an intermediate
+//! tensor placed in the workspace of the graph. An intermediate must be written by a node
+//! before it is read.
+//! @param[out] tensorId Id of the tensor in the graph.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the graph is nullptr.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if desc or tensorId is nullptr.
+hiptensorStatus_t hiptensorOperationGraphAddTensor(hiptensorOperationGraph_t*         graph,
+                                                   const hiptensorTensorDescriptor_t* desc,
+                                                   void*                              data,
+                                                   int32_t*                           tensorId);
+
+//! @brief Adds a contraction \f[ D = alpha * A * B + beta * C \f] to an operation graph
+//! @param[in,out] graph The operation graph.
+//! @param[in] plan The contraction plan, copied into the graph. The tensors must have the
+//! lengths, strides and data types of the plan's descriptors.
+//! @param[in] alpha Scaling for A*B, read when the graph is executed.
+//! @param[in] tensorA Id of A.
+//! @param[in] tensorB Id of B.
+//! @param[in] beta Scaling for C, read when the graph is executed. May be nullptr without C.
+//! @param[in] tensorC Id of C, or -1 without C.
+//! @param[in] tensorD Id of D. It may be the id of C.
+//! @param[out] nodeId Id of the node in the graph. May be nullptr.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the graph or plan is nullptr.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if a tensor id is invalid, an intermediate is read
+//! before it is written, or a tensor does not match the plan.
+hiptensorStatus_t hiptensorOperationGraphAddContraction(hiptensorOperationGraph_t*        graph,
+                                                        const hiptensorContractionPlan_t* plan,
+                                                        const void*                       alpha,
+                                                        int32_t                           tensorA,
+                                                        int32_t                           tensorB,
+                                                        const void*                       beta,
+                                                        int32_t                           tensorC,
+                                                        int32_t                           tensorD,
+                                                        int32_t*                          nodeId);
+
+//! @brief Adds a permutation \f[ B_{modeB} = alpha * A_{modeA} \f] to an operation graph
+//! @param[in,out] graph The operation graph.
+//! @param[in] alpha Scaling for A, read when the graph is executed.
+//! @param[in] tensorA Id of A.
+//! @param[in] modeA Modes of A, copied into the graph.
+//! @param[in] tensorB Id of B.
+//! @param[in] modeB Modes of B, copied into the graph.
+//! @param[in] typeScalar Data type of alpha.
+//! @param[out] nodeId Id of the node in the graph. May be nullptr.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the graph is nullptr.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if a tensor id or mode array is invalid, or an
+//! intermediate is read before it is written.
+hiptensorStatus_t hiptensorOperationGraphAddPermutation(hiptensorOperationGraph_t* graph,
+                                                        const void*                alpha,
+                                                        int32_t                    tensorA,
+                                                        const int32_t              modeA[],
+                                                        int32_t                    tensorB,
+                                                        const int32_t              modeB[],
+                                                        hipDataType                typeScalar,
+                                                        int32_t*                   nodeId);
+
+//! @brief Adds a reduction \f[ D = alpha * opReduce(A) + beta * C \f] to an operation graph
+//! @param[in,out] graph The operation graph.
+//! @param[in] alpha Scaling for the reduction of A, read when the graph is executed.
+//! @param[in] tensorA Id of A.
+//! @param[in] modeA Modes of A, copied into the graph.
+//! @param[in] beta Scaling for C, read when the graph is executed. May be nullptr without C.
+//! @param[in] tensorC Id of C, or -1 without C.
+//! @param[in] modeC Modes of C, copied into the graph. May be nullptr without C.
+//! @param[in] tensorD Id of D. It may be the id of C.
+//! @param[in] modeD Modes of D, copied into the graph.
+//! @param[in] opReduce The reduction operator.
+//! @param[in] typeCompute Datatype for the intermediate computation and the scalars.
+//! @param[out] nodeId Id of the node in the graph. May be nullptr.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the graph is nullptr.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if a tensor id or mode array is invalid, or an
+//! intermediate is read before it is written.
+hiptensorStatus_t hiptensorOperationGraphAddReduction(hiptensorOperationGraph_t* graph,
+                                                      const void*                alpha,
+                                                      int32_t                    tensorA,
+                                                      const int32_t              modeA[],
+                                                      const void*                beta,
+                                                      int32_t                    tensorC,
+                                                      const int32_t              modeC[],
+                                                      int32_t                    tensorD,
+                                                      const int32_t              modeD[],
+                                                      hiptensorOperator_t        opReduce,
+                                                      hiptensorComputeType_t     typeCompute,
+                                                      int32_t*                   nodeId);
+
+//! @brief Determines the workspace size of an operation graph: its intermediates and the
+//! workspace of its contractions, placed by liveness.
+//! @param[in] graph The operation graph.
+//! @param[out] workspaceSize The workspace size (in bytes) of the graph.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the graph is nullptr.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if workspaceSize is nullptr.
+hiptensorStatus_t hiptensorOperationGraphGetWorkspaceSize(hiptensorOperationGraph_t* graph,
+                                                          uint64_t* workspaceSize);
+
+//! @brief Runs the nodes of an operation graph on its stream pool
+//! @details The nodes run after the work queued on the stream, and the work queued on the
+//! stream afterwards runs after all nodes. The streams of the pool are forked from and
+//! joined to the stream with events, so the execution may be captured into a HIP graph.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in,out] graph The operation graph.
+//! @param[out] workspace Workspace pointer in device memory, of at least the size given by
+//! hiptensorOperationGraphGetWorkspaceSize. If nullptr, the workspace is provided by the
+//! handle's stream-ordered memory arena.
+//! @param[in] workspaceSize Available workspace size. Ignored if workspace is nullptr.
+//! @param[in] stream HIP stream ordering the graph.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or graph is nullptr.
+//! @retval HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE if the workspace is too small.
+//! @retval Otherwise the error of the first node that failed.
+hiptensorStatus_t hiptensorOperationGraphExecute(const hiptensorHandle_t*   handle,
+                                                 hiptensorOperationGraph_t* graph,
+                                                 void*                      workspace,
+                                                 uint64_t                   workspaceSize,
+                                                 hipStream_t                stream);
+
 //! @brief Implements a tensor reduction of the form \f[ D = alpha * opReduce(opA(A)) + beta * opC(C) \f]
 //!
 //! @param[in] handle Opaque handle holding hipTensor's library context.
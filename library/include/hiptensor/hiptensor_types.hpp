@@ -105,6 +105,8 @@ typedef enum
     HIPTENSOR_OP_IDENTITY = 1,
     //! Square root operator
     HIPTENSOR_OP_SQRT = 2,
+    //! Complex conjugate operator (identity on real tensors)
+    HIPTENSOR_OP_CONJ = 9,
 
     /* Binary */
     //! Addition operator
@@ -120,6 +122,22 @@ typedef enum
     HIPTENSOR_OP_UNKNOWN = 126,
 } hiptensorOperator_t;
 
+//! @brief Activations applied by the epilogue of a contraction
+typedef enum
+{
+    //! No activation
+    HIPTENSOR_ACTIVATION_NONE = 0,
+    //! Rectified linear unit, max(x, 0)
+    HIPTENSOR_ACTIVATION_RELU = 1,
+    //! Gaussian error linear unit, with the tanh approximation
+    HIPTENSOR_ACTIVATION_GELU = 2,
+    //! Sigmoid linear unit, x * sigmoid(x)
+    HIPTENSOR_ACTIVATION_SILU = 3,
+    //! Clamp to the lower and upper bounds of the epilogue
+    HIPTENSOR_ACTIVATION_CLAMP = 4,
+
+} hiptensorActivation_t;
+
 //! @brief Tensor contraction kernel selection algorithm
 typedef enum
 {
@@ -144,6 +162,16 @@ typedef enum
 
 } hiptensorWorksizePreference_t;
 
+//! @brief Location of the alpha and beta scalars of the operations run on a handle
+typedef enum
+{
+    //! Scalars are host memory, read when the operation is called
+    HIPTENSOR_POINTER_MODE_HOST = 0,
+    //! Scalars are device memory, read by the kernels in stream order
+    HIPTENSOR_POINTER_MODE_DEVICE = 1,
+
+} hiptensorPointerMode_t;
+
 //! @brief Logging context
 //! @details The logger output of certain contexts maybe constrained to these levels
 typedef enum
@@ -173,7 +201,8 @@ struct hiptensorHandle_t
 //!
 //! Represents a descriptor for the tensor with the given properties of
 //! data type, lengths, strides and element-wise unary operation.
-//! Constructed with hiptensorInitTensorDescriptor() function.
+//! Constructed with hiptensorInitTensorDescriptor() function, or with
+//! hiptensorInitPlanarTensorDescriptor() for planar complex tensors.
 struct hiptensorTensorDescriptor_t
 {
     //! Data type of the tensors enum selection
@@ -184,6 +213,29 @@ struct hiptensorTensorDescriptor_t
     std::vector<std::size_t> mStrides;
     //! Unary operator applied to the tensor
     hiptensorOperator_t mUnaryOp;
+    //! Distance, in real elements, from the real to the imaginary plane of a
+    //! planar complex tensor. Zero for interleaved complex and real tensors.
+    std::size_t mPlaneStride;
+};
+
+//! @brief Structure representing the epilogue of a tensor contraction
+//!
+//! The epilogue is applied to each element before it is stored to D:
+//! D = activation(alpha * A * B + beta * C + bias), converted to the data type of D.
+//! Set with hiptensorContractionDescriptorSetEpilogue().
+struct hiptensorContractionEpilogue_t
+{
+    //! Activation of the result
+    hiptensorActivation_t mActivation;
+    //! Bounds of HIPTENSOR_ACTIVATION_CLAMP
+    float mLower;
+    float mUpper;
+    //! Bias added to the result, or nullptr. It is broadcast over the modes of D
+    //! that it does not have.
+    const void* mBias;
+    //! Bias tensor descriptor and modes, a subset of the modes of D
+    hiptensorTensorDescriptor_t mBiasDesc;
+    std::vector<int32_t>        mBiasMode;
 };
 
 //! @brief Structure representing a tensor contraction descriptor
@@ -205,6 +257,13 @@ struct hiptensorContractionDescriptor_t
     std::vector<uint32_t> mAlignmentReq;
     //! Tensor modes
     std::vector<std::vector<int32_t>> mTensorMode;
+    //! Diagonal views of A and B, and their modes, when modes found in no other tensor are
+    //! summed out of A or B before the contraction. Empty otherwise. An operand whose modes
+    //! equal its modes in mTensorMode is contracted as is.
+    std::vector<hiptensorTensorDescriptor_t> mPreReductionDesc;
+    std::vector<std::vector<int32_t>>        mPreReductionMode;
+    //! Epilogue of the contraction. Without one, no activation and no bias are applied.
+    hiptensorContractionEpilogue_t mEpilogue;
 };
 
 //! @brief hipTensor structure representing the contraction selection algorithm and candidates.
@@ -212,7 +271,8 @@ struct hiptensorContractionFind_t
 {
     //! Id of the selection algorithm
     hiptensorAlgo_t mSelectionAlgorithm;
-    //! A vector of the solver candidates
+    //! Optional explicit solver candidates. When empty, candidates are looked up
+    //! from the contraction descriptor at plan time.
     std::vector<void*> mCandidates;
 };
 
@@ -224,8 +284,63 @@ struct hiptensorContractionPlan_t
     void* mSolution;
     //! Contraction parameters
     hiptensorContractionDescriptor_t mContractionDesc;
+    //! Workspace size required by the solution (in bytes)
+    uint64_t mWorkspaceSize;
+    //! Batched solution ranked by hiptensorInitContractionPlanBatched() for its batch shape:
+    //! batch count, batch strides of A, B, C and D, whether C is given, and the workspace
+    //! size it was ranked within. Null if no batched solution solves that shape.
+    void*                mBatchedSolution;
+    std::vector<int64_t> mBatchedShape;
 };
 
+//! @brief Contraction path search of tensor networks
+typedef enum
+{
+    //! Repeatedly contracts the pair of tensors that most reduces the elements held
+    HIPTENSOR_PATH_GREEDY = 0,
+    //! Searches all pairwise contraction orders for the fewest FLOPs, then the least
+    //! intermediate memory. Networks of more than 12 inputs use the greedy search.
+    HIPTENSOR_PATH_OPTIMAL = 1,
+
+} hiptensorContractionPathAlgo_t;
+
+//! @brief One pairwise contraction of a tensor network plan
+struct hiptensorTensorNetworkStep_t
+{
+    //! Operands of the contraction. The inputs of the network are numbered from 0,
+    //! followed by the result of each step.
+    int32_t mOperands[2];
+    //! Offset of the result in the workspace (in bytes). Unused by the last step,
+    //! which writes the network output.
+    uint64_t mResultOffset;
+    //! Contraction plan of the step
+    hiptensorContractionPlan_t mPlan;
+};
+
+//! @brief hipTensor structure representing a tensor network plan.
+//! Constructed with the hiptensorInitTensorNetworkPlan() function.
+struct hiptensorTensorNetworkPlan_t
+{
+    //! Number of input tensors
+    uint32_t mNumInputs;
+    //! Compute type of all contractions
+    hiptensorComputeType_t mComputeType;
+    //! Pairwise contractions, in execution order
+    std::vector<hiptensorTensorNetworkStep_t> mSteps;
+    //! FLOPs of all contractions, as estimated by the path search
+    double mFlops;
+    //! Workspace size holding the intermediates (in bytes). Intermediates that are
+    //! not live at the same time share memory.
+    uint64_t mIntermediateSize;
+    //! Workspace size required by the plan (in bytes): the intermediates, followed by
+    //! the workspace of the contractions
+    uint64_t mWorkspaceSize;
+};
+
+//! @brief Opaque structure holding a graph of contractions, permutations and reductions.
+//! Created with hiptensorCreateOperationGraph() and run with hiptensorOperationGraphExecute().
+struct hiptensorOperationGraph_t;
+
 //! @brief Logging callback
 //! The specified callback is invoked whenever logging is enabled and a message is generated.
 //! @param logContext The logging context enum
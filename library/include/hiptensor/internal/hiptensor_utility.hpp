@@ -135,7 +135,7 @@ bool inline operator==(const hiptensorTensorDescriptor_t& lhs,
                        const hiptensorTensorDescriptor_t& rhs)
 {
     return lhs.mType == rhs.mType && lhs.mLengths == rhs.mLengths && lhs.mStrides == rhs.mStrides
-           && lhs.mUnaryOp == rhs.mUnaryOp;
+           && lhs.mUnaryOp == rhs.mUnaryOp && lhs.mPlaneStride == rhs.mPlaneStride;
 }
 
 namespace std
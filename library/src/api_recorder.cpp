@@ -0,0 +1,413 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "include/api_recorder.hpp"
+#include "include/data_types.hpp"
+#include "include/device_scalars.hpp"
+#include "include/hip_device.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <tuple>
+
+namespace hiptensor
+{
+    namespace
+    {
+        // "HTRC" little endian
+        constexpr uint32_t ApiTraceMagic   = 0x43525448u;
+        constexpr uint32_t ApiTraceVersion = 2u;
+
+        // Upper bound on tensor rank and operand count accepted from a trace
+        constexpr uint32_t MaxTraceRank     = 32u;
+        constexpr uint32_t MaxTraceOperands = 4u;
+
+        template <typename T>
+        bool writePod(FILE* stream, T const& value)
+        {
+            return fwrite(&value, sizeof(T), 1, stream) == 1;
+        }
+
+        template <typename T>
+        bool readPod(FILE* stream, T& value)
+        {
+            return fread(&value, sizeof(T), 1, stream) == 1;
+        }
+
+        template <typename T>
+        bool writeVec(FILE* stream, std::vector<T> const& values)
+        {
+            auto count = static_cast<uint32_t>(values.size());
+            return writePod(stream, count)
+                   && (count == 0 || fwrite(values.data(), sizeof(T), count, stream) == count);
+        }
+
+        template <typename T>
+        bool readVec(FILE* stream, std::vector<T>& values)
+        {
+            uint32_t count = 0;
+            if(!readPod(stream, count) || count > MaxTraceRank)
+            {
+                return false;
+            }
+            values.resize(count);
+            return count == 0 || fread(values.data(), sizeof(T), count, stream) == count;
+        }
+
+        ApiRecordTensor toRecordTensor(hiptensorTensorDescriptor_t const& desc,
+                                       int32_t const*                     modes)
+        {
+            auto rank = desc.mLengths.size();
+            return {desc.mType,
+                    desc.mUnaryOp,
+                    desc.mLengths,
+                    desc.mStrides,
+                    modes != nullptr ? std::vector<int32_t>(modes, modes + rank)
+                                     : std::vector<int32_t>{},
+                    desc.mPlaneStride};
+        }
+
+        void toRecordScalar(double (&out)[2],
+                            void const*            value,
+                            hiptensorComputeType_t type,
+                            bool                   deviceScalars,
+                            hipStream_t            stream)
+        {
+            // Device scalars are read by waiting for the stream. Those of captured work
+            // have no value until the graph runs, and are recorded as zero.
+            out[0] = out[1] = 0.0;
+            if(value == nullptr || (deviceScalars && isStreamCapturing(stream)))
+            {
+                return;
+            }
+
+            auto scalar = deviceScalars ? readDeviceScalar(value, type, stream)
+                                        : readVal<ScalarData>(value, type);
+            if(type == HIPTENSOR_COMPUTE_C32F || type == HIPTENSOR_COMPUTE_C64F)
+            {
+                out[0] = hipCreal(scalar.mComplex);
+                out[1] = hipCimag(scalar.mComplex);
+            }
+            else
+            {
+                out[0] = scalar.mReal;
+            }
+        }
+    } // namespace
+
+    bool writeApiTraceHeader(FILE* stream)
+    {
+        return writePod(stream, ApiTraceMagic) && writePod(stream, ApiTraceVersion);
+    }
+
+    bool readApiTraceHeader(FILE* stream)
+    {
+        uint32_t magic = 0, version = 0;
+        return readPod(stream, magic) && readPod(stream, version) && magic == ApiTraceMagic
+               && version == ApiTraceVersion;
+    }
+
+    bool writeApiRecord(FILE* stream, ApiRecord const& record)
+    {
+        auto numTensors = static_cast<uint32_t>(record.mTensors.size());
+        bool result     = writePod(stream, record.mKind) && writePod(stream, numTensors);
+        for(auto const& tensor : record.mTensors)
+        {
+            result = result && writePod(stream, tensor.mType) && writePod(stream, tensor.mUnaryOp)
+                     && writeVec(stream, tensor.mLengths) && writeVec(stream, tensor.mStrides)
+                     && writeVec(stream, tensor.mModes) && writePod(stream, tensor.mPlaneStride);
+        }
+        return result && writePod(stream, record.mComputeType)
+               && writePod(stream, record.mScalarType) && writePod(stream, record.mOpId)
+               && writePod(stream, record.mAlpha) && writePod(stream, record.mBeta)
+               && writePod(stream, record.mAlgo) && writePod(stream, record.mWorksizePref)
+               && writePod(stream, record.mWorkspaceSize);
+    }
+
+    bool readApiRecord(FILE* stream, ApiRecord& record)
+    {
+        uint32_t numTensors = 0;
+        if(!readPod(stream, record.mKind) || !readPod(stream, numTensors)
+           || numTensors > MaxTraceOperands)
+        {
+            return false;
+        }
+
+        record.mTensors.resize(numTensors);
+        for(auto& tensor : record.mTensors)
+        {
+            if(!readPod(stream, tensor.mType) || !readPod(stream, tensor.mUnaryOp)
+               || !readVec(stream, tensor.mLengths) || !readVec(stream, tensor.mStrides)
+               || !readVec(stream, tensor.mModes) || !readPod(stream, tensor.mPlaneStride))
+            {
+                return false;
+            }
+        }
+        return readPod(stream, record.mComputeType) && readPod(stream, record.mScalarType)
+               && readPod(stream, record.mOpId) && readPod(stream, record.mAlpha)
+               && readPod(stream, record.mBeta) && readPod(stream, record.mAlgo)
+               && readPod(stream, record.mWorksizePref) && readPod(stream, record.mWorkspaceSize);
+    }
+
+    bool readApiTrace(const char* fileName, std::vector<ApiRecord>& records)
+    {
+        FILE* stream = fileName != nullptr ? fopen(fileName, "rb") : nullptr;
+        if(stream == nullptr)
+        {
+            return false;
+        }
+
+        bool result = readApiTraceHeader(stream);
+        if(result)
+        {
+            ApiRecord record;
+            while(readApiRecord(stream, record))
+            {
+                records.push_back(record);
+            }
+        }
+
+        fclose(stream);
+        return result;
+    }
+
+    ApiRecorder::ApiRecorder()
+        : mStream(nullptr)
+    {
+        if(const char* traceEnv = std::getenv("HIPTENSOR_API_RECORD"))
+        {
+            openTrace(traceEnv);
+        }
+    }
+
+    ApiRecorder::~ApiRecorder()
+    {
+        closeTrace();
+    }
+
+    bool ApiRecorder::openTrace(const char* fileName)
+    {
+        std::scoped_lock lock(mMutex);
+        if(mStream != nullptr)
+        {
+            fclose(mStream);
+            mStream = nullptr;
+        }
+
+        if(fileName == nullptr || strcmp(fileName, "") == 0)
+        {
+            return false;
+        }
+
+        mStream = fopen(fileName, "wb");
+        if(mStream != nullptr && !writeApiTraceHeader(mStream))
+        {
+            fclose(mStream);
+            mStream = nullptr;
+        }
+
+        return mStream != nullptr;
+    }
+
+    void ApiRecorder::closeTrace()
+    {
+        std::scoped_lock lock(mMutex);
+        if(mStream != nullptr)
+        {
+            fclose(mStream);
+            mStream = nullptr;
+        }
+        mFindPrefs.clear();
+        mPlanInfo.clear();
+    }
+
+    bool ApiRecorder::isEnabled() const
+    {
+        std::scoped_lock lock(mMutex);
+        return mStream != nullptr;
+    }
+
+    void ApiRecorder::resetContractionFind(hiptensorContractionFind_t const* find)
+    {
+        std::scoped_lock lock(mMutex);
+        mFindPrefs.erase(find);
+    }
+
+    void ApiRecorder::resetContractionPlan(hiptensorContractionPlan_t const* plan)
+    {
+        std::scoped_lock lock(mMutex);
+        mPlanInfo.erase(plan);
+    }
+
+    void ApiRecorder::recordContractionWorkspacePref(hiptensorContractionFind_t const* find,
+                                                     hiptensorWorksizePreference_t     pref)
+    {
+        std::scoped_lock lock(mMutex);
+        if(mStream != nullptr)
+        {
+            mFindPrefs[find] = pref;
+        }
+    }
+
+    void ApiRecorder::recordContractionPlan(hiptensorContractionPlan_t const* plan,
+                                            hiptensorContractionFind_t const* find)
+    {
+        std::scoped_lock lock(mMutex);
+        if(mStream != nullptr)
+        {
+            auto pref = HIPTENSOR_WORKSPACE_RECOMMENDED;
+            if(auto it = mFindPrefs.find(find); it != mFindPrefs.end())
+            {
+                pref = it->second;
+            }
+            mPlanInfo[plan] = {find->mSelectionAlgorithm, pref};
+        }
+    }
+
+    void ApiRecorder::recordContraction(hiptensorContractionPlan_t const* plan,
+                                        void const*                       alpha,
+                                        void const*                       beta,
+                                        uint64_t                          workspaceSize,
+                                        bool                              deviceScalars,
+                                        hipStream_t                       stream)
+    {
+        if(!isEnabled())
+        {
+            return;
+        }
+
+        auto const& desc = plan->mContractionDesc;
+
+        ApiRecord record;
+        record.mKind = ApiRecordKind_t::CONTRACTION;
+        for(auto const& tensorDesc : desc.mTensorDesc)
+        {
+            record.mTensors.push_back(toRecordTensor(tensorDesc, nullptr));
+        }
+
+        // Modes are stored as {A, B, D} for scale and {A, B, C, D} for bilinear
+        record.mTensors[0].mModes = desc.mTensorMode[0];
+        record.mTensors[1].mModes = desc.mTensorMode[1];
+        record.mTensors[2].mModes = desc.mTensorMode[2];
+        record.mTensors[3].mModes = desc.mTensorMode.back();
+
+        record.mComputeType = desc.mComputeType;
+        record.mScalarType  = NONE_TYPE;
+        record.mOpId        = desc.mContractionOpId;
+        toRecordScalar(record.mAlpha, alpha, desc.mComputeType, deviceScalars, stream);
+        toRecordScalar(record.mBeta, beta, desc.mComputeType, deviceScalars, stream);
+        record.mAlgo          = HIPTENSOR_ALGO_DEFAULT;
+        record.mWorksizePref  = HIPTENSOR_WORKSPACE_RECOMMENDED;
+        record.mWorkspaceSize = workspaceSize;
+
+        {
+            std::scoped_lock lock(mMutex);
+            if(auto it = mPlanInfo.find(plan); it != mPlanInfo.end())
+            {
+                std::tie(record.mAlgo, record.mWorksizePref) = it->second;
+            }
+        }
+
+        write(record);
+    }
+
+    void ApiRecorder::recordPermutation(void const*                        alpha,
+                                        hiptensorTensorDescriptor_t const* descA,
+                                        int32_t const*                     modeA,
+                                        hiptensorTensorDescriptor_t const* descB,
+                                        int32_t const*                     modeB,
+                                        hipDataType                        typeScalar,
+                                        bool                               deviceScalars,
+                                        hipStream_t                        stream)
+    {
+        if(!isEnabled())
+        {
+            return;
+        }
+
+        ApiRecord record;
+        record.mKind          = ApiRecordKind_t::PERMUTATION;
+        record.mTensors       = {toRecordTensor(*descA, modeA), toRecordTensor(*descB, modeB)};
+        record.mComputeType   = convertToComputeType(typeScalar);
+        record.mScalarType    = typeScalar;
+        record.mOpId          = HIPTENSOR_OP_IDENTITY;
+        record.mBeta[0]       = 0.0;
+        record.mBeta[1]       = 0.0;
+        record.mAlgo          = HIPTENSOR_ALGO_DEFAULT;
+        record.mWorksizePref  = HIPTENSOR_WORKSPACE_RECOMMENDED;
+        record.mWorkspaceSize = 0;
+        toRecordScalar(record.mAlpha, alpha, record.mComputeType, deviceScalars, stream);
+
+        write(record);
+    }
+
+    void ApiRecorder::recordReduction(void const*                        alpha,
+                                      hiptensorTensorDescriptor_t const* descA,
+                                      int32_t const*                     modeA,
+                                      void const*                        beta,
+                                      hiptensorTensorDescriptor_t const* descC,
+                                      int32_t const*                     modeC,
+                                      hiptensorTensorDescriptor_t const* descD,
+                                      int32_t const*                     modeD,
+                                      hiptensorOperator_t                opReduce,
+                                      hiptensorComputeType_t             typeCompute,
+                                      uint64_t                           workspaceSize,
+                                      bool                               deviceScalars,
+                                      hipStream_t                        stream)
+    {
+        if(!isEnabled())
+        {
+            return;
+        }
+
+        ApiRecord record;
+        record.mKind        = ApiRecordKind_t::REDUCTION;
+        record.mTensors     = {toRecordTensor(*descA, modeA),
+                               toRecordTensor(*descC, modeC),
+                               toRecordTensor(*descD, modeD)};
+        record.mComputeType = typeCompute;
+        record.mScalarType  = NONE_TYPE;
+        record.mOpId        = opReduce;
+        toRecordScalar(record.mAlpha, alpha, typeCompute, deviceScalars, stream);
+        toRecordScalar(record.mBeta, beta, typeCompute, deviceScalars, stream);
+        record.mAlgo          = HIPTENSOR_ALGO_DEFAULT;
+        record.mWorksizePref  = HIPTENSOR_WORKSPACE_RECOMMENDED;
+        record.mWorkspaceSize = workspaceSize;
+
+        write(record);
+    }
+
+    void ApiRecorder::write(ApiRecord const& record)
+    {
+        std::scoped_lock lock(mMutex);
+        if(mStream != nullptr)
+        {
+            writeApiRecord(mStream, record);
+            fflush(mStream);
+        }
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "contraction_batched_solution_instances.hpp"
+#include "contraction_solution.hpp"
+#include "kernel_modules.hpp"
+
+namespace hiptensor
+{
+    BatchedContractionSolutionInstances::BatchedContractionSolutionInstances()
+    {
+#if HIPTENSOR_KERNEL_MODULES
+        // Device instances are packaged in the contraction module, opened on first use.
+        // If the module is missing the registry stays empty.
+        using EntryT = void (*)(BatchedContractionSolutionInstances*);
+        if(auto entry = reinterpret_cast<EntryT>(KernelModules::instance()->symbol(
+               KernelModule_t::CONTRACTION, "hiptensorRegisterBatchedContractionKernels")))
+        {
+            entry(this);
+        }
+#else
+        registerInstances();
+#endif // HIPTENSOR_KERNEL_MODULES
+    }
+} // namespace hiptensor
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_BATCHED_CONTRACTION_SOLUTION_INSTANCES_HPP
+#define HIPTENSOR_BATCHED_CONTRACTION_SOLUTION_INSTANCES_HPP
+
+#include <memory>
+
+#include "contraction_solution_registry.hpp"
+#include "kernel_modules.hpp"
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    class BatchedContractionSolutionInstances;
+}
+
+// Entry point of the contraction kernel module: registers the batched device instance families
+HIPTENSOR_KERNEL_MODULE_ENTRY void hiptensorRegisterBatchedContractionKernels(
+    hiptensor::BatchedContractionSolutionInstances* instances);
+
+namespace hiptensor
+{
+    // Batched contraction solutions, which run over the batch modes of A, B and E in a
+    // single launch. Kept apart from the other solutions, so that they are only
+    // selected for batched problems.
+    class BatchedContractionSolutionInstances
+        : public ContractionSolutionRegistry,
+          public LazySingleton<BatchedContractionSolutionInstances>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<BatchedContractionSolutionInstances>
+            std::make_unique<BatchedContractionSolutionInstances>();
+
+        // Registers the device instance families from within the kernel module
+        friend void ::hiptensorRegisterBatchedContractionKernels(
+            BatchedContractionSolutionInstances* instances);
+
+        ~BatchedContractionSolutionInstances() = default;
+
+    private:
+        // Registers every device instance family exactly once
+        void registerInstances();
+
+        // Singleton: only one instance
+        BatchedContractionSolutionInstances();
+        BatchedContractionSolutionInstances(BatchedContractionSolutionInstances const&) = delete;
+        BatchedContractionSolutionInstances(BatchedContractionSolutionInstances&&)      = delete;
+        BatchedContractionSolutionInstances& operator=(BatchedContractionSolutionInstances const&)
+            = delete;
+        BatchedContractionSolutionInstances& operator=(BatchedContractionSolutionInstances&&)
+            = delete;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_BATCHED_CONTRACTION_SOLUTION_INSTANCES_HPP
@@ -27,6 +27,78 @@
 #include "contraction_cpu_reference.hpp"
 #include "contraction_cpu_reference_impl.hpp"
 #include "contraction_cpu_reference_instances.hpp"
+#include "contraction_epilogue.hpp"
+#include "data_types.hpp"
+#include "util.hpp"
+
+namespace
+{
+    // An operand of a contraction with batch modes, split into the operand of one batch
+    // and the strides of its batch modes
+    struct BatchSlice
+    {
+        std::vector<size_t>  mLengths;
+        std::vector<size_t>  mStrides;
+        std::vector<int32_t> mModes;
+        std::vector<size_t>  mBatchStrides;
+    };
+
+    BatchSlice sliceBatchModes(std::vector<size_t> const&  lengths,
+                               std::vector<size_t> const&  strides,
+                               std::vector<int32_t> const& modes,
+                               std::vector<int32_t> const& batchModes)
+    {
+        BatchSlice result;
+        result.mBatchStrides.resize(batchModes.size(), 0);
+        for(size_t i = 0; i < modes.size(); i++)
+        {
+            auto it = std::find(batchModes.cbegin(), batchModes.cend(), modes[i]);
+            if(it != batchModes.cend())
+            {
+                result.mBatchStrides[std::distance(batchModes.cbegin(), it)]
+                    = i < strides.size() ? strides[i] : 0;
+            }
+            else
+            {
+                result.mLengths.push_back(i < lengths.size() ? lengths[i] : 0);
+                result.mStrides.push_back(i < strides.size() ? strides[i] : 0);
+                result.mModes.push_back(modes[i]);
+            }
+        }
+        return result;
+    }
+
+    // Size in bytes of one element of a tensor plane
+    size_t planeElementBytes(hiptensorTensorDescriptor_t const& desc)
+    {
+        auto bytes = hiptensor::hipDataTypeSize(desc.mType);
+        return desc.mPlaneStride == 0 ? bytes : bytes / 2u;
+    }
+
+    template <typename T>
+    T* offsetBytes(T* ptr, size_t bytes)
+    {
+        using ByteT = std::conditional_t<std::is_const_v<T>, const char, char>;
+        return ptr == nullptr ? nullptr : (T*)((ByteT*)ptr + bytes);
+    }
+
+    // Store one f32 epilogue result as an element of D
+    void writeElement(void* addr, hipDataType id, float value)
+    {
+        if(id == HIP_R_16BF)
+        {
+            *(hip_bfloat16*)addr = static_cast<hip_bfloat16>(value);
+        }
+        else if(id == HIP_R_16F)
+        {
+            *(_Float16*)addr = static_cast<_Float16>(value);
+        }
+        else
+        {
+            *(float*)addr = value;
+        }
+    }
+} // namespace
 
 hiptensorStatus_t hiptensorContractionReference(const hiptensorContractionPlan_t* plan,
                                                 void const*                       alpha,
@@ -53,6 +125,108 @@ hiptensorStatus_t hiptensorContractionReference(const hiptensorContractionPlan_t
                                                 hipDataType                       typeD,
                                                 void*                             workspace)
 {
+    // Epilogues: the f32 contraction is computed by the scale reference into a packed
+    // temporary, then the epilogue is applied element-wise as the solutions fuse it
+    if(plan->mContractionDesc.mContractionOpId == (int32_t)hiptensor::ContractionOpId_t::EPILOGUE)
+    {
+        auto scalePlan = *plan;
+        scalePlan.mContractionDesc.mContractionOpId = (int32_t)hiptensor::ContractionOpId_t::SCALE;
+        scalePlan.mContractionDesc.mTensorDesc[3].mType = HIP_R_32F;
+
+        auto packedStrides  = hiptensor::stridesFromLengths(d_ms_ns_lengths, false);
+        auto elementCount   = std::accumulate(d_ms_ns_lengths.begin(),
+                                              d_ms_ns_lengths.end(),
+                                              size_t{1},
+                                              std::multiplies<size_t>());
+        auto contractionOut = std::vector<float>(elementCount);
+        auto one            = 1.0f;
+        auto errorCode      = hiptensorContractionReference(&scalePlan,
+                                                            alpha,
+                                                            A,
+                                                            B,
+                                                            &one,
+                                                            nullptr,
+                                                            contractionOut.data(),
+                                                            a_ms_ks_lengths,
+                                                            a_ms_ks_strides,
+                                                            a_ms_ks_modes,
+                                                            b_ns_ks_lengths,
+                                                            b_ns_ks_strides,
+                                                            b_ns_ks_modes,
+                                                            d_ms_ns_lengths,
+                                                            packedStrides,
+                                                            d_ms_ns_modes,
+                                                            d_ms_ns_lengths,
+                                                            packedStrides,
+                                                            d_ms_ns_modes,
+                                                            typeA,
+                                                            typeB,
+                                                            hiptensor::NONE_TYPE,
+                                                            HIP_R_32F,
+                                                            workspace);
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return errorCode;
+        }
+
+        // The bias is given to the descriptor as a device pointer
+        auto epilogue = hiptensor::contractionEpilogue(plan->mContractionDesc);
+        auto bias     = std::vector<float>{};
+        if(epilogue.hasBias())
+        {
+            size_t biasSpan = 1;
+            for(size_t i = 0; i < d_ms_ns_lengths.size(); i++)
+            {
+                biasSpan += (d_ms_ns_lengths[i] - 1) * epilogue.mBiasStrides[i];
+            }
+            bias.resize(biasSpan);
+            if(hipMemcpy(bias.data(), epilogue.mBias, biasSpan * sizeof(float), hipMemcpyDefault)
+               != hipSuccess)
+            {
+                return HIPTENSOR_STATUS_INTERNAL_ERROR;
+            }
+        }
+
+        auto betaF  = C == nullptr ? 0.0f : hiptensor::readVal<float>(beta, HIPTENSOR_COMPUTE_32F);
+        auto bytesC = C == nullptr ? size_t{0} : hiptensor::hipDataTypeSize(typeC);
+        auto bytesD = hiptensor::hipDataTypeSize(typeD);
+
+        std::vector<size_t> coord(d_ms_ns_lengths.size(), 0);
+        for(size_t element = 0; element < elementCount; element++)
+        {
+            auto offset = [&coord](std::vector<size_t> const& strides) {
+                return std::inner_product(coord.begin(), coord.end(), strides.begin(), size_t{0});
+            };
+
+            auto value = contractionOut[offset(packedStrides)];
+            if(betaF != 0.0f)
+            {
+                auto elementC = offsetBytes(C, bytesC * offset(c_ms_ns_strides));
+                value += betaF * hiptensor::readVal<float>(elementC, typeC);
+            }
+            if(epilogue.hasBias())
+            {
+                value += bias[offset(epilogue.mBiasStrides)];
+            }
+            writeElement(offsetBytes(D, bytesD * offset(d_ms_ns_strides)),
+                         typeD,
+                         hiptensor::applyActivation(
+                             value, epilogue.mActivation, epilogue.mLower, epilogue.mUpper));
+
+            // Next element, with the last mode fastest
+            for(int i = (int)coord.size() - 1; i >= 0; i--)
+            {
+                if(++coord[i] < d_ms_ns_lengths[i])
+                {
+                    break;
+                }
+                coord[i] = 0;
+            }
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
     auto& instances   = hiptensor::ContractionCpuReferenceInstances::instance();
     auto  computeType = plan->mContractionDesc.mComputeType;
     auto  candidates
@@ -60,16 +234,21 @@ hiptensorStatus_t hiptensorContractionReference(const hiptensorContractionPlan_t
               typeA, typeB, hiptensor::NONE_TYPE, typeD, computeType)
                          : instances->allSolutions().query(typeA, typeB, typeC, typeD, computeType);
 
-    auto toCKVec
-        = [](auto& inputVec) { return std::vector<ck::index_t>(inputVec.begin(), inputVec.end()); };
+    // Families differing only in the unary ops on A and B share their hash
+    candidates = candidates.query(plan->mContractionDesc.mTensorDesc[0].mUnaryOp,
+                                  plan->mContractionDesc.mTensorDesc[1].mUnaryOp);
 
     if(candidates.solutionCount() != 1)
     {
         return HIPTENSOR_STATUS_INTERNAL_ERROR;
     }
-    else
+
+    auto refCandidate = candidates.solutionList().front();
+    auto planeStrides = hiptensor::planeStrides(plan->mContractionDesc);
+
+    auto batchModes = hiptensor::batchModes(a_ms_ks_modes, b_ns_ks_modes, d_ms_ns_modes);
+    if(batchModes.empty())
     {
-        auto refCandidate      = candidates.solutions().begin()->second;
         auto [errorCode, time] = (*refCandidate)(alpha,
                                                  A,
                                                  B,
@@ -88,8 +267,81 @@ hiptensorStatus_t hiptensorContractionReference(const hiptensorContractionPlan_t
                                                  d_ms_ns_lengths,
                                                  d_ms_ns_strides,
                                                  d_ms_ns_modes,
+                                                 planeStrides,
+                                                 hiptensor::ContractionEpilogue{},
                                                  workspace,
                                                  0);
         return errorCode;
     }
+
+    // Batch (Hadamard) modes: contract each batch on its own, as a contraction without them
+    auto sliceA = sliceBatchModes(a_ms_ks_lengths, a_ms_ks_strides, a_ms_ks_modes, batchModes);
+    auto sliceB = sliceBatchModes(b_ns_ks_lengths, b_ns_ks_strides, b_ns_ks_modes, batchModes);
+    auto sliceC = sliceBatchModes(c_ms_ns_lengths, c_ms_ns_strides, c_ms_ns_modes, batchModes);
+    auto sliceD = sliceBatchModes(d_ms_ns_lengths, d_ms_ns_strides, d_ms_ns_modes, batchModes);
+
+    std::vector<size_t> batchLengths;
+    for(auto mode : batchModes)
+    {
+        auto offset = std::distance(d_ms_ns_modes.cbegin(),
+                                    std::find(d_ms_ns_modes.cbegin(), d_ms_ns_modes.cend(), mode));
+        batchLengths.push_back(d_ms_ns_lengths[offset]);
+    }
+    auto batchCount = std::accumulate(
+        batchLengths.begin(), batchLengths.end(), size_t{1}, std::multiplies<size_t>());
+
+    auto const& tensorDescs = plan->mContractionDesc.mTensorDesc;
+    auto        bytesA      = planeElementBytes(tensorDescs[0]);
+    auto        bytesB      = planeElementBytes(tensorDescs[1]);
+    auto        bytesC      = C == nullptr ? size_t{0} : planeElementBytes(tensorDescs[2]);
+    auto        bytesD      = planeElementBytes(tensorDescs[3]);
+
+    std::vector<size_t> coord(batchModes.size(), 0);
+    for(size_t batch = 0; batch < batchCount; batch++)
+    {
+        auto offset = [&coord](BatchSlice const& slice, size_t elementBytes) {
+            return elementBytes
+                   * std::inner_product(
+                       coord.begin(), coord.end(), slice.mBatchStrides.begin(), size_t{0});
+        };
+
+        auto [errorCode, time] = (*refCandidate)(alpha,
+                                                 offsetBytes(A, offset(sliceA, bytesA)),
+                                                 offsetBytes(B, offset(sliceB, bytesB)),
+                                                 beta,
+                                                 offsetBytes(C, offset(sliceC, bytesC)),
+                                                 offsetBytes(D, offset(sliceD, bytesD)),
+                                                 sliceA.mLengths,
+                                                 sliceA.mStrides,
+                                                 sliceA.mModes,
+                                                 sliceB.mLengths,
+                                                 sliceB.mStrides,
+                                                 sliceB.mModes,
+                                                 sliceC.mLengths,
+                                                 sliceC.mStrides,
+                                                 sliceC.mModes,
+                                                 sliceD.mLengths,
+                                                 sliceD.mStrides,
+                                                 sliceD.mModes,
+                                                 planeStrides,
+                                                 hiptensor::ContractionEpilogue{},
+                                                 workspace,
+                                                 0);
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return errorCode;
+        }
+
+        // Next batch, with the last batch mode fastest
+        for(int i = (int)coord.size() - 1; i >= 0; i--)
+        {
+            if(++coord[i] < batchLengths[i])
+            {
+                break;
+            }
+            coord[i] = 0;
+        }
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
 }
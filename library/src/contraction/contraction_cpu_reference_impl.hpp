@@ -28,8 +28,10 @@
 #define HIPTENSOR_CONTRACTION_CPU_REFERENCE_IMPL_HPP
 
 // Std includes
+#include <algorithm>
 #include <array>
 #include <numeric>
+#include <thread>
 #include <vector>
 
 // CK includes
@@ -40,6 +42,7 @@
 #include <host_tensor.hpp>
 
 #include "contraction_meta_traits.hpp"
+#include "contraction_pack_util.hpp"
 #include "contraction_solution.hpp"
 
 namespace hiptensor
@@ -85,8 +88,14 @@ namespace hiptensor
 
         static constexpr ck::index_t NumDTensor = DsDataType::Size();
 
+        // Complex A and B are conjugated by negating their imaginary parts as they are read
+        static constexpr bool ConjA
+            = std::is_same_v<AElementwiseOperation, ck::tensor_operation::element_wise::Conjugate>;
+        static constexpr bool ConjB
+            = std::is_same_v<BElementwiseOperation, ck::tensor_operation::element_wise::Conjugate>;
+
         // Argument
-        struct Argument : public BaseArgument
+        struct Argument : public BaseArgument, public PlanarComplexArgument
         {
             Argument(void const*                                             p_a,
                      void const*                                             p_b,
@@ -126,6 +135,14 @@ namespace hiptensor
             Argument& operator=(Argument const&) = default;
             ~Argument()                          = default;
 
+            void setPlaneStrides(PlaneStrides const& planeStrides) override
+            {
+                mLayoutA = ComplexLayout::fromPlaneStride(planeStrides[0]);
+                mLayoutB = ComplexLayout::fromPlaneStride(planeStrides[1]);
+                mLayoutD = ComplexLayout::fromPlaneStride(planeStrides[2]);
+                mLayoutE = ComplexLayout::fromPlaneStride(planeStrides[3]);
+            }
+
             void const*                                      mA;
             void const*                                      mB;
             std::array<void const*, NumDTensor>              mD;
@@ -142,8 +159,62 @@ namespace hiptensor
             AElementwiseOperation   mOpA;
             BElementwiseOperation   mOpB;
             CDEElementwiseOperation mOpCDE;
+
+            // Complex operands are interleaved unless set planar
+            ComplexLayout mLayoutA;
+            ComplexLayout mLayoutB;
+            ComplexLayout mLayoutD;
+            ComplexLayout mLayoutE;
         };
 
+        // Complex dot product of A and B over K, with the K offsets of each operand given by
+        // offsetA(k) and offsetB(k), in complex elements. Real and imaginary parts accumulate
+        // in independent lanes, so the complex multiply-adds vectorize over interleaved data.
+        template <typename AccT, typename RealT, typename OffsetA, typename OffsetB>
+        static HIP_vector_type<AccT, 2> complexDot(RealT const*  a,
+                                                   ComplexLayout layoutA,
+                                                   RealT const*  b,
+                                                   ComplexLayout layoutB,
+                                                   std::size_t   elementsK,
+                                                   OffsetA&&     offsetA,
+                                                   OffsetB&&     offsetB)
+        {
+            constexpr std::size_t Lanes = 4;
+
+            AccT accumReal[Lanes] = {};
+            AccT accumImag[Lanes] = {};
+
+            auto multiplyAdd = [&](std::size_t k, std::size_t l) {
+                auto realA = a[layoutA.real(offsetA(k))];
+                auto imagA = ConjA ? -a[layoutA.imag(offsetA(k))] : a[layoutA.imag(offsetA(k))];
+                auto realB = b[layoutB.real(offsetB(k))];
+                auto imagB = ConjB ? -b[layoutB.imag(offsetB(k))] : b[layoutB.imag(offsetB(k))];
+                accumReal[l] += realA * realB - imagA * imagB;
+                accumImag[l] += realA * imagB + imagA * realB;
+            };
+
+            std::size_t k = 0;
+            for(; k + Lanes <= elementsK; k += Lanes)
+            {
+                for(std::size_t l = 0; l < Lanes; l++)
+                {
+                    multiplyAdd(k + l, l);
+                }
+            }
+            for(; k < elementsK; k++)
+            {
+                multiplyAdd(k, 0);
+            }
+
+            HIP_vector_type<AccT, 2> accum{0};
+            for(std::size_t l = 0; l < Lanes; l++)
+            {
+                accum.x += accumReal[l];
+                accum.y += accumImag[l];
+            }
+            return accum;
+        }
+
         // Invoker
         struct Invoker : public BaseInvoker
         {
@@ -156,6 +227,40 @@ namespace hiptensor
                         indices.begin(), indices.end(), strides.begin(), std::size_t{0});
                 };
 
+                // Offsets of each K index into A and B, in loop order (last K mode
+                // fastest). They are computed once, rather than for every product.
+                auto elementsK = std::accumulate(arg.mA_ms_ks_lengths.begin() + NumDimM,
+                                                 arg.mA_ms_ks_lengths.end(),
+                                                 std::size_t{1},
+                                                 std::multiplies<std::size_t>());
+
+                std::vector<std::size_t> offsetsKA(elementsK);
+                std::vector<std::size_t> offsetsKB(elementsK);
+                {
+                    std::array<ck::index_t, NumDimK> coordK{};
+                    std::size_t                      offsetA = 0;
+                    std::size_t                      offsetB = 0;
+                    for(std::size_t k = 0; k < elementsK; k++)
+                    {
+                        offsetsKA[k] = offsetA;
+                        offsetsKB[k] = offsetB;
+                        for(int i = NumDimK - 1; i >= 0; i--)
+                        {
+                            auto strideA = arg.mA_ms_ks_strides[NumDimM + i];
+                            auto strideB = arg.mB_ns_ks_strides[NumDimN + i];
+                            offsetA += strideA;
+                            offsetB += strideB;
+                            if(++coordK[i] < arg.mA_ms_ks_lengths[NumDimM + i])
+                            {
+                                break;
+                            }
+                            offsetA -= strideA * coordK[i];
+                            offsetB -= strideB * coordK[i];
+                            coordK[i] = 0;
+                        }
+                    }
+                }
+
                 if constexpr((std::is_same_v<ADataType, hipFloatComplex>
                               && std::is_same_v<BDataType, hipFloatComplex>
                               && std::is_same_v<EDataType, hipFloatComplex>)
@@ -163,6 +268,46 @@ namespace hiptensor
                                  && std::is_same_v<BDataType, hipDoubleComplex>
                                  && std::is_same_v<EDataType, hipDoubleComplex>))
                 {
+                    // When the K offsets of both operands are evenly strided, they are
+                    // computed inline instead of read from the tables.
+                    auto isStrided = [elementsK](std::vector<std::size_t> const& offsets,
+                                                 std::size_t                     stride) {
+                        for(std::size_t k = 0; k < elementsK; k++)
+                        {
+                            if(offsets[k] != k * stride)
+                            {
+                                return false;
+                            }
+                        }
+                        return true;
+                    };
+                    auto strideKA = elementsK > 1 ? offsetsKA[1] : std::size_t{0};
+                    auto strideKB = elementsK > 1 ? offsetsKB[1] : std::size_t{0};
+                    auto stridedK
+                        = isStrided(offsetsKA, strideKA) && isStrided(offsetsKB, strideKB);
+
+                    // A, B, D and E are read and written through their layouts, so that
+                    // planar operands need no conversion.
+                    using RealT = std::conditional_t<std::is_same_v<EDataType, hipFloatComplex>,
+                                                     float,
+                                                     double>;
+
+                    auto realA = (RealT const*)arg.mA;
+                    auto realB = (RealT const*)arg.mB;
+                    auto realE = (RealT*)arg.mE;
+
+                    auto storeE = [&](std::size_t indexE, EDataType value) {
+                        realE[arg.mLayoutE.real(indexE)] = value.x;
+                        realE[arg.mLayoutE.imag(indexE)] = value.y;
+                    };
+
+                    // Only instantiated with a D tensor
+                    auto loadD = [&](auto indexD) {
+                        auto realD = (RealT const*)arg.mD[0];
+                        return EDataType{realD[arg.mLayoutD.real(indexD)],
+                                         realD[arg.mLayoutD.imag(indexD)]};
+                    };
+
                     auto f_ms_ns_complex = [&](auto m0,
                                                auto m1,
                                                auto m2,
@@ -175,72 +320,37 @@ namespace hiptensor
                                                auto n3,
                                                auto n4,
                                                auto n5) {
-                        HIP_vector_type<AccDataType, 2> accum{0};
-
-                        auto K0 = arg.mA_ms_ks_lengths[NumDimM];
-                        auto K1 = arg.mA_ms_ks_lengths[NumDimM + 1];
-                        auto K2 = arg.mA_ms_ks_lengths[NumDimM + 2];
-                        auto K3 = arg.mA_ms_ks_lengths[NumDimM + 3];
-                        auto K4 = arg.mA_ms_ks_lengths[NumDimM + 4];
-                        auto K5 = arg.mA_ms_ks_lengths[NumDimM + 5];
+                        auto baseA = offset(std::vector<size_t>{m0, m1, m2, m3, m4, m5},
+                                            arg.mA_ms_ks_strides);
+                        auto baseB = offset(std::vector<size_t>{n0, n1, n2, n3, n4, n5},
+                                            arg.mB_ns_ks_strides);
 
-                        for(size_t k0 = 0; k0 < K0; k0++)
+                        HIP_vector_type<AccDataType, 2> accum;
+                        if(stridedK)
                         {
-                            for(size_t k1 = 0; k1 < K1; k1++)
-                            {
-                                for(size_t k2 = 0; k2 < K2; k2++)
-                                {
-                                    for(size_t k3 = 0; k3 < K3; k3++)
-                                    {
-                                        for(size_t k4 = 0; k4 < K4; k4++)
-                                        {
-                                            for(size_t k5 = 0; k5 < K5; k5++)
-                                            {
-                                                auto indexA = offset(std::vector<size_t>{m0,
-                                                                                         m1,
-                                                                                         m2,
-                                                                                         m3,
-                                                                                         m4,
-                                                                                         m5,
-                                                                                         k0,
-                                                                                         k1,
-                                                                                         k2,
-                                                                                         k3,
-                                                                                         k4,
-                                                                                         k5},
-                                                                     arg.mA_ms_ks_strides);
-                                                auto indexB = offset(std::vector<size_t>{n0,
-                                                                                         n1,
-                                                                                         n2,
-                                                                                         n3,
-                                                                                         n4,
-                                                                                         n5,
-                                                                                         k0,
-                                                                                         k1,
-                                                                                         k2,
-                                                                                         k3,
-                                                                                         k4,
-                                                                                         k5},
-                                                                     arg.mB_ns_ks_strides);
-
-                                                ADataType valA = ((ADataType*)arg.mA)[indexA];
-                                                BDataType valB = ((BDataType*)arg.mB)[indexB];
-
-                                                // Mult / accum
-                                                if constexpr(std::is_same_v<AccDataType, float>)
-                                                {
-                                                    accum = hipCaddf(accum, hipCmulf(valA, valB));
-                                                }
-                                                else if constexpr(std::is_same_v<AccDataType,
-                                                                                 double>)
-                                                {
-                                                    accum = hipCadd(accum, hipCmul(valA, valB));
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-                            }
+                            accum = complexDot<AccDataType>(
+                                realA,
+                                arg.mLayoutA,
+                                realB,
+                                arg.mLayoutB,
+                                elementsK,
+                                [baseA, strideKA](std::size_t k) { return baseA + k * strideKA; },
+                                [baseB, strideKB](std::size_t k) { return baseB + k * strideKB; });
+                        }
+                        else
+                        {
+                            accum = complexDot<AccDataType>(
+                                realA,
+                                arg.mLayoutA,
+                                realB,
+                                arg.mLayoutB,
+                                elementsK,
+                                [baseA, &offsetsKA](std::size_t k) {
+                                    return baseA + offsetsKA[k];
+                                },
+                                [baseB, &offsetsKB](std::size_t k) {
+                                    return baseB + offsetsKB[k];
+                                });
                         }
 
                         auto indexE = offset(
@@ -250,7 +360,7 @@ namespace hiptensor
                         if constexpr(std::is_same_v<CDEElementwiseOperation,
                                                     ck::tensor_operation::element_wise::Scale>)
                         {
-                            ((EDataType*)arg.mE)[indexE] = arg.mOpCDE.scale_ * (EDataType)accum;
+                            storeE(indexE, arg.mOpCDE.scale_ * (EDataType)accum);
                         }
                         else if constexpr(std::is_same_v<
                                               CDEElementwiseOperation,
@@ -258,13 +368,13 @@ namespace hiptensor
                         {
                             if constexpr(std::is_same_v<EDataType, hipFloatComplex>)
                             {
-                                ((EDataType*)arg.mE)[indexE] = hipCmulf(
-                                    hipComplexDoubleToFloat(arg.mOpCDE.scale_), (EDataType)accum);
+                                storeE(indexE,
+                                       hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.scale_),
+                                                (EDataType)accum));
                             }
                             else
                             {
-                                ((EDataType*)arg.mE)[indexE]
-                                    = hipCmul(arg.mOpCDE.scale_, (EDataType)accum);
+                                storeE(indexE, hipCmul(arg.mOpCDE.scale_, (EDataType)accum));
                             }
                         }
                         else if constexpr(std::is_same_v<
@@ -276,9 +386,9 @@ namespace hiptensor
                                 std::vector<size_t>{m0, m1, m2, m3, m4, m5, n0, n1, n2, n3, n4, n5},
                                 arg.mD_ms_ns_strides[0]);
 
-                            ((EDataType*)arg.mE)[indexE]
-                                = arg.mOpCDE.alpha_ * (EDataType)accum
-                                  + arg.mOpCDE.beta_ * ((EDataType*)(arg.mD[0]))[indexD];
+                            storeE(indexE,
+                                   arg.mOpCDE.alpha_ * (EDataType)accum
+                                       + arg.mOpCDE.beta_ * loadD(indexD));
                         }
                         else if constexpr(std::is_same_v<
                                               CDEElementwiseOperation,
@@ -291,17 +401,17 @@ namespace hiptensor
 
                             if constexpr(std::is_same_v<EDataType, hipFloatComplex>)
                             {
-                                ((EDataType*)arg.mE)[indexE]
-                                    = hipCaddf(hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.alpha_),
-                                                        (EDataType)accum),
-                                               hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.beta_),
-                                                        ((EDataType*)(arg.mD[0]))[indexD]));
+                                storeE(indexE,
+                                       hipCaddf(hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.alpha_),
+                                                         (EDataType)accum),
+                                                hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.beta_),
+                                                         loadD(indexD))));
                             }
                             else
                             {
-                                ((EDataType*)arg.mE)[indexE] = hipCadd(
-                                    hipCmul(arg.mOpCDE.alpha_, (EDataType)accum),
-                                    hipCmul(arg.mOpCDE.beta_, ((EDataType*)(arg.mD[0]))[indexD]));
+                                storeE(indexE,
+                                       hipCadd(hipCmul(arg.mOpCDE.alpha_, (EDataType)accum),
+                                               hipCmul(arg.mOpCDE.beta_, loadD(indexD))));
                             }
                         }
                     };
@@ -323,6 +433,79 @@ namespace hiptensor
                 }
                 else
                 {
+                    // Product of A and B at the given offsets, after their element-wise ops
+                    auto product = [&](std::size_t indexA, std::size_t indexB) {
+                        AccDataType valA;
+                        AccDataType valB;
+
+                        // Element-wise ops
+                        arg.mOpA(valA,
+                                 ck::type_convert<ComputeDataType>(((ADataType*)arg.mA)[indexA]));
+                        arg.mOpB(valB,
+                                 ck::type_convert<ComputeDataType>(((BDataType*)arg.mB)[indexB]));
+
+                        return valA * valB;
+                    };
+
+                    auto storeE = [&](std::vector<size_t> const& indicesE, AccDataType accum) {
+                        auto indexE = offset(indicesE, arg.mE_ms_ns_strides);
+
+                        if constexpr(std::is_same_v<CDEElementwiseOperation,
+                                                    ck::tensor_operation::element_wise::Scale>)
+                        {
+                            arg.mOpCDE(((EDataType*)arg.mE)[indexE],
+                                       ck::type_convert<EDataType>(accum));
+                        }
+                        else // bilinear
+                        {
+                            // NumDTensor will be 1 due to SFINAE of this class
+                            auto indexD = offset(indicesE, arg.mD_ms_ns_strides[0]);
+                            arg.mOpCDE(((EDataType*)arg.mE)[indexE],
+                                       ck::type_convert<EDataType>(accum),
+                                       ((EDataType*)(arg.mD[0]))[indexD]);
+                        }
+                    };
+
+                    auto elementsE = std::accumulate(arg.mE_ms_ns_lengths.begin(),
+                                                     arg.mE_ms_ns_lengths.end(),
+                                                     std::size_t{1},
+                                                     std::multiplies<std::size_t>());
+
+                    // Dot products have a single element of E, so their K range is split over
+                    // the threads instead, which each sum a partial product.
+                    if(elementsE == 1)
+                    {
+                        auto numThreads
+                            = std::max(std::size_t{1},
+                                       std::min<std::size_t>(std::thread::hardware_concurrency(),
+                                                             elementsK));
+                        auto chunkK = (elementsK + numThreads - 1) / numThreads;
+
+                        std::vector<AccDataType> partials(numThreads, AccDataType{0});
+                        std::vector<std::thread> threads;
+                        for(std::size_t t = 0; t < numThreads; t++)
+                        {
+                            threads.emplace_back([&, t]() {
+                                auto endK = std::min(elementsK, (t + 1) * chunkK);
+                                for(auto k = t * chunkK; k < endK; k++)
+                                {
+                                    partials[t] += product(offsetsKA[k], offsetsKB[k]);
+                                }
+                            });
+                        }
+
+                        AccDataType accum = 0;
+                        for(std::size_t t = 0; t < numThreads; t++)
+                        {
+                            threads[t].join();
+                            accum += partials[t];
+                        }
+                        storeE(std::vector<size_t>(NumDimM + NumDimN, 0), accum);
+                        return 0;
+                    }
+
+                    // Outer products have a single K index, and GEMV a single M or N index:
+                    // the K offset tables leave each element of E a plain strided sum.
                     auto f_ms_ns = [&](auto m0,
                                        auto m1,
                                        auto m2,
@@ -335,94 +518,20 @@ namespace hiptensor
                                        auto n3,
                                        auto n4,
                                        auto n5) {
-                        AccDataType accum = 0;
+                        auto baseA = offset(std::vector<size_t>{m0, m1, m2, m3, m4, m5},
+                                            arg.mA_ms_ks_strides);
+                        auto baseB = offset(std::vector<size_t>{n0, n1, n2, n3, n4, n5},
+                                            arg.mB_ns_ks_strides);
 
-                        auto K0 = arg.mA_ms_ks_lengths[NumDimM];
-                        auto K1 = arg.mA_ms_ks_lengths[NumDimM + 1];
-                        auto K2 = arg.mA_ms_ks_lengths[NumDimM + 2];
-                        auto K3 = arg.mA_ms_ks_lengths[NumDimM + 3];
-                        auto K4 = arg.mA_ms_ks_lengths[NumDimM + 4];
-                        auto K5 = arg.mA_ms_ks_lengths[NumDimM + 5];
-
-                        for(size_t k0 = 0; k0 < K0; k0++)
+                        // Mult / accum
+                        AccDataType accum = 0;
+                        for(std::size_t k = 0; k < elementsK; k++)
                         {
-                            for(size_t k1 = 0; k1 < K1; k1++)
-                            {
-                                for(size_t k2 = 0; k2 < K2; k2++)
-                                {
-                                    for(size_t k3 = 0; k3 < K3; k3++)
-                                    {
-                                        for(size_t k4 = 0; k4 < K4; k4++)
-                                        {
-                                            for(size_t k5 = 0; k5 < K5; k5++)
-                                            {
-                                                auto indexA = offset(std::vector<size_t>{m0,
-                                                                                         m1,
-                                                                                         m2,
-                                                                                         m3,
-                                                                                         m4,
-                                                                                         m5,
-                                                                                         k0,
-                                                                                         k1,
-                                                                                         k2,
-                                                                                         k3,
-                                                                                         k4,
-                                                                                         k5},
-                                                                     arg.mA_ms_ks_strides);
-                                                auto indexB = offset(std::vector<size_t>{n0,
-                                                                                         n1,
-                                                                                         n2,
-                                                                                         n3,
-                                                                                         n4,
-                                                                                         n5,
-                                                                                         k0,
-                                                                                         k1,
-                                                                                         k2,
-                                                                                         k3,
-                                                                                         k4,
-                                                                                         k5},
-                                                                     arg.mB_ns_ks_strides);
-
-                                                AccDataType valA;
-                                                AccDataType valB;
-
-                                                // Element-wise ops
-                                                arg.mOpA(valA,
-                                                         ck::type_convert<ComputeDataType>(
-                                                             ((ADataType*)arg.mA)[indexA]));
-                                                arg.mOpB(valB,
-                                                         ck::type_convert<ComputeDataType>(
-                                                             ((BDataType*)arg.mB)[indexB]));
-
-                                                // Mult / accum
-                                                accum += valA * valB;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
+                            accum += product(baseA + offsetsKA[k], baseB + offsetsKB[k]);
                         }
 
-                        auto indexE = offset(
-                            std::vector<size_t>{m0, m1, m2, m3, m4, m5, n0, n1, n2, n3, n4, n5},
-                            arg.mE_ms_ns_strides);
-
-                        if constexpr(std::is_same_v<CDEElementwiseOperation,
-                                                    ck::tensor_operation::element_wise::Scale>)
-                        {
-                            arg.mOpCDE(((EDataType*)arg.mE)[indexE],
-                                       ck::type_convert<EDataType>(accum));
-                        }
-                        else // bilinear
-                        {
-                            // NumDTensor will be 1 due to SFINAE of this class
-                            auto indexD = offset(
-                                std::vector<size_t>{m0, m1, m2, m3, m4, m5, n0, n1, n2, n3, n4, n5},
-                                arg.mD_ms_ns_strides[0]);
-                            arg.mOpCDE(((EDataType*)arg.mE)[indexE],
-                                       ck::type_convert<EDataType>(accum),
-                                       ((EDataType*)(arg.mD[0]))[indexD]);
-                        }
+                        storeE(std::vector<size_t>{m0, m1, m2, m3, m4, m5, n0, n1, n2, n3, n4, n5},
+                               accum);
                     };
 
                     make_ParallelTensorFunctor(f_ms_ns,
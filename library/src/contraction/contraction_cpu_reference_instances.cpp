@@ -295,5 +295,185 @@ namespace hiptensor
                                         ck::tensor_operation::element_wise::PassThrough,
                                         ck::tensor_operation::element_wise::ScaleComplex,
                                         hipDoubleComplex>());
+
+        // Bilinear f32, sqrt(A)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        float,
+                                        float,
+                                        float,
+                                        ck::Tuple<float>,
+                                        float,
+                                        ck::tensor_operation::element_wise::UnarySqrt,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Bilinear,
+                                        float>());
+
+        // Bilinear f32, sqrt(B)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        float,
+                                        float,
+                                        float,
+                                        ck::Tuple<float>,
+                                        float,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::UnarySqrt,
+                                        ck::tensor_operation::element_wise::Bilinear,
+                                        float>());
+
+        // Bilinear f32, sqrt(A) and sqrt(B)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        float,
+                                        float,
+                                        float,
+                                        ck::Tuple<float>,
+                                        float,
+                                        ck::tensor_operation::element_wise::UnarySqrt,
+                                        ck::tensor_operation::element_wise::UnarySqrt,
+                                        ck::tensor_operation::element_wise::Bilinear,
+                                        float>());
+
+        // Scale f32, sqrt(A)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        float,
+                                        float,
+                                        float,
+                                        ck::Tuple<>,
+                                        float,
+                                        ck::tensor_operation::element_wise::UnarySqrt,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        float>());
+
+        // Scale f32, sqrt(B)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        float,
+                                        float,
+                                        float,
+                                        ck::Tuple<>,
+                                        float,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::UnarySqrt,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        float>());
+
+        // Scale f32, sqrt(A) and sqrt(B)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        float,
+                                        float,
+                                        float,
+                                        ck::Tuple<>,
+                                        float,
+                                        ck::tensor_operation::element_wise::UnarySqrt,
+                                        ck::tensor_operation::element_wise::UnarySqrt,
+                                        ck::tensor_operation::element_wise::Scale,
+                                        float>());
+
+        // Bilinear complex f32, conj(A)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        hipFloatComplex,
+                                        hipFloatComplex,
+                                        float,
+                                        ck::Tuple<hipFloatComplex>,
+                                        hipFloatComplex,
+                                        ck::tensor_operation::element_wise::Conjugate,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::BilinearComplex,
+                                        hipFloatComplex>());
+
+        // Bilinear complex f32, conj(B)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        hipFloatComplex,
+                                        hipFloatComplex,
+                                        float,
+                                        ck::Tuple<hipFloatComplex>,
+                                        hipFloatComplex,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Conjugate,
+                                        ck::tensor_operation::element_wise::BilinearComplex,
+                                        hipFloatComplex>());
+
+        // Bilinear complex f32, conj(A) and conj(B)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        hipFloatComplex,
+                                        hipFloatComplex,
+                                        float,
+                                        ck::Tuple<hipFloatComplex>,
+                                        hipFloatComplex,
+                                        ck::tensor_operation::element_wise::Conjugate,
+                                        ck::tensor_operation::element_wise::Conjugate,
+                                        ck::tensor_operation::element_wise::BilinearComplex,
+                                        hipFloatComplex>());
+
+        // Scale complex f32, conj(A)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        hipFloatComplex,
+                                        hipFloatComplex,
+                                        float,
+                                        ck::Tuple<>,
+                                        hipFloatComplex,
+                                        ck::tensor_operation::element_wise::Conjugate,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::ScaleComplex,
+                                        hipFloatComplex>());
+
+        // Scale complex f32, conj(B)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        hipFloatComplex,
+                                        hipFloatComplex,
+                                        float,
+                                        ck::Tuple<>,
+                                        hipFloatComplex,
+                                        ck::tensor_operation::element_wise::PassThrough,
+                                        ck::tensor_operation::element_wise::Conjugate,
+                                        ck::tensor_operation::element_wise::ScaleComplex,
+                                        hipFloatComplex>());
+
+        // Scale complex f32, conj(A) and conj(B)
+        registerSolutions(
+            enumerateReferenceSolutions<6,
+                                        6,
+                                        6,
+                                        hipFloatComplex,
+                                        hipFloatComplex,
+                                        float,
+                                        ck::Tuple<>,
+                                        hipFloatComplex,
+                                        ck::tensor_operation::element_wise::Conjugate,
+                                        ck::tensor_operation::element_wise::Conjugate,
+                                        ck::tensor_operation::element_wise::ScaleComplex,
+                                        hipFloatComplex>());
     }
 } // namespace hiptensor
@@ -0,0 +1,506 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_DEGENERATE_HPP
+#define HIPTENSOR_CONTRACTION_DEGENERATE_HPP
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "contraction_meta_traits.hpp"
+#include "util.hpp"
+
+namespace hiptensor
+{
+    // Threads per block of the degenerate contraction kernels
+    static constexpr int32_t DegenerateBlockSize = 256;
+
+    // Blocks that keep the device busy. GEMV rows are split over K until there are as many.
+    static constexpr int64_t DegenerateTargetBlocks = 1024;
+
+    // Fewest K elements a thread reduces for each split of a GEMV row
+    static constexpr int64_t DegenerateMinLoadsPerThread = 16;
+
+    // Lengths and strides of a contraction with a single M or N element, in elements, as
+    // a matrix-vector product E[R...] = sum_K Mat[R..., K...] * Vec[K...]. The rows R are
+    // the modes of the matrix found in E. Unit modes are dropped, and the rows and K modes
+    // are ordered by their matrix strides, so that packed operands reduce over a single
+    // K mode. A dot product has no rows.
+    struct GemvDesc
+    {
+        int32_t mNumDimsR;
+        int32_t mNumDimsK;
+        int64_t mLengthsR[MaxNumDimsM];
+        int64_t mLengthsK[MaxNumDimsK];
+        int64_t mStridesMatR[MaxNumDimsM];
+        int64_t mStridesDR[MaxNumDimsM];
+        int64_t mStridesER[MaxNumDimsM];
+        int64_t mStridesMatK[MaxNumDimsK];
+        int64_t mStridesVecK[MaxNumDimsK];
+        int64_t mElementsR;
+        int64_t mElementsK;
+
+        // Each row is reduced in mSplitsK chunks of mChunkK elements
+        int64_t mSplitsK;
+        int64_t mChunkK;
+
+        // The matrix is A, unless E has a single M element
+        bool mMatrixIsA;
+    };
+
+    // Lengths and strides of a contraction without K modes, E[M..., N...] = A[M...] * B[N...],
+    // in elements. Unit modes are dropped.
+    struct OuterProductDesc
+    {
+        int32_t mNumDimsM;
+        int32_t mNumDimsN;
+        int64_t mLengthsM[MaxNumDimsM];
+        int64_t mLengthsN[MaxNumDimsN];
+        int64_t mStridesAM[MaxNumDimsM];
+        int64_t mStridesDM[MaxNumDimsM];
+        int64_t mStridesEM[MaxNumDimsM];
+        int64_t mStridesBN[MaxNumDimsN];
+        int64_t mStridesDN[MaxNumDimsN];
+        int64_t mStridesEN[MaxNumDimsN];
+        int64_t mElementsM;
+        int64_t mElementsN;
+    };
+
+    // Builds the GEMV description from A[M..., K...], B[N..., K...], D and E[M..., N...],
+    // normalized to MaxNumDimsM, MaxNumDimsN and MaxNumDimsK modes
+    template <typename IndexT>
+    GemvDesc makeGemvDesc(std::vector<IndexT> const& a_ms_ks_lengths,
+                          std::vector<IndexT> const& a_ms_ks_strides,
+                          std::vector<IndexT> const& b_ns_ks_lengths,
+                          std::vector<IndexT> const& b_ns_ks_strides,
+                          std::vector<IndexT> const& d_ms_ns_strides,
+                          std::vector<IndexT> const& e_ms_ns_strides)
+    {
+        GemvDesc desc   = {};
+        desc.mElementsR = 1;
+        desc.mElementsK = 1;
+        desc.mSplitsK   = 1;
+
+        int64_t elementsM = 1;
+        for(int i = 0; i < MaxNumDimsM; i++)
+        {
+            elementsM *= a_ms_ks_lengths[i];
+        }
+        desc.mMatrixIsA = elementsM > 1;
+
+        auto const& matLengths = desc.mMatrixIsA ? a_ms_ks_lengths : b_ns_ks_lengths;
+        auto const& matStrides = desc.mMatrixIsA ? a_ms_ks_strides : b_ns_ks_strides;
+        auto const& vecStrides = desc.mMatrixIsA ? b_ns_ks_strides : a_ms_ks_strides;
+        auto        numDimsR   = desc.mMatrixIsA ? MaxNumDimsM : MaxNumDimsN;
+        auto        offsetE    = desc.mMatrixIsA ? 0 : MaxNumDimsM;
+
+        for(int i = 0; i < numDimsR; i++)
+        {
+            if(matLengths[i] > 1)
+            {
+                auto r               = desc.mNumDimsR++;
+                desc.mLengthsR[r]    = matLengths[i];
+                desc.mStridesMatR[r] = matStrides[i];
+                desc.mStridesDR[r]   = d_ms_ns_strides[offsetE + i];
+                desc.mStridesER[r]   = e_ms_ns_strides[offsetE + i];
+                desc.mElementsR *= matLengths[i];
+            }
+        }
+        for(int i = 0; i < MaxNumDimsK; i++)
+        {
+            if(matLengths[numDimsR + i] > 1)
+            {
+                auto k               = desc.mNumDimsK++;
+                desc.mLengthsK[k]    = matLengths[numDimsR + i];
+                desc.mStridesMatK[k] = matStrides[numDimsR + i];
+                desc.mStridesVecK[k] = vecStrides[numDimsR + i];
+                desc.mElementsK *= matLengths[numDimsR + i];
+            }
+        }
+
+        // Insertion sort on the matrix strides, leading mode smallest
+        for(int i = 1; i < desc.mNumDimsR; i++)
+        {
+            for(int j = i; j > 0 && desc.mStridesMatR[j] < desc.mStridesMatR[j - 1]; j--)
+            {
+                std::swap(desc.mLengthsR[j], desc.mLengthsR[j - 1]);
+                std::swap(desc.mStridesMatR[j], desc.mStridesMatR[j - 1]);
+                std::swap(desc.mStridesDR[j], desc.mStridesDR[j - 1]);
+                std::swap(desc.mStridesER[j], desc.mStridesER[j - 1]);
+            }
+        }
+        for(int i = 1; i < desc.mNumDimsK; i++)
+        {
+            for(int j = i; j > 0 && desc.mStridesMatK[j] < desc.mStridesMatK[j - 1]; j--)
+            {
+                std::swap(desc.mLengthsK[j], desc.mLengthsK[j - 1]);
+                std::swap(desc.mStridesMatK[j], desc.mStridesMatK[j - 1]);
+                std::swap(desc.mStridesVecK[j], desc.mStridesVecK[j - 1]);
+            }
+        }
+
+        desc.mChunkK = desc.mElementsK;
+        return desc;
+    }
+
+    // True if the GEMV rows are reduced by a thread each. That is the case when the leading
+    // rows are adjacent in the matrix, so that the loads of a wavefront coalesce, or when
+    // the rows are too short to occupy a block. Otherwise each row is reduced by a block.
+    inline bool isGemvThreadPerRow(GemvDesc const& desc)
+    {
+        return (desc.mNumDimsR > 0 && desc.mStridesMatR[0] == 1)
+               || desc.mElementsK < DegenerateBlockSize;
+    }
+
+    // Splits the rows over K when there are too few of them to occupy the device. The
+    // partial sums of the splits are then reduced in the workspace by gemvReduceSplits.
+    inline void splitGemvRows(GemvDesc& desc)
+    {
+        auto threadPerRow = isGemvThreadPerRow(desc);
+        auto blocks
+            = threadPerRow ? ceilDiv(desc.mElementsR, DegenerateBlockSize) : desc.mElementsR;
+        auto minChunk = threadPerRow ? DegenerateMinLoadsPerThread
+                                     : DegenerateMinLoadsPerThread * DegenerateBlockSize;
+
+        desc.mSplitsK = 1;
+        desc.mChunkK  = desc.mElementsK;
+        if(blocks < DegenerateTargetBlocks)
+        {
+            auto splits   = std::min(ceilDiv(DegenerateTargetBlocks, blocks),
+                                     ceilDiv(desc.mElementsK, minChunk));
+            desc.mChunkK  = ceilDiv(desc.mElementsK, std::max(splits, int64_t(1)));
+            desc.mSplitsK = ceilDiv(desc.mElementsK, desc.mChunkK);
+        }
+    }
+
+    // Builds the outer product description from A[M..., K...], B[N..., K...], D and
+    // E[M..., N...], normalized to MaxNumDimsM, MaxNumDimsN and MaxNumDimsK modes
+    template <typename IndexT>
+    OuterProductDesc makeOuterProductDesc(std::vector<IndexT> const& a_ms_ks_lengths,
+                                          std::vector<IndexT> const& a_ms_ks_strides,
+                                          std::vector<IndexT> const& b_ns_ks_lengths,
+                                          std::vector<IndexT> const& b_ns_ks_strides,
+                                          std::vector<IndexT> const& d_ms_ns_strides,
+                                          std::vector<IndexT> const& e_ms_ns_strides)
+    {
+        OuterProductDesc desc = {};
+        desc.mElementsM       = 1;
+        desc.mElementsN       = 1;
+
+        for(int i = 0; i < MaxNumDimsM; i++)
+        {
+            if(a_ms_ks_lengths[i] > 1)
+            {
+                auto m             = desc.mNumDimsM++;
+                desc.mLengthsM[m]  = a_ms_ks_lengths[i];
+                desc.mStridesAM[m] = a_ms_ks_strides[i];
+                desc.mStridesDM[m] = d_ms_ns_strides[i];
+                desc.mStridesEM[m] = e_ms_ns_strides[i];
+                desc.mElementsM *= a_ms_ks_lengths[i];
+            }
+        }
+        for(int i = 0; i < MaxNumDimsN; i++)
+        {
+            if(b_ns_ks_lengths[i] > 1)
+            {
+                auto n             = desc.mNumDimsN++;
+                desc.mLengthsN[n]  = b_ns_ks_lengths[i];
+                desc.mStridesBN[n] = b_ns_ks_strides[i];
+                desc.mStridesDN[n] = d_ms_ns_strides[MaxNumDimsM + i];
+                desc.mStridesEN[n] = e_ms_ns_strides[MaxNumDimsM + i];
+                desc.mElementsN *= b_ns_ks_lengths[i];
+            }
+        }
+
+        return desc;
+    }
+
+    // Loads an operand element, rounded to the compute type and widened to the accumulator
+    template <typename ComputeT, typename AccT, typename DataT>
+    __device__ inline AccT loadOperand(DataT value)
+    {
+        return ck::type_convert<AccT>(ck::type_convert<ComputeT>(value));
+    }
+
+    // E = alpha * accum + beta * D. D may be null, in which case E = alpha * accum.
+    template <typename EDataT, typename AccT>
+    __device__ inline void storeScaled(EDataT*       e,
+                                       EDataT const* d,
+                                       int64_t       offsetE,
+                                       int64_t       offsetD,
+                                       AccT          accum,
+                                       AccT          alpha,
+                                       AccT          beta)
+    {
+        auto result = alpha * accum;
+        if(d != nullptr)
+        {
+            result += beta * ck::type_convert<AccT>(d[offsetD]);
+        }
+        e[offsetE] = ck::type_convert<EDataT>(result);
+    }
+
+    // Offsets of GEMV row r in the matrix, D and E
+    __device__ inline void gemvRowOffsets(GemvDesc const& desc,
+                                          int64_t         r,
+                                          int64_t&        offsetMat,
+                                          int64_t&        offsetD,
+                                          int64_t&        offsetE)
+    {
+        offsetMat = 0;
+        offsetD   = 0;
+        offsetE   = 0;
+        for(int i = 0; i < desc.mNumDimsR; i++)
+        {
+            auto coord = r % desc.mLengthsR[i];
+            r /= desc.mLengthsR[i];
+            offsetMat += coord * desc.mStridesMatR[i];
+            offsetD += coord * desc.mStridesDR[i];
+            offsetE += coord * desc.mStridesER[i];
+        }
+    }
+
+    /**
+     * \brief This function reduces GEMV rows with a thread each, over one split of K.
+     *        Block b reduces split (b % mSplitsK) of DegenerateBlockSize consecutive rows.
+     *        Without splits E is written directly, otherwise the partial sums of the rows
+     *        are written to partials[r * mSplitsK + split].
+     */
+    template <typename DataT, typename EDataT, typename ComputeT, typename AccT>
+    __global__ void gemvThreadPerRow(DataT const*  mat,
+                                     DataT const*  vec,
+                                     EDataT const* d,
+                                     EDataT*       e,
+                                     AccT*         partials,
+                                     GemvDesc      desc,
+                                     AccT          alpha,
+                                     AccT          beta)
+    {
+        int64_t split = blockIdx.x % desc.mSplitsK;
+        int64_t r     = (blockIdx.x / desc.mSplitsK) * blockDim.x + threadIdx.x;
+
+        if(r >= desc.mElementsR)
+        {
+            return;
+        }
+
+        int64_t offsetMat, offsetD, offsetE;
+        gemvRowOffsets(desc, r, offsetMat, offsetD, offsetE);
+
+        auto kBegin = split * desc.mChunkK;
+        auto kEnd   = std::min(kBegin + desc.mChunkK, desc.mElementsK);
+
+        // Start the K coordinates at kBegin, then step them, leading mode fastest
+        int64_t coordK[MaxNumDimsK] = {};
+        int64_t offsetVec           = 0;
+        auto    idx                 = kBegin;
+        for(int i = 0; i < desc.mNumDimsK; i++)
+        {
+            coordK[i] = idx % desc.mLengthsK[i];
+            idx /= desc.mLengthsK[i];
+            offsetMat += coordK[i] * desc.mStridesMatK[i];
+            offsetVec += coordK[i] * desc.mStridesVecK[i];
+        }
+
+        AccT accum = 0;
+        for(auto k = kBegin; k < kEnd; k++)
+        {
+            accum += loadOperand<ComputeT, AccT>(mat[offsetMat])
+                     * loadOperand<ComputeT, AccT>(vec[offsetVec]);
+
+            for(int i = 0; i < desc.mNumDimsK; i++)
+            {
+                offsetMat += desc.mStridesMatK[i];
+                offsetVec += desc.mStridesVecK[i];
+                if(++coordK[i] < desc.mLengthsK[i])
+                {
+                    break;
+                }
+                offsetMat -= desc.mStridesMatK[i] * desc.mLengthsK[i];
+                offsetVec -= desc.mStridesVecK[i] * desc.mLengthsK[i];
+                coordK[i] = 0;
+            }
+        }
+
+        if(desc.mSplitsK == 1)
+        {
+            storeScaled(e, d, offsetE, offsetD, accum, alpha, beta);
+        }
+        else
+        {
+            partials[r * desc.mSplitsK + split] = accum;
+        }
+    }
+
+    /**
+     * \brief This function reduces GEMV rows with a block each, over one split of K.
+     *        Block b reduces split (b % mSplitsK) of row (b / mSplitsK), its threads
+     *        striding over K. A dot product is the GEMV of a single row.
+     *        Without splits E is written directly, otherwise the partial sums of the rows
+     *        are written to partials[r * mSplitsK + split].
+     */
+    template <typename DataT, typename EDataT, typename ComputeT, typename AccT>
+    __global__ void gemvBlockPerRow(DataT const*  mat,
+                                    DataT const*  vec,
+                                    EDataT const* d,
+                                    EDataT*       e,
+                                    AccT*         partials,
+                                    GemvDesc      desc,
+                                    AccT          alpha,
+                                    AccT          beta)
+    {
+        __shared__ AccT blockAccum[DegenerateBlockSize];
+
+        int64_t split = blockIdx.x % desc.mSplitsK;
+        int64_t r     = blockIdx.x / desc.mSplitsK;
+
+        int64_t offsetMat, offsetD, offsetE;
+        gemvRowOffsets(desc, r, offsetMat, offsetD, offsetE);
+
+        auto kBegin = split * desc.mChunkK;
+        auto kEnd   = std::min(kBegin + desc.mChunkK, desc.mElementsK);
+
+        AccT accum = 0;
+        for(auto k = kBegin + threadIdx.x; k < kEnd; k += blockDim.x)
+        {
+            int64_t offsetMatK = 0;
+            int64_t offsetVecK = 0;
+            auto    idx        = k;
+            for(int i = 0; i < desc.mNumDimsK; i++)
+            {
+                auto coord = idx % desc.mLengthsK[i];
+                idx /= desc.mLengthsK[i];
+                offsetMatK += coord * desc.mStridesMatK[i];
+                offsetVecK += coord * desc.mStridesVecK[i];
+            }
+
+            accum += loadOperand<ComputeT, AccT>(mat[offsetMat + offsetMatK])
+                     * loadOperand<ComputeT, AccT>(vec[offsetVecK]);
+        }
+
+        // Tree reduction of the block
+        blockAccum[threadIdx.x] = accum;
+        __syncthreads();
+        for(int32_t width = DegenerateBlockSize / 2; width > 0; width /= 2)
+        {
+            if(static_cast<int32_t>(threadIdx.x) < width)
+            {
+                blockAccum[threadIdx.x] += blockAccum[threadIdx.x + width];
+            }
+            __syncthreads();
+        }
+
+        if(threadIdx.x == 0)
+        {
+            if(desc.mSplitsK == 1)
+            {
+                storeScaled(e, d, offsetE, offsetD, blockAccum[0], alpha, beta);
+            }
+            else
+            {
+                partials[r * desc.mSplitsK + split] = blockAccum[0];
+            }
+        }
+    }
+
+    /**
+     * \brief This function sums the partial sums of the splits of each GEMV row, in split
+     *        order, and writes E = alpha * sum + beta * D.
+     */
+    template <typename EDataT, typename AccT>
+    __global__ void gemvReduceSplits(
+        AccT const* partials, EDataT const* d, EDataT* e, GemvDesc desc, AccT alpha, AccT beta)
+    {
+        int64_t r = threadIdx.x + static_cast<int64_t>(blockIdx.x) * blockDim.x;
+
+        if(r >= desc.mElementsR)
+        {
+            return;
+        }
+
+        int64_t offsetMat, offsetD, offsetE;
+        gemvRowOffsets(desc, r, offsetMat, offsetD, offsetE);
+
+        AccT accum = 0;
+        for(int64_t split = 0; split < desc.mSplitsK; split++)
+        {
+            accum += partials[r * desc.mSplitsK + split];
+        }
+
+        storeScaled(e, d, offsetE, offsetD, accum, alpha, beta);
+    }
+
+    /**
+     * \brief This function writes E = alpha * (A * B) + beta * D for contractions without
+     *        K modes. Each thread owns one element of E; the leading M mode varies fastest
+     *        across threads, matching the default column major layout of E.
+     */
+    template <typename DataT, typename EDataT, typename ComputeT, typename AccT>
+    __global__ void outerProduct(DataT const*     a,
+                                 DataT const*     b,
+                                 EDataT const*    d,
+                                 EDataT*          e,
+                                 OuterProductDesc desc,
+                                 AccT             alpha,
+                                 AccT             beta)
+    {
+        int64_t idx = threadIdx.x + static_cast<int64_t>(blockIdx.x) * blockDim.x;
+
+        if(idx >= desc.mElementsM * desc.mElementsN)
+        {
+            return;
+        }
+
+        int64_t offsetA = 0;
+        int64_t offsetB = 0;
+        int64_t offsetD = 0;
+        int64_t offsetE = 0;
+        for(int i = 0; i < desc.mNumDimsM; i++)
+        {
+            auto coord = idx % desc.mLengthsM[i];
+            idx /= desc.mLengthsM[i];
+            offsetA += coord * desc.mStridesAM[i];
+            offsetD += coord * desc.mStridesDM[i];
+            offsetE += coord * desc.mStridesEM[i];
+        }
+        for(int i = 0; i < desc.mNumDimsN; i++)
+        {
+            auto coord = idx % desc.mLengthsN[i];
+            idx /= desc.mLengthsN[i];
+            offsetB += coord * desc.mStridesBN[i];
+            offsetD += coord * desc.mStridesDN[i];
+            offsetE += coord * desc.mStridesEN[i];
+        }
+
+        auto accum
+            = loadOperand<ComputeT, AccT>(a[offsetA]) * loadOperand<ComputeT, AccT>(b[offsetB]);
+        storeScaled(e, d, offsetE, offsetD, accum, alpha, beta);
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_DEGENERATE_HPP
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+
+#include "contraction_epilogue.hpp"
+
+namespace hiptensor
+{
+    bool epilogueBiasStrides(std::vector<std::size_t>*       result,
+                             std::vector<std::size_t> const& biasLengths,
+                             std::vector<std::size_t> const& biasStrides,
+                             std::vector<int32_t> const&     biasModes,
+                             std::vector<std::size_t> const& lengthsE,
+                             std::vector<int32_t> const&     modesE)
+    {
+        result->assign(modesE.size(), 0);
+        for(std::size_t i = 0; i < biasModes.size(); i++)
+        {
+            auto it = std::find(modesE.cbegin(), modesE.cend(), biasModes[i]);
+            if(it == modesE.cend())
+            {
+                return false;
+            }
+
+            auto index = std::distance(modesE.cbegin(), it);
+            if(lengthsE[index] != biasLengths[i])
+            {
+                return false;
+            }
+            (*result)[index] = biasStrides[i];
+        }
+        return true;
+    }
+
+    ContractionEpilogue contractionEpilogue(hiptensorContractionDescriptor_t const& desc)
+    {
+        auto const& epilogue = desc.mEpilogue;
+        auto const& descE    = desc.mTensorDesc[3];
+        auto const& modesE   = desc.mTensorMode.back();
+
+        ContractionEpilogue result;
+        result.mActivation = epilogue.mActivation;
+        result.mLower      = epilogue.mLower;
+        result.mUpper      = epilogue.mUpper;
+        result.mBias       = epilogue.mBias;
+        result.mBiasStrides.assign(modesE.size(), 0);
+        if(epilogue.mBias != nullptr)
+        {
+            // Bias modes are validated when the epilogue is set
+            epilogueBiasStrides(&result.mBiasStrides,
+                                epilogue.mBiasDesc.mLengths,
+                                epilogue.mBiasDesc.mStrides,
+                                epilogue.mBiasMode,
+                                descE.mLengths,
+                                modesE);
+        }
+        return result;
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_EPILOGUE_HPP
+#define HIPTENSOR_CONTRACTION_EPILOGUE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <hiptensor/hiptensor_types.hpp>
+
+namespace hiptensor
+{
+    // Epilogue of a contraction as the solutions apply it to each element of E, before
+    // it is stored: E = activation(alpha * A * B + beta * D + bias).
+    struct ContractionEpilogue
+    {
+        hiptensorActivation_t mActivation = HIPTENSOR_ACTIVATION_NONE;
+        float                 mLower      = 0.0f;
+        float                 mUpper      = 0.0f;
+        void const*           mBias       = nullptr;
+
+        // Strides of the bias in the order of the modes of E, zero on the modes it is
+        // broadcast over
+        std::vector<std::size_t> mBiasStrides;
+
+        bool hasBias() const
+        {
+            return mBias != nullptr;
+        }
+    };
+
+    // Strides of a bias in the order of the modes of E, zero on the modes of E that the
+    // bias does not have. Returns false if a bias mode is not in E or differs in length.
+    bool epilogueBiasStrides(std::vector<std::size_t>*       result,
+                             std::vector<std::size_t> const& biasLengths,
+                             std::vector<std::size_t> const& biasStrides,
+                             std::vector<int32_t> const&     biasModes,
+                             std::vector<std::size_t> const& lengthsE,
+                             std::vector<int32_t> const&     modesE);
+
+    // Epilogue of a contraction descriptor, with its bias strides over the modes of D
+    ContractionEpilogue contractionEpilogue(hiptensorContractionDescriptor_t const& desc);
+
+    // Activation of one element of the epilogue, in float
+    __host__ __device__ inline float
+        applyActivation(float x, hiptensorActivation_t activation, float lower, float upper)
+    {
+        switch(activation)
+        {
+        case HIPTENSOR_ACTIVATION_RELU:
+            return x > 0.0f ? x : 0.0f;
+        case HIPTENSOR_ACTIVATION_GELU:
+        {
+            // tanh approximation: 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+            constexpr float sqrt2OverPi = 0.7978845608f;
+            return 0.5f * x * (1.0f + tanhf(sqrt2OverPi * (x + 0.044715f * x * x * x)));
+        }
+        case HIPTENSOR_ACTIVATION_SILU:
+            return x / (1.0f + expf(-x));
+        case HIPTENSOR_ACTIVATION_CLAMP:
+            return x < lower ? lower : (x > upper ? upper : x);
+        default:
+            return x;
+        }
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_EPILOGUE_HPP
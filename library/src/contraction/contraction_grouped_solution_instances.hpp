@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_GROUPED_CONTRACTION_SOLUTION_INSTANCES_HPP
+#define HIPTENSOR_GROUPED_CONTRACTION_SOLUTION_INSTANCES_HPP
+
+#include <memory>
+
+#include "contraction_solution_registry.hpp"
+#include "kernel_modules.hpp"
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    class GroupedContractionSolutionInstances;
+}
+
+// Entry point of the contraction kernel module: registers the grouped device instance families
+HIPTENSOR_KERNEL_MODULE_ENTRY void hiptensorRegisterGroupedContractionKernels(
+    hiptensor::GroupedContractionSolutionInstances* instances);
+
+namespace hiptensor
+{
+    // Grouped contraction solutions, which run a list of problems with different extents
+    // in a single launch. All of them are GroupedContractionSolutions.
+    class GroupedContractionSolutionInstances
+        : public ContractionSolutionRegistry,
+          public LazySingleton<GroupedContractionSolutionInstances>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<GroupedContractionSolutionInstances>
+            std::make_unique<GroupedContractionSolutionInstances>();
+
+        // Registers the device instance families from within the kernel module
+        friend void ::hiptensorRegisterGroupedContractionKernels(
+            GroupedContractionSolutionInstances* instances);
+
+        ~GroupedContractionSolutionInstances() = default;
+
+    private:
+        // Registers every device instance family exactly once
+        void registerInstances();
+
+        // Singleton: only one instance
+        GroupedContractionSolutionInstances();
+        GroupedContractionSolutionInstances(GroupedContractionSolutionInstances const&) = delete;
+        GroupedContractionSolutionInstances(GroupedContractionSolutionInstances&&)      = delete;
+        GroupedContractionSolutionInstances& operator=(GroupedContractionSolutionInstances const&)
+            = delete;
+        GroupedContractionSolutionInstances& operator=(GroupedContractionSolutionInstances&&)
+            = delete;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_GROUPED_CONTRACTION_SOLUTION_INSTANCES_HPP
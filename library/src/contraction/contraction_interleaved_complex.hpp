@@ -0,0 +1,206 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_INTERLEAVED_COMPLEX_HPP
+#define HIPTENSOR_CONTRACTION_INTERLEAVED_COMPLEX_HPP
+
+#include <vector>
+
+#include "contraction_pack_util.hpp"
+#include "data_types.hpp"
+#include "util.hpp"
+#include <hiptensor/hiptensor.hpp>
+
+namespace hiptensor
+{
+    // Lengths and strides of a complex contraction, in elements, passed by value to
+    // contractInterleaved. D shares the strides of E. The layouts address the real and
+    // imaginary parts of interleaved or planar operands, and A and B are conjugated as
+    // they are loaded when their flag is set.
+    template <int NumDimM, int NumDimN, int NumDimK>
+    struct InterleavedComplexDesc
+    {
+        int64_t mLengthsM[NumDimM];
+        int64_t mLengthsN[NumDimN];
+        int64_t mLengthsK[NumDimK];
+        int64_t mStridesAM[NumDimM];
+        int64_t mStridesAK[NumDimK];
+        int64_t mStridesBN[NumDimN];
+        int64_t mStridesBK[NumDimK];
+        int64_t mStridesEM[NumDimM];
+        int64_t mStridesEN[NumDimN];
+        int64_t mElementsK;
+
+        ComplexLayout mLayoutA;
+        ComplexLayout mLayoutB;
+        ComplexLayout mLayoutD;
+        ComplexLayout mLayoutE;
+
+        bool mConjA = false;
+        bool mConjB = false;
+    };
+
+    // Builds the kernel description from A[M..., K...], B[N..., K...] and E[M..., N...]
+    template <int NumDimM, int NumDimN, int NumDimK, typename IndexT>
+    InterleavedComplexDesc<NumDimM, NumDimN, NumDimK>
+        makeInterleavedComplexDesc(std::vector<IndexT> const& a_ms_ks_lengths,
+                                   std::vector<IndexT> const& a_ms_ks_strides,
+                                   std::vector<IndexT> const& b_ns_ks_lengths,
+                                   std::vector<IndexT> const& b_ns_ks_strides,
+                                   std::vector<IndexT> const& e_ms_ns_strides)
+    {
+        InterleavedComplexDesc<NumDimM, NumDimN, NumDimK> desc;
+        desc.mElementsK = 1;
+
+        for(int i = 0; i < NumDimM; i++)
+        {
+            desc.mLengthsM[i]  = a_ms_ks_lengths[i];
+            desc.mStridesAM[i] = a_ms_ks_strides[i];
+            desc.mStridesEM[i] = e_ms_ns_strides[i];
+        }
+        for(int i = 0; i < NumDimN; i++)
+        {
+            desc.mLengthsN[i]  = b_ns_ks_lengths[i];
+            desc.mStridesBN[i] = b_ns_ks_strides[i];
+            desc.mStridesEN[i] = e_ms_ns_strides[NumDimM + i];
+        }
+        for(int i = 0; i < NumDimK; i++)
+        {
+            desc.mLengthsK[i]  = a_ms_ks_lengths[NumDimM + i];
+            desc.mStridesAK[i] = a_ms_ks_strides[NumDimM + i];
+            desc.mStridesBK[i] = b_ns_ks_strides[NumDimN + i];
+            desc.mElementsK *= desc.mLengthsK[i];
+        }
+
+        return desc;
+    }
+
+    /**
+     * \brief This function contracts complex A and B in a single pass, into
+     *        E = alpha * (A * B) + beta * D. Each thread owns one element of E and
+     *        accumulates its real and imaginary parts in registers, so no planar copies of
+     *        the operands are made, and planar operands are read and written in place.
+     *        D may be null, in which case E = alpha * (A * B).
+     */
+    template <typename DataType, int NumDimM, int NumDimN, int NumDimK>
+    __global__ void contractInterleaved(DataType const*                                   a,
+                                        DataType const*                                   b,
+                                        DataType const*                                   d,
+                                        DataType*                                         e,
+                                        InterleavedComplexDesc<NumDimM, NumDimN, NumDimK> desc,
+                                        HIP_vector_type<double, 2>                        alpha,
+                                        HIP_vector_type<double, 2>                        beta,
+                                        int64_t                                           length)
+    {
+        int64_t idx = threadIdx.x + static_cast<int64_t>(blockIdx.x) * blockDim.x;
+
+        if(idx >= length)
+        {
+            return;
+        }
+
+        // The leading M mode varies fastest across threads, matching the default
+        // column major layout of E.
+        int64_t offsetA = 0;
+        int64_t offsetB = 0;
+        int64_t offsetE = 0;
+        for(int i = 0; i < NumDimM; i++)
+        {
+            auto coord = idx % desc.mLengthsM[i];
+            idx /= desc.mLengthsM[i];
+            offsetA += coord * desc.mStridesAM[i];
+            offsetE += coord * desc.mStridesEM[i];
+        }
+        for(int i = 0; i < NumDimN; i++)
+        {
+            auto coord = idx % desc.mLengthsN[i];
+            idx /= desc.mLengthsN[i];
+            offsetB += coord * desc.mStridesBN[i];
+            offsetE += coord * desc.mStridesEN[i];
+        }
+
+        DataType accumReal = 0;
+        DataType accumImag = 0;
+
+        DataType signA = desc.mConjA ? DataType(-1) : DataType(1);
+        DataType signB = desc.mConjB ? DataType(-1) : DataType(1);
+
+        int64_t coordK[NumDimK] = {};
+        for(int64_t k = 0; k < desc.mElementsK; k++)
+        {
+            auto realA = a[desc.mLayoutA.real(offsetA)];
+            auto imagA = signA * a[desc.mLayoutA.imag(offsetA)];
+            auto realB = b[desc.mLayoutB.real(offsetB)];
+            auto imagB = signB * b[desc.mLayoutB.imag(offsetB)];
+
+            accumReal = fma(realA, realB, accumReal);
+            accumReal = fma(-imagA, imagB, accumReal);
+            accumImag = fma(realA, imagB, accumImag);
+            accumImag = fma(imagA, realB, accumImag);
+
+            // Step the K modes, leading mode fastest
+            for(int i = 0; i < NumDimK; i++)
+            {
+                offsetA += desc.mStridesAK[i];
+                offsetB += desc.mStridesBK[i];
+                if(++coordK[i] < desc.mLengthsK[i])
+                {
+                    break;
+                }
+                offsetA -= desc.mStridesAK[i] * desc.mLengthsK[i];
+                offsetB -= desc.mStridesBK[i] * desc.mLengthsK[i];
+                coordK[i] = 0;
+            }
+        }
+
+        if constexpr(std::is_same_v<DataType, float>)
+        {
+            auto result = hipCmulf(make_hipFloatComplex(accumReal, accumImag),
+                                   hipComplexDoubleToFloat(alpha));
+            if(d != nullptr)
+            {
+                auto valD = make_hipFloatComplex(d[desc.mLayoutD.real(offsetE)],
+                                                 d[desc.mLayoutD.imag(offsetE)]);
+                result    = hipCaddf(result, hipCmulf(valD, hipComplexDoubleToFloat(beta)));
+            }
+            storeComplex(e, desc.mLayoutE, offsetE, result);
+        }
+        else if constexpr(std::is_same_v<DataType, double>)
+        {
+            auto result = hipCmul(make_hipDoubleComplex(accumReal, accumImag), alpha);
+            if(d != nullptr)
+            {
+                auto valD = make_hipDoubleComplex(d[desc.mLayoutD.real(offsetE)],
+                                                  d[desc.mLayoutD.imag(offsetE)]);
+                result    = hipCadd(result, hipCmul(valD, beta));
+            }
+            storeComplex(e, desc.mLayoutE, offsetE, result);
+        }
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_INTERLEAVED_COMPLEX_HPP
@@ -0,0 +1,640 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "contraction_batched_solution_instances.hpp"
+#include "contraction_grouped_solution_instances.hpp"
+#include "contraction_solution_instances.hpp"
+#include "contraction_solution.hpp"
+
+// Ensure access to
+#include "device/hiptensor_batched_contraction_instances.hpp"
+#include "device/hiptensor_contraction_bilinear_instances.hpp"
+#include "device/hiptensor_contraction_epilogue_instances.hpp"
+#include "device/hiptensor_contraction_scale_instances.hpp"
+#include "device/hiptensor_contraction_unary_op_instances.hpp"
+#include "device/hiptensor_grouped_contraction_instances.hpp"
+
+namespace hiptensor
+{
+    void ContractionSolutionInstances::registerInstances()
+    {
+        // Register all the solution families exactly once. Device ops of a
+        // family are only instantiated by the first query that may select them.
+
+        // Bilinear bf16
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      ck::bhalf_t,
+                                      ck::bhalf_t,
+                                      ck::Tuple<ck::bhalf_t>,
+                                      ck::bhalf_t,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      float>());
+
+        // Bilinear f16
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      ck::half_t,
+                                      ck::half_t,
+                                      ck::Tuple<ck::half_t>,
+                                      ck::half_t,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      float>());
+
+        // Bilinear f32
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<float>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      float>());
+
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<float>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      ck::half_t>());
+
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<float>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      ck::bhalf_t>());
+
+        // Bilinear complex f32
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipFloatComplex,
+                                      hipFloatComplex,
+                                      ck::Tuple<hipFloatComplex>,
+                                      hipFloatComplex,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::BilinearComplex,
+                                      hipFloatComplex>());
+
+        // Bilinear f64
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      double,
+                                      double,
+                                      ck::Tuple<double>,
+                                      double,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      float>());
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      double,
+                                      double,
+                                      ck::Tuple<double>,
+                                      double,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      double>());
+
+        // Bilinear complex f64
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipDoubleComplex,
+                                      hipDoubleComplex,
+                                      ck::Tuple<hipDoubleComplex>,
+                                      hipDoubleComplex,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::BilinearComplex,
+                                      hipDoubleComplex>());
+
+        // Scale bf16
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      ck::bhalf_t,
+                                      ck::bhalf_t,
+                                      ck::Tuple<>,
+                                      ck::bhalf_t,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      float>());
+
+        // Scale f16
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      ck::half_t,
+                                      ck::half_t,
+                                      ck::Tuple<>,
+                                      ck::half_t,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      float>());
+
+        // Scale f32
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      float>());
+
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      ck::half_t>());
+
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      ck::bhalf_t>());
+
+        // scale complex f32
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipFloatComplex,
+                                      hipFloatComplex,
+                                      ck::Tuple<>,
+                                      hipFloatComplex,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::ScaleComplex,
+                                      hipFloatComplex>());
+
+        // Scale f64
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      double,
+                                      double,
+                                      ck::Tuple<>,
+                                      double,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      float>());
+
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      double,
+                                      double,
+                                      ck::Tuple<>,
+                                      double,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      double>());
+        // scale complex f64
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipDoubleComplex,
+                                      hipDoubleComplex,
+                                      ck::Tuple<>,
+                                      hipDoubleComplex,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::ScaleComplex,
+                                      hipDoubleComplex>());
+
+        // Epilogue f32, stored as f32
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<float, float>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Epilogue,
+                                      float>());
+
+        // Epilogue f32, stored as bf16
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<ck::bhalf_t, float>,
+                                      ck::bhalf_t,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Epilogue,
+                                      float>());
+
+        // Epilogue f32, stored as f16
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<ck::half_t, float>,
+                                      ck::half_t,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Epilogue,
+                                      float>());
+
+        // Scale f32, sqrt(A)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<>,
+                                      float,
+                                      ck::tensor_operation::element_wise::UnarySqrt,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      float>());
+
+        // Scale f32, sqrt(B)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::UnarySqrt,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      float>());
+
+        // Scale f32, sqrt(A) and sqrt(B)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<>,
+                                      float,
+                                      ck::tensor_operation::element_wise::UnarySqrt,
+                                      ck::tensor_operation::element_wise::UnarySqrt,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      float>());
+
+        // Scale cf32, conj(A)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipFloatComplex,
+                                      hipFloatComplex,
+                                      ck::Tuple<>,
+                                      hipFloatComplex,
+                                      ck::tensor_operation::element_wise::Conjugate,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::ScaleComplex,
+                                      hipFloatComplex>());
+
+        // Scale cf32, conj(B)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipFloatComplex,
+                                      hipFloatComplex,
+                                      ck::Tuple<>,
+                                      hipFloatComplex,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Conjugate,
+                                      ck::tensor_operation::element_wise::ScaleComplex,
+                                      hipFloatComplex>());
+
+        // Scale cf32, conj(A) and conj(B)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipFloatComplex,
+                                      hipFloatComplex,
+                                      ck::Tuple<>,
+                                      hipFloatComplex,
+                                      ck::tensor_operation::element_wise::Conjugate,
+                                      ck::tensor_operation::element_wise::Conjugate,
+                                      ck::tensor_operation::element_wise::ScaleComplex,
+                                      hipFloatComplex>());
+
+        // Bilinear f32, sqrt(A)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<float>,
+                                      float,
+                                      ck::tensor_operation::element_wise::UnarySqrt,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      float>());
+
+        // Bilinear f32, sqrt(B)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<float>,
+                                      float,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::UnarySqrt,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      float>());
+
+        // Bilinear f32, sqrt(A) and sqrt(B)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      float,
+                                      float,
+                                      ck::Tuple<float>,
+                                      float,
+                                      ck::tensor_operation::element_wise::UnarySqrt,
+                                      ck::tensor_operation::element_wise::UnarySqrt,
+                                      ck::tensor_operation::element_wise::Bilinear,
+                                      float>());
+
+        // Bilinear cf32, conj(A)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipFloatComplex,
+                                      hipFloatComplex,
+                                      ck::Tuple<hipFloatComplex>,
+                                      hipFloatComplex,
+                                      ck::tensor_operation::element_wise::Conjugate,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::BilinearComplex,
+                                      hipFloatComplex>());
+
+        // Bilinear cf32, conj(B)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipFloatComplex,
+                                      hipFloatComplex,
+                                      ck::Tuple<hipFloatComplex>,
+                                      hipFloatComplex,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::Conjugate,
+                                      ck::tensor_operation::element_wise::BilinearComplex,
+                                      hipFloatComplex>());
+
+        // Bilinear cf32, conj(A) and conj(B)
+        registerSolutionFamily(
+            contractionSolutionFamily<6,
+                                      6,
+                                      6,
+                                      hipFloatComplex,
+                                      hipFloatComplex,
+                                      ck::Tuple<hipFloatComplex>,
+                                      hipFloatComplex,
+                                      ck::tensor_operation::element_wise::Conjugate,
+                                      ck::tensor_operation::element_wise::Conjugate,
+                                      ck::tensor_operation::element_wise::BilinearComplex,
+                                      hipFloatComplex>());
+    }
+
+    void BatchedContractionSolutionInstances::registerInstances()
+    {
+        // Register the batched solution families exactly once. Batched device ops
+        // carry MaxNumDimsG batch dimensions; unused ones are padded to length 1.
+
+        // Batched bilinear f32
+        registerSolutionFamily(
+            batchedContractionSolutionFamily<MaxNumDimsG,
+                                             6,
+                                             6,
+                                             6,
+                                             float,
+                                             float,
+                                             ck::Tuple<float>,
+                                             float,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::Bilinear>());
+
+        // Batched bilinear f64
+        registerSolutionFamily(
+            batchedContractionSolutionFamily<MaxNumDimsG,
+                                             6,
+                                             6,
+                                             6,
+                                             double,
+                                             double,
+                                             ck::Tuple<double>,
+                                             double,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::Bilinear>());
+
+        // Batched scale f32
+        registerSolutionFamily(
+            batchedContractionSolutionFamily<MaxNumDimsG,
+                                             6,
+                                             6,
+                                             6,
+                                             float,
+                                             float,
+                                             ck::Tuple<>,
+                                             float,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::Scale>());
+
+        // Batched scale f64
+        registerSolutionFamily(
+            batchedContractionSolutionFamily<MaxNumDimsG,
+                                             6,
+                                             6,
+                                             6,
+                                             double,
+                                             double,
+                                             ck::Tuple<>,
+                                             double,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::Scale>());
+    }
+
+    void GroupedContractionSolutionInstances::registerInstances()
+    {
+        // Register the grouped solution families exactly once
+
+        // Grouped bilinear f32
+        registerSolutionFamily(
+            groupedContractionSolutionFamily<6,
+                                             6,
+                                             6,
+                                             float,
+                                             float,
+                                             ck::Tuple<float>,
+                                             float,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::Bilinear>());
+
+        // Grouped bilinear f64
+        registerSolutionFamily(
+            groupedContractionSolutionFamily<6,
+                                             6,
+                                             6,
+                                             double,
+                                             double,
+                                             ck::Tuple<double>,
+                                             double,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::Bilinear>());
+
+        // Grouped scale f32
+        registerSolutionFamily(
+            groupedContractionSolutionFamily<6,
+                                             6,
+                                             6,
+                                             float,
+                                             float,
+                                             ck::Tuple<>,
+                                             float,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::Scale>());
+
+        // Grouped scale f64
+        registerSolutionFamily(
+            groupedContractionSolutionFamily<6,
+                                             6,
+                                             6,
+                                             double,
+                                             double,
+                                             ck::Tuple<>,
+                                             double,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::Scale>());
+    }
+} // namespace hiptensor
+
+#if HIPTENSOR_KERNEL_MODULES
+HIPTENSOR_KERNEL_MODULE_ENTRY void
+    hiptensorRegisterContractionKernels(hiptensor::ContractionSolutionInstances* instances)
+{
+    instances->registerInstances();
+}
+
+HIPTENSOR_KERNEL_MODULE_ENTRY void hiptensorRegisterBatchedContractionKernels(
+    hiptensor::BatchedContractionSolutionInstances* instances)
+{
+    instances->registerInstances();
+}
+
+HIPTENSOR_KERNEL_MODULE_ENTRY void hiptensorRegisterGroupedContractionKernels(
+    hiptensor::GroupedContractionSolutionInstances* instances)
+{
+    instances->registerInstances();
+}
+#endif // HIPTENSOR_KERNEL_MODULES
@@ -30,17 +30,21 @@
 // CK includes
 #include <contraction_bilinear.hpp>
 #include <contraction_scale.hpp>
+#include <device_batched_contraction_multiple_d.hpp>
 #include <device_contraction_multiple_d.hpp>
+#include <device_grouped_contraction_multiple_d.hpp>
 #include <element_wise_operation.hpp>
 
 // hiptensor includes
 #include "data_types.hpp"
 #include "device/device_element_wise_operation_complex.hpp"
+#include "device/device_element_wise_operation_epilogue.hpp"
 #include "meta_traits.hpp"
 
 #define MaxNumDimsM 6
 #define MaxNumDimsN 6
 #define MaxNumDimsK 6
+#define MaxNumDimsG 4
 
 namespace hiptensor
 {
@@ -73,6 +77,7 @@ namespace hiptensor
             || (std::is_same_v<CDEElementwiseOperation,
                                ck::tensor_operation::element_wise::BilinearComplex>)>>
     {
+        constexpr static ck::index_t DimsG = 0;
         constexpr static ck::index_t DimsM = NumDimsM;
         constexpr static ck::index_t DimsN = NumDimsN;
         constexpr static ck::index_t DimsK = NumDimsK;
@@ -128,6 +133,7 @@ namespace hiptensor
             || (std::is_same_v<CDEElementwiseOperation,
                                ck::tensor_operation::element_wise::ScaleComplex>)>>
     {
+        constexpr static ck::index_t DimsG = 0;
         constexpr static ck::index_t DimsM = NumDimsM;
         constexpr static ck::index_t DimsN = NumDimsN;
         constexpr static ck::index_t DimsK = NumDimsK;
@@ -146,6 +152,215 @@ namespace hiptensor
         using CDEOp        = CDEElementwiseOperation;
     };
 
+    // Partial specialize for contraction with an epilogue. D0 is C, of the type of E,
+    // and D1 the bias.
+    template <ck::index_t NumDimsM,
+              ck::index_t NumDimsN,
+              ck::index_t NumDimsK,
+              typename ADataType,
+              typename BDataType,
+              typename DDataType,
+              typename BiasDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename ComputeDataType>
+    struct MetaTraits<ck::tensor_operation::device::DeviceContractionMultipleD<
+        NumDimsM,
+        NumDimsN,
+        NumDimsK,
+        ADataType,
+        BDataType,
+        ck::Tuple<DDataType, BiasDataType>,
+        EDataType,
+        AElementwiseOperation,
+        BElementwiseOperation,
+        ck::tensor_operation::element_wise::Epilogue,
+        ComputeDataType>>
+    {
+        constexpr static ck::index_t DimsG = 0;
+        constexpr static ck::index_t DimsM = NumDimsM;
+        constexpr static ck::index_t DimsN = NumDimsN;
+        constexpr static ck::index_t DimsK = NumDimsK;
+        using ADataT
+            = std::conditional_t<std::is_same_v<ADataType, ck::bhalf_t>, hip_bfloat16, ADataType>;
+        using BDataT
+            = std::conditional_t<std::is_same_v<BDataType, ck::bhalf_t>, hip_bfloat16, BDataType>;
+        using DDataT
+            = std::conditional_t<std::is_same_v<DDataType, ck::bhalf_t>, hip_bfloat16, DDataType>;
+        using BiasDataT = BiasDataType;
+        using EDataT
+            = std::conditional_t<std::is_same_v<EDataType, ck::bhalf_t>, hip_bfloat16, EDataType>;
+        using ComputeDataT = std::conditional_t<std::is_same_v<ComputeDataType, ck::bhalf_t>,
+                                                hip_bfloat16,
+                                                ComputeDataType>;
+        using AOp          = AElementwiseOperation;
+        using BOp          = BElementwiseOperation;
+        using CDEOp        = ck::tensor_operation::element_wise::Epilogue;
+    };
+
+    // Partial specialize for batched Bilinear contraction
+    template <ck::index_t NumDimsG,
+              ck::index_t NumDimsM,
+              ck::index_t NumDimsN,
+              ck::index_t NumDimsK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    struct MetaTraits<
+        ck::tensor_operation::device::DeviceBatchedContractionMultipleD<NumDimsG,
+                                                                        NumDimsM,
+                                                                        NumDimsN,
+                                                                        NumDimsK,
+                                                                        ADataType,
+                                                                        BDataType,
+                                                                        ck::Tuple<DsDataType>,
+                                                                        EDataType,
+                                                                        AElementwiseOperation,
+                                                                        BElementwiseOperation,
+                                                                        CDEElementwiseOperation>,
+        std::enable_if_t<
+            std::is_same_v<CDEElementwiseOperation, ck::tensor_operation::element_wise::Bilinear>>>
+    {
+        constexpr static ck::index_t DimsG = NumDimsG;
+        constexpr static ck::index_t DimsM = NumDimsM;
+        constexpr static ck::index_t DimsN = NumDimsN;
+        constexpr static ck::index_t DimsK = NumDimsK;
+        using ADataT                       = ADataType;
+        using BDataT                       = BDataType;
+        using DDataT                       = DsDataType;
+        using EDataT                       = EDataType;
+        // Batched instances compute in the data type
+        using ComputeDataT = ADataType;
+        using AOp          = AElementwiseOperation;
+        using BOp          = BElementwiseOperation;
+        using CDEOp        = CDEElementwiseOperation;
+    };
+
+    // Partial specialize for batched Scale contraction
+    template <ck::index_t NumDimsG,
+              ck::index_t NumDimsM,
+              ck::index_t NumDimsN,
+              ck::index_t NumDimsK,
+              typename ADataType,
+              typename BDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    struct MetaTraits<
+        ck::tensor_operation::device::DeviceBatchedContractionMultipleD<NumDimsG,
+                                                                        NumDimsM,
+                                                                        NumDimsN,
+                                                                        NumDimsK,
+                                                                        ADataType,
+                                                                        BDataType,
+                                                                        ck::Tuple<>,
+                                                                        EDataType,
+                                                                        AElementwiseOperation,
+                                                                        BElementwiseOperation,
+                                                                        CDEElementwiseOperation>,
+        std::enable_if_t<
+            std::is_same_v<CDEElementwiseOperation, ck::tensor_operation::element_wise::Scale>>>
+    {
+        constexpr static ck::index_t DimsG = NumDimsG;
+        constexpr static ck::index_t DimsM = NumDimsM;
+        constexpr static ck::index_t DimsN = NumDimsN;
+        constexpr static ck::index_t DimsK = NumDimsK;
+        using ADataT                       = ADataType;
+        using BDataT                       = BDataType;
+        using DDataT                       = NoneType;
+        using EDataT                       = EDataType;
+        // Batched instances compute in the data type
+        using ComputeDataT = ADataType;
+        using AOp          = AElementwiseOperation;
+        using BOp          = BElementwiseOperation;
+        using CDEOp        = CDEElementwiseOperation;
+    };
+
+    // Partial specialize for grouped Bilinear contraction
+    template <ck::index_t NumDimsM,
+              ck::index_t NumDimsN,
+              ck::index_t NumDimsK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    struct MetaTraits<
+        ck::tensor_operation::device::DeviceGroupedContractionMultipleD<NumDimsM,
+                                                                        NumDimsN,
+                                                                        NumDimsK,
+                                                                        ADataType,
+                                                                        BDataType,
+                                                                        ck::Tuple<DsDataType>,
+                                                                        EDataType,
+                                                                        AElementwiseOperation,
+                                                                        BElementwiseOperation,
+                                                                        CDEElementwiseOperation>,
+        std::enable_if_t<
+            std::is_same_v<CDEElementwiseOperation, ck::tensor_operation::element_wise::Bilinear>>>
+    {
+        constexpr static ck::index_t DimsG = 0;
+        constexpr static ck::index_t DimsM = NumDimsM;
+        constexpr static ck::index_t DimsN = NumDimsN;
+        constexpr static ck::index_t DimsK = NumDimsK;
+        using ADataT                       = ADataType;
+        using BDataT                       = BDataType;
+        using DDataT                       = DsDataType;
+        using EDataT                       = EDataType;
+        // Grouped instances compute in the data type
+        using ComputeDataT = ADataType;
+        using AOp          = AElementwiseOperation;
+        using BOp          = BElementwiseOperation;
+        using CDEOp        = CDEElementwiseOperation;
+    };
+
+    // Partial specialize for grouped Scale contraction
+    template <ck::index_t NumDimsM,
+              ck::index_t NumDimsN,
+              ck::index_t NumDimsK,
+              typename ADataType,
+              typename BDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    struct MetaTraits<
+        ck::tensor_operation::device::DeviceGroupedContractionMultipleD<NumDimsM,
+                                                                        NumDimsN,
+                                                                        NumDimsK,
+                                                                        ADataType,
+                                                                        BDataType,
+                                                                        ck::Tuple<>,
+                                                                        EDataType,
+                                                                        AElementwiseOperation,
+                                                                        BElementwiseOperation,
+                                                                        CDEElementwiseOperation>,
+        std::enable_if_t<
+            std::is_same_v<CDEElementwiseOperation, ck::tensor_operation::element_wise::Scale>>>
+    {
+        constexpr static ck::index_t DimsG = 0;
+        constexpr static ck::index_t DimsM = NumDimsM;
+        constexpr static ck::index_t DimsN = NumDimsN;
+        constexpr static ck::index_t DimsK = NumDimsK;
+        using ADataT                       = ADataType;
+        using BDataT                       = BDataType;
+        using DDataT                       = NoneType;
+        using EDataT                       = EDataType;
+        // Grouped instances compute in the data type
+        using ComputeDataT = ADataType;
+        using AOp          = AElementwiseOperation;
+        using BOp          = BElementwiseOperation;
+        using CDEOp        = CDEElementwiseOperation;
+    };
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_CONTRACTION_META_TRAITS_HPP
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+
+#include "contraction_operand_view.hpp"
+
+namespace hiptensor
+{
+    bool contractionOperandView(ContractionOperandView*                  view,
+                                std::vector<std::size_t> const&          lengths,
+                                std::vector<std::size_t> const&          strides,
+                                std::vector<int32_t> const&              modes,
+                                std::vector<std::vector<int32_t>> const& otherModes)
+    {
+        ContractionOperandView result;
+        for(std::size_t i = 0; i < modes.size(); i++)
+        {
+            auto found = std::find(result.mModes.begin(), result.mModes.end(), modes[i]);
+            if(found == result.mModes.end())
+            {
+                result.mModes.push_back(modes[i]);
+                result.mLengths.push_back(lengths[i]);
+                result.mStrides.push_back(strides[i]);
+                continue;
+            }
+
+            auto index = std::distance(result.mModes.begin(), found);
+            if(result.mLengths[index] != lengths[i])
+            {
+                return false;
+            }
+            result.mStrides[index] += strides[i];
+            result.mHasRepeatedModes = true;
+        }
+
+        for(std::size_t i = 0; i < result.mModes.size(); i++)
+        {
+            if(std::any_of(otherModes.begin(), otherModes.end(), [&](auto const& other) {
+                   return std::find(other.begin(), other.end(), result.mModes[i]) != other.end();
+               }))
+            {
+                result.mKeptModes.push_back(result.mModes[i]);
+                result.mKeptLengths.push_back(result.mLengths[i]);
+            }
+        }
+
+        *view = std::move(result);
+        return true;
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_OPERAND_VIEW_HPP
+#define HIPTENSOR_CONTRACTION_OPERAND_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hiptensor
+{
+    // Input operand of a contraction as seen by the contraction kernels.
+    //
+    // Modes repeated in the operand select its diagonal: they are merged into one mode
+    // whose stride is the sum of their strides, so no data is moved. Modes of the
+    // operand found in no other tensor of the contraction are summed out before the
+    // contraction, by a pre-reduction of the diagonal view.
+    struct ContractionOperandView
+    {
+        // Diagonal view of the operand, each mode once in order of first appearance
+        std::vector<std::size_t> mLengths;
+        std::vector<std::size_t> mStrides;
+        std::vector<int32_t>     mModes;
+
+        // Modes of the view kept by the pre-reduction, in the order of the view, and
+        // their lengths
+        std::vector<int32_t>     mKeptModes;
+        std::vector<std::size_t> mKeptLengths;
+
+        bool mHasRepeatedModes = false;
+
+        bool needsPreReduction() const
+        {
+            return mKeptModes.size() != mModes.size();
+        }
+    };
+
+    // Builds the view of an operand, given the modes of the other tensors of the
+    // contraction. Returns false if a repeated mode has different lengths.
+    bool contractionOperandView(ContractionOperandView*                  view,
+                                std::vector<std::size_t> const&          lengths,
+                                std::vector<std::size_t> const&          strides,
+                                std::vector<int32_t> const&              modes,
+                                std::vector<std::vector<int32_t>> const& otherModes);
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_OPERAND_VIEW_HPP
@@ -27,69 +27,166 @@
 #ifndef HIPTENSOR_CONTRACTION_PACK_UTIL_HPP
 #define HIPTENSOR_CONTRACTION_PACK_UTIL_HPP
 
+#include <cmath>
+
+#include "contraction_types.hpp"
 #include "data_types.hpp"
+#include "hiptensor_options.hpp"
 #include "util.hpp"
 #include <hiptensor/hiptensor.hpp>
 
 namespace hiptensor
 {
+    // Position, in real elements from the base pointer, of the real and imaginary parts of
+    // complex element i of a tensor. Interleaved tensors store each element as a (real, imag)
+    // pair; planar tensors store the imaginary parts in a second plane, mImagOffset real
+    // elements past the real plane.
+    struct ComplexLayout
+    {
+        int64_t mScale      = 2;
+        int64_t mImagOffset = 1;
+
+        // A plane stride of 0 denotes an interleaved tensor
+        static ComplexLayout fromPlaneStride(std::size_t planeStride)
+        {
+            return planeStride == 0 ? ComplexLayout{}
+                                    : ComplexLayout{1, static_cast<int64_t>(planeStride)};
+        }
+
+        __host__ __device__ bool isPlanar() const
+        {
+            return mScale == 1;
+        }
+
+        __host__ __device__ int64_t real(int64_t i) const
+        {
+            return i * mScale;
+        }
+
+        __host__ __device__ int64_t imag(int64_t i) const
+        {
+            return i * mScale + mImagOffset;
+        }
+    };
+
+    // Implemented by the arguments of complex contraction device ops, so that the solution
+    // can hand them the plane strides of planar complex operands.
+    struct PlanarComplexArgument
+    {
+        virtual ~PlanarComplexArgument() = default;
+
+        // Plane strides of A, B, D and E, in real elements. Zero for interleaved operands.
+        // Set before the workspace is attached, as planar operands need no planes of it.
+        virtual void setPlaneStrides(PlaneStrides const& planeStrides) = 0;
+    };
+
+    // Stores complex element idx of E in the given layout
+    template <typename DataType>
+    __device__ inline void
+        storeComplex(DataType* e, ComplexLayout layout, int64_t idx, HIP_vector_type<DataType, 2> v)
+    {
+        if(layout.isPlanar())
+        {
+            e[layout.real(idx)] = v.x;
+            e[layout.imag(idx)] = v.y;
+        }
+        else
+        {
+            reinterpret_cast<HIP_vector_type<DataType, 2>*>(e)[idx] = v;
+        }
+    }
+
     /**
      * \brief This function performs multiply-accumulate of the form E = accum * alpha + D * beta
-     *
+     *        When mE_corr is not null (3M decomposition), it is subtracted from both
+     *        planes of the accumulator first. E is written in the given layout.
      */
     template <typename DataType>
-    __global__ void mfma(DataType*                     mE_real,
-                         DataType*                     mE_imag,
-                         DataType*                     mD_real,
-                         DataType*                     mD_imag,
-                         HIP_vector_type<DataType, 2>* mE_grid,
-                         HIP_vector_type<double, 2>    alpha,
-                         HIP_vector_type<double, 2>    beta,
-                         int                           length)
+    __global__ void mfma(DataType*                  mE_real,
+                         DataType*                  mE_imag,
+                         DataType const*            mE_corr,
+                         DataType const*            mD_real,
+                         DataType const*            mD_imag,
+                         DataType*                  mE_grid,
+                         ComplexLayout              layoutE,
+                         HIP_vector_type<double, 2> alpha,
+                         HIP_vector_type<double, 2> beta,
+                         int                        length)
     {
         int idx = threadIdx.x + blockIdx.x * blockDim.x;
 
         if(idx < length)
         {
+            auto accum_real = mE_real[idx];
+            auto accum_imag = mE_imag[idx];
+            if(mE_corr != nullptr)
+            {
+                accum_real -= mE_corr[idx];
+                accum_imag -= mE_corr[idx];
+            }
+
             if constexpr(std::is_same_v<DataType, float>)
             {
-                mE_grid[idx] = hipCaddf(hipCmulf(make_hipFloatComplex(mE_real[idx], mE_imag[idx]),
-                                                 hipComplexDoubleToFloat(alpha)),
-                                        hipCmulf(make_hipFloatComplex(mD_real[idx], mD_imag[idx]),
-                                                 hipComplexDoubleToFloat(beta)));
+                storeComplex(mE_grid,
+                             layoutE,
+                             idx,
+                             hipCaddf(hipCmulf(make_hipFloatComplex(accum_real, accum_imag),
+                                               hipComplexDoubleToFloat(alpha)),
+                                      hipCmulf(make_hipFloatComplex(mD_real[idx], mD_imag[idx]),
+                                               hipComplexDoubleToFloat(beta))));
             }
             else if constexpr(std::is_same_v<DataType, double>)
             {
-                mE_grid[idx]
-                    = hipCadd(hipCmul(make_hipDoubleComplex(mE_real[idx], mE_imag[idx]), alpha),
-                              hipCmul(make_hipDoubleComplex(mD_real[idx], mD_imag[idx]), beta));
+                storeComplex(
+                    mE_grid,
+                    layoutE,
+                    idx,
+                    hipCadd(hipCmul(make_hipDoubleComplex(accum_real, accum_imag), alpha),
+                            hipCmul(make_hipDoubleComplex(mD_real[idx], mD_imag[idx]), beta)));
             }
         }
     }
 
     /**
      * \brief This function performs multiply of the form C = accum * alpha
-     *
+     *        When mE_corr is not null (3M decomposition), it is subtracted from both
+     *        planes of the accumulator first. E is written in the given layout.
      */
     template <typename DataType>
-    __global__ void multiply(DataType*                     mE_real,
-                             DataType*                     mE_imag,
-                             HIP_vector_type<DataType, 2>* mE_grid,
-                             HIP_vector_type<double, 2>    alpha,
-                             int                           length)
+    __global__ void multiply(DataType*                  mE_real,
+                             DataType*                  mE_imag,
+                             DataType const*            mE_corr,
+                             DataType*                  mE_grid,
+                             ComplexLayout              layoutE,
+                             HIP_vector_type<double, 2> alpha,
+                             int                        length)
     {
         int idx = threadIdx.x + blockIdx.x * blockDim.x;
 
         if(idx < length)
         {
+            auto accum_real = mE_real[idx];
+            auto accum_imag = mE_imag[idx];
+            if(mE_corr != nullptr)
+            {
+                accum_real -= mE_corr[idx];
+                accum_imag -= mE_corr[idx];
+            }
+
             if constexpr(std::is_same_v<DataType, float>)
             {
-                mE_grid[idx] = hipCmulf(make_hipFloatComplex(mE_real[idx], mE_imag[idx]),
-                                        hipComplexDoubleToFloat(alpha));
+                storeComplex(mE_grid,
+                             layoutE,
+                             idx,
+                             hipCmulf(make_hipFloatComplex(accum_real, accum_imag),
+                                      hipComplexDoubleToFloat(alpha)));
             }
             else if constexpr(std::is_same_v<DataType, double>)
             {
-                mE_grid[idx] = hipCmul(make_hipDoubleComplex(mE_real[idx], mE_imag[idx]), alpha);
+                storeComplex(mE_grid,
+                             layoutE,
+                             idx,
+                             hipCmul(make_hipDoubleComplex(accum_real, accum_imag), alpha));
             }
         }
     }
@@ -97,10 +194,14 @@ namespace hiptensor
     /**
      * \brief This function unpacks structured data (hipFloatComplex / hipDoubleComplex)
      *        into non-structured data (float / double).
+     *        When out_sum is not null, real + imag is also written to it (3M decomposition).
      */
     template <typename InputType, typename OutputType>
-    __global__ void
-        unpack(const InputType* in, OutputType* out_real, OutputType* out_img, int length)
+    __global__ void unpack(const InputType* in,
+                           OutputType*      out_real,
+                           OutputType*      out_img,
+                           OutputType*      out_sum,
+                           int              length)
     {
         int idx = threadIdx.x + blockIdx.x * blockDim.x;
 
@@ -116,23 +217,112 @@ namespace hiptensor
                 out_real[idx] = hipCreal(in[idx]);
                 out_img[idx]  = hipCimag(in[idx]);
             }
+
+            if(out_sum != nullptr)
+            {
+                out_sum[idx] = out_real[idx] + out_img[idx];
+            }
         }
     }
 
-    struct DeviceDeleter
+    /**
+     * \brief This function sums the real and imaginary planes of planar complex data,
+     *        which need no unpacking (3M decomposition).
+     */
+    template <typename DataType>
+    __global__ void
+        sumPlanes(const DataType* in_real, const DataType* in_img, DataType* out_sum, int length)
     {
-        void operator()(void* ptr)
+        int idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+        if(idx < length)
         {
-            CHECK_HIP_ERROR(hipFree(ptr));
+            out_sum[idx] = in_real[idx] + in_img[idx];
         }
-    };
+    }
+
+    // Arithmetic intensity bounds (flop per byte of each real sub-contraction) selecting the
+    // complex contraction algorithm under ComplexAlgo_t::AUTO:
+    // - Below InterleavedMaxIntensity the problem is bandwidth-bound, and contracting the
+    //   interleaved operands directly saves the unpack and pack sweeps over memory.
+    // - From Gauss3MMinIntensity the problem is compute-bound, and the 3M decomposition
+    //   saves one of the four real contractions.
+    static constexpr double InterleavedMaxIntensity = 4.0;
+    static constexpr double Gauss3MMinIntensity     = 32.0;
+
+    // Chooses the algorithm of a complex contraction with the given element counts of
+    // A, B and E, and real element type T. Never returns ComplexAlgo_t::AUTO.
+    template <typename T>
+    ComplexAlgo_t selectComplexAlgo(int64_t elementsA, int64_t elementsB, int64_t elementsE)
+    {
+        auto algo = HiptensorOptions::instance()->complexAlgo();
+        if(algo != ComplexAlgo_t::AUTO)
+        {
+            return algo;
+        }
+
+        // (M * K) * (N * K) * (M * N) = (M * N * K)^2
+        auto mnk       = std::sqrt(static_cast<double>(elementsA) * static_cast<double>(elementsB)
+                                 * static_cast<double>(elementsE));
+        auto bytes     = static_cast<double>(sizeof(T)) * (elementsA + elementsB + elementsE);
+        auto intensity = 2.0 * mnk / bytes;
+
+        if(intensity < InterleavedMaxIntensity)
+        {
+            return ComplexAlgo_t::INTERLEAVED;
+        }
+        else if(intensity >= Gauss3MMinIntensity)
+        {
+            return ComplexAlgo_t::GAUSS_3M;
+        }
+        return ComplexAlgo_t::STANDARD_4M;
+    }
+
+    // Real and imaginary planes of decomposed complex tensors are carved from the
+    // contraction workspace, each starting on this boundary.
+    static constexpr size_t PlaneAlignment = 256u;
+
+    template <typename T>
+    constexpr size_t planeBytes(int64_t numElements)
+    {
+        return (numElements * sizeof(T) + PlaneAlignment - 1) / PlaneAlignment * PlaneAlignment;
+    }
 
+    // Returns the next plane of the workspace and advances the cursor past it.
+    // A null cursor (no workspace attached yet) yields null planes.
     template <typename T>
-    auto allocDevice(int64_t numElements)
+    T* carvePlane(char*& cursor, int64_t numElements)
     {
-        T* data;
-        CHECK_HIP_ERROR(hipMalloc(&data, numElements * sizeof(T)));
-        return std::unique_ptr<T, DeviceDeleter>(data, DeviceDeleter());
+        if(cursor == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto* plane = reinterpret_cast<T*>(cursor);
+        cursor += planeBytes<T>(numElements);
+        return plane;
+    }
+
+    // Points real and imag at the planes of a complex operand. Planar operands are used in
+    // place; interleaved operands get planes of the workspace to be unpacked into.
+    template <typename T>
+    void operandPlanes(T*&           real,
+                       T*&           imag,
+                       const void*   grid,
+                       ComplexLayout layout,
+                       char*&        cursor,
+                       int64_t       numElements)
+    {
+        if(layout.isPlanar())
+        {
+            real = const_cast<T*>(static_cast<const T*>(grid));
+            imag = real != nullptr ? real + layout.mImagOffset : nullptr;
+        }
+        else
+        {
+            real = carvePlane<T>(cursor, numElements);
+            imag = carvePlane<T>(cursor, numElements);
+        }
     }
 
 } // namespace hiptensor
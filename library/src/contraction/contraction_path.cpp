@@ -0,0 +1,436 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <bitset>
+#include <functional>
+#include <limits>
+#include <numeric>
+
+#include "contraction_path.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        using ModeSet = std::bitset<MaxNetworkModes>;
+
+        // Network with its modes numbered densely, and each tensor as a set of modes
+        struct Network
+        {
+            std::vector<int32_t> mLabels;
+            std::vector<double>  mExtents;
+            std::vector<ModeSet> mInputs;
+            ModeSet              mOutput;
+
+            double elements(ModeSet const& modes) const
+            {
+                double result = 1.0;
+                for(std::size_t i = 0; i < mLabels.size(); i++)
+                {
+                    if(modes.test(i))
+                    {
+                        result *= mExtents[i];
+                    }
+                }
+                return result;
+            }
+
+            // A multiply-add for every combination of the modes of both operands
+            double stepFlops(ModeSet const& lhs, ModeSet const& rhs) const
+            {
+                return 2.0 * elements(lhs | rhs);
+            }
+        };
+
+        // Appends a step to the path, with the modes of its result ordered as in its
+        // operands. The last step takes the order of the output.
+        void appendStep(ContractionPath*                         path,
+                        Network const&                           network,
+                        std::vector<std::vector<int32_t>> const& inputModes,
+                        std::vector<int32_t> const&              outputModes,
+                        std::array<int32_t, 2>                   operands,
+                        ModeSet const&                           lhs,
+                        ModeSet const&                           rhs,
+                        ModeSet const&                           result,
+                        bool                                     isLast)
+        {
+            auto modesOf = [&](int32_t operand) -> std::vector<int32_t> const& {
+                return operand < (int32_t)inputModes.size()
+                           ? inputModes[operand]
+                           : path->mSteps[operand - inputModes.size()].mModes;
+            };
+
+            ContractionPath::Step step;
+            step.mOperands = operands;
+            step.mFlops    = network.stepFlops(lhs, rhs);
+            step.mElements = network.elements(result);
+            if(isLast)
+            {
+                step.mModes = outputModes;
+            }
+            else
+            {
+                for(auto operand : operands)
+                {
+                    for(auto mode : modesOf(operand))
+                    {
+                        auto index = std::distance(
+                            network.mLabels.begin(),
+                            std::find(network.mLabels.begin(), network.mLabels.end(), mode));
+                        if(result.test(index)
+                           && std::find(step.mModes.begin(), step.mModes.end(), mode)
+                                  == step.mModes.end())
+                        {
+                            step.mModes.push_back(mode);
+                        }
+                    }
+                }
+            }
+
+            path->mFlops += step.mFlops;
+            path->mElements += isLast ? 0.0 : step.mElements;
+            path->mSteps.push_back(std::move(step));
+        }
+
+        void greedyPath(ContractionPath*                         path,
+                        Network const&                           network,
+                        std::vector<std::vector<int32_t>> const& inputModes,
+                        std::vector<int32_t> const&              outputModes)
+        {
+            // Operands left to contract
+            std::vector<std::pair<int32_t, ModeSet>> live;
+            for(std::size_t i = 0; i < network.mInputs.size(); i++)
+            {
+                live.emplace_back((int32_t)i, network.mInputs[i]);
+            }
+
+            auto nextOperand = (int32_t)network.mInputs.size();
+            while(live.size() > 1)
+            {
+                struct Candidate
+                {
+                    std::size_t mLhs;
+                    std::size_t mRhs;
+                    ModeSet     mResult;
+                    bool        mShared;
+                    double      mDelta;
+                    double      mFlops;
+                };
+
+                Candidate best{0, 0, {}, false, 0.0, 0.0};
+                bool      found = false;
+                for(std::size_t i = 0; i < live.size(); i++)
+                {
+                    for(std::size_t j = i + 1; j < live.size(); j++)
+                    {
+                        auto needed = network.mOutput;
+                        for(std::size_t k = 0; k < live.size(); k++)
+                        {
+                            if(k != i && k != j)
+                            {
+                                needed |= live[k].second;
+                            }
+                        }
+
+                        auto const& lhs = live[i].second;
+                        auto const& rhs = live[j].second;
+                        auto        result = (lhs | rhs) & needed;
+
+                        Candidate candidate{i,
+                                            j,
+                                            result,
+                                            (lhs & rhs).any(),
+                                            network.elements(result) - network.elements(lhs)
+                                                - network.elements(rhs),
+                                            network.stepFlops(lhs, rhs)};
+
+                        auto better = !found || (candidate.mShared && !best.mShared)
+                                      || (candidate.mShared == best.mShared
+                                          && (candidate.mDelta < best.mDelta
+                                              || (candidate.mDelta == best.mDelta
+                                                  && candidate.mFlops < best.mFlops)));
+                        if(better)
+                        {
+                            best  = candidate;
+                            found = true;
+                        }
+                    }
+                }
+
+                appendStep(path,
+                           network,
+                           inputModes,
+                           outputModes,
+                           {live[best.mLhs].first, live[best.mRhs].first},
+                           live[best.mLhs].second,
+                           live[best.mRhs].second,
+                           best.mResult,
+                           live.size() == 2);
+
+                live.erase(live.begin() + best.mRhs);
+                live.erase(live.begin() + best.mLhs);
+                live.emplace_back(nextOperand++, best.mResult);
+            }
+        }
+
+        void optimalPath(ContractionPath*                         path,
+                         Network const&                           network,
+                         std::vector<std::vector<int32_t>> const& inputModes,
+                         std::vector<int32_t> const&              outputModes)
+        {
+            auto count = network.mInputs.size();
+            auto full  = (uint32_t(1) << count) - 1u;
+
+            // Modes of the tensor contracted from each subset of inputs: those of its
+            // inputs that are still needed by the other inputs or the output
+            std::vector<ModeSet> unionModes(full + 1);
+            for(uint32_t subset = 1; subset <= full; subset++)
+            {
+                auto lowest        = subset & (~subset + 1u);
+                unionModes[subset] = unionModes[subset ^ lowest]
+                                     | network.mInputs[__builtin_ctz(lowest)];
+            }
+
+            std::vector<ModeSet> resultModes(full + 1);
+            std::vector<double>  resultElements(full + 1);
+            for(uint32_t subset = 1; subset <= full; subset++)
+            {
+                resultModes[subset]
+                    = unionModes[subset] & (unionModes[full ^ subset] | network.mOutput);
+                resultElements[subset] = network.elements(resultModes[subset]);
+            }
+
+            struct Cost
+            {
+                double   mFlops;
+                double   mElements;
+                uint32_t mSplit;
+            };
+
+            auto const infinity = std::numeric_limits<double>::infinity();
+            auto       best     = std::vector<Cost>(full + 1, Cost{infinity, infinity, 0u});
+            for(std::size_t i = 0; i < count; i++)
+            {
+                best[uint32_t(1) << i] = {0.0, 0.0, 0u};
+            }
+
+            for(uint32_t subset = 1; subset <= full; subset++)
+            {
+                auto lowest = subset & (~subset + 1u);
+                if(subset == lowest)
+                {
+                    continue;
+                }
+
+                // Each split is visited once, with the lowest input on the left
+                auto elements = subset == full ? 0.0 : resultElements[subset];
+                for(auto lhs = (subset - 1u) & subset; lhs > 0u; lhs = (lhs - 1u) & subset)
+                {
+                    if((lhs & lowest) == 0u)
+                    {
+                        continue;
+                    }
+
+                    auto rhs   = subset ^ lhs;
+                    auto flops = best[lhs].mFlops + best[rhs].mFlops
+                                 + network.stepFlops(resultModes[lhs], resultModes[rhs]);
+                    auto total = best[lhs].mElements + best[rhs].mElements + elements;
+                    if(flops < best[subset].mFlops
+                       || (flops == best[subset].mFlops && total < best[subset].mElements))
+                    {
+                        best[subset] = {flops, total, lhs};
+                    }
+                }
+            }
+
+            // Steps in post-order, so that operands precede the steps using them
+            std::function<int32_t(uint32_t)> emit = [&](uint32_t subset) -> int32_t {
+                if((subset & (subset - 1u)) == 0u)
+                {
+                    return __builtin_ctz(subset);
+                }
+
+                auto lhs = best[subset].mSplit;
+                auto rhs = subset ^ lhs;
+                auto l   = emit(lhs);
+                auto r   = emit(rhs);
+                appendStep(path,
+                           network,
+                           inputModes,
+                           outputModes,
+                           {l, r},
+                           resultModes[lhs],
+                           resultModes[rhs],
+                           resultModes[subset],
+                           subset == full);
+                return (int32_t)(count + path->mSteps.size() - 1);
+            };
+            emit(full);
+        }
+
+    } // namespace
+
+    bool findContractionPath(ContractionPath*                                path,
+                             std::vector<std::vector<int32_t>> const&        inputModes,
+                             std::vector<int32_t> const&                     outputModes,
+                             std::unordered_map<int32_t, std::size_t> const& extents,
+                             ContractionPathAlgo_t                           algo)
+    {
+        if(path == nullptr || inputModes.size() < 2)
+        {
+            return false;
+        }
+
+        Network network;
+        auto    indexOf = [&network, &extents](int32_t mode) -> int64_t {
+            auto it = std::find(network.mLabels.begin(), network.mLabels.end(), mode);
+            if(it != network.mLabels.end())
+            {
+                return std::distance(network.mLabels.begin(), it);
+            }
+            auto extent = extents.find(mode);
+            if(extent == extents.end() || network.mLabels.size() == MaxNetworkModes)
+            {
+                return -1;
+            }
+            network.mLabels.push_back(mode);
+            network.mExtents.push_back((double)extent->second);
+            return (int64_t)network.mLabels.size() - 1;
+        };
+
+        // Modes are unique within each tensor
+        auto toModeSet = [&indexOf](std::vector<int32_t> const& modes, ModeSet* result) {
+            for(auto mode : modes)
+            {
+                auto index = indexOf(mode);
+                if(index < 0 || result->test(index))
+                {
+                    return false;
+                }
+                result->set(index);
+            }
+            return true;
+        };
+
+        network.mInputs.resize(inputModes.size());
+        for(std::size_t i = 0; i < inputModes.size(); i++)
+        {
+            if(!toModeSet(inputModes[i], &network.mInputs[i]))
+            {
+                return false;
+            }
+        }
+        if(!toModeSet(outputModes, &network.mOutput))
+        {
+            return false;
+        }
+
+        // Every input mode is contracted with another input or kept in the output, and
+        // every output mode comes from an input
+        ModeSet once, several;
+        for(auto const& input : network.mInputs)
+        {
+            several |= once & input;
+            once |= input;
+        }
+        if((once & ~several & ~network.mOutput).any() || (network.mOutput & ~once).any())
+        {
+            return false;
+        }
+
+        *path = ContractionPath{};
+        if(algo == ContractionPathAlgo_t::OPTIMAL && inputModes.size() <= MaxOptimalPathInputs)
+        {
+            optimalPath(path, network, inputModes, outputModes);
+        }
+        else
+        {
+            greedyPath(path, network, inputModes, outputModes);
+        }
+        return true;
+    }
+
+    std::vector<std::size_t>
+        planBufferOffsets(std::vector<std::size_t> const&            sizes,
+                          std::vector<std::array<int32_t, 2>> const& lifetimes,
+                          std::size_t                                alignment,
+                          std::size_t*                               totalSize)
+    {
+        auto roundUp = [alignment](std::size_t bytes) {
+            return (bytes + alignment - 1u) / alignment * alignment;
+        };
+
+        // Larger buffers are placed first, so that smaller ones fill the gaps
+        std::vector<std::size_t> order(sizes.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&sizes](auto lhs, auto rhs) {
+            return sizes[lhs] > sizes[rhs];
+        });
+
+        std::vector<std::size_t> offsets(sizes.size(), 0u);
+        std::vector<std::size_t> placed;
+        std::size_t              total = 0u;
+        for(auto buffer : order)
+        {
+            // Placed buffers live at the same time, by offset
+            std::vector<std::size_t> conflicts;
+            for(auto other : placed)
+            {
+                if(lifetimes[buffer][0] <= lifetimes[other][1]
+                   && lifetimes[other][0] <= lifetimes[buffer][1])
+                {
+                    conflicts.push_back(other);
+                }
+            }
+            std::sort(conflicts.begin(), conflicts.end(), [&offsets](auto lhs, auto rhs) {
+                return offsets[lhs] < offsets[rhs];
+            });
+
+            // Lowest gap that fits the buffer
+            std::size_t offset = 0u;
+            for(auto other : conflicts)
+            {
+                if(offset + sizes[buffer] <= offsets[other])
+                {
+                    break;
+                }
+                offset = std::max(offset, roundUp(offsets[other] + sizes[other]));
+            }
+
+            offsets[buffer] = offset;
+            total           = std::max(total, offset + sizes[buffer]);
+            placed.push_back(buffer);
+        }
+
+        if(totalSize != nullptr)
+        {
+            *totalSize = roundUp(total);
+        }
+        return offsets;
+    }
+
+} // namespace hiptensor
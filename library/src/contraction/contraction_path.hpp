@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_PATH_HPP
+#define HIPTENSOR_CONTRACTION_PATH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace hiptensor
+{
+    // Pairwise contraction order of a tensor network.
+    //
+    // Operands are numbered as the inputs of the network, followed by the result of
+    // each step in path order. The result of the last step is the network output.
+    struct ContractionPath
+    {
+        struct Step
+        {
+            // Operands contracted by the step
+            std::array<int32_t, 2> mOperands;
+            // Modes of the result, in order of the first and then the second operand,
+            // or the output modes for the last step
+            std::vector<int32_t> mModes;
+            // Multiply-add count of the step, times two
+            double mFlops;
+            // Elements of the result
+            double mElements;
+        };
+
+        std::vector<Step> mSteps;
+
+        // Cost model: the FLOPs of all steps, then the elements of all intermediates
+        double mFlops    = 0.0;
+        double mElements = 0.0;
+    };
+
+    enum struct ContractionPathAlgo_t : int32_t
+    {
+        // Repeatedly contracts the pair of tensors whose result most reduces the
+        // elements held, preferring pairs that share modes
+        GREEDY,
+        // Dynamic programming over the subsets of inputs for the least FLOPs, then the
+        // fewest intermediate elements. Exponential in the number of inputs, so larger
+        // networks fall back to the greedy search.
+        OPTIMAL,
+    };
+
+    // Largest network searched by ContractionPathAlgo_t::OPTIMAL
+    static constexpr std::size_t MaxOptimalPathInputs = 12;
+
+    // Largest number of distinct modes of a network
+    static constexpr std::size_t MaxNetworkModes = 128;
+
+    // Finds a contraction path of the inputs into the output. Every mode of an input
+    // must be in another input or in the output, and every output mode in an input.
+    // Returns false if the network is not valid, or has more than MaxNetworkModes modes.
+    bool findContractionPath(ContractionPath*                                path,
+                             std::vector<std::vector<int32_t>> const&        inputModes,
+                             std::vector<int32_t> const&                     outputModes,
+                             std::unordered_map<int32_t, std::size_t> const& extents,
+                             ContractionPathAlgo_t                           algo);
+
+    // Places buffers in a single allocation, with buffers of disjoint lifetimes
+    // sharing memory. Lifetimes are the first and last step using a buffer, inclusive.
+    // Returns the offset of each buffer, aligned to the given alignment; totalSize is
+    // set to the size of the allocation.
+    std::vector<std::size_t>
+        planBufferOffsets(std::vector<std::size_t> const&            sizes,
+                          std::vector<std::array<int32_t, 2>> const& lifetimes,
+                          std::size_t                                alignment,
+                          std::size_t*                               totalSize);
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_PATH_HPP
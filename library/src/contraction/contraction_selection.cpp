@@ -24,14 +24,6 @@
  *
  *******************************************************************************/
 
-#ifndef CHECK_HIP_ALLOC
-#define CHECK_HIP_ALLOC(status)               \
-    if(status != hipSuccess)                  \
-    {                                         \
-        return HIPTENSOR_STATUS_ALLOC_FAILED; \
-    }
-#endif
-
 #include "contraction_selection.hpp"
 #include "hiptensor_options.hpp"
 #include "logger.hpp"
@@ -60,20 +52,28 @@ namespace hiptensor
                                       std::vector<std::size_t> const&          e_ms_ns_lengths,
                                       std::vector<std::size_t> const&          e_ms_ns_strides,
                                       std::vector<int32_t> const&              e_ms_ns_modes,
+                                      PlaneStrides const&                      planeStrides,
+                                      ContractionEpilogue const&               epilogue,
                                       hiptensorComputeType_t                   computeType,
-                                      const uint64_t                           workspaceSize)
+                                      const uint64_t                           workspaceSize,
+                                      WorkspaceArena&                          arena)
     {
         // Make sure that we calculate full element space incase strides are not packed.
-        auto sizeA = elementsFromLengths(a_ms_ks_lengths) * hipDataTypeSize(typeA);
-        auto sizeB = elementsFromLengths(b_ns_ks_lengths) * hipDataTypeSize(typeB);
+        // Planar complex tensors also span the distance to their imaginary plane.
+        auto tensorBytes = [](std::vector<std::size_t> const& lengths,
+                              hipDataType                     type,
+                              std::size_t                     planeStride) {
+            auto bytes = elementsFromLengths(lengths) * hipDataTypeSize(type);
+            return planeStride == 0 ? bytes : (bytes + planeStride * hipDataTypeSize(type)) / 2;
+        };
+        auto sizeA = tensorBytes(a_ms_ks_lengths, typeA, planeStrides[0]);
+        auto sizeB = tensorBytes(b_ns_ks_lengths, typeB, planeStrides[1]);
         auto sizeD = 0;
         if(typeD != NONE_TYPE)
         {
-            sizeD = elementsFromLengths(d_ms_ns_lengths) * hipDataTypeSize(typeD);
+            sizeD = tensorBytes(d_ms_ns_lengths, typeD, planeStrides[2]);
         }
-        auto sizeE = elementsFromLengths(e_ms_ns_lengths) * hipDataTypeSize(typeE);
-
-        void *A_d, *B_d, *D_d, *E_d, *wspace;
+        auto sizeE = tensorBytes(e_ms_ns_lengths, typeE, planeStrides[3]);
 
         /*
          * `alpha` and `beta` are void pointer. hiptensor uses readVal to load the value of alpha.
@@ -96,11 +96,18 @@ namespace hiptensor
             writeVal(&beta, computeType, ScalarData(computeType, 1.03));
         }
 
-        CHECK_HIP_ALLOC(hipMalloc(&A_d, sizeA));
-        CHECK_HIP_ALLOC(hipMalloc(&B_d, sizeB));
-        CHECK_HIP_ALLOC(hipMalloc(&D_d, sizeD));
-        CHECK_HIP_ALLOC(hipMalloc(&E_d, sizeE));
-        CHECK_HIP_ALLOC(hipMalloc(&wspace, workspaceSize));
+        // Scratch tensors come from the handle's arena and are given back, not freed,
+        // when selection completes. Candidates are timed on the null stream.
+        auto A_d    = arena.allocate(sizeA, nullptr);
+        auto B_d    = arena.allocate(sizeB, nullptr);
+        auto D_d    = arena.allocate(sizeD, nullptr);
+        auto E_d    = arena.allocate(sizeE, nullptr);
+        auto wspace = arena.allocate(workspaceSize, nullptr);
+        if(!A_d.get() || !B_d.get() || (sizeD && !D_d.get()) || !E_d.get()
+           || (workspaceSize && !wspace.get()))
+        {
+            return HIPTENSOR_STATUS_ALLOC_FAILED;
+        }
 
         std::string          best_op_name;
         ContractionSolution* bestSolution = nullptr;
@@ -115,11 +122,11 @@ namespace hiptensor
         for(auto* solution : candidates)
         {
             auto [errorCode, time] = (*solution)(&alpha,
-                                                 A_d,
-                                                 B_d,
+                                                 A_d.get(),
+                                                 B_d.get(),
                                                  &beta,
-                                                 D_d,
-                                                 E_d,
+                                                 D_d.get(),
+                                                 E_d.get(),
                                                  a_ms_ks_lengths,
                                                  a_ms_ks_strides,
                                                  a_ms_ks_modes,
@@ -132,7 +139,9 @@ namespace hiptensor
                                                  e_ms_ns_lengths,
                                                  e_ms_ns_strides,
                                                  e_ms_ns_modes,
-                                                 wspace,
+                                                 planeStrides,
+                                                 epilogue,
+                                                 wspace.get(),
                                                  workspaceSize,
                                                  StreamConfig{nullptr, true});
             if(errorCode == HIPTENSOR_STATUS_SUCCESS && time > 0)
@@ -177,12 +186,6 @@ namespace hiptensor
             }
         }
 
-        CHECK_HIP_ALLOC(hipFree(A_d));
-        CHECK_HIP_ALLOC(hipFree(B_d));
-        CHECK_HIP_ALLOC(hipFree(D_d));
-        CHECK_HIP_ALLOC(hipFree(E_d));
-        CHECK_HIP_ALLOC(hipFree(wspace));
-
         *winner = bestSolution;
 
         if(bestSolution == nullptr)
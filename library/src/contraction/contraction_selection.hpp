@@ -28,6 +28,7 @@
 #define HIPTENSOR_CONTRACTION_HEURISTICS_HPP
 
 #include "contraction_solution.hpp"
+#include "workspace_arena.hpp"
 #include <vector>
 
 namespace hiptensor
@@ -53,8 +54,11 @@ namespace hiptensor
                                       std::vector<std::size_t> const&          e_ms_ns_lengths,
                                       std::vector<std::size_t> const&          e_ms_ns_strides,
                                       std::vector<int32_t> const&              e_ms_ns_modes,
+                                      PlaneStrides const&                      planeStrides,
+                                      ContractionEpilogue const&               epilogue,
                                       hiptensorComputeType_t                   computeType,
-                                      const uint64_t                           workspaceSize);
+                                      const uint64_t                           workspaceSize,
+                                      WorkspaceArena&                          arena);
 
     template <typename A,
               typename B,
@@ -78,16 +78,18 @@ namespace hiptensor
             }
         }
 
-        assert(mOffset > 0 && nOffset > 0);
+        // Contractions without M modes (or N modes) are padded with unit modes of stride 1
         for(; mOffset < MaxNumDimsM; mOffset++)
         {
             normal_a_ms_ks_lengths[mOffset] = 1;
-            normal_a_ms_ks_strides[mOffset] = normal_a_ms_ks_strides[mOffset - 1];
+            normal_a_ms_ks_strides[mOffset]
+                = mOffset > 0 ? normal_a_ms_ks_strides[mOffset - 1] : std::size_t{1};
         }
         for(; nOffset < MaxNumDimsN; nOffset++)
         {
             normal_b_ns_ks_lengths[nOffset] = 1;
-            normal_b_ns_ks_strides[nOffset] = normal_b_ns_ks_strides[nOffset - 1];
+            normal_b_ns_ks_strides[nOffset]
+                = nOffset > 0 ? normal_b_ns_ks_strides[nOffset - 1] : std::size_t{1};
         }
 
         // reorder k in A, B - Do not check if A and B have same k here.
@@ -109,7 +111,7 @@ namespace hiptensor
             }
         }
 
-        assert(mOffset > 0 && nOffset > 0);
+        // Contractions without K modes (outer products) are padded in the same way
         for(; mOffset < MaxNumDimsM + MaxNumDimsK; mOffset++)
         {
             normal_a_ms_ks_lengths[mOffset] = 1;
@@ -143,7 +145,7 @@ namespace hiptensor
             else
             {
                 normal_e_ms_ns_lengths[i] = 1;
-                normal_e_ms_ns_strides[i] = normal_e_ms_ns_strides[i - 1];
+                normal_e_ms_ns_strides[i] = i > 0 ? normal_e_ms_ns_strides[i - 1] : std::size_t{1};
             }
         }
 
@@ -159,6 +161,124 @@ namespace hiptensor
         };
     }
 
+    std::array<std::vector<std::size_t>, 8>
+        normalizeBatchedTensorModes(std::vector<std::size_t> const& a_gs_ms_ks_lengths,
+                                    std::vector<std::size_t> const& a_gs_ms_ks_strides,
+                                    std::vector<int32_t> const&     a_gs_ms_ks_modes,
+                                    std::vector<std::size_t> const& b_gs_ns_ks_lengths,
+                                    std::vector<std::size_t> const& b_gs_ns_ks_strides,
+                                    std::vector<int32_t> const&     b_gs_ns_ks_modes,
+                                    std::vector<std::size_t> const& e_gs_ms_ns_lengths,
+                                    std::vector<std::size_t> const& e_gs_ms_ns_strides,
+                                    std::vector<int32_t> const&     e_gs_ms_ns_modes)
+    {
+        std::array<std::vector<std::size_t>, 6> gs;
+        std::array<std::vector<std::size_t>, 6> rest;
+        std::array<std::vector<int32_t>, 3>     restModes;
+
+        auto gModes      = batchModes(a_gs_ms_ks_modes, b_gs_ns_ks_modes, e_gs_ms_ns_modes);
+        auto isBatchMode = [&gModes](int32_t mode) {
+            return std::find(gModes.cbegin(), gModes.cend(), mode) != gModes.cend();
+        };
+
+        // Batch modes are ordered as in E
+        for(int i = 0; i < e_gs_ms_ns_modes.size(); i++)
+        {
+            if(isBatchMode(e_gs_ms_ns_modes[i]))
+            {
+                auto aOffset = std::distance(
+                    a_gs_ms_ks_modes.cbegin(),
+                    std::find(
+                        a_gs_ms_ks_modes.cbegin(), a_gs_ms_ks_modes.cend(), e_gs_ms_ns_modes[i]));
+                auto bOffset = std::distance(
+                    b_gs_ns_ks_modes.cbegin(),
+                    std::find(
+                        b_gs_ns_ks_modes.cbegin(), b_gs_ns_ks_modes.cend(), e_gs_ms_ns_modes[i]));
+                gs[0].push_back(a_gs_ms_ks_lengths[aOffset]);
+                gs[1].push_back(a_gs_ms_ks_strides[aOffset]);
+                gs[2].push_back(b_gs_ns_ks_lengths[bOffset]);
+                gs[3].push_back(b_gs_ns_ks_strides[bOffset]);
+                gs[4].push_back(e_gs_ms_ns_lengths[i]);
+                gs[5].push_back(e_gs_ms_ns_strides[i]);
+            }
+        }
+
+        for(int i = 0; i < a_gs_ms_ks_modes.size(); i++)
+        {
+            if(!isBatchMode(a_gs_ms_ks_modes[i]))
+            {
+                rest[0].push_back(a_gs_ms_ks_lengths[i]);
+                rest[1].push_back(a_gs_ms_ks_strides[i]);
+                restModes[0].push_back(a_gs_ms_ks_modes[i]);
+            }
+        }
+        for(int i = 0; i < b_gs_ns_ks_modes.size(); i++)
+        {
+            if(!isBatchMode(b_gs_ns_ks_modes[i]))
+            {
+                rest[2].push_back(b_gs_ns_ks_lengths[i]);
+                rest[3].push_back(b_gs_ns_ks_strides[i]);
+                restModes[1].push_back(b_gs_ns_ks_modes[i]);
+            }
+        }
+        for(int i = 0; i < e_gs_ms_ns_modes.size(); i++)
+        {
+            if(!isBatchMode(e_gs_ms_ns_modes[i]))
+            {
+                rest[4].push_back(e_gs_ms_ns_lengths[i]);
+                rest[5].push_back(e_gs_ms_ns_strides[i]);
+                restModes[2].push_back(e_gs_ms_ns_modes[i]);
+            }
+        }
+
+        // Too many batch modes for the kernels
+        if(gs[0].size() > MaxNumDimsG)
+        {
+            return {};
+        }
+
+        auto normal = normalizeTensorModes(rest[0],
+                                           rest[1],
+                                           restModes[0],
+                                           rest[2],
+                                           rest[3],
+                                           restModes[1],
+                                           rest[4],
+                                           rest[5],
+                                           restModes[2]);
+
+        // Pad the batch dimensions as the others, then prepend them to A, B, D and E
+        std::array<std::vector<std::size_t>, 8> result;
+        for(int tensor = 0; tensor < 4; tensor++)
+        {
+            auto const& lengths = gs[2 * std::min(tensor, 2)];
+            auto const& strides = gs[2 * std::min(tensor, 2) + 1];
+
+            result[2 * tensor]     = std::vector<std::size_t>(MaxNumDimsG, 1);
+            result[2 * tensor + 1] = std::vector<std::size_t>(MaxNumDimsG, 1);
+            for(int g = 0; g < MaxNumDimsG; g++)
+            {
+                if(g < lengths.size())
+                {
+                    result[2 * tensor][g]     = lengths[g];
+                    result[2 * tensor + 1][g] = strides[g];
+                }
+                else if(g > 0)
+                {
+                    result[2 * tensor + 1][g] = result[2 * tensor + 1][g - 1];
+                }
+            }
+
+            result[2 * tensor].insert(
+                result[2 * tensor].end(), normal[2 * tensor].begin(), normal[2 * tensor].end());
+            result[2 * tensor + 1].insert(result[2 * tensor + 1].end(),
+                                          normal[2 * tensor + 1].begin(),
+                                          normal[2 * tensor + 1].end());
+        }
+
+        return result;
+    }
+
     ContractionSolution::ContractionSolution(
         std::unique_ptr<ck::tensor_operation::device::BaseOperator>&& deviceOp,
         std::unique_ptr<ContractionSolutionParams>&&                  params)
@@ -169,7 +289,12 @@ namespace hiptensor
         , mValid(false)
         , mDeviceOp(std::move(deviceOp))
         , mParams(std::move(params))
+        , mRegistry(nullptr)
+        , mRegistryIndex(0u)
     {
+        // Convert CK uid string into binary once; it is queried on every registry lookup.
+        std::istringstream converter(mDeviceOp->GetTypeIdHashCode());
+        converter >> std::hex >> mUid;
     }
 
     ContractionSolution::ContractionSolution(ContractionSolution&& other)
@@ -182,6 +307,9 @@ namespace hiptensor
         , mParams(std::move(other.mParams))
         , mInvokerArgPtr(std::move(other.mInvokerArgPtr))
         , mInvokerPtr(std::move(other.mInvokerPtr))
+        , mUid(other.mUid)
+        , mRegistry(other.mRegistry)
+        , mRegistryIndex(other.mRegistryIndex)
     {
     }
 
@@ -200,32 +328,38 @@ namespace hiptensor
             mDeviceOp      = std::move(other.mDeviceOp);
             mInvokerArgPtr = std::move(other.mInvokerArgPtr);
             mInvokerPtr    = std::move(other.mInvokerPtr);
+
+            mUid           = other.mUid;
+            mRegistry      = other.mRegistry;
+            mRegistryIndex = other.mRegistryIndex;
         }
         return *this;
     }
 
     std::tuple<hiptensorStatus_t, float>
-        ContractionSolution::operator()(void const*              alpha,
-                                        void const*              A,
-                                        void const*              B,
-                                        void const*              beta,
-                                        void const*              D,
-                                        void*                    E,
-                                        std::vector<std::size_t> a_ms_ns_lengths,
-                                        std::vector<std::size_t> a_ms_ks_strides,
-                                        std::vector<int32_t>     a_ms_ks_modes,
-                                        std::vector<std::size_t> b_ns_ks_lengths,
-                                        std::vector<std::size_t> b_ns_ks_strides,
-                                        std::vector<int32_t>     b_ns_ks_modes,
-                                        std::vector<std::size_t> ds_ms_ns_lengths,
-                                        std::vector<std::size_t> ds_ms_ns_strides,
-                                        std::vector<int32_t>     ds_ms_ns_modes,
-                                        std::vector<std::size_t> e_ms_ns_lengths,
-                                        std::vector<std::size_t> e_ms_ns_strides,
-                                        std::vector<int32_t>     e_ms_ns_modes,
-                                        void*                    workspacePtr,
-                                        unsigned long            workspaceSize,
-                                        StreamConfig const&      streamConfig /*= StreamConfig{}*/)
+        ContractionSolution::operator()(void const*                alpha,
+                                        void const*                A,
+                                        void const*                B,
+                                        void const*                beta,
+                                        void const*                D,
+                                        void*                      E,
+                                        std::vector<std::size_t>   a_ms_ns_lengths,
+                                        std::vector<std::size_t>   a_ms_ks_strides,
+                                        std::vector<int32_t>       a_ms_ks_modes,
+                                        std::vector<std::size_t>   b_ns_ks_lengths,
+                                        std::vector<std::size_t>   b_ns_ks_strides,
+                                        std::vector<int32_t>       b_ns_ks_modes,
+                                        std::vector<std::size_t>   ds_ms_ns_lengths,
+                                        std::vector<std::size_t>   ds_ms_ns_strides,
+                                        std::vector<int32_t>       ds_ms_ns_modes,
+                                        std::vector<std::size_t>   e_ms_ns_lengths,
+                                        std::vector<std::size_t>   e_ms_ns_strides,
+                                        std::vector<int32_t>       e_ms_ns_modes,
+                                        PlaneStrides const&        planeStrides,
+                                        ContractionEpilogue const& epilogue,
+                                        void*                      workspacePtr,
+                                        unsigned long              workspaceSize,
+                                        StreamConfig const&        streamConfig)
     {
         if(!initArgs(alpha,
                      A,
@@ -245,6 +379,8 @@ namespace hiptensor
                      e_ms_ns_lengths,
                      e_ms_ns_strides,
                      e_ms_ns_modes,
+                     planeStrides,
+                     epilogue,
                      workspacePtr))
         {
             return {HIPTENSOR_STATUS_INTERNAL_ERROR, -1.0f};
@@ -273,11 +409,17 @@ namespace hiptensor
 
     size_t ContractionSolution::uid() const
     {
-        // Convert CK uid string into binary.
-        std::istringstream converter(mDeviceOp->GetTypeIdHashCode());
-        size_t             value;
-        converter >> std::hex >> value;
-        return value;
+        return mUid;
+    }
+
+    ContractionSolutionRegistry* ContractionSolution::registry() const
+    {
+        return mRegistry;
+    }
+
+    uint32_t ContractionSolution::registryIndex() const
+    {
+        return mRegistryIndex;
     }
 
     std::tuple<ck::index_t, ck::index_t, ck::index_t> ContractionSolution::problemDims() const
@@ -307,6 +449,11 @@ namespace hiptensor
         }
     }
 
+    bool ContractionSolution::isDegenerate() const
+    {
+        return dynamic_cast<DegenerateContractionDeviceOp const*>(mDeviceOp.get()) != nullptr;
+    }
+
     void ContractionSolution::resetArgs()
     {
         mM     = 0;
@@ -324,4 +471,37 @@ namespace hiptensor
     {
         mInvokerArgPtr.reset(nullptr);
     }
+
+    std::tuple<hiptensorStatus_t, float>
+        GroupedContractionSolution::runGrouped(void const*                          alpha,
+                                               void const*                          beta,
+                                               std::vector<ContractionGroup> const& groups,
+                                               void*                                workspacePtr,
+                                               unsigned long                        workspaceSize,
+                                               StreamConfig const&                  streamConfig)
+    {
+        if(!initGroupedArgs(alpha, beta, groups, workspacePtr))
+        {
+            return {HIPTENSOR_STATUS_INTERNAL_ERROR, -1.0f};
+        }
+
+        if(this->workspaceSize() > workspaceSize)
+        {
+            resetInvokerArgs();
+            return {HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE, -1.0f};
+        }
+        auto time = mInvokerPtr->Run(mInvokerArgPtr.get(), streamConfig);
+        resetInvokerArgs();
+
+        return {HIPTENSOR_STATUS_SUCCESS, time};
+    }
+
+    std::array<int32_t, 2> GroupedContractionSolution::blockTile() const
+    {
+        if(auto* tiled = dynamic_cast<BlockTiledDeviceOp const*>(mDeviceOp.get()))
+        {
+            return tiled->blockTile();
+        }
+        return {1, 1};
+    }
 } // namespace hiptensor
@@ -35,20 +35,28 @@
 // CK includes
 #include <contraction_bilinear.hpp>
 #include <contraction_scale.hpp>
+#include <device_batched_contraction_multiple_d.hpp>
 #include <device_contraction_multiple_d.hpp>
+#include <device_grouped_contraction_multiple_d.hpp>
 #include <element_wise_operation.hpp>
 
 #include "device/device_element_wise_operation_complex.hpp"
 
+#include "contraction_epilogue.hpp"
 #include "contraction_meta_traits.hpp"
 #include "contraction_solution_params.hpp"
 #include "performance.hpp"
 
 namespace hiptensor
 {
+    class ContractionSolutionRegistry;
+
     class ContractionSolution
     {
     public:
+        // Assigns the registry index
+        friend class ContractionSolutionRegistry;
+
         // Due to unique_ptr ownership of members,
         // ContractionSolutions should also be considered unique.
         // This means disabling default and copy ctor
@@ -65,48 +73,52 @@ namespace hiptensor
         ContractionSolution& operator=(ContractionSolution&& other);
 
         // Must specialize incoming arg handling
-        virtual bool initArgs(void const*              alpha,
-                              void const*              A,
-                              void const*              B,
-                              void const*              beta,
-                              void const*              D,
-                              void*                    E,
-                              std::vector<std::size_t> a_ms_ns_lengths,
-                              std::vector<std::size_t> a_ms_ks_strides,
-                              std::vector<int32_t>     a_ms_ks_modes,
-                              std::vector<std::size_t> b_ns_ks_lengths,
-                              std::vector<std::size_t> b_ns_ks_strides,
-                              std::vector<int32_t>     b_ns_ks_modes,
-                              std::vector<std::size_t> ds_ms_ns_lengths,
-                              std::vector<std::size_t> ds_ms_ns_strides,
-                              std::vector<int32_t>     ds_ms_ns_modes,
-                              std::vector<std::size_t> e_ms_ns_lengths,
-                              std::vector<std::size_t> e_ms_ns_strides,
-                              std::vector<int32_t>     e_ms_ns_modes,
-                              void*                    workspacePtr)
+        virtual bool initArgs(void const*                alpha,
+                              void const*                A,
+                              void const*                B,
+                              void const*                beta,
+                              void const*                D,
+                              void*                      E,
+                              std::vector<std::size_t>   a_ms_ns_lengths,
+                              std::vector<std::size_t>   a_ms_ks_strides,
+                              std::vector<int32_t>       a_ms_ks_modes,
+                              std::vector<std::size_t>   b_ns_ks_lengths,
+                              std::vector<std::size_t>   b_ns_ks_strides,
+                              std::vector<int32_t>       b_ns_ks_modes,
+                              std::vector<std::size_t>   ds_ms_ns_lengths,
+                              std::vector<std::size_t>   ds_ms_ns_strides,
+                              std::vector<int32_t>       ds_ms_ns_modes,
+                              std::vector<std::size_t>   e_ms_ns_lengths,
+                              std::vector<std::size_t>   e_ms_ns_strides,
+                              std::vector<int32_t>       e_ms_ns_modes,
+                              PlaneStrides const&        planeStrides,
+                              ContractionEpilogue const& epilogue,
+                              void*                      workspacePtr)
             = 0;
 
-        std::tuple<hiptensorStatus_t, float> operator()(void const*              alpha,
-                                                        void const*              A,
-                                                        void const*              B,
-                                                        void const*              beta,
-                                                        void const*              D,
-                                                        void*                    E,
-                                                        std::vector<std::size_t> a_ms_ns_lengths,
-                                                        std::vector<std::size_t> a_ms_ks_strides,
-                                                        std::vector<int32_t>     a_ms_ks_modes,
-                                                        std::vector<std::size_t> b_ns_ks_lengths,
-                                                        std::vector<std::size_t> b_ns_ks_strides,
-                                                        std::vector<int32_t>     b_ns_ks_modes,
-                                                        std::vector<std::size_t> ds_ms_ns_lengths,
-                                                        std::vector<std::size_t> ds_ms_ns_strides,
-                                                        std::vector<int32_t>     ds_ms_ns_modes,
-                                                        std::vector<std::size_t> e_ms_ns_lengths,
-                                                        std::vector<std::size_t> e_ms_ns_strides,
-                                                        std::vector<int32_t>     e_ms_ns_modes,
-                                                        void*                    workspacePtr,
-                                                        unsigned long            workspaceSize,
-                                                        StreamConfig const&      streamConfig
+        std::tuple<hiptensorStatus_t, float> operator()(void const*                alpha,
+                                                        void const*                A,
+                                                        void const*                B,
+                                                        void const*                beta,
+                                                        void const*                D,
+                                                        void*                      E,
+                                                        std::vector<std::size_t>   a_ms_ns_lengths,
+                                                        std::vector<std::size_t>   a_ms_ks_strides,
+                                                        std::vector<int32_t>       a_ms_ks_modes,
+                                                        std::vector<std::size_t>   b_ns_ks_lengths,
+                                                        std::vector<std::size_t>   b_ns_ks_strides,
+                                                        std::vector<int32_t>       b_ns_ks_modes,
+                                                        std::vector<std::size_t>   ds_ms_ns_lengths,
+                                                        std::vector<std::size_t>   ds_ms_ns_strides,
+                                                        std::vector<int32_t>       ds_ms_ns_modes,
+                                                        std::vector<std::size_t>   e_ms_ns_lengths,
+                                                        std::vector<std::size_t>   e_ms_ns_strides,
+                                                        std::vector<int32_t>       e_ms_ns_modes,
+                                                        PlaneStrides const&        planeStrides,
+                                                        ContractionEpilogue const& epilogue,
+                                                        void*                      workspacePtr,
+                                                        unsigned long              workspaceSize,
+                                                        StreamConfig const&        streamConfig
                                                         = StreamConfig{});
 
         /// Accessors
@@ -120,6 +132,10 @@ namespace hiptensor
         // Unique ID for the kernel
         size_t uid() const;
 
+        // Owning registry and dense index within it, if registered
+        ContractionSolutionRegistry* registry() const;
+        uint32_t                     registryIndex() const;
+
         // Problem dimensions
         std::tuple<ck::index_t, ck::index_t, ck::index_t> problemDims() const;
 
@@ -132,6 +148,9 @@ namespace hiptensor
         // Kernel's required workspace size
         size_t workspaceSize() const;
 
+        // Kernel is specialized for GEMV, outer product or dot contractions
+        bool isDegenerate() const;
+
         // Reset all arguments
         void resetArgs();
 
@@ -148,6 +167,57 @@ namespace hiptensor
         std::unique_ptr<ck::tensor_operation::device::BaseOperator> mDeviceOp;
         std::unique_ptr<ck::tensor_operation::device::BaseArgument> mInvokerArgPtr;
         std::unique_ptr<ck::tensor_operation::device::BaseInvoker>  mInvokerPtr;
+
+        // Cached kernel uid
+        size_t mUid;
+
+        // Registry index
+        ContractionSolutionRegistry* mRegistry;
+        uint32_t                     mRegistryIndex;
+    };
+
+    // Operands, lengths, strides and modes of one problem of a grouped contraction
+    struct ContractionGroup
+    {
+        void const*              mA;
+        void const*              mB;
+        void const*              mD;
+        void*                    mE;
+        std::vector<std::size_t> mALengths;
+        std::vector<std::size_t> mAStrides;
+        std::vector<int32_t>     mAModes;
+        std::vector<std::size_t> mBLengths;
+        std::vector<std::size_t> mBStrides;
+        std::vector<int32_t>     mBModes;
+        std::vector<std::size_t> mELengths;
+        std::vector<std::size_t> mEStrides;
+        std::vector<int32_t>     mEModes;
+    };
+
+    // Solutions that contract a group of problems of the same data types, with
+    // different extents, in a single launch. D is laid out as E in every group.
+    class GroupedContractionSolution : public ContractionSolution
+    {
+    public:
+        using ContractionSolution::ContractionSolution;
+
+        // Must specialize incoming arg handling
+        virtual bool initGroupedArgs(void const*                          alpha,
+                                     void const*                          beta,
+                                     std::vector<ContractionGroup> const& groups,
+                                     void*                                workspacePtr)
+            = 0;
+
+        std::tuple<hiptensorStatus_t, float>
+            runGrouped(void const*                          alpha,
+                       void const*                          beta,
+                       std::vector<ContractionGroup> const& groups,
+                       void*                                workspacePtr,
+                       unsigned long                        workspaceSize,
+                       StreamConfig const&                  streamConfig = StreamConfig{});
+
+        // M and N extents of the kernel's block tile, or {1, 1} if unknown
+        std::array<int32_t, 2> blockTile() const;
     };
 
     template <ck::index_t NumDimM,
@@ -163,6 +233,53 @@ namespace hiptensor
               typename ComputeDataType>
     std::vector<std::unique_ptr<hiptensor::ContractionSolution>> enumerateContractionSolutions();
 
+    // Solutions enumerated by one enumerateContractionSolutions instantiation.
+    // Params describe the query attributes shared by the whole family so that
+    // registries can defer instantiating device ops until they are queried.
+    struct ContractionSolutionFamily
+    {
+        std::unique_ptr<ContractionSolutionParams>                         mParams;
+        std::function<std::vector<std::unique_ptr<ContractionSolution>>()> mGenerate;
+    };
+
+    template <ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation,
+              typename ComputeDataType>
+    ContractionSolutionFamily contractionSolutionFamily();
+
+    template <ck::index_t NumDimG,
+              ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    ContractionSolutionFamily batchedContractionSolutionFamily();
+
+    template <ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    ContractionSolutionFamily groupedContractionSolutionFamily();
+
 } // namespace hiptensor
 
 #include "contraction_solution_impl.hpp"
@@ -30,7 +30,9 @@
 #include <algorithm>
 #include <numeric>
 
+#include "contraction_pack_util.hpp"
 #include "contraction_solution.hpp"
+#include "device/device_contraction_degenerate.hpp"
 #include "hash.hpp"
 
 namespace std
@@ -58,6 +60,34 @@ namespace hiptensor
                              std::vector<std::size_t> const& e_ms_ns_strides,
                              std::vector<int32_t> const&     e_ms_ns_modes);
 
+    // As normalizeTensorModes, with the batch modes of A, B and E leading each tensor and
+    // padded to MaxNumDimsG. Batch modes are those present in A, B and E. Returns empty
+    // vectors if there are more than MaxNumDimsG batch modes.
+    std::array<std::vector<std::size_t>, 8>
+        normalizeBatchedTensorModes(std::vector<std::size_t> const& a_gs_ms_ks_lengths,
+                                    std::vector<std::size_t> const& a_gs_ms_ks_strides,
+                                    std::vector<int32_t> const&     a_gs_ms_ks_modes,
+                                    std::vector<std::size_t> const& b_gs_ns_ks_lengths,
+                                    std::vector<std::size_t> const& b_gs_ns_ks_strides,
+                                    std::vector<int32_t> const&     b_gs_ns_ks_modes,
+                                    std::vector<std::size_t> const& e_gs_ms_ns_lengths,
+                                    std::vector<std::size_t> const& e_gs_ms_ns_strides,
+                                    std::vector<int32_t> const&     e_gs_ms_ns_modes);
+
+    // Hands the plane strides to arguments of complex device ops that take planar operands.
+    // Returns false if there are planar operands, but the argument cannot take them.
+    inline bool setArgPlaneStrides(ck::tensor_operation::device::BaseArgument* arg,
+                                   PlaneStrides const&                         planeStrides)
+    {
+        if(auto* planarArg = dynamic_cast<PlanarComplexArgument*>(arg))
+        {
+            planarArg->setPlaneStrides(planeStrides);
+            return true;
+        }
+        return std::all_of(
+            planeStrides.begin(), planeStrides.end(), [](std::size_t s) { return s == 0; });
+    }
+
     template <typename DeviceOp, typename Enabler = void>
     class ContractionSolutionImpl;
 
@@ -77,25 +107,27 @@ namespace hiptensor
         {
         }
 
-        bool initArgs(void const*              alpha,
-                      void const*              A,
-                      void const*              B,
-                      void const*              beta,
-                      void const*              D,
-                      void*                    E,
-                      std::vector<std::size_t> a_ms_ks_lengths,
-                      std::vector<std::size_t> a_ms_ks_strides,
-                      std::vector<int32_t>     a_ms_ks_modes,
-                      std::vector<std::size_t> b_ns_ks_lengths,
-                      std::vector<std::size_t> b_ns_ks_strides,
-                      std::vector<int32_t>     b_ns_ks_modes,
-                      std::vector<std::size_t> ds_ms_ns_lengths,
-                      std::vector<std::size_t> ds_ms_ns_strides,
-                      std::vector<int32_t>     ds_ms_ns_modes,
-                      std::vector<std::size_t> e_ms_ns_lengths,
-                      std::vector<std::size_t> e_ms_ns_strides,
-                      std::vector<int32_t>     e_ms_ns_modes,
-                      void*                    workspacePtr) override
+        bool initArgs(void const*                alpha,
+                      void const*                A,
+                      void const*                B,
+                      void const*                beta,
+                      void const*                D,
+                      void*                      E,
+                      std::vector<std::size_t>   a_ms_ks_lengths,
+                      std::vector<std::size_t>   a_ms_ks_strides,
+                      std::vector<int32_t>       a_ms_ks_modes,
+                      std::vector<std::size_t>   b_ns_ks_lengths,
+                      std::vector<std::size_t>   b_ns_ks_strides,
+                      std::vector<int32_t>       b_ns_ks_modes,
+                      std::vector<std::size_t>   ds_ms_ns_lengths,
+                      std::vector<std::size_t>   ds_ms_ns_strides,
+                      std::vector<int32_t>       ds_ms_ns_modes,
+                      std::vector<std::size_t>   e_ms_ns_lengths,
+                      std::vector<std::size_t>   e_ms_ns_strides,
+                      std::vector<int32_t>       e_ms_ns_modes,
+                      PlaneStrides const&        planeStrides,
+                      ContractionEpilogue const& epilogue,
+                      void*                      workspacePtr) override
         {
             using Base   = ContractionSolution;
             using Traits = MetaTraits<DeviceOp>;
@@ -103,6 +135,12 @@ namespace hiptensor
             // Clear out the previous arguments
             resetArgs();
 
+            // Batch modes are contracted by batched solutions
+            if(!batchModes(a_ms_ks_modes, b_ns_ks_modes, e_ms_ns_modes).empty())
+            {
+                return false;
+            }
+
             // Promote to derived class for necessary functions such as
             // MakeArgumentPointer and MakeInvokerPointer.
             auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
@@ -163,6 +201,14 @@ namespace hiptensor
                 typename Traits::BOp{},
                 typename Traits::CDEOp(alphaF, betaF)));
 
+            // Planar complex operands are addressed through their plane strides, which
+            // decide the workspace layout and so are set before it is attached
+            if(!setArgPlaneStrides(Base::mInvokerArgPtr.get(), planeStrides))
+            {
+                resetArgs();
+                return false;
+            }
+
             // Attach the workspace pointer
             deviceOp->SetWorkSpacePointer(Base::mInvokerArgPtr.get(), workspacePtr);
 
@@ -219,25 +265,27 @@ namespace hiptensor
         {
         }
 
-        bool initArgs(void const*              alpha,
-                      void const*              A,
-                      void const*              B,
-                      void const*              beta,
-                      void const*              D,
-                      void*                    E,
-                      std::vector<std::size_t> a_ms_ks_lengths,
-                      std::vector<std::size_t> a_ms_ks_strides,
-                      std::vector<int32_t>     a_ms_ks_modes,
-                      std::vector<std::size_t> b_ns_ks_lengths,
-                      std::vector<std::size_t> b_ns_ks_strides,
-                      std::vector<int32_t>     b_ns_ks_modes,
-                      std::vector<std::size_t> ds_ms_ns_lengths,
-                      std::vector<std::size_t> ds_ms_ns_strides,
-                      std::vector<int32_t>     ds_ms_ns_modes,
-                      std::vector<std::size_t> e_ms_ns_lengths,
-                      std::vector<std::size_t> e_ms_ns_strides,
-                      std::vector<int32_t>     e_ms_ns_modes,
-                      void*                    workspacePtr) override
+        bool initArgs(void const*                alpha,
+                      void const*                A,
+                      void const*                B,
+                      void const*                beta,
+                      void const*                D,
+                      void*                      E,
+                      std::vector<std::size_t>   a_ms_ks_lengths,
+                      std::vector<std::size_t>   a_ms_ks_strides,
+                      std::vector<int32_t>       a_ms_ks_modes,
+                      std::vector<std::size_t>   b_ns_ks_lengths,
+                      std::vector<std::size_t>   b_ns_ks_strides,
+                      std::vector<int32_t>       b_ns_ks_modes,
+                      std::vector<std::size_t>   ds_ms_ns_lengths,
+                      std::vector<std::size_t>   ds_ms_ns_strides,
+                      std::vector<int32_t>       ds_ms_ns_modes,
+                      std::vector<std::size_t>   e_ms_ns_lengths,
+                      std::vector<std::size_t>   e_ms_ns_strides,
+                      std::vector<int32_t>       e_ms_ns_modes,
+                      PlaneStrides const&        planeStrides,
+                      ContractionEpilogue const& epilogue,
+                      void*                      workspacePtr) override
         {
             using Base   = ContractionSolution;
             using Traits = MetaTraits<DeviceOp>;
@@ -245,6 +293,12 @@ namespace hiptensor
             // Clear previous data
             resetArgs();
 
+            // Batch modes are contracted by batched solutions
+            if(!batchModes(a_ms_ks_modes, b_ns_ks_modes, e_ms_ns_modes).empty())
+            {
+                return false;
+            }
+
             // Promote to derived class for necessary functions such as
             // MakeArgumentPointer and MakeInvokerPointer.
             auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
@@ -299,6 +353,14 @@ namespace hiptensor
                                                           typename Traits::BOp{},
                                                           typename Traits::CDEOp(alphaF)));
 
+            // Planar complex operands are addressed through their plane strides, which
+            // decide the workspace layout and so are set before it is attached
+            if(!setArgPlaneStrides(Base::mInvokerArgPtr.get(), planeStrides))
+            {
+                resetArgs();
+                return false;
+            }
+
             // Attach the workspace pointer
             deviceOp->SetWorkSpacePointer(Base::mInvokerArgPtr.get(), workspacePtr);
 
@@ -338,6 +400,379 @@ namespace hiptensor
         }
     };
 
+    // Contraction with an epilogue: bias, activation and conversion to the type of E are
+    // applied by the CDE op before E is stored. D0 is C, or E itself when there is no C,
+    // and D1 is the bias, broadcast by zero strides.
+    template <typename DeviceOp>
+    class ContractionSolutionImpl<
+        DeviceOp,
+        std::enable_if_t<std::is_same_v<typename MetaTraits<DeviceOp>::CDEOp,
+                                        ck::tensor_operation::element_wise::Epilogue>>>
+        : public ContractionSolution
+    {
+    public:
+        ContractionSolutionImpl(std::unique_ptr<DeviceOp>&& deviceOp)
+            : ContractionSolution(std::move(deviceOp),
+                                  std::make_unique<ContractionSolutionParamsImpl<DeviceOp>>())
+        {
+        }
+
+        bool initArgs(void const*                alpha,
+                      void const*                A,
+                      void const*                B,
+                      void const*                beta,
+                      void const*                D,
+                      void*                      E,
+                      std::vector<std::size_t>   a_ms_ks_lengths,
+                      std::vector<std::size_t>   a_ms_ks_strides,
+                      std::vector<int32_t>       a_ms_ks_modes,
+                      std::vector<std::size_t>   b_ns_ks_lengths,
+                      std::vector<std::size_t>   b_ns_ks_strides,
+                      std::vector<int32_t>       b_ns_ks_modes,
+                      std::vector<std::size_t>   ds_ms_ns_lengths,
+                      std::vector<std::size_t>   ds_ms_ns_strides,
+                      std::vector<int32_t>       ds_ms_ns_modes,
+                      std::vector<std::size_t>   e_ms_ns_lengths,
+                      std::vector<std::size_t>   e_ms_ns_strides,
+                      std::vector<int32_t>       e_ms_ns_modes,
+                      PlaneStrides const&        planeStrides,
+                      ContractionEpilogue const& epilogue,
+                      void*                      workspacePtr) override
+        {
+            using Base   = ContractionSolution;
+            using Traits = MetaTraits<DeviceOp>;
+
+            // Clear out the previous arguments
+            resetArgs();
+
+            // Batch modes are contracted by batched solutions
+            if(!batchModes(a_ms_ks_modes, b_ns_ks_modes, e_ms_ns_modes).empty())
+            {
+                return false;
+            }
+
+            // Promote to derived class for necessary functions such as
+            // MakeArgumentPointer and MakeInvokerPointer.
+            auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
+
+            float alphaF = 0.0f;
+            float betaF  = 0.0f;
+            if(alpha != nullptr)
+            {
+                alphaF = hiptensor::readVal<float>(
+                    alpha, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+            if(beta != nullptr && D != nullptr)
+            {
+                betaF = hiptensor::readVal<float>(
+                    beta, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+
+            // Without a bias, D1 is never read: any pointer with zero strides will do
+            auto biasStrides = epilogue.mBiasStrides;
+            if(!epilogue.hasBias() || biasStrides.size() != e_ms_ns_modes.size())
+            {
+                biasStrides.assign(e_ms_ns_modes.size(), 0);
+            }
+
+            auto [normal_a_ms_ks_lengths,
+                  normal_a_ms_ks_strides,
+                  normal_b_ns_ks_lengths,
+                  normal_b_ns_ks_strides,
+                  normal_ds_ms_ns_lengths,
+                  normal_ds_ms_ns_strides,
+                  normal_e_ms_ns_lengths,
+                  normal_e_ms_ns_strides]
+                = normalizeTensorModes(a_ms_ks_lengths,
+                                       a_ms_ks_strides,
+                                       a_ms_ks_modes,
+                                       b_ns_ks_lengths,
+                                       b_ns_ks_strides,
+                                       b_ns_ks_modes,
+                                       e_ms_ns_lengths,
+                                       e_ms_ns_strides,
+                                       e_ms_ns_modes);
+
+            // The bias strides follow the modes of E through the same normalization
+            auto normal_bias_ms_ns_strides = normalizeTensorModes(a_ms_ks_lengths,
+                                                                  a_ms_ks_strides,
+                                                                  a_ms_ks_modes,
+                                                                  b_ns_ks_lengths,
+                                                                  b_ns_ks_strides,
+                                                                  b_ns_ks_modes,
+                                                                  e_ms_ns_lengths,
+                                                                  biasStrides,
+                                                                  e_ms_ns_modes)[7];
+
+            // CK has its own format for indices...
+            auto toCKVec = [](std::vector<size_t> const& v) {
+                return std::vector<ck::index_t>(v.begin(), v.end());
+            };
+
+            // Initialize the argument pointer
+            Base::mInvokerArgPtr = std::move(deviceOp->MakeArgumentPointer(
+                A,
+                B,
+                std::array<const void*, 2>{D != nullptr ? D : E,
+                                           epilogue.hasBias() ? epilogue.mBias : A},
+                E,
+                toCKVec(normal_a_ms_ks_lengths),
+                toCKVec(normal_a_ms_ks_strides),
+                toCKVec(normal_b_ns_ks_lengths),
+                toCKVec(normal_b_ns_ks_strides),
+                std::array<std::vector<ck::index_t>, 2>{toCKVec(normal_ds_ms_ns_lengths),
+                                                        toCKVec(normal_ds_ms_ns_lengths)},
+                std::array<std::vector<ck::index_t>, 2>{toCKVec(normal_ds_ms_ns_strides),
+                                                        toCKVec(normal_bias_ms_ns_strides)},
+                toCKVec(normal_e_ms_ns_lengths),
+                toCKVec(normal_e_ms_ns_strides),
+                typename Traits::AOp{},
+                typename Traits::BOp{},
+                typename Traits::CDEOp(alphaF,
+                                       betaF,
+                                       epilogue.mActivation,
+                                       epilogue.mLower,
+                                       epilogue.mUpper,
+                                       epilogue.hasBias())));
+
+            // Epilogue families are real: planar operands are not supported
+            if(!setArgPlaneStrides(Base::mInvokerArgPtr.get(), planeStrides))
+            {
+                resetArgs();
+                return false;
+            }
+
+            // Attach the workspace pointer
+            deviceOp->SetWorkSpacePointer(Base::mInvokerArgPtr.get(), workspacePtr);
+
+            // Initialize the invoker
+            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
+
+            // Fill problem metrics
+            Base::mM = std::accumulate(normal_a_ms_ks_lengths.begin(),
+                                       normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
+                                       ck::index_t{1},
+                                       std::multiplies<ck::index_t>{});
+
+            Base::mN = std::accumulate(normal_b_ns_ks_lengths.begin(),
+                                       normal_b_ns_ks_lengths.begin() + MaxNumDimsN,
+                                       ck::index_t{1},
+                                       std::multiplies<ck::index_t>{});
+
+            Base::mK = std::accumulate(normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
+                                       normal_a_ms_ks_lengths.end(),
+                                       ck::index_t{1},
+                                       std::multiplies<ck::index_t>{});
+
+            // Byte count. C is only read with a non-zero beta.
+            Base::mBytes = sizeof(typename Traits::ADataT) * Base::mM * Base::mK
+                           + sizeof(typename Traits::BDataT) * Base::mK * Base::mN
+                           + sizeof(typename Traits::EDataT) * Base::mM * Base::mN;
+            if(betaF != 0.0f)
+            {
+                Base::mBytes += sizeof(typename Traits::DDataT) * Base::mM * Base::mN;
+            }
+
+            // Arg test
+            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
+
+            if(!Base::mValid)
+            {
+                resetArgs();
+            }
+
+            return Base::mValid;
+        }
+    };
+
+    // Batched contraction over the batch modes of A, B and E in a single launch. Takes
+    // the same arguments as the other solutions; the batch modes are found from the modes.
+    template <typename DeviceOp>
+    class BatchedContractionSolutionImpl : public ContractionSolution
+    {
+    public:
+        BatchedContractionSolutionImpl(std::unique_ptr<DeviceOp>&& deviceOp)
+            : ContractionSolution(std::move(deviceOp),
+                                  std::make_unique<ContractionSolutionParamsImpl<DeviceOp>>())
+        {
+        }
+
+        bool initArgs(void const*                alpha,
+                      void const*                A,
+                      void const*                B,
+                      void const*                beta,
+                      void const*                D,
+                      void*                      E,
+                      std::vector<std::size_t>   a_gs_ms_ks_lengths,
+                      std::vector<std::size_t>   a_gs_ms_ks_strides,
+                      std::vector<int32_t>       a_gs_ms_ks_modes,
+                      std::vector<std::size_t>   b_gs_ns_ks_lengths,
+                      std::vector<std::size_t>   b_gs_ns_ks_strides,
+                      std::vector<int32_t>       b_gs_ns_ks_modes,
+                      std::vector<std::size_t>   ds_gs_ms_ns_lengths,
+                      std::vector<std::size_t>   ds_gs_ms_ns_strides,
+                      std::vector<int32_t>       ds_gs_ms_ns_modes,
+                      std::vector<std::size_t>   e_gs_ms_ns_lengths,
+                      std::vector<std::size_t>   e_gs_ms_ns_strides,
+                      std::vector<int32_t>       e_gs_ms_ns_modes,
+                      PlaneStrides const&        planeStrides,
+                      ContractionEpilogue const& epilogue,
+                      void*                      workspacePtr) override
+        {
+            using Base   = ContractionSolution;
+            using Traits = MetaTraits<DeviceOp>;
+
+            constexpr bool IsBilinear = !std::is_same_v<typename Traits::DDataT, NoneType>;
+
+            // Clear out the previous arguments
+            resetArgs();
+
+            // Promote to derived class for necessary functions such as
+            // MakeArgumentPointer and MakeInvokerPointer.
+            auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
+
+            ScalarData alphaF;
+            ScalarData betaF;
+
+            if(alpha != nullptr)
+            {
+                alphaF = hiptensor::readVal<ScalarData>(
+                    alpha, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+            if(beta != nullptr)
+            {
+                betaF = hiptensor::readVal<ScalarData>(
+                    beta, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+
+            auto [normal_a_gs_ms_ks_lengths,
+                  normal_a_gs_ms_ks_strides,
+                  normal_b_gs_ns_ks_lengths,
+                  normal_b_gs_ns_ks_strides,
+                  normal_ds_gs_ms_ns_lengths,
+                  normal_ds_gs_ms_ns_strides,
+                  normal_e_gs_ms_ns_lengths,
+                  normal_e_gs_ms_ns_strides]
+                = normalizeBatchedTensorModes(a_gs_ms_ks_lengths,
+                                              a_gs_ms_ks_strides,
+                                              a_gs_ms_ks_modes,
+                                              b_gs_ns_ks_lengths,
+                                              b_gs_ns_ks_strides,
+                                              b_gs_ns_ks_modes,
+                                              e_gs_ms_ns_lengths,
+                                              e_gs_ms_ns_strides,
+                                              e_gs_ms_ns_modes);
+
+            if(normal_a_gs_ms_ks_lengths.empty())
+            {
+                return false;
+            }
+
+            // CK has its own format for indices...
+            auto toCKVec = [](std::vector<size_t> const& v) {
+                return std::vector<ck::index_t>(v.begin(), v.end());
+            };
+
+            // Initialize the argument pointer
+            if constexpr(IsBilinear)
+            {
+                Base::mInvokerArgPtr = std::move(deviceOp->MakeArgumentPointer(
+                    A,
+                    B,
+                    std::array<const void*, 1>{D},
+                    E,
+                    toCKVec(normal_a_gs_ms_ks_lengths),
+                    toCKVec(normal_a_gs_ms_ks_strides),
+                    toCKVec(normal_b_gs_ns_ks_lengths),
+                    toCKVec(normal_b_gs_ns_ks_strides),
+                    std::array<std::vector<ck::index_t>, 1>{toCKVec(normal_ds_gs_ms_ns_lengths)},
+                    std::array<std::vector<ck::index_t>, 1>{toCKVec(normal_ds_gs_ms_ns_strides)},
+                    toCKVec(normal_e_gs_ms_ns_lengths),
+                    toCKVec(normal_e_gs_ms_ns_strides),
+                    typename Traits::AOp{},
+                    typename Traits::BOp{},
+                    typename Traits::CDEOp(alphaF, betaF)));
+            }
+            else
+            {
+                Base::mInvokerArgPtr = std::move(
+                    deviceOp->MakeArgumentPointer(A,
+                                                  B,
+                                                  std::array<const void*, 0>{},
+                                                  E,
+                                                  toCKVec(normal_a_gs_ms_ks_lengths),
+                                                  toCKVec(normal_a_gs_ms_ks_strides),
+                                                  toCKVec(normal_b_gs_ns_ks_lengths),
+                                                  toCKVec(normal_b_gs_ns_ks_strides),
+                                                  std::array<std::vector<ck::index_t>, 0>{},
+                                                  std::array<std::vector<ck::index_t>, 0>{},
+                                                  toCKVec(normal_e_gs_ms_ns_lengths),
+                                                  toCKVec(normal_e_gs_ms_ns_strides),
+                                                  typename Traits::AOp{},
+                                                  typename Traits::BOp{},
+                                                  typename Traits::CDEOp(alphaF)));
+            }
+
+            // Batched kernels only take interleaved operands
+            if(!setArgPlaneStrides(Base::mInvokerArgPtr.get(), planeStrides))
+            {
+                resetArgs();
+                return false;
+            }
+
+            // Attach the workspace pointer
+            deviceOp->SetWorkSpacePointer(Base::mInvokerArgPtr.get(), workspacePtr);
+
+            // Initialize the invoker
+            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
+
+            // Fill problem metrics. Batches are folded into M.
+            auto dimsBegin = [](std::vector<std::size_t> const& lengths, int offset) {
+                return lengths.begin() + MaxNumDimsG + offset;
+            };
+
+            auto batchCount = std::accumulate(normal_e_gs_ms_ns_lengths.begin(),
+                                              normal_e_gs_ms_ns_lengths.begin() + MaxNumDimsG,
+                                              ck::index_t{1},
+                                              std::multiplies<ck::index_t>{});
+
+            Base::mM = batchCount
+                       * std::accumulate(dimsBegin(normal_a_gs_ms_ks_lengths, 0),
+                                         dimsBegin(normal_a_gs_ms_ks_lengths, MaxNumDimsM),
+                                         ck::index_t{1},
+                                         std::multiplies<ck::index_t>{});
+
+            Base::mN = std::accumulate(dimsBegin(normal_b_gs_ns_ks_lengths, 0),
+                                       dimsBegin(normal_b_gs_ns_ks_lengths, MaxNumDimsN),
+                                       ck::index_t{1},
+                                       std::multiplies<ck::index_t>{});
+
+            Base::mK = std::accumulate(dimsBegin(normal_a_gs_ms_ks_lengths, MaxNumDimsM),
+                                       normal_a_gs_ms_ks_lengths.end(),
+                                       ck::index_t{1},
+                                       std::multiplies<ck::index_t>{});
+
+            // Byte count
+            Base::mBytes = sizeof(typename Traits::ADataT) * Base::mM * Base::mK
+                           + sizeof(typename Traits::BDataT) * batchCount * Base::mK * Base::mN
+                           + sizeof(typename Traits::EDataT) * Base::mM * Base::mN;
+            if constexpr(IsBilinear)
+            {
+                Base::mBytes += sizeof(typename Traits::DDataT) * Base::mM * Base::mN;
+            }
+
+            // Arg test
+            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
+
+            if(!Base::mValid)
+            {
+                resetArgs();
+            }
+
+            return Base::mValid;
+        }
+    };
+
     template <ck::index_t NumDimM,
               ck::index_t NumDimN,
               ck::index_t NumDimK,
@@ -367,15 +802,462 @@ namespace hiptensor
         using Factory
             = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<ContractionOp>;
 
+        using DegenerateOp = ck::tensor_operation::device::DeviceContractionMultipleD_Degenerate<
+            NumDimM,
+            NumDimN,
+            NumDimK,
+            ADataType,
+            BDataType,
+            DsDataType,
+            EDataType,
+            AElementwiseOperation,
+            BElementwiseOperation,
+            CDEElementwiseOperation,
+            ComputeDataType>;
+
         std::vector<std::unique_ptr<ContractionSolution>> result;
         for(auto& opPtr : Factory::GetInstances())
         {
             result.push_back(
                 std::make_unique<ContractionSolutionImpl<ContractionOp>>(std::move(opPtr)));
         }
+
+        // GEMV, outer product and dot contractions of real types
+        if constexpr(DegenerateOp::IsSupportedInstance())
+        {
+            result.push_back(std::make_unique<ContractionSolutionImpl<ContractionOp>>(
+                std::make_unique<DegenerateOp>()));
+        }
+        return result;
+    }
+
+    template <ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation,
+              typename ComputeDataType = ADataType>
+    ContractionSolutionFamily contractionSolutionFamily()
+    {
+        using ContractionOp
+            = ck::tensor_operation::device::DeviceContractionMultipleD<NumDimM,
+                                                                       NumDimN,
+                                                                       NumDimK,
+                                                                       ADataType,
+                                                                       BDataType,
+                                                                       DsDataType,
+                                                                       EDataType,
+                                                                       AElementwiseOperation,
+                                                                       BElementwiseOperation,
+                                                                       CDEElementwiseOperation,
+                                                                       ComputeDataType>;
+
+        // Params only depend on the op type, no device op is constructed here
+        return {std::make_unique<ContractionSolutionParamsImpl<ContractionOp>>(),
+                &enumerateContractionSolutions<NumDimM,
+                                               NumDimN,
+                                               NumDimK,
+                                               ADataType,
+                                               BDataType,
+                                               DsDataType,
+                                               EDataType,
+                                               AElementwiseOperation,
+                                               BElementwiseOperation,
+                                               CDEElementwiseOperation,
+                                               ComputeDataType>};
+    }
+
+    template <ck::index_t NumDimG,
+              ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    std::vector<std::unique_ptr<hiptensor::ContractionSolution>>
+        enumerateBatchedContractionSolutions()
+    {
+        using ContractionOp = ck::tensor_operation::device::DeviceBatchedContractionMultipleD<
+            NumDimG,
+            NumDimM,
+            NumDimN,
+            NumDimK,
+            ADataType,
+            BDataType,
+            DsDataType,
+            EDataType,
+            AElementwiseOperation,
+            BElementwiseOperation,
+            CDEElementwiseOperation>;
+
+        using Factory
+            = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<ContractionOp>;
+
+        std::vector<std::unique_ptr<ContractionSolution>> result;
+        for(auto& opPtr : Factory::GetInstances())
+        {
+            result.push_back(
+                std::make_unique<BatchedContractionSolutionImpl<ContractionOp>>(std::move(opPtr)));
+        }
+        return result;
+    }
+
+    template <ck::index_t NumDimG,
+              ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    ContractionSolutionFamily batchedContractionSolutionFamily()
+    {
+        using ContractionOp = ck::tensor_operation::device::DeviceBatchedContractionMultipleD<
+            NumDimG,
+            NumDimM,
+            NumDimN,
+            NumDimK,
+            ADataType,
+            BDataType,
+            DsDataType,
+            EDataType,
+            AElementwiseOperation,
+            BElementwiseOperation,
+            CDEElementwiseOperation>;
+
+        // Params only depend on the op type, no device op is constructed here
+        return {std::make_unique<ContractionSolutionParamsImpl<ContractionOp>>(),
+                &enumerateBatchedContractionSolutions<NumDimG,
+                                                      NumDimM,
+                                                      NumDimN,
+                                                      NumDimK,
+                                                      ADataType,
+                                                      BDataType,
+                                                      DsDataType,
+                                                      EDataType,
+                                                      AElementwiseOperation,
+                                                      BElementwiseOperation,
+                                                      CDEElementwiseOperation>};
+    }
+
+    template <typename DeviceOp>
+    class GroupedContractionSolutionImpl : public GroupedContractionSolution
+    {
+    public:
+        GroupedContractionSolutionImpl(std::unique_ptr<DeviceOp>&& deviceOp)
+            : GroupedContractionSolution(
+                std::move(deviceOp), std::make_unique<ContractionSolutionParamsImpl<DeviceOp>>())
+        {
+        }
+
+        // A single problem is a group of one
+        bool initArgs(void const*                alpha,
+                      void const*                A,
+                      void const*                B,
+                      void const*                beta,
+                      void const*                D,
+                      void*                      E,
+                      std::vector<std::size_t>   a_ms_ks_lengths,
+                      std::vector<std::size_t>   a_ms_ks_strides,
+                      std::vector<int32_t>       a_ms_ks_modes,
+                      std::vector<std::size_t>   b_ns_ks_lengths,
+                      std::vector<std::size_t>   b_ns_ks_strides,
+                      std::vector<int32_t>       b_ns_ks_modes,
+                      std::vector<std::size_t>   ds_ms_ns_lengths,
+                      std::vector<std::size_t>   ds_ms_ns_strides,
+                      std::vector<int32_t>       ds_ms_ns_modes,
+                      std::vector<std::size_t>   e_ms_ns_lengths,
+                      std::vector<std::size_t>   e_ms_ns_strides,
+                      std::vector<int32_t>       e_ms_ns_modes,
+                      PlaneStrides const&        planeStrides,
+                      ContractionEpilogue const& epilogue,
+                      void*                      workspacePtr) override
+        {
+            // Grouped kernels only take interleaved operands
+            if(std::any_of(planeStrides.begin(), planeStrides.end(), [](std::size_t s) {
+                   return s != 0;
+               }))
+            {
+                resetArgs();
+                return false;
+            }
+
+            return initGroupedArgs(alpha,
+                                   beta,
+                                   {ContractionGroup{A,
+                                                     B,
+                                                     D,
+                                                     E,
+                                                     std::move(a_ms_ks_lengths),
+                                                     std::move(a_ms_ks_strides),
+                                                     std::move(a_ms_ks_modes),
+                                                     std::move(b_ns_ks_lengths),
+                                                     std::move(b_ns_ks_strides),
+                                                     std::move(b_ns_ks_modes),
+                                                     std::move(e_ms_ns_lengths),
+                                                     std::move(e_ms_ns_strides),
+                                                     std::move(e_ms_ns_modes)}},
+                                   workspacePtr);
+        }
+
+        bool initGroupedArgs(void const*                          alpha,
+                             void const*                          beta,
+                             std::vector<ContractionGroup> const& groups,
+                             void*                                workspacePtr) override
+        {
+            using Base   = ContractionSolution;
+            using Traits = MetaTraits<DeviceOp>;
+
+            constexpr bool        IsBilinear = !std::is_same_v<typename Traits::DDataT, NoneType>;
+            constexpr ck::index_t NumDTensor = IsBilinear ? 1 : 0;
+
+            // Clear out the previous arguments
+            resetArgs();
+
+            // Promote to derived class for necessary functions such as
+            // MakeArgumentPointer and MakeInvokerPointer.
+            auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
+
+            ScalarData alphaF;
+            ScalarData betaF;
+
+            if(alpha != nullptr)
+            {
+                alphaF = hiptensor::readVal<ScalarData>(
+                    alpha, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+            if(beta != nullptr)
+            {
+                betaF = hiptensor::readVal<ScalarData>(
+                    beta, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+
+            // CK has its own format for indices...
+            auto toCKVec = [](std::vector<size_t> const& v) {
+                return std::vector<ck::index_t>(v.begin(), v.end());
+            };
+
+            auto product = [](auto begin, auto end) {
+                return std::accumulate(begin, end, int64_t{1}, std::multiplies<int64_t>{});
+            };
+
+            std::vector<const void*>                         aPtrs;
+            std::vector<const void*>                         bPtrs;
+            std::vector<std::array<const void*, NumDTensor>> dsPtrs;
+            std::vector<void*>                               ePtrs;
+            std::vector<ck::tensor_operation::device::ContractionDesc<NumDTensor>> descs;
+
+            int64_t totalM = 0, totalMN = 0, totalMNK = 0, totalBytes = 0;
+            for(auto const& group : groups)
+            {
+                if(!batchModes(group.mAModes, group.mBModes, group.mEModes).empty())
+                {
+                    return false;
+                }
+
+                auto [normal_a_ms_ks_lengths,
+                      normal_a_ms_ks_strides,
+                      normal_b_ns_ks_lengths,
+                      normal_b_ns_ks_strides,
+                      normal_ds_ms_ns_lengths,
+                      normal_ds_ms_ns_strides,
+                      normal_e_ms_ns_lengths,
+                      normal_e_ms_ns_strides]
+                    = normalizeTensorModes(group.mALengths,
+                                           group.mAStrides,
+                                           group.mAModes,
+                                           group.mBLengths,
+                                           group.mBStrides,
+                                           group.mBModes,
+                                           group.mELengths,
+                                           group.mEStrides,
+                                           group.mEModes);
+
+                ck::tensor_operation::device::ContractionDesc<NumDTensor> desc;
+                desc.a_ms_ks_lengths = toCKVec(normal_a_ms_ks_lengths);
+                desc.a_ms_ks_strides = toCKVec(normal_a_ms_ks_strides);
+                desc.b_ns_ks_lengths = toCKVec(normal_b_ns_ks_lengths);
+                desc.b_ns_ks_strides = toCKVec(normal_b_ns_ks_strides);
+                desc.e_ms_ns_lengths = toCKVec(normal_e_ms_ns_lengths);
+                desc.e_ms_ns_strides = toCKVec(normal_e_ms_ns_strides);
+                if constexpr(IsBilinear)
+                {
+                    desc.ds_ms_ns_lengths = {toCKVec(normal_ds_ms_ns_lengths)};
+                    desc.ds_ms_ns_strides = {toCKVec(normal_ds_ms_ns_strides)};
+                    dsPtrs.push_back({group.mD});
+                }
+                else
+                {
+                    dsPtrs.push_back({});
+                }
+
+                aPtrs.push_back(group.mA);
+                bPtrs.push_back(group.mB);
+                ePtrs.push_back(group.mE);
+                descs.push_back(std::move(desc));
+
+                auto m = product(normal_a_ms_ks_lengths.begin(),
+                                 normal_a_ms_ks_lengths.begin() + MaxNumDimsM);
+                auto n = product(normal_b_ns_ks_lengths.begin(),
+                                 normal_b_ns_ks_lengths.begin() + MaxNumDimsN);
+                auto k = product(normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
+                                 normal_a_ms_ks_lengths.end());
+
+                totalM += m;
+                totalMN += m * n;
+                totalMNK += m * n * k;
+                totalBytes += sizeof(typename Traits::ADataT) * m * k
+                              + sizeof(typename Traits::BDataT) * k * n
+                              + sizeof(typename Traits::EDataT) * m * n;
+                if constexpr(IsBilinear)
+                {
+                    totalBytes += sizeof(typename Traits::DDataT) * m * n;
+                }
+            }
+
+            if(groups.empty() || totalMN == 0)
+            {
+                return false;
+            }
+
+            // Initialize the argument pointer
+            if constexpr(IsBilinear)
+            {
+                Base::mInvokerArgPtr = std::move(
+                    deviceOp->MakeArgumentPointer(aPtrs,
+                                                  bPtrs,
+                                                  dsPtrs,
+                                                  ePtrs,
+                                                  descs,
+                                                  typename Traits::AOp{},
+                                                  typename Traits::BOp{},
+                                                  typename Traits::CDEOp(alphaF, betaF)));
+            }
+            else
+            {
+                Base::mInvokerArgPtr = std::move(
+                    deviceOp->MakeArgumentPointer(aPtrs,
+                                                  bPtrs,
+                                                  dsPtrs,
+                                                  ePtrs,
+                                                  descs,
+                                                  typename Traits::AOp{},
+                                                  typename Traits::BOp{},
+                                                  typename Traits::CDEOp(alphaF)));
+            }
+
+            // Attach the workspace pointer, which holds the kernel arguments of the groups
+            deviceOp->SetWorkSpacePointer(Base::mInvokerArgPtr.get(), workspacePtr);
+
+            // Initialize the invoker
+            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
+
+            // Fill problem metrics. Dimensions are averaged over the groups so that
+            // 2 * m * n * k is the flop count of the whole group.
+            Base::mM     = totalM;
+            Base::mN     = totalMN / totalM;
+            Base::mK     = totalMNK / totalMN;
+            Base::mBytes = totalBytes;
+
+            // Arg test
+            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
+
+            if(!Base::mValid)
+            {
+                resetArgs();
+            }
+
+            return Base::mValid;
+        }
+    };
+
+    template <ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    std::vector<std::unique_ptr<hiptensor::ContractionSolution>>
+        enumerateGroupedContractionSolutions()
+    {
+        using ContractionOp = ck::tensor_operation::device::DeviceGroupedContractionMultipleD<
+            NumDimM,
+            NumDimN,
+            NumDimK,
+            ADataType,
+            BDataType,
+            DsDataType,
+            EDataType,
+            AElementwiseOperation,
+            BElementwiseOperation,
+            CDEElementwiseOperation>;
+
+        using Factory
+            = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<ContractionOp>;
+
+        std::vector<std::unique_ptr<ContractionSolution>> result;
+        for(auto& opPtr : Factory::GetInstances())
+        {
+            result.push_back(
+                std::make_unique<GroupedContractionSolutionImpl<ContractionOp>>(std::move(opPtr)));
+        }
         return result;
     }
 
+    template <ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename DsDataType,
+              typename EDataType,
+              typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CDEElementwiseOperation>
+    ContractionSolutionFamily groupedContractionSolutionFamily()
+    {
+        using ContractionOp = ck::tensor_operation::device::DeviceGroupedContractionMultipleD<
+            NumDimM,
+            NumDimN,
+            NumDimK,
+            ADataType,
+            BDataType,
+            DsDataType,
+            EDataType,
+            AElementwiseOperation,
+            BElementwiseOperation,
+            CDEElementwiseOperation>;
+
+        // Params only depend on the op type, no device op is constructed here
+        return {std::make_unique<ContractionSolutionParamsImpl<ContractionOp>>(),
+                &enumerateGroupedContractionSolutions<NumDimM,
+                                                      NumDimN,
+                                                      NumDimK,
+                                                      ADataType,
+                                                      BDataType,
+                                                      DsDataType,
+                                                      EDataType,
+                                                      AElementwiseOperation,
+                                                      BElementwiseOperation,
+                                                      CDEElementwiseOperation>};
+    }
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_CONTRACTION_SOLUTION_IMPL_HPP
@@ -26,259 +26,23 @@
 
 #include "contraction_solution_instances.hpp"
 #include "contraction_solution.hpp"
-
-// Ensure access to
-#include "device/hiptensor_contraction_bilinear_instances.hpp"
-#include "device/hiptensor_contraction_scale_instances.hpp"
+#include "kernel_modules.hpp"
 
 namespace hiptensor
 {
     ContractionSolutionInstances::ContractionSolutionInstances()
     {
-        // Register all the solutions exactly once
-
-        // Bilinear bf16
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          ck::bhalf_t,
-                                          ck::bhalf_t,
-                                          ck::Tuple<ck::bhalf_t>,
-                                          ck::bhalf_t,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Bilinear,
-                                          float>());
-
-        // Bilinear f16
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          ck::half_t,
-                                          ck::half_t,
-                                          ck::Tuple<ck::half_t>,
-                                          ck::half_t,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Bilinear,
-                                          float>());
-
-        // Bilinear f32
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          float,
-                                          float,
-                                          ck::Tuple<float>,
-                                          float,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Bilinear,
-                                          float>());
-
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          float,
-                                          float,
-                                          ck::Tuple<float>,
-                                          float,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Bilinear,
-                                          ck::half_t>());
-
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          float,
-                                          float,
-                                          ck::Tuple<float>,
-                                          float,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Bilinear,
-                                          ck::bhalf_t>());
-
-        // Bilinear complex f32
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          hipFloatComplex,
-                                          hipFloatComplex,
-                                          ck::Tuple<hipFloatComplex>,
-                                          hipFloatComplex,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::BilinearComplex,
-                                          hipFloatComplex>());
-
-        // Bilinear f64
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          double,
-                                          double,
-                                          ck::Tuple<double>,
-                                          double,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Bilinear,
-                                          float>());
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          double,
-                                          double,
-                                          ck::Tuple<double>,
-                                          double,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Bilinear,
-                                          double>());
-
-        // Bilinear complex f64
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          hipDoubleComplex,
-                                          hipDoubleComplex,
-                                          ck::Tuple<hipDoubleComplex>,
-                                          hipDoubleComplex,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::BilinearComplex,
-                                          hipDoubleComplex>());
-
-        // Scale bf16
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          ck::bhalf_t,
-                                          ck::bhalf_t,
-                                          ck::Tuple<>,
-                                          ck::bhalf_t,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Scale,
-                                          float>());
-
-        // Scale f16
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          ck::half_t,
-                                          ck::half_t,
-                                          ck::Tuple<>,
-                                          ck::half_t,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Scale,
-                                          float>());
-
-        // Scale f32
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          float,
-                                          float,
-                                          ck::Tuple<>,
-                                          float,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Scale,
-                                          float>());
-
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          float,
-                                          float,
-                                          ck::Tuple<>,
-                                          float,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Scale,
-                                          ck::half_t>());
-
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          float,
-                                          float,
-                                          ck::Tuple<>,
-                                          float,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Scale,
-                                          ck::bhalf_t>());
-
-        // scale complex f32
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          hipFloatComplex,
-                                          hipFloatComplex,
-                                          ck::Tuple<>,
-                                          hipFloatComplex,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::ScaleComplex,
-                                          hipFloatComplex>());
-
-        // Scale f64
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          double,
-                                          double,
-                                          ck::Tuple<>,
-                                          double,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Scale,
-                                          float>());
-
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          double,
-                                          double,
-                                          ck::Tuple<>,
-                                          double,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::Scale,
-                                          double>());
-        // scale complex f64
-        registerSolutions(
-            enumerateContractionSolutions<6,
-                                          6,
-                                          6,
-                                          hipDoubleComplex,
-                                          hipDoubleComplex,
-                                          ck::Tuple<>,
-                                          hipDoubleComplex,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::ScaleComplex,
-                                          hipDoubleComplex>());
+#if HIPTENSOR_KERNEL_MODULES
+        // Device instances are packaged in a separate module, opened on first use.
+        // If the module is missing the registry stays empty.
+        using EntryT = void (*)(ContractionSolutionInstances*);
+        if(auto entry = reinterpret_cast<EntryT>(KernelModules::instance()->symbol(
+               KernelModule_t::CONTRACTION, "hiptensorRegisterContractionKernels")))
+        {
+            entry(this);
+        }
+#else
+        registerInstances();
+#endif // HIPTENSOR_KERNEL_MODULES
     }
 } // namespace hiptensor
@@ -30,8 +30,18 @@
 #include <memory>
 
 #include "contraction_solution_registry.hpp"
+#include "kernel_modules.hpp"
 #include "singleton.hpp"
 
+namespace hiptensor
+{
+    class ContractionSolutionInstances;
+}
+
+// Entry point of the contraction kernel module: registers the device instance families
+HIPTENSOR_KERNEL_MODULE_ENTRY void
+    hiptensorRegisterContractionKernels(hiptensor::ContractionSolutionInstances* instances);
+
 namespace hiptensor
 {
     class ContractionSolutionInstances : public ContractionSolutionRegistry,
@@ -42,9 +52,15 @@ namespace hiptensor
         friend std::unique_ptr<ContractionSolutionInstances>
             std::make_unique<ContractionSolutionInstances>();
 
+        // Registers the device instance families from within the kernel module
+        friend void ::hiptensorRegisterContractionKernels(ContractionSolutionInstances* instances);
+
         ~ContractionSolutionInstances() = default;
 
     private:
+        // Registers every device instance family exactly once
+        void registerInstances();
+
         // Singleton: only one instance
         ContractionSolutionInstances();
         ContractionSolutionInstances(ContractionSolutionInstances const&)            = delete;
@@ -43,7 +43,8 @@ namespace hiptensor
         ContractionSolutionParams& operator=(ContractionSolutionParams const&) = default;
         ContractionSolutionParams& operator=(ContractionSolutionParams&&)      = default;
 
-        // Map tensor dimensions
+        // Map tensor dimensions. Batch dimensions are zero for non-batched solutions.
+        virtual int32_t dimsG() const = 0;
         virtual int32_t dimsM() const = 0;
         virtual int32_t dimsN() const = 0;
         virtual int32_t dimsK() const = 0;
@@ -39,7 +39,8 @@ namespace std
     {
         size_t operator()(hiptensor::ContractionSolutionParams const& s) const noexcept
         {
-            return hiptensor::Hash{}(s.dimsM(),
+            return hiptensor::Hash{}(s.dimsG(),
+                                     s.dimsM(),
                                      s.dimsN(),
                                      s.dimsK(),
                                      s.typeCompute(),
@@ -68,6 +69,11 @@ namespace hiptensor
 
         using MetaTraitsT = MetaTraits<DeviceOp>;
 
+        int32_t dimsG() const override
+        {
+            return MetaTraitsT::DimsG;
+        }
+
         int32_t dimsM() const override
         {
             return MetaTraitsT::DimsM;
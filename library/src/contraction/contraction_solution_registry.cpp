@@ -35,8 +35,9 @@ namespace hiptensor
 
     // @cond
     ContractionSolutionRegistry::Query::Query(Query const& other)
-        : mAllSolutions(other.mAllSolutions)
-        , mSolutionHash(other.mSolutionHash)
+        : mRegistry(other.mRegistry)
+        , mAll(other.mAll)
+        , mSelection(other.mSelection)
     {
     }
 
@@ -45,8 +46,11 @@ namespace hiptensor
     {
         if(&other != this)
         {
-            mAllSolutions = other.mAllSolutions;
-            mSolutionHash = other.mSolutionHash;
+            mRegistry         = other.mRegistry;
+            mAll              = other.mAll;
+            mSelection        = other.mSelection;
+            mSolutionMapValid = false;
+            mSolutionMap.clear();
         }
 
         return *this;
@@ -65,15 +69,8 @@ namespace hiptensor
                                                   ContractionOpId_t      opCDE,
                                                   hiptensorComputeType_t typeCompute) const
     {
-        auto solutionHash = hashSolution(
-            dimsM, dimsN, dimsK, typeA, typeB, typeC, typeD, opA, opB, opCDE, typeCompute);
-
-        if(auto solutions = mSolutionHash.find(solutionHash); solutions != mSolutionHash.end())
-        {
-            return Query(mSolutionHash.at(solutionHash));
-        }
-
-        return Query();
+        return query(hashSolution(
+            dimsM, dimsN, dimsK, typeA, typeB, typeC, typeD, opA, opB, opCDE, typeCompute));
     }
 
     ContractionSolutionRegistry::Query
@@ -105,41 +102,102 @@ namespace hiptensor
         return query(hashContractionOps(opCDE));
     }
 
+    ContractionSolutionRegistry::Query
+        ContractionSolutionRegistry::Query::query(ContractionOpId_t      opCDE,
+                                                  hipDataType            typeA,
+                                                  hipDataType            typeB,
+                                                  hipDataType            typeC,
+                                                  hipDataType            typeD,
+                                                  hiptensorComputeType_t typeCompute) const
+    {
+        return query(hashFamily(opCDE, typeA, typeB, typeC, typeD, typeCompute));
+    }
+
     ContractionSolutionRegistry::Query
         ContractionSolutionRegistry::Query::operator||(Query const& other) const
     {
+        if(mRegistry == nullptr || other.mAll)
+        {
+            return other;
+        }
+
         auto newQuery = *this;
-        newQuery.addSolutions(other.mAllSolutions);
+        if(!mAll && other.mRegistry == mRegistry)
+        {
+            newQuery.mSelection |= other.mSelection;
+        }
         return newQuery;
     }
 
     ContractionSolutionRegistry::Query
         ContractionSolutionRegistry::Query::operator&&(Query const& other) const
     {
-        auto newQuery = Query();
-
-        // Add only if both queries have the solution
-        for(auto& solutionPair : other.mAllSolutions)
+        if(other.mRegistry != mRegistry)
         {
-            if(auto solution = mAllSolutions.find(solutionPair.first);
-               solution != mAllSolutions.end())
-            {
-                newQuery.addSolution(solutionPair.second);
-            }
+            return Query();
+        }
+        else if(mAll)
+        {
+            return other;
+        }
+        else if(other.mAll)
+        {
+            return *this;
         }
 
+        // Keep only solutions present in both queries
+        auto newQuery = *this;
+        newQuery.mSelection &= other.mSelection;
         return newQuery;
     }
 
     std::unordered_map<ContractionSolutionRegistry::Query::Uid, ContractionSolution*> const&
         ContractionSolutionRegistry::Query::solutions() const
     {
-        return mAllSolutions;
+        if(mRegistry == nullptr)
+        {
+            return mSolutionMap;
+        }
+
+        std::lock_guard<std::mutex> lock(mRegistry->mMutex);
+        if(!mSolutionMapValid)
+        {
+            auto& selected = selection();
+            mSolutionMap.clear();
+            mSolutionMap.reserve(selected.count());
+            selected.forEach([this](uint32_t index) {
+                auto* solution = mRegistry->mSolutionIndex[index];
+                mSolutionMap.emplace(solution->uid(), solution);
+            });
+            mSolutionMapValid = true;
+        }
+
+        return mSolutionMap;
+    }
+
+    std::vector<ContractionSolution*> ContractionSolutionRegistry::Query::solutionList() const
+    {
+        auto result = std::vector<ContractionSolution*>();
+        if(mRegistry != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(mRegistry->mMutex);
+            auto&                       selected = selection();
+            result.reserve(selected.count());
+            selected.forEach(
+                [&](uint32_t index) { result.push_back(mRegistry->mSolutionIndex[index]); });
+        }
+        return result;
     }
 
     uint32_t ContractionSolutionRegistry::Query::solutionCount() const
     {
-        return mAllSolutions.size();
+        if(mRegistry == nullptr)
+        {
+            return 0u;
+        }
+
+        std::lock_guard<std::mutex> lock(mRegistry->mMutex);
+        return selection().count();
     }
 
     ///////////////
@@ -148,20 +206,63 @@ namespace hiptensor
 
     ContractionSolutionRegistry::Query::Query(std::vector<ContractionSolution*> const& solutions)
     {
-        addSolutions(solutions);
+        for(auto* solution : solutions)
+        {
+            if(mRegistry == nullptr)
+            {
+                mRegistry = solution->registry();
+            }
+
+            if(solution->registry() == mRegistry && mRegistry != nullptr)
+            {
+                mSelection.set(solution->registryIndex());
+            }
+        }
+    }
+
+    ContractionSolutionRegistry::Query::Query(ContractionSolutionRegistry* registry,
+                                              SolutionBitset const&        selection)
+        : mRegistry(registry)
+        , mSelection(selection)
+    {
     }
 
     ContractionSolutionRegistry::Query
         ContractionSolutionRegistry::Query::query(HashId queryHash) const
     {
-        if(auto solutions = mSolutionHash.find(queryHash); solutions != mSolutionHash.end())
+        if(mRegistry != nullptr)
         {
-            return Query(mSolutionHash.at(queryHash));
+            std::lock_guard<std::mutex> lock(mRegistry->mMutex);
+
+            // Only families that may match are instantiated
+            mRegistry->loadFamilies(queryHash);
+
+            auto& attributes = mRegistry->mAttributeIndex;
+            if(auto attribute = attributes.find(queryHash); attribute != attributes.end())
+            {
+                auto newQuery = Query(mRegistry, attribute->second);
+                if(!mAll)
+                {
+                    newQuery.mSelection &= mSelection;
+                }
+                return newQuery;
+            }
         }
 
         return Query();
     }
 
+    SolutionBitset const& ContractionSolutionRegistry::Query::selection() const
+    {
+        if(mAll)
+        {
+            mRegistry->loadAllFamilies();
+            return mRegistry->mIndexedSolutions;
+        }
+
+        return mSelection;
+    }
+
     /* static */
     ContractionSolutionRegistry::Query::HashId
         ContractionSolutionRegistry::Query::hashSolution(int32_t                dimsM,
@@ -213,47 +314,122 @@ namespace hiptensor
         return Hash{}(opCDE);
     }
 
-    void ContractionSolutionRegistry::Query::addSolution(ContractionSolution* solution)
+    /* static */
+    ContractionSolutionRegistry::Query::HashId
+        ContractionSolutionRegistry::Query::hashFamily(ContractionOpId_t      opCDE,
+                                                       hipDataType            typeA,
+                                                       hipDataType            typeB,
+                                                       hipDataType            typeC,
+                                                       hipDataType            typeD,
+                                                       hiptensorComputeType_t typeCompute)
+    {
+        return Hash{}(opCDE, typeA, typeB, typeC, typeD, typeCompute);
+    }
+
+    /////////////////////////////////////////
+    /// Class ContractionSolutionRegistry ///
+    /////////////////////////////////////////
+
+    ContractionSolutionRegistry::ContractionSolutionRegistry()
+        : mPendingFamilies(0u)
+    {
+        mSolutionQuery.mRegistry = this;
+        mSolutionQuery.mAll      = true;
+    }
+
+    void ContractionSolutionRegistry::registerSolutions(
+        std::vector<std::unique_ptr<ContractionSolution>>&& solutions)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for(auto&& solution : solutions)
+        {
+            // Index the solution then take ownership
+            indexSolution(solution.get());
+            mSolutionStorage.push_back(std::move(solution));
+        }
+    }
+
+    void ContractionSolutionRegistry::registerSolutionFamily(ContractionSolutionFamily&& family)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto familyIndex = static_cast<uint32_t>(mFamilies.size());
+        mFamilies.push_back({std::move(family.mGenerate), false});
+        mPendingFamilies++;
+
+        // A family is a candidate for any query on one of its attributes
+        for(auto attribute : attributeHashes(*family.mParams))
+        {
+            mFamilyIndex[attribute].push_back(familyIndex);
+        }
+    }
+
+    ContractionSolutionRegistry::Query const& ContractionSolutionRegistry::allSolutions() const
+    {
+        return mSolutionQuery;
+    }
+
+    uint32_t ContractionSolutionRegistry::solutionCount() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mSolutionStorage.size();
+    }
+
+    bool ContractionSolutionRegistry::hasSolutions() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return !mSolutionStorage.empty() || mPendingFamilies != 0u;
+    }
+
+    /* static */
+    std::array<ContractionSolutionRegistry::Query::HashId, 6>
+        ContractionSolutionRegistry::attributeHashes(ContractionSolutionParams const& params)
+    {
+        return {Query::hashSolution(params.dimsM(),
+                                    params.dimsN(),
+                                    params.dimsK(),
+                                    params.typeA(),
+                                    params.typeB(),
+                                    params.typeC(),
+                                    params.typeD(),
+                                    params.opA(),
+                                    params.opB(),
+                                    params.opCDE(),
+                                    params.typeCompute()),
+                Query::hashDimsMNK(params.dimsM(), params.dimsN(), params.dimsK()),
+                Query::hashTypesComputeABCD(params.typeA(),
+                                            params.typeB(),
+                                            params.typeC(),
+                                            params.typeD(),
+                                            params.typeCompute()),
+                Query::hashElementOps(params.opA(), params.opB()),
+                Query::hashContractionOps(params.opCDE()),
+                Query::hashFamily(params.opCDE(),
+                                  params.typeA(),
+                                  params.typeB(),
+                                  params.typeC(),
+                                  params.typeD(),
+                                  params.typeCompute())};
+    }
+
+    void ContractionSolutionRegistry::indexSolution(ContractionSolution* solution)
     {
         // Acquire unique ID and category ID per solution
-        auto  solutionUid = solution->uid();
-        auto& params      = solution->params();
+        auto solutionUid = solution->uid();
+        auto index       = static_cast<uint32_t>(mSolutionIndex.size());
 
-        if(auto const& result = mAllSolutions.emplace(std::make_pair(solutionUid, solution));
-           result.second == true)
+        if(auto const& result = mUidIndex.emplace(solutionUid, index); result.second == true)
         {
-            auto solutionHash = hashSolution(params->dimsM(),
-                                             params->dimsN(),
-                                             params->dimsK(),
-                                             params->typeA(),
-                                             params->typeB(),
-                                             params->typeC(),
-                                             params->typeD(),
-                                             params->opA(),
-                                             params->opB(),
-                                             params->opCDE(),
-                                             params->typeCompute());
-
-            auto dimsMNKHash = hashDimsMNK(params->dimsM(), params->dimsN(), params->dimsK());
-
-            auto typesComputeABCDHash = hashTypesComputeABCD(params->typeA(),
-                                                             params->typeB(),
-                                                             params->typeC(),
-                                                             params->typeD(),
-                                                             params->typeCompute());
-
-            auto elementOpsHash = hashElementOps(params->opA(), params->opB());
-
-            auto contactionOpsHash = hashContractionOps(params->opCDE());
-
-            // Hash contraction solutions into categories and then register
-            // into master list.
-            mAllSolutions[solutionUid] = solution;
-            mSolutionHash[solutionHash].push_back(solution);
-            mSolutionHash[dimsMNKHash].push_back(solution);
-            mSolutionHash[typesComputeABCDHash].push_back(solution);
-            mSolutionHash[elementOpsHash].push_back(solution);
-            mSolutionHash[contactionOpsHash].push_back(solution);
+            // Assign the dense index, then mark the solution in the
+            // bitset of each of its categories.
+            solution->mRegistry      = this;
+            solution->mRegistryIndex = index;
+            mSolutionIndex.push_back(solution);
+            mIndexedSolutions.set(index);
+
+            for(auto attribute : attributeHashes(*solution->params()))
+            {
+                mAttributeIndex[attribute].set(index);
+            }
         }
         else
         {
@@ -263,47 +439,52 @@ namespace hiptensor
         }
     }
 
-    void ContractionSolutionRegistry::Query::addSolutions(
-        std::vector<ContractionSolution*> const& solutions)
+    void ContractionSolutionRegistry::loadFamilies(Query::HashId attribute)
     {
-        for(auto* soln : solutions)
+        if(mPendingFamilies == 0u)
         {
-            addSolution(soln);
+            return;
         }
-    }
 
-    void ContractionSolutionRegistry::Query::addSolutions(
-        std::unordered_map<Uid, ContractionSolution*> const& solutions)
-    {
-        for(auto& solutionPair : solutions)
+        if(auto families = mFamilyIndex.find(attribute); families != mFamilyIndex.end())
         {
-            addSolution(solutionPair.second);
+            for(auto familyIndex : families->second)
+            {
+                loadFamily(mFamilies[familyIndex]);
+            }
         }
     }
 
-    /////////////////////////////////////////
-    /// Class ContractionSolutionRegistry ///
-    /////////////////////////////////////////
-
-    void ContractionSolutionRegistry::registerSolutions(
-        std::vector<std::unique_ptr<ContractionSolution>>&& solutions)
+    void ContractionSolutionRegistry::loadAllFamilies()
     {
-        for(auto&& solution : solutions)
+        for(auto& family : mFamilies)
         {
-            // Register with the query then take ownership
-            mSolutionQuery.addSolution(solution.get());
-            mSolutionStorage.push_back(std::move(solution));
+            if(mPendingFamilies == 0u)
+            {
+                break;
+            }
+            loadFamily(family);
         }
     }
 
-    ContractionSolutionRegistry::Query const& ContractionSolutionRegistry::allSolutions() const
+    void ContractionSolutionRegistry::loadFamily(Family& family)
     {
-        return mSolutionQuery;
-    }
+        if(family.mLoaded)
+        {
+            return;
+        }
 
-    uint32_t ContractionSolutionRegistry::solutionCount() const
-    {
-        return mSolutionStorage.size();
+        family.mLoaded = true;
+        mPendingFamilies--;
+
+        for(auto&& solution : family.mGenerate())
+        {
+            indexSolution(solution.get());
+            mSolutionStorage.push_back(std::move(solution));
+        }
+
+        // Release the generator's captures
+        family.mGenerate = nullptr;
     }
     // @endcond
 
@@ -27,18 +27,24 @@
 #ifndef HIPTENSOR_CONTRACTION_SOLUTION_REGISTRY_HPP
 #define HIPTENSOR_CONTRACTION_SOLUTION_REGISTRY_HPP
 
+#include <array>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
 #include "contraction_types.hpp"
 #include "data_types.hpp"
 #include "singleton.hpp"
+#include "solution_bitset.hpp"
 
 namespace hiptensor
 {
     // @cond
     class ContractionSolution;
+    struct ContractionSolutionParams;
+    struct ContractionSolutionFamily;
 
     class ContractionSolutionRegistry
     {
@@ -87,6 +93,15 @@ namespace hiptensor
             // By contraction operation
             Query query(ContractionOpId_t opCDE) const;
 
+            // By contraction operation and data types. This is the key of a
+            // solution family, so only the matching family is instantiated.
+            Query query(ContractionOpId_t      opCDE,
+                        hipDataType            typeA,
+                        hipDataType            typeB,
+                        hipDataType            typeC,
+                        hipDataType            typeD,
+                        hiptensorComputeType_t typeCompute) const;
+
             // union
             Query operator||(Query const& other) const;
 
@@ -96,15 +111,24 @@ namespace hiptensor
             // Full map of Uid to ContractionSolution*
             std::unordered_map<Uid, ContractionSolution*> const& solutions() const;
 
+            // Solutions in registration order
+            std::vector<ContractionSolution*> solutionList() const;
+
             uint32_t solutionCount() const;
 
-            // Internal ctor
+            // Internal ctor. Solutions must belong to the same registry.
             Query(std::vector<ContractionSolution*> const& solutions);
 
         private:
+            Query(ContractionSolutionRegistry* registry, SolutionBitset const& selection);
+
             // Query by explicit hash
             Query query(HashId queryHash) const;
 
+            // Selected solutions. Instantiates every pending family of an
+            // all-solutions query. Registry lock must be held.
+            SolutionBitset const& selection() const;
+
             // Hashing helpers
             static HashId hashSolution(int32_t                dimsM,
                                        int32_t                dimsN,
@@ -126,33 +150,48 @@ namespace hiptensor
                                                hiptensorComputeType_t typeCompute);
             static HashId hashElementOps(hiptensorOperator_t opA, hiptensorOperator_t opB);
             static HashId hashContractionOps(ContractionOpId_t opCDE);
-
-            // Adding solutions to the query
-            void addSolution(ContractionSolution* solution);
-            void addSolutions(std::vector<ContractionSolution*> const& solutions);
-            void addSolutions(std::unordered_map<Uid, ContractionSolution*> const& solutions);
+            static HashId hashFamily(ContractionOpId_t      opCDE,
+                                     hipDataType            typeA,
+                                     hipDataType            typeB,
+                                     hipDataType            typeC,
+                                     hipDataType            typeD,
+                                     hiptensorComputeType_t typeCompute);
 
         private: // members
-            // This is the has of all solutions, by unique Uid
-            // [Key = KernelUid, element = ContractionSolution*]
-            std::unordered_map<Uid, ContractionSolution*> mAllSolutions;
+            // Registry that assigned the dense solution indices
+            ContractionSolutionRegistry* mRegistry = nullptr;
+
+            // Selects every solution of the registry, including families
+            // that have not been instantiated yet
+            bool mAll = false;
+
+            // Selected solutions, by dense registry index
+            SolutionBitset mSelection;
 
-            // This is the contextual query hash
-            // [Key = Query hash, Element = ContractionSolution*]
-            std::unordered_map<HashId, std::vector<ContractionSolution*>> mSolutionHash;
+            // Uid map materialized on first call to solutions()
+            mutable std::unordered_map<Uid, ContractionSolution*> mSolutionMap;
+            mutable bool                                          mSolutionMapValid = false;
         };
 
+        // Generates the solutions of one family
+        using SolutionGenerator
+            = std::function<std::vector<std::unique_ptr<ContractionSolution>>()>;
+
     protected:
-        // Move only
-        ContractionSolutionRegistry()                                              = default;
-        ContractionSolutionRegistry(ContractionSolutionRegistry&&)                 = default;
-        ContractionSolutionRegistry& operator=(ContractionSolutionRegistry&&)      = default;
+        // Queries keep a pointer back to the registry index, so
+        // registries are neither copyable nor movable.
+        ContractionSolutionRegistry();
+        ContractionSolutionRegistry(ContractionSolutionRegistry&&)                 = delete;
+        ContractionSolutionRegistry& operator=(ContractionSolutionRegistry&&)      = delete;
         ContractionSolutionRegistry(ContractionSolutionRegistry const&)            = delete;
         ContractionSolutionRegistry& operator=(ContractionSolutionRegistry const&) = delete;
 
         // Import contraction solutions for the registry to manage
         void registerSolutions(std::vector<std::unique_ptr<ContractionSolution>>&& solutions);
 
+        // Defer a family of solutions until the first query that may select them
+        void registerSolutionFamily(ContractionSolutionFamily&& family);
+
     public:
         virtual ~ContractionSolutionRegistry() = default;
 
@@ -162,13 +201,60 @@ namespace hiptensor
             return mSolutionQuery.query(ts...);
         }
 
+        // Every solution; instantiates all pending families when resolved
         Query const& allSolutions() const;
 
+        // Solutions instantiated so far
         uint32_t solutionCount() const;
 
+        // True if any solution or pending family is registered
+        bool hasSolutions() const;
+
+    private:
+        struct Family
+        {
+            SolutionGenerator mGenerate;
+            bool              mLoaded;
+        };
+
+        // Query attribute hashes of a solution with the given parameters
+        static std::array<Query::HashId, 6>
+            attributeHashes(ContractionSolutionParams const& params);
+
+        // Assigns the next dense index to the solution and records it
+        // in every attribute bitset.
+        void indexSolution(ContractionSolution* solution);
+
+        // Instantiates pending families having the attribute, or all of them.
+        // Registry lock must be held.
+        void loadFamilies(Query::HashId attribute);
+        void loadAllFamilies();
+        void loadFamily(Family& family);
+
     private:
         std::vector<std::unique_ptr<ContractionSolution>> mSolutionStorage;
-        Query                                             mSolutionQuery;
+
+        // Dense index -> solution
+        std::vector<ContractionSolution*> mSolutionIndex;
+
+        // Unique kernel Uid -> dense index
+        std::unordered_map<Query::Uid, uint32_t> mUidIndex;
+
+        // Attribute hash -> solutions having that attribute
+        std::unordered_map<Query::HashId, SolutionBitset> mAttributeIndex;
+
+        // Every indexed solution
+        SolutionBitset mIndexedSolutions;
+
+        // Families not instantiated at registration
+        std::vector<Family>                                      mFamilies;
+        std::unordered_map<Query::HashId, std::vector<uint32_t>> mFamilyIndex;
+        uint32_t                                                 mPendingFamilies;
+
+        // Guards the index and family loading
+        mutable std::mutex mMutex;
+
+        Query mSolutionQuery;
     };
     // @endcond
 
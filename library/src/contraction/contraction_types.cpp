@@ -24,7 +24,141 @@
  *
  *******************************************************************************/
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 #include "contraction_types.hpp"
+#include "data_types.hpp"
+#include "util.hpp"
+
+namespace hiptensor
+{
+    PlaneStrides planeStrides(hiptensorContractionDescriptor_t const& desc)
+    {
+        PlaneStrides result = {};
+        for(std::size_t i = 0; i < result.size() && i < desc.mTensorDesc.size(); i++)
+        {
+            result[i] = desc.mTensorDesc[i].mPlaneStride;
+        }
+        return result;
+    }
+
+    std::vector<int32_t> batchModes(std::vector<int32_t> const& modesA,
+                                    std::vector<int32_t> const& modesB,
+                                    std::vector<int32_t> const& modesE)
+    {
+        std::vector<int32_t> result;
+        for(auto mode : modesE)
+        {
+            if(std::find(modesA.cbegin(), modesA.cend(), mode) != modesA.cend()
+               && std::find(modesB.cbegin(), modesB.cend(), mode) != modesB.cend())
+            {
+                result.push_back(mode);
+            }
+        }
+        return result;
+    }
+
+    bool hasBatchModes(hiptensorContractionDescriptor_t const& desc)
+    {
+        return desc.mTensorMode.size() >= 3
+               && !batchModes(desc.mTensorMode[0], desc.mTensorMode[1], desc.mTensorMode[2])
+                       .empty();
+    }
+
+    bool hasPreReduction(hiptensorContractionDescriptor_t const& desc)
+    {
+        return isPreReduced(desc, 0) || isPreReduced(desc, 1);
+    }
+
+    bool isPreReduced(hiptensorContractionDescriptor_t const& desc, int operand)
+    {
+        return desc.mPreReductionMode.size() == 2
+               && desc.mPreReductionMode[operand].size() != desc.mTensorMode[operand].size();
+    }
+
+    bool hasElementOps(hiptensorContractionDescriptor_t const& desc)
+    {
+        return desc.mTensorDesc.size() >= 2
+               && (desc.mTensorDesc[0].mUnaryOp != HIPTENSOR_OP_IDENTITY
+                   || desc.mTensorDesc[1].mUnaryOp != HIPTENSOR_OP_IDENTITY);
+    }
+
+    std::array<std::size_t, 2> preReductionOffsets(hiptensorContractionDescriptor_t const& desc,
+                                                   std::size_t* totalSize)
+    {
+        // Aligned as arena blocks, for the vector loads of the solutions
+        constexpr std::size_t Alignment = 256u;
+
+        std::array<std::size_t, 2> offsets = {};
+        std::size_t                size    = 0;
+        for(int i = 0; i < 2; i++)
+        {
+            offsets[i] = size;
+            if(isPreReduced(desc, i))
+            {
+                auto const& tensor   = desc.mTensorDesc[i];
+                auto        elements = std::accumulate(tensor.mLengths.begin(),
+                                                       tensor.mLengths.end(),
+                                                       std::size_t(1),
+                                                       std::multiplies<std::size_t>());
+                size += ceilDiv(elements * hipDataTypeSize(tensor.mType), Alignment) * Alignment;
+            }
+        }
+
+        *totalSize = size;
+        return offsets;
+    }
+
+    ContractionShape_t contractionShape(std::vector<int32_t> const& modesA,
+                                        std::vector<int32_t> const& modesB,
+                                        std::vector<int32_t> const& modesE)
+    {
+        auto contains = [](std::vector<int32_t> const& modes, int32_t mode) {
+            return std::find(modes.cbegin(), modes.cend(), mode) != modes.cend();
+        };
+
+        bool hasM = false;
+        bool hasN = false;
+        bool hasK = false;
+        for(auto mode : modesE)
+        {
+            auto inA = contains(modesA, mode);
+            auto inB = contains(modesB, mode);
+            hasM |= inA && !inB;
+            hasN |= inB && !inA;
+        }
+        for(auto mode : modesA)
+        {
+            hasK |= contains(modesB, mode) && !contains(modesE, mode);
+        }
+
+        if(!hasK)
+        {
+            return ContractionShape_t::OUTER_PRODUCT;
+        }
+        if(!hasM && !hasN)
+        {
+            return ContractionShape_t::DOT;
+        }
+        if(!hasM || !hasN)
+        {
+            return ContractionShape_t::GEMV;
+        }
+        return ContractionShape_t::GEMM;
+    }
+
+    ContractionShape_t contractionShape(hiptensorContractionDescriptor_t const& desc)
+    {
+        if(desc.mTensorMode.size() < 3)
+        {
+            return ContractionShape_t::GEMM;
+        }
+        return contractionShape(desc.mTensorMode[0], desc.mTensorMode[1], desc.mTensorMode[2]);
+    }
+
+} // namespace hiptensor
 
 namespace std
 {
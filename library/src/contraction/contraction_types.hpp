@@ -27,7 +27,13 @@
 #ifndef HIPTENSOR_CONTRACTION_TYPES_HPP
 #define HIPTENSOR_CONTRACTION_TYPES_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <ostream>
+#include <vector>
+
+struct hiptensorContractionDescriptor_t;
 
 namespace hiptensor
 {
@@ -42,6 +48,7 @@ namespace hiptensor
         BILINEAR         = 1, ///< \f${D=\alpha\mathcal{A}\mathcal{B}+\beta\mathcal{C}}\f$
         SCALE_COMPLEX    = 2,
         BILINEAR_COMPLEX = 3,
+        EPILOGUE         = 4, ///< \f${D=f(\alpha\mathcal{A}\mathcal{B}+\beta\mathcal{C}+b)}\f$
         UNKNOWN,
     };
 
@@ -59,6 +66,74 @@ namespace hiptensor
     template <typename OpId>
     static constexpr auto ContractionOperatorType_v = ContractionOperatorType<OpId>::value;
 
+    // Shape of a contraction, by which of its M, N and K modes are missing. Batch modes are
+    // not counted. GEMV covers tensor-times-vector contractions with no M or no N modes.
+    enum struct ContractionShape_t : int32_t
+    {
+        GEMM          = 0, ///< M, N and K modes
+        GEMV          = 1, ///< K modes, and M or N modes but not both
+        OUTER_PRODUCT = 2, ///< No K modes
+        DOT           = 3, ///< K modes only
+    };
+
+    // Plane strides, in real elements, of the A, B, D and E tensors of a contraction.
+    // Zero for interleaved complex and real tensors.
+    using PlaneStrides = std::array<std::size_t, 4>;
+
+    // Plane strides of the A, B, C and D tensors of the descriptor, which the solutions
+    // see as A, B, D and E
+    PlaneStrides planeStrides(hiptensorContractionDescriptor_t const& desc);
+
+    // Batch (Hadamard) modes of a contraction: the modes of E that are also in both A and B,
+    // in the order of E
+    std::vector<int32_t> batchModes(std::vector<int32_t> const& modesA,
+                                    std::vector<int32_t> const& modesB,
+                                    std::vector<int32_t> const& modesE);
+
+    // True if the descriptor has batch modes, which are contracted by batched solutions
+    bool hasBatchModes(hiptensorContractionDescriptor_t const& desc);
+
+    // True if modes are summed out of A or B before the contraction
+    bool hasPreReduction(hiptensorContractionDescriptor_t const& desc);
+
+    // True if modes are summed out of the given operand (0 for A, 1 for B)
+    bool isPreReduced(hiptensorContractionDescriptor_t const& desc, int operand);
+
+    // True if the unary operator of A or B is not the identity. The solutions apply it
+    // to the operand as they load it.
+    bool hasElementOps(hiptensorContractionDescriptor_t const& desc);
+
+    // Offsets in the workspace of the pre-reduced A and B, ahead of the workspace of the
+    // solution. totalSize is set to the workspace they take, zero without pre-reduction.
+    std::array<std::size_t, 2> preReductionOffsets(hiptensorContractionDescriptor_t const& desc,
+                                                   std::size_t* totalSize);
+
+    // Shape of the contraction of A and B into E, given their modes. Modes of unit extent
+    // count as present.
+    ContractionShape_t contractionShape(std::vector<int32_t> const& modesA,
+                                        std::vector<int32_t> const& modesB,
+                                        std::vector<int32_t> const& modesE);
+
+    // Shape of the contraction of the descriptor, after any pre-reduction of A and B
+    ContractionShape_t contractionShape(hiptensorContractionDescriptor_t const& desc);
+
+    // Implemented by device ops that only solve GEMV, outer product and dot contractions, so
+    // that the planner can dispatch those contractions to them ahead of the GEMM kernels.
+    struct DegenerateContractionDeviceOp
+    {
+        virtual ~DegenerateContractionDeviceOp() = default;
+    };
+
+    // Implemented by device ops that expose their block tile, so that grouped solutions
+    // can be selected on the aggregate workload of their groups.
+    struct BlockTiledDeviceOp
+    {
+        virtual ~BlockTiledDeviceOp() = default;
+
+        // M and N extents of the block tile
+        virtual std::array<int32_t, 2> blockTile() const = 0;
+    };
+
 } // namespace hiptensor
 
 namespace std
@@ -34,6 +34,7 @@
 
 #include "contraction_types.hpp"
 #include "device/device_element_wise_operation_complex.hpp"
+#include "device/device_element_wise_operation_epilogue.hpp"
 #include <hiptensor/hiptensor_types.hpp>
 
 namespace hiptensor
@@ -45,6 +46,18 @@ namespace hiptensor
         static constexpr auto value = hiptensorOperator_t::HIPTENSOR_OP_IDENTITY;
     };
 
+    template <>
+    struct ElementWiseOperatorType<ck::tensor_operation::element_wise::UnarySqrt>
+    {
+        static constexpr auto value = hiptensorOperator_t::HIPTENSOR_OP_SQRT;
+    };
+
+    template <>
+    struct ElementWiseOperatorType<ck::tensor_operation::element_wise::Conjugate>
+    {
+        static constexpr auto value = hiptensorOperator_t::HIPTENSOR_OP_CONJ;
+    };
+
     // Specialize overrides for runtime ContractionOperatorType
     template <>
     struct ContractionOperatorType<ck::tensor_operation::element_wise::Scale>
@@ -70,6 +83,12 @@ namespace hiptensor
         static constexpr auto value = ContractionOpId_t::BILINEAR_COMPLEX;
     };
 
+    template <>
+    struct ContractionOperatorType<ck::tensor_operation::element_wise::Epilogue>
+    {
+        static constexpr auto value = ContractionOpId_t::EPILOGUE;
+    };
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_CONTRACTION_TYPES_IMPL_HPP
@@ -40,5 +40,6 @@
 #include <gemm_specialization.hpp>
 
 #include "device_element_wise_operation_complex.hpp"
+#include "device_element_wise_operation_epilogue.hpp"
 
 #endif // CONTRACTION_DEVICE_COMMON_HPP
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "device_batched_contraction_instance.hpp"
+#include "hiptensor_batched_contraction_instances.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+
+                // A[g0, g1, g2, g3, m0, ..., k0, ...] * B[g0, g1, g2, g3, n0, ..., k0, ...]
+                using device_batched_contraction_bilinear_g4_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_instance
+                    = device_batched_contraction_f32_instance<MaxNumDimsG,
+                                                              6,
+                                                              6,
+                                                              6,
+                                                              F32_Tuple,
+                                                              Bilinear>;
+
+                void add_device_batched_contraction_bilinear_g4_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_instance(
+                    std::vector<std::unique_ptr<DeviceBatchedContractionMultipleD<MaxNumDimsG,
+                                                                                  6,
+                                                                                  6,
+                                                                                  6,
+                                                                                  F32,
+                                                                                  F32,
+                                                                                  F32_Tuple,
+                                                                                  F32,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  Bilinear>>>& instances)
+                {
+#if !HIPTENSOR_INSTANCE_PRUNED
+                    add_device_operation_instances(
+                        instances,
+                        device_batched_contraction_bilinear_g4_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_instance{});
+#endif // !HIPTENSOR_INSTANCE_PRUNED
+                }
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_BATCHED_CONTRACTION_INSTANCE_HPP
+#define HIPTENSOR_BATCHED_CONTRACTION_INSTANCE_HPP
+
+#include <device_batched_contraction_multiple_d_xdl_cshuffle.hpp>
+
+#include "common.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+                template <index_t... Is>
+                using BatchedS = ck::Sequence<Is...>;
+
+                using F32         = float;
+                using F64         = double;
+                using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+                static constexpr auto BatchedGemmMNKPadding
+                    = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+                // Batched contraction instances read A and B with a scalar vector width of 1
+                // on the K dimension, so that any of the kk/kn/mk/mn stride orders is
+                // supported by the same instance: one instance covers every batch layout.
+                // A[g0, ..., m0, ..., k0, ...] * B[g0, ..., n0, ..., k0, ...]
+                //     + D[g0, ..., m0, ..., n0, ...] = E[g0, ..., m0, ..., n0, ...]
+                // clang-format off
+                template <index_t NumDimG,
+                          index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename DsDataType,
+                          typename CDEElementwiseOp>
+                using device_batched_contraction_f32_instance = std::tuple<
+                    //#####################################| NumDimG| NumDimM| NumDimN| NumDimK| AData| BData| AccData| CShuffle|      DsData| EData|           A|           B|              CDE|                  GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle|    CBlockTransferClusterLengths| CBlockTransfer|
+                    //#####################################|        |        |        |        |  Type|  Type|    Type| DataType|        Type|  Type| Elementwise| Elementwise|      Elementwise|        Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|            _MBlock_MWaveMPerXdl|  ScalarPerVector|
+                    DeviceBatchedContractionMultipleD_Xdl_CShuffle< NumDimG, NumDimM, NumDimN, NumDimK,   F32,   F32,     F32,      F32,  DsDataType,   F32, PassThrough, PassThrough, CDEElementwiseOp, BatchedGemmMNKPadding,        1,   256,   128,   128,    16,   4,   4,   32,   32,    2,    2, BatchedS<4, 64, 1>,  BatchedS<1, 0, 2>,  BatchedS<1, 0, 2>,              2,              1,              4,         1, BatchedS<4, 64, 1>,  BatchedS<1, 0, 2>,  BatchedS<1, 0, 2>,              2,              1,              4,         1,           1,           1, BatchedS<1, 16, 1, 16>,               1>,
+                    DeviceBatchedContractionMultipleD_Xdl_CShuffle< NumDimG, NumDimM, NumDimN, NumDimK,   F32,   F32,     F32,      F32,  DsDataType,   F32, PassThrough, PassThrough, CDEElementwiseOp, BatchedGemmMNKPadding,        1,    64,    32,    32,    16,   4,   4,   32,   32,    1,    1, BatchedS<4, 16, 1>,  BatchedS<1, 0, 2>,  BatchedS<1, 0, 2>,              2,              1,              4,         1, BatchedS<4, 16, 1>,  BatchedS<1, 0, 2>,  BatchedS<1, 0, 2>,              2,              1,              4,         1,           1,           1,  BatchedS<1, 16, 1, 4>,               1>
+                    >;
+
+                template <index_t NumDimG,
+                          index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename DsDataType,
+                          typename CDEElementwiseOp>
+                using device_batched_contraction_f64_instance = std::tuple<
+                    //#####################################| NumDimG| NumDimM| NumDimN| NumDimK| AData| BData| AccData| CShuffle|      DsData| EData|           A|           B|              CDE|                  GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle|    CBlockTransferClusterLengths| CBlockTransfer|
+                    //#####################################|        |        |        |        |  Type|  Type|    Type| DataType|        Type|  Type| Elementwise| Elementwise|      Elementwise|        Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|            _MBlock_MWaveMPerXdl|  ScalarPerVector|
+                    DeviceBatchedContractionMultipleD_Xdl_CShuffle< NumDimG, NumDimM, NumDimN, NumDimK,   F64,   F64,     F64,      F64,  DsDataType,   F64, PassThrough, PassThrough, CDEElementwiseOp, BatchedGemmMNKPadding,        1,   256,   128,   128,    16,   2,   2,   16,   16,    4,    4, BatchedS<8, 32, 1>,  BatchedS<1, 0, 2>,  BatchedS<1, 0, 2>,              2,              1,              2,         1, BatchedS<8, 32, 1>,  BatchedS<1, 0, 2>,  BatchedS<1, 0, 2>,              2,              1,              2,         1,           1,           1, BatchedS<1, 16, 1, 16>,               1>,
+                    DeviceBatchedContractionMultipleD_Xdl_CShuffle< NumDimG, NumDimM, NumDimN, NumDimK,   F64,   F64,     F64,      F64,  DsDataType,   F64, PassThrough, PassThrough, CDEElementwiseOp, BatchedGemmMNKPadding,        1,    64,    32,    32,    16,   2,   2,   16,   16,    2,    2,  BatchedS<8, 8, 1>,  BatchedS<1, 0, 2>,  BatchedS<1, 0, 2>,              2,              1,              2,         1,  BatchedS<8, 8, 1>,  BatchedS<1, 0, 2>,  BatchedS<1, 0, 2>,              2,              1,              2,         1,           1,           1,   BatchedS<1, 8, 1, 8>,               1>
+                    >;
+                // clang-format on
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // HIPTENSOR_BATCHED_CONTRACTION_INSTANCE_HPP
@@ -75,9 +75,11 @@ namespace ck
                                                                                Bilinear,
                                                                                F32>>>& instances)
                 {
+#if !HIPTENSOR_INSTANCE_PRUNED
                     add_device_operation_instances(
                         instances,
                         device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_bf16_bf16_bf16_bf16_compute_f32_mnnn_instance{});
+#endif // !HIPTENSOR_INSTANCE_PRUNED
                 }
 
             } // namespace instance
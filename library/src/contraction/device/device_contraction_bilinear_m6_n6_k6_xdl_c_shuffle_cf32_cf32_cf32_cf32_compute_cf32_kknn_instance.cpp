@@ -81,9 +81,11 @@ namespace ck
                                                                                BilinearComplex,
                                                                                CF32>>>& instances)
                 {
+#if !HIPTENSOR_INSTANCE_PRUNED
                     add_device_operation_instances(
                         instances,
                         device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_cf32_compute_cf32_kknn_instance{});
+#endif // !HIPTENSOR_INSTANCE_PRUNED
                 }
 
             } // namespace instance
@@ -0,0 +1,468 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_DEGENERATE_DEVICE_HPP
+#define HIPTENSOR_CONTRACTION_DEGENERATE_DEVICE_HPP
+
+#include <functional>
+#include <numeric>
+#include <sstream>
+
+#include "../contraction_degenerate.hpp"
+#include "../contraction_types.hpp"
+#include "common.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+
+            using hiptensor::ceilDiv;
+
+            // The following is a device op for the bandwidth-bound contractions of real types
+            // that have no N modes or no M modes (tensor-times-vector, GEMV), no K modes
+            // (outer product) or neither M nor N modes (dot product).
+            // The XDL GEMM instances tile M and N for reuse of A and B through LDS, which
+            // these shapes do not have: most of each tile would be padding. Instead, GEMV
+            // rows are reduced by a thread each when their matrix elements are adjacent,
+            // and by a block each otherwise, with K split over blocks when there are too few
+            // rows to occupy the device. Outer products write each element of E once.
+            // Problems with M, N and K elements are not supported.
+
+            // Tensor Contraction:
+            //   input : A
+            //   input : B
+            //   input : D0 (bilinear only)
+            //   output : E
+            //   E = alpha * (A * B) + beta * D0
+            // Assume:
+            //   A[M0, M1, M2, ..., K0, K1, K2, ...]
+            //   B[N0, N1, N2, ..., K0, K1, K2, ...]
+            //   D[M0, M1, M2, ..., N0, N1, N2, ...]
+            //   E[M0, M1, M2, ..., N0, N1, N2, ...]
+            template <index_t NumDimM,
+                      index_t NumDimN,
+                      index_t NumDimK,
+                      typename ADataType,
+                      typename BDataType,
+                      typename DsDataType,
+                      typename EDataType,
+                      typename AElementwiseOperation,
+                      typename BElementwiseOperation,
+                      typename CDEElementwiseOperation,
+                      typename ComputeDataType>
+            struct DeviceContractionMultipleD_Degenerate
+                : public DeviceContractionMultipleD<NumDimM,
+                                                    NumDimN,
+                                                    NumDimK,
+                                                    ADataType,
+                                                    BDataType,
+                                                    DsDataType,
+                                                    EDataType,
+                                                    AElementwiseOperation,
+                                                    BElementwiseOperation,
+                                                    CDEElementwiseOperation,
+                                                    ComputeDataType>,
+                  public hiptensor::DegenerateContractionDeviceOp
+            {
+                using DeviceOp = DeviceContractionMultipleD_Degenerate;
+
+                static constexpr index_t NumDTensor = DsDataType::Size();
+
+                // Products are accumulated in double for double compute, float otherwise
+                using AccDataType = std::
+                    conditional_t<std::is_same_v<ComputeDataType, double>, double, float>;
+
+                // Real A, B, D and E of the same type, in normalized (6, 6, 6) modes. A and B
+                // are loaded as stored, without element ops.
+                static constexpr bool IsSupportedInstance()
+                {
+                    constexpr bool isReal
+                        = std::is_same_v<EDataType, ck::half_t>
+                          || std::is_same_v<EDataType, ck::bhalf_t>
+                          || std::is_same_v<EDataType, float> || std::is_same_v<EDataType, double>;
+                    constexpr bool isScaleOrBilinear
+                        = (std::is_same_v<CDEElementwiseOperation, element_wise::Scale>
+                           && NumDTensor == 0)
+                          || (std::is_same_v<CDEElementwiseOperation, element_wise::Bilinear>
+                              && NumDTensor == 1);
+
+                    constexpr bool isPassThrough
+                        = std::is_same_v<AElementwiseOperation, element_wise::PassThrough>
+                          && std::is_same_v<BElementwiseOperation, element_wise::PassThrough>;
+
+                    return isReal && isScaleOrBilinear && isPassThrough
+                           && std::is_same_v<ADataType, EDataType>
+                           && std::is_same_v<BDataType, EDataType> && NumDimM == MaxNumDimsM
+                           && NumDimN == MaxNumDimsN && NumDimK == MaxNumDimsK;
+                }
+
+                // Argument
+                struct Argument : public BaseArgument
+                {
+                    Argument(const void*                                         p_a,
+                             const void*                                         p_b,
+                             std::array<const void*, NumDTensor>                 p_ds,
+                             void*                                               p_e,
+                             const std::vector<index_t>&                         a_ms_ks_lengths,
+                             const std::vector<index_t>&                         a_ms_ks_strides,
+                             const std::vector<index_t>&                         b_ns_ks_lengths,
+                             const std::vector<index_t>&                         b_ns_ks_strides,
+                             const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_lengths,
+                             const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_strides,
+                             const std::vector<index_t>&                         e_ms_ns_lengths,
+                             const std::vector<index_t>&                         e_ms_ns_strides,
+                             AElementwiseOperation                               a_element_op,
+                             BElementwiseOperation                               b_element_op,
+                             CDEElementwiseOperation                             cde_element_op)
+                        : mA(p_a)
+                        , mB(p_b)
+                        , mD(nullptr)
+                        , mE(p_e)
+                        , mShape(hiptensor::ContractionShape_t::GEMM)
+                        , mGemvDesc{}
+                        , mOuterProductDesc{}
+                        , mAlpha(1)
+                        , mBeta(0)
+                    {
+                        // Scale contractions have no D. Its strides are then those of E.
+                        auto const* d_ms_ns_strides = &e_ms_ns_strides;
+                        if constexpr(NumDTensor > 0)
+                        {
+                            mD              = p_ds[0];
+                            d_ms_ns_strides = &ds_ms_ns_strides[0];
+                        }
+
+                        if constexpr(std::is_same_v<CDEElementwiseOperation, element_wise::Scale>)
+                        {
+                            mAlpha = static_cast<AccDataType>(cde_element_op.scale_);
+                        }
+                        else
+                        {
+                            mAlpha = static_cast<AccDataType>(cde_element_op.alpha_);
+                            mBeta  = static_cast<AccDataType>(cde_element_op.beta_);
+                        }
+
+                        auto elements = [](std::vector<index_t> const& lengths,
+                                           int                         begin,
+                                           int                         end) {
+                            return std::accumulate(lengths.begin() + begin,
+                                                   lengths.begin() + end,
+                                                   int64_t(1),
+                                                   std::multiplies<int64_t>());
+                        };
+                        auto elementsM = elements(a_ms_ks_lengths, 0, NumDimM);
+                        auto elementsN = elements(b_ns_ks_lengths, 0, NumDimN);
+                        auto elementsK = elements(a_ms_ks_lengths, NumDimM, NumDimM + NumDimK);
+
+                        if(elementsK == 1)
+                        {
+                            mShape            = hiptensor::ContractionShape_t::OUTER_PRODUCT;
+                            mOuterProductDesc = hiptensor::makeOuterProductDesc(a_ms_ks_lengths,
+                                                                                a_ms_ks_strides,
+                                                                                b_ns_ks_lengths,
+                                                                                b_ns_ks_strides,
+                                                                                *d_ms_ns_strides,
+                                                                                e_ms_ns_strides);
+                        }
+                        else if(elementsM == 1 || elementsN == 1)
+                        {
+                            mShape    = elementsM == 1 && elementsN == 1
+                                            ? hiptensor::ContractionShape_t::DOT
+                                            : hiptensor::ContractionShape_t::GEMV;
+                            mGemvDesc = hiptensor::makeGemvDesc(a_ms_ks_lengths,
+                                                                a_ms_ks_strides,
+                                                                b_ns_ks_lengths,
+                                                                b_ns_ks_strides,
+                                                                *d_ms_ns_strides,
+                                                                e_ms_ns_strides);
+                            hiptensor::splitGemvRows(mGemvDesc);
+                        }
+                    }
+
+                    // Workspace layout: the partial sums of the splits of each GEMV row
+                    size_t workspaceBytes() const
+                    {
+                        if(mShape == hiptensor::ContractionShape_t::OUTER_PRODUCT
+                           || mGemvDesc.mSplitsK <= 1)
+                        {
+                            return 0;
+                        }
+                        return sizeof(AccDataType) * mGemvDesc.mElementsR * mGemvDesc.mSplitsK;
+                    }
+
+                    const void* mA;
+                    const void* mB;
+                    const void* mD;
+                    void*       mE;
+
+                    hiptensor::ContractionShape_t mShape;
+                    hiptensor::GemvDesc           mGemvDesc;
+                    hiptensor::OuterProductDesc   mOuterProductDesc;
+
+                    AccDataType mAlpha;
+                    AccDataType mBeta;
+                };
+
+                // Invoker
+                struct Invoker : public BaseInvoker
+                {
+                    using Argument = typename DeviceOp::Argument;
+
+                    float Run(const Argument&     arg,
+                              const StreamConfig& stream_config = StreamConfig{})
+                    {
+                        auto blockDim = dim3(hiptensor::DegenerateBlockSize);
+
+                        auto a = static_cast<const ADataType*>(arg.mA);
+                        auto b = static_cast<const BDataType*>(arg.mB);
+                        auto d = static_cast<const EDataType*>(arg.mD);
+                        auto e = static_cast<EDataType*>(arg.mE);
+
+                        if(arg.mShape == hiptensor::ContractionShape_t::OUTER_PRODUCT)
+                        {
+                            auto const& desc    = arg.mOuterProductDesc;
+                            auto        gridDim = dim3(
+                                ceilDiv(desc.mElementsM * desc.mElementsN, int64_t(blockDim.x)));
+                            return launch_and_time_kernel(
+                                stream_config,
+                                hiptensor::outerProduct<ADataType,
+                                                        EDataType,
+                                                        ComputeDataType,
+                                                        AccDataType>,
+                                gridDim,
+                                blockDim,
+                                0,
+                                a,
+                                b,
+                                d,
+                                e,
+                                desc,
+                                arg.mAlpha,
+                                arg.mBeta);
+                        }
+
+                        auto const& desc     = arg.mGemvDesc;
+                        auto        mat      = desc.mMatrixIsA ? a : b;
+                        auto        vec      = desc.mMatrixIsA ? b : a;
+                        auto        partials = static_cast<AccDataType*>(arg.p_workspace_);
+
+                        float time = 0.0f;
+                        if(hiptensor::isGemvThreadPerRow(desc))
+                        {
+                            auto gridDim = dim3(ceilDiv(desc.mElementsR, int64_t(blockDim.x))
+                                                * desc.mSplitsK);
+                            time         = launch_and_time_kernel(
+                                stream_config,
+                                hiptensor::gemvThreadPerRow<ADataType,
+                                                            EDataType,
+                                                            ComputeDataType,
+                                                            AccDataType>,
+                                gridDim,
+                                blockDim,
+                                0,
+                                mat,
+                                vec,
+                                d,
+                                e,
+                                partials,
+                                desc,
+                                arg.mAlpha,
+                                arg.mBeta);
+                        }
+                        else
+                        {
+                            auto gridDim = dim3(desc.mElementsR * desc.mSplitsK);
+                            time         = launch_and_time_kernel(
+                                stream_config,
+                                hiptensor::gemvBlockPerRow<ADataType,
+                                                           EDataType,
+                                                           ComputeDataType,
+                                                           AccDataType>,
+                                gridDim,
+                                blockDim,
+                                0,
+                                mat,
+                                vec,
+                                d,
+                                e,
+                                partials,
+                                desc,
+                                arg.mAlpha,
+                                arg.mBeta);
+                        }
+
+                        if(desc.mSplitsK > 1)
+                        {
+                            auto gridDim = dim3(ceilDiv(desc.mElementsR, int64_t(blockDim.x)));
+                            time += launch_and_time_kernel(
+                                stream_config,
+                                hiptensor::gemvReduceSplits<EDataType, AccDataType>,
+                                gridDim,
+                                blockDim,
+                                0,
+                                static_cast<const AccDataType*>(partials),
+                                d,
+                                e,
+                                desc,
+                                arg.mAlpha,
+                                arg.mBeta);
+                        }
+
+                        return time;
+                    }
+
+                    // polymorphic
+                    float Run(const BaseArgument* p_arg,
+                              const StreamConfig& stream_config = StreamConfig{}) override
+                    {
+                        return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+                    }
+                };
+
+                static bool IsSupportedArgument(const Argument& arg)
+                {
+                    return arg.mShape != hiptensor::ContractionShape_t::GEMM;
+                }
+
+                // polymorphic
+                bool IsSupportedArgument(const BaseArgument* p_arg) override
+                {
+                    return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+                }
+
+                // polymorphic
+                size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+                {
+                    return dynamic_cast<const Argument*>(p_arg)->workspaceBytes();
+                }
+
+                static auto MakeArgument(
+                    const void*                                         p_a,
+                    const void*                                         p_b,
+                    std::array<const void*, NumDTensor>                 p_ds,
+                    void*                                               p_e,
+                    const std::vector<index_t>&                         a_ms_ks_lengths,
+                    const std::vector<index_t>&                         a_ms_ks_strides,
+                    const std::vector<index_t>&                         b_ns_ks_lengths,
+                    const std::vector<index_t>&                         b_ns_ks_strides,
+                    const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_lengths,
+                    const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_strides,
+                    const std::vector<index_t>&                         e_ms_ns_lengths,
+                    const std::vector<index_t>&                         e_ms_ns_strides,
+                    AElementwiseOperation                               a_element_op,
+                    BElementwiseOperation                               b_element_op,
+                    CDEElementwiseOperation                             cde_element_op)
+                {
+                    return Argument{p_a,
+                                    p_b,
+                                    p_ds,
+                                    p_e,
+                                    a_ms_ks_lengths,
+                                    a_ms_ks_strides,
+                                    b_ns_ks_lengths,
+                                    b_ns_ks_strides,
+                                    ds_ms_ns_lengths,
+                                    ds_ms_ns_strides,
+                                    e_ms_ns_lengths,
+                                    e_ms_ns_strides,
+                                    a_element_op,
+                                    b_element_op,
+                                    cde_element_op};
+                }
+
+                static auto MakeInvoker()
+                {
+                    return Invoker{};
+                }
+
+                // polymorphic
+                std::unique_ptr<BaseArgument> MakeArgumentPointer(
+                    const void*                                         p_a,
+                    const void*                                         p_b,
+                    std::array<const void*, NumDTensor>                 p_ds,
+                    void*                                               p_e,
+                    const std::vector<index_t>&                         a_ms_ks_lengths,
+                    const std::vector<index_t>&                         a_ms_ks_strides,
+                    const std::vector<index_t>&                         b_ns_ks_lengths,
+                    const std::vector<index_t>&                         b_ns_ks_strides,
+                    const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_lengths,
+                    const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_strides,
+                    const std::vector<index_t>&                         e_ms_ns_lengths,
+                    const std::vector<index_t>&                         e_ms_ns_strides,
+                    AElementwiseOperation                               a_element_op,
+                    BElementwiseOperation                               b_element_op,
+                    CDEElementwiseOperation                             cde_element_op) override
+                {
+                    return std::make_unique<Argument>(p_a,
+                                                      p_b,
+                                                      p_ds,
+                                                      p_e,
+                                                      a_ms_ks_lengths,
+                                                      a_ms_ks_strides,
+                                                      b_ns_ks_lengths,
+                                                      b_ns_ks_strides,
+                                                      ds_ms_ns_lengths,
+                                                      ds_ms_ns_strides,
+                                                      e_ms_ns_lengths,
+                                                      e_ms_ns_strides,
+                                                      a_element_op,
+                                                      b_element_op,
+                                                      cde_element_op);
+                }
+
+                // polymorphic
+                std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+                {
+                    return std::make_unique<Invoker>(Invoker{});
+                }
+
+                // polymorphic
+                std::string GetTypeString() const override
+                {
+                    auto str = std::stringstream();
+
+                    // clang-format off
+        str << "DeviceContractionMultipleD_Degenerate"
+            << "<"
+            << NumDimM << ", "
+            << NumDimN << ", "
+            << NumDimK << ", "
+            << hiptensor::DegenerateBlockSize
+            << ">";
+                    // clang-format on
+
+                    return str.str();
+                }
+            };
+
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // HIPTENSOR_CONTRACTION_DEGENERATE_DEVICE_HPP
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "device_contraction_epilogue_instance.hpp"
+#include "hiptensor_contraction_epilogue_instances.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+
+                // A[m0, m1, ..., k0, k1, ...] * B[n0, n1, ..., k0, k1, ...], stored as bf16
+                using device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_bf16_bf16_instance
+                    = device_contraction_epilogue_f32_instance<6, 6, 6, BF16>;
+
+                void add_device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_bf16_bf16_instance(
+                    std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                           6,
+                                                                           6,
+                                                                           F32,
+                                                                           F32,
+                                                                           ck::Tuple<BF16, F32>,
+                                                                           BF16,
+                                                                           PassThrough,
+                                                                           PassThrough,
+                                                                           Epilogue,
+                                                                           F32>>>& instances)
+                {
+#if !HIPTENSOR_INSTANCE_PRUNED
+                    add_device_operation_instances(
+                        instances,
+                        device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_bf16_bf16_instance{});
+#endif // !HIPTENSOR_INSTANCE_PRUNED
+                }
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
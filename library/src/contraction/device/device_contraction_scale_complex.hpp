@@ -27,6 +27,9 @@
 #ifndef HIPTENSOR_CONTRACTION_SCALE_COMPLEX_HPP
 #define HIPTENSOR_CONTRACTION_SCALE_COMPLEX_HPP
 
+#include <algorithm>
+
+#include "../contraction_interleaved_complex.hpp"
 #include "../contraction_pack_util.hpp"
 #include "common.hpp"
 #include <hip/hip_complex.h>
@@ -38,9 +41,7 @@ namespace ck
         namespace device
         {
 
-            using hiptensor::allocDevice;
             using hiptensor::ceilDiv;
-            using hiptensor::DeviceDeleter;
             using hiptensor::elementsFromLengths;
 
             using Bilinear        = ck::tensor_operation::element_wise::Bilinear;
@@ -56,6 +57,14 @@ namespace ck
             // Note: We are assuming that the data comes in as an Array of Structures (AOS) format in complex pairs.
             // The argument initialization portion decomposes this data into structure of arrays (SOA) where the
             // real and complex elements can be operated on separately.
+            // For compute-bound problems, the 3M (Gauss) decomposition is used instead:
+            //   T1 = Ar * Br, T2 = Ai * Bi, T3 = (Ar + Ai) * (Br + Bi)
+            //   Er = T1 - T2, Ei = T3 - T1 - T2
+            // which trades one of the 4 contractions for element-wise sums of A and B.
+            // Bandwidth-bound problems skip the decomposition, and are contracted in one pass
+            // over the interleaved data by hiptensor::contractInterleaved.
+            // Planar (split) complex operands already are in SOA format: their planes are used
+            // in place of the unpacked ones, and a planar E is written without re-interleaving.
 
             // Tensor Contraction:
             //   input : A
@@ -204,6 +213,31 @@ namespace ck
 
                 static constexpr index_t NumDTensor = 0;
 
+                // A conjugated operand is loaded as stored by the decomposed contractions,
+                // which negate the terms with its imaginary part through their alphas.
+                static constexpr bool ConjA
+                    = std::is_same_v<AElementwiseOperation, element_wise::Conjugate>;
+                static constexpr bool ConjB
+                    = std::is_same_v<BElementwiseOperation, element_wise::Conjugate>;
+
+                using DecompAElementwiseOperation
+                    = std::conditional_t<ConjA, element_wise::PassThrough, AElementwiseOperation>;
+                using DecompBElementwiseOperation
+                    = std::conditional_t<ConjB, element_wise::PassThrough, BElementwiseOperation>;
+
+                template <typename DecompOp, typename Op>
+                static DecompOp decompElementOp(Op const& op)
+                {
+                    if constexpr(std::is_same_v<DecompOp, Op>)
+                    {
+                        return op;
+                    }
+                    else
+                    {
+                        return DecompOp{};
+                    }
+                }
+
                 // The internal operation that we will decompose the complex operations with.
                 // For complex will be either float or double
                 using ScaleDecompOp = DeviceContractionMultipleD_Xdl_CShuffle<
@@ -216,8 +250,8 @@ namespace ck
                     CShuffleDataType,
                     ck::Tuple<>,
                     DecompE,
-                    AElementwiseOperation,
-                    BElementwiseOperation,
+                    DecompAElementwiseOperation,
+                    DecompBElementwiseOperation,
                     DecompScaleCDEElementwiseOperation,
                     GemmSpec,
                     NumGemmKPrefetchStage,
@@ -264,8 +298,8 @@ namespace ck
                     CShuffleDataType,
                     ck::Tuple<DecompDs>,
                     DecompE,
-                    AElementwiseOperation,
-                    BElementwiseOperation,
+                    DecompAElementwiseOperation,
+                    DecompBElementwiseOperation,
                     DecompBilinearCDEElementwiseOperation,
                     GemmSpec,
                     NumGemmKPrefetchStage,
@@ -301,30 +335,13 @@ namespace ck
                     LoopSched>;
 
                 // Argument
-                struct Argument : public BaseArgument
+                struct Argument : public BaseArgument, public hiptensor::PlanarComplexArgument
                 {
                     using ScaleDecompArgument    = typename ScaleDecompOp::Argument;
                     using BilinearDecompArgument = typename BilinearDecompOp::Argument;
 
-                    Argument(Argument&& other)
-                        : mScaleArgs(
-                            {std::move(other.mScaleArgs[0]), std::move(other.mScaleArgs[1])})
-                        , mBilinearArgs({std::move(other.mBilinearArgs[0]),
-                                         std::move(other.mBilinearArgs[1])})
-                    {
-                    }
-
-                    Argument& operator=(Argument&& other)
-                    {
-                        if(this != &other)
-                        {
-                            mScaleArgs[0]    = std::move(other.mScaleArgs[0]);
-                            mScaleArgs[1]    = std::move(other.mScaleArgs[1]);
-                            mBilinearArgs[0] = std::move(other.mBilinearArgs[0]);
-                            mBilinearArgs[1] = std::move(other.mBilinearArgs[1]);
-                        }
-                        return *this;
-                    }
+                    Argument(Argument&& other)            = default;
+                    Argument& operator=(Argument&& other) = default;
 
                     Argument(const void*                                         p_a_grid,
                              const void*                                         p_b_grid,
@@ -342,66 +359,171 @@ namespace ck
                              BElementwiseOperation                               b_element_op,
                              ScaleCDEElementwiseOperation                        cde_element_op)
                         : element_op(cde_element_op)
+                        , mA_grid(p_a_grid)
+                        , mB_grid(p_b_grid)
+                        , mE_grid(p_e_grid)
+                        , elementsA(elementsFromLengths(a_ms_ks_lengths))
+                        , elementsB(elementsFromLengths(b_ns_ks_lengths))
+                        , elementsE(elementsFromLengths(e_ms_ns_lengths))
+                        , a_ms_ks_lengths(a_ms_ks_lengths)
+                        , a_ms_ks_strides(a_ms_ks_strides)
+                        , b_ns_ks_lengths(b_ns_ks_lengths)
+                        , b_ns_ks_strides(b_ns_ks_strides)
+                        , e_ms_ns_lengths(e_ms_ns_lengths)
+                        , e_ms_ns_strides(e_ms_ns_strides)
+                        , a_element_op(decompElementOp<DecompAElementwiseOperation>(a_element_op))
+                        , b_element_op(decompElementOp<DecompBElementwiseOperation>(b_element_op))
+                        , mAlgo(hiptensor::selectComplexAlgo<DecompCompute>(
+                              elementsA, elementsB, elementsE))
                     {
+                        // The 3M sum planes are made of the operands as stored
+                        if(mAlgo == hiptensor::ComplexAlgo_t::GAUSS_3M && (ConjA || ConjB))
+                        {
+                            mAlgo = hiptensor::ComplexAlgo_t::STANDARD_4M;
+                        }
+
+                        if(mAlgo == hiptensor::ComplexAlgo_t::INTERLEAVED)
+                        {
+                            mInterleavedDesc
+                                = hiptensor::makeInterleavedComplexDesc<NumDimM, NumDimN, NumDimK>(
+                                    a_ms_ks_lengths,
+                                    a_ms_ks_strides,
+                                    b_ns_ks_lengths,
+                                    b_ns_ks_strides,
+                                    e_ms_ns_strides);
+                            mInterleavedDesc.mConjA = ConjA;
+                            mInterleavedDesc.mConjB = ConjB;
+                            return;
+                        }
+
                         // Take the incoming arguments, treat them as complex.
+                        // The real and imaginary planes are carved from the workspace once
+                        // it is attached; until then the decomposed arguments only describe
+                        // the problem.
+                        initDecompArgs();
+
+                        mDecompWorkspaceBytes
+                            = std::max(ScaleDecompOp{}.GetWorkSpaceSize(mScaleArgs[0].get()),
+                                       ScaleDecompOp{}.GetWorkSpaceSize(mScaleArgs[1].get()));
+                        for(auto const& bilinearArgs : mBilinearArgs)
+                        {
+                            if(bilinearArgs)
+                            {
+                                mDecompWorkspaceBytes = std::max(
+                                    mDecompWorkspaceBytes,
+                                    BilinearDecompOp{}.GetWorkSpaceSize(bilinearArgs.get()));
+                            }
+                        }
+                    }
 
-                        // Allocate Real and Imaginary inputs
-                        auto elementsA = elementsFromLengths(a_ms_ks_lengths);
-                        auto elementsB = elementsFromLengths(b_ns_ks_lengths);
-                        elementsE      = elementsFromLengths(e_ms_ns_lengths);
+                    // D is ignored, scale contractions have none
+                    void setPlaneStrides(hiptensor::PlaneStrides const& planeStrides) override
+                    {
+                        using hiptensor::ComplexLayout;
+                        mLayoutA = ComplexLayout::fromPlaneStride(planeStrides[0]);
+                        mLayoutB = ComplexLayout::fromPlaneStride(planeStrides[1]);
+                        mLayoutE = ComplexLayout::fromPlaneStride(planeStrides[3]);
+
+                        mInterleavedDesc.mLayoutA = mLayoutA;
+                        mInterleavedDesc.mLayoutB = mLayoutB;
+                        mInterleavedDesc.mLayoutE = mLayoutE;
+                    }
 
-                        mA_real.reset(nullptr);
-                        mA_imag.reset(nullptr);
-                        mB_real.reset(nullptr);
-                        mB_imag.reset(nullptr);
-                        mE_real.reset(nullptr);
-                        mE_imag.reset(nullptr);
+                    // Workspace layout: the decomposed operations' own workspace, followed
+                    // by the real and imaginary planes of A, B and E. Planar A and B are
+                    // used in place, and get no planes. The 3M decomposition adds the sum
+                    // planes of A and B, and the Ai * Bi correction plane.
+                    size_t workspaceBytes() const
+                    {
+                        using hiptensor::planeBytes;
+                        if(mAlgo == hiptensor::ComplexAlgo_t::INTERLEAVED)
+                        {
+                            return 0;
+                        }
 
-                        mE_grid       = p_e_grid;
-                        auto blockDim = dim3(1024);
+                        auto bytes = planeBytes<char>(mDecompWorkspaceBytes)
+                                     + 2 * planeBytes<DecompE>(elementsE);
+                        if(!mLayoutA.isPlanar())
+                        {
+                            bytes += 2 * planeBytes<DecompA>(elementsA);
+                        }
+                        if(!mLayoutB.isPlanar())
+                        {
+                            bytes += 2 * planeBytes<DecompB>(elementsB);
+                        }
+                        if(mAlgo == hiptensor::ComplexAlgo_t::GAUSS_3M)
+                        {
+                            bytes += planeBytes<DecompA>(elementsA)
+                                     + planeBytes<DecompB>(elementsB)
+                                     + planeBytes<DecompE>(elementsE);
+                        }
+                        return bytes;
+                    }
 
-                        auto decompGrid = [blockDim](auto&       out_r,
-                                                     auto&       out_i,
-                                                     auto const* input_grid,
-                                                     uint32_t    elementCount) {
-                            using DecompT = typename std::decay_t<decltype(out_r)>::element_type;
-                            static_assert(std::is_same_v<
-                                              DecompT,
-                                              typename std::decay_t<decltype(out_i)>::element_type>,
-                                          "r and i buffers must be same type");
-
-                            if(input_grid != nullptr)
-                            {
-                                out_r = std::move(allocDevice<DecompT>(elementCount));
-                                out_i = std::move(allocDevice<DecompT>(elementCount));
+                    void setWorkspace(void* p_workspace)
+                    {
+                        using hiptensor::carvePlane;
+                        using hiptensor::operandPlanes;
+                        using hiptensor::planeBytes;
+                        if(mAlgo == hiptensor::ComplexAlgo_t::INTERLEAVED)
+                        {
+                            return;
+                        }
 
-                                auto gridDim = dim3(ceilDiv(elementCount, blockDim.x));
-                                hiptensor::unpack<<<gridDim, blockDim, 0>>>(
-                                    input_grid, out_r.get(), out_i.get(), elementCount);
-                            }
-                        };
+                        auto* cursor = static_cast<char*>(p_workspace);
+                        if(cursor != nullptr)
+                        {
+                            cursor += planeBytes<char>(mDecompWorkspaceBytes);
+                        }
+
+                        operandPlanes(mA_real, mA_imag, mA_grid, mLayoutA, cursor, elementsA);
+                        operandPlanes(mB_real, mB_imag, mB_grid, mLayoutB, cursor, elementsB);
+                        mE_real = carvePlane<DecompE>(cursor, elementsE);
+                        mE_imag = carvePlane<DecompE>(cursor, elementsE);
+
+                        if(mAlgo == hiptensor::ComplexAlgo_t::GAUSS_3M)
+                        {
+                            mA_sum  = carvePlane<DecompA>(cursor, elementsA);
+                            mB_sum  = carvePlane<DecompB>(cursor, elementsB);
+                            mE_corr = carvePlane<DecompE>(cursor, elementsE);
+                        }
+
+                        initDecompArgs();
+                    }
+
+                    void Print() const
+                    {
+                        if(mAlgo == hiptensor::ComplexAlgo_t::INTERLEAVED)
+                        {
+                            std::cout << "Interleaved" << std::endl;
+                            return;
+                        }
+
+                        std::cout << "ScaleArgs0:" << std::endl;
+                        mScaleArgs[0]->Print();
+                        std::cout << "ScaleArgs1:" << std::endl;
+                        mScaleArgs[1]->Print();
+                        std::cout << "BilinearArgs0:" << std::endl;
+                        mBilinearArgs[0]->Print();
+                        if(mBilinearArgs[1])
+                        {
+                            std::cout << "BilinearArgs1:" << std::endl;
+                            mBilinearArgs[1]->Print();
+                        }
+                    }
 
-                        // Decompose the incoming data from AOS->SOA
-                        decompGrid(mA_real, mA_imag, (const ComplexA*)p_a_grid, elementsA);
-                        decompGrid(mB_real, mB_imag, (const ComplexB*)p_b_grid, elementsB);
-                        decompGrid(mE_real, mE_imag, (const ComplexE*)p_e_grid, elementsE);
-
-                        auto allocScaleArgs = [a_ms_ks_lengths,
-                                               a_ms_ks_strides,
-                                               b_ns_ks_lengths,
-                                               b_ns_ks_strides,
-                                               e_ms_ns_lengths,
-                                               e_ms_ns_strides,
-                                               a_element_op,
-                                               b_element_op](auto&       out_e,
-                                                             auto const& in_a,
-                                                             auto const& in_b,
-                                                             auto const& cde_element_op) {
+                    //  private:
+                    void initDecompArgs()
+                    {
+                        auto allocScaleArgs = [this](auto*       out_e,
+                                                     auto const* in_a,
+                                                     auto const* in_b,
+                                                     auto const& cde_element_op) {
                             return std::make_unique<ScaleDecompArgument>(
-                                in_a.get(),
-                                in_b.get(),
+                                in_a,
+                                in_b,
                                 std::array<void const*, 0>{},
-                                out_e.get(),
+                                out_e,
                                 a_ms_ks_lengths,
                                 a_ms_ks_strides,
                                 b_ns_ks_lengths,
@@ -415,23 +537,16 @@ namespace ck
                                 cde_element_op);
                         };
 
-                        auto allocBilinearArgs = [a_ms_ks_lengths,
-                                                  a_ms_ks_strides,
-                                                  b_ns_ks_lengths,
-                                                  b_ns_ks_strides,
-                                                  e_ms_ns_lengths,
-                                                  e_ms_ns_strides,
-                                                  a_element_op,
-                                                  b_element_op](auto&       out_e,
-                                                                auto const& in_a,
-                                                                auto const& in_b,
-                                                                auto const& in_d,
-                                                                auto const& cde_element_op) {
+                        auto allocBilinearArgs = [this](auto*       out_e,
+                                                        auto const* in_a,
+                                                        auto const* in_b,
+                                                        auto const* in_d,
+                                                        auto const& cde_element_op) {
                             return std::make_unique<BilinearDecompArgument>(
-                                in_a.get(),
-                                in_b.get(),
-                                std::array<void const*, 1>{in_d.get()},
-                                out_e.get(),
+                                in_a,
+                                in_b,
+                                std::array<void const*, 1>{in_d},
+                                out_e,
                                 a_ms_ks_lengths,
                                 a_ms_ks_strides,
                                 b_ns_ks_lengths,
@@ -445,56 +560,91 @@ namespace ck
                                 cde_element_op);
                         };
 
+                        if(mAlgo == hiptensor::ComplexAlgo_t::GAUSS_3M)
+                        {
+                            // T1 into E real, T2 into the correction plane, T3 - T1 into
+                            // E imag. The correction is subtracted from both when packing E.
+                            auto unitScale = DecompScaleCDEElementwiseOperation{1.0f};
+                            mScaleArgs[0]  = allocScaleArgs(mE_real, mA_real, mB_real, unitScale);
+                            mScaleArgs[1]  = allocScaleArgs(mE_corr, mA_imag, mB_imag, unitScale);
+
+                            mBilinearArgs[0] = allocBilinearArgs(
+                                mE_imag,
+                                mA_sum,
+                                mB_sum,
+                                mE_real,
+                                DecompBilinearCDEElementwiseOperation{1.0f, -1.0f});
+                            mBilinearArgs[1].reset();
+                            return;
+                        }
+
+                        // Conjugating A or B negates the terms with its imaginary part
+                        auto signA = ConjA ? -1.0f : 1.0f;
+                        auto signB = ConjB ? -1.0f : 1.0f;
+
                         mScaleArgs[0] = allocScaleArgs(
                             mE_real, mA_real, mB_real, DecompScaleCDEElementwiseOperation{1.0f});
-                        mBilinearArgs[0]
-                            = allocBilinearArgs(mE_real,
-                                                mA_imag,
-                                                mB_imag,
-                                                mE_real,
-                                                DecompBilinearCDEElementwiseOperation{-1.0f, 1.0f});
+                        mBilinearArgs[0] = allocBilinearArgs(
+                            mE_real,
+                            mA_imag,
+                            mB_imag,
+                            mE_real,
+                            DecompBilinearCDEElementwiseOperation{-signA * signB, 1.0f});
 
                         mScaleArgs[1] = allocScaleArgs(
-                            mE_imag, mA_real, mB_imag, DecompScaleCDEElementwiseOperation{1.0f});
+                            mE_imag, mA_real, mB_imag, DecompScaleCDEElementwiseOperation{signB});
                         mBilinearArgs[1]
                             = allocBilinearArgs(mE_imag,
                                                 mA_imag,
                                                 mB_real,
                                                 mE_imag,
-                                                DecompBilinearCDEElementwiseOperation{1.0f, 1.0f});
-                    }
-
-                    void Print() const
-                    {
-                        std::cout << "ScaleArgs0:" << std::endl;
-                        mScaleArgs[0]->Print();
-                        std::cout << "ScaleArgs1:" << std::endl;
-                        mScaleArgs[1]->Print();
-                        std::cout << "BilinearArgs0:" << std::endl;
-                        mBilinearArgs[0]->Print();
-                        std::cout << "BilinearArgs1:" << std::endl;
-                        mBilinearArgs[1]->Print();
+                                                DecompBilinearCDEElementwiseOperation{signA, 1.0f});
                     }
 
-                    //  private:
                     // Each argument set for complex:
                     std::unique_ptr<ScaleDecompArgument>    mScaleArgs[2];
                     std::unique_ptr<BilinearDecompArgument> mBilinearArgs[2];
 
-                    template <typename DataT>
-                    using DeviceArray = std::unique_ptr<DataT, DeviceDeleter>;
+                    // Planes for AOS->SOA, carved from the workspace, or those of planar
+                    // operands
+                    DecompA* mA_real = nullptr;
+                    DecompA* mA_imag = nullptr;
+                    DecompB* mB_real = nullptr;
+                    DecompB* mB_imag = nullptr;
+                    DecompE* mE_real = nullptr;
+                    DecompE* mE_imag = nullptr;
 
-                    // Manage extra memory for AOS->SOA
-                    DeviceArray<DecompA> mA_real;
-                    DeviceArray<DecompA> mA_imag;
-                    DeviceArray<DecompB> mB_real;
-                    DeviceArray<DecompB> mB_imag;
-                    DeviceArray<DecompE> mE_real;
-                    DeviceArray<DecompE> mE_imag;
+                    // 3M only: sum planes of A and B, and the Ai * Bi correction
+                    DecompA* mA_sum  = nullptr;
+                    DecompB* mB_sum  = nullptr;
+                    DecompE* mE_corr = nullptr;
 
                     ScaleCDEElementwiseOperation element_op;
+                    const void*                  mA_grid;
+                    const void*                  mB_grid;
                     void*                        mE_grid;
+                    index_t                      elementsA;
+                    index_t                      elementsB;
                     index_t                      elementsE;
+                    size_t                       mDecompWorkspaceBytes = 0;
+
+                    std::vector<index_t>        a_ms_ks_lengths;
+                    std::vector<index_t>        a_ms_ks_strides;
+                    std::vector<index_t>        b_ns_ks_lengths;
+                    std::vector<index_t>        b_ns_ks_strides;
+                    std::vector<index_t>        e_ms_ns_lengths;
+                    std::vector<index_t>        e_ms_ns_strides;
+                    DecompAElementwiseOperation a_element_op;
+                    DecompBElementwiseOperation b_element_op;
+                    hiptensor::ComplexAlgo_t    mAlgo;
+
+                    // Layouts of the complex operands, interleaved unless set planar
+                    hiptensor::ComplexLayout mLayoutA;
+                    hiptensor::ComplexLayout mLayoutB;
+                    hiptensor::ComplexLayout mLayoutE;
+
+                    // Interleaved only
+                    hiptensor::InterleavedComplexDesc<NumDimM, NumDimN, NumDimK> mInterleavedDesc;
                 };
 
                 // Invoker
@@ -527,21 +677,85 @@ namespace ck
                     float Run(const Argument&     arg,
                               const StreamConfig& stream_config = StreamConfig{})
                     {
+                        auto stream   = stream_config.stream_id_;
+                        auto blockDim = dim3(1024);
+
+                        if(arg.mAlgo == hiptensor::ComplexAlgo_t::INTERLEAVED)
+                        {
+                            auto gridDim = dim3(ceilDiv(arg.elementsE, blockDim.x));
+                            return launch_and_time_kernel(
+                                stream_config,
+                                hiptensor::contractInterleaved<DecompE, NumDimM, NumDimN, NumDimK>,
+                                gridDim,
+                                blockDim,
+                                0,
+                                (const DecompA*)arg.mA_grid,
+                                (const DecompB*)arg.mB_grid,
+                                (const DecompE*)nullptr,
+                                (DecompE*)arg.mE_grid,
+                                arg.mInterleavedDesc,
+                                arg.element_op.scale_,
+                                HIP_vector_type<double, 2>{0.0, 0.0},
+                                static_cast<int64_t>(arg.elementsE));
+                        }
+
+                        auto decompGrid = [stream, blockDim](auto*                    out_r,
+                                                             auto*                    out_i,
+                                                             auto*                    out_s,
+                                                             auto const*              input_grid,
+                                                             hiptensor::ComplexLayout layout,
+                                                             uint32_t elementCount) {
+                            if(input_grid == nullptr || out_r == nullptr)
+                            {
+                                return;
+                            }
+
+                            auto gridDim = dim3(ceilDiv(elementCount, blockDim.x));
+                            if(!layout.isPlanar())
+                            {
+                                hiptensor::unpack<<<gridDim, blockDim, 0, stream>>>(
+                                    input_grid, out_r, out_i, out_s, elementCount);
+                            }
+                            else if(out_s != nullptr)
+                            {
+                                hiptensor::sumPlanes<<<gridDim, blockDim, 0, stream>>>(
+                                    out_r, out_i, out_s, elementCount);
+                            }
+                        };
+
+                        // Decompose the incoming data from AOS->SOA. E is only written by
+                        // the decomposed contractions and does not need to be unpacked.
+                        decompGrid(arg.mA_real,
+                                   arg.mA_imag,
+                                   arg.mA_sum,
+                                   (const ComplexA*)arg.mA_grid,
+                                   arg.mLayoutA,
+                                   arg.elementsA);
+                        decompGrid(arg.mB_real,
+                                   arg.mB_imag,
+                                   arg.mB_sum,
+                                   (const ComplexB*)arg.mB_grid,
+                                   arg.mLayoutB,
+                                   arg.elementsB);
+
                         auto r0 = mScaleInvoker->Run(arg.mScaleArgs[0].get(), stream_config);
                         auto r1 = mScaleInvoker->Run(arg.mScaleArgs[1].get(), stream_config);
                         auto r2 = mBilinearInvoker->Run(arg.mBilinearArgs[0].get(), stream_config);
-                        auto r3 = mBilinearInvoker->Run(arg.mBilinearArgs[1].get(), stream_config);
+                        auto r3 = arg.mBilinearArgs[1] ? mBilinearInvoker->Run(
+                                      arg.mBilinearArgs[1].get(), stream_config)
+                                                       : 0.0f;
 
                         if(arg.mE_grid != nullptr)
                         {
-                            auto blockDim = dim3(1024);
-                            auto gridDim  = dim3(ceilDiv(arg.elementsE, blockDim.x));
-
-                            hiptensor::multiply<<<gridDim, blockDim, 0>>>(arg.mE_real.get(),
-                                                                          arg.mE_imag.get(),
-                                                                          ((ComplexE*)arg.mE_grid),
-                                                                          arg.element_op.scale_,
-                                                                          arg.elementsE);
+                            auto gridDim = dim3(ceilDiv(arg.elementsE, blockDim.x));
+                            hiptensor::multiply<<<gridDim, blockDim, 0, stream>>>(
+                                arg.mE_real,
+                                arg.mE_imag,
+                                arg.mE_corr,
+                                (DecompE*)arg.mE_grid,
+                                arg.mLayoutE,
+                                arg.element_op.scale_,
+                                arg.elementsE);
                         }
 
                         return r0 + r1 + r2 + r3;
@@ -560,10 +774,18 @@ namespace ck
 
                 static bool IsSupportedArgument(const Argument& arg)
                 {
+                    // The interleaved kernel handles any lengths and strides
+                    if(arg.mAlgo == hiptensor::ComplexAlgo_t::INTERLEAVED)
+                    {
+                        return true;
+                    }
+
                     return ScaleDecompOp::IsSupportedArgument(*(arg.mScaleArgs[0].get()))
                            && ScaleDecompOp::IsSupportedArgument(*(arg.mScaleArgs[1].get()))
                            && BilinearDecompOp::IsSupportedArgument(*(arg.mBilinearArgs[0].get()))
-                           && BilinearDecompOp::IsSupportedArgument(*(arg.mBilinearArgs[1].get()));
+                           && (!arg.mBilinearArgs[1]
+                               || BilinearDecompOp::IsSupportedArgument(
+                                   *(arg.mBilinearArgs[1].get())));
                 }
 
                 // polymorphic
@@ -572,23 +794,38 @@ namespace ck
                     return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
                 }
 
+                // polymorphic
+                size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+                {
+                    return dynamic_cast<const Argument*>(p_arg)->workspaceBytes();
+                }
+
                 // polymorphic
                 virtual void SetWorkSpacePointer(BaseArgument*       p_arg,
                                                  void*               p_workspace,
                                                  StreamConfig const& s
                                                  = StreamConfig{}) const override
                 {
-                    // Call the base, then fwd to each arg.
+                    // Carve the planes, then fwd the workspace head to each arg.
                     this->BaseOperator::SetWorkSpacePointer(p_arg, p_workspace, s);
                     auto* arg = dynamic_cast<Argument*>(p_arg);
-                    this->BaseOperator::SetWorkSpacePointer(
-                        arg->mScaleArgs[0].get(), p_workspace, s);
-                    this->BaseOperator::SetWorkSpacePointer(
-                        arg->mScaleArgs[1].get(), p_workspace, s);
-                    this->BaseOperator::SetWorkSpacePointer(
-                        arg->mBilinearArgs[0].get(), p_workspace, s);
-                    this->BaseOperator::SetWorkSpacePointer(
-                        arg->mBilinearArgs[1].get(), p_workspace, s);
+                    arg->setWorkspace(p_workspace);
+                    for(auto const& scaleArgs : arg->mScaleArgs)
+                    {
+                        if(scaleArgs)
+                        {
+                            this->BaseOperator::SetWorkSpacePointer(
+                                scaleArgs.get(), p_workspace, s);
+                        }
+                    }
+                    for(auto const& bilinearArgs : arg->mBilinearArgs)
+                    {
+                        if(bilinearArgs)
+                        {
+                            this->BaseOperator::SetWorkSpacePointer(
+                                bilinearArgs.get(), p_workspace, s);
+                        }
+                    }
                 }
 
                 static auto MakeArgument(
@@ -80,9 +80,11 @@ namespace ck
                                                                                ScaleComplex,
                                                                                CF64>>>& instances)
                 {
+#if !HIPTENSOR_INSTANCE_PRUNED
                     add_device_operation_instances(
                         instances,
                         device_contraction_scale_m6_n6_k6_xdl_c_shuffle_cf64_cf64_cf64_compute_cf64_mnn_instance{});
+#endif // !HIPTENSOR_INSTANCE_PRUNED
                 }
             } // namespace instance
         } // namespace device
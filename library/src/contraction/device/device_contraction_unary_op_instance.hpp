@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_UNARY_OP_INSTANCE_HPP
+#define HIPTENSOR_CONTRACTION_UNARY_OP_INSTANCE_HPP
+
+#include "common.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+                template <index_t... Is>
+                using UnaryS = ck::Sequence<Is...>;
+
+                static constexpr auto UnaryOpGemmMNKPadding
+                    = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+                // Contractions that apply element ops to A and B as they are loaded from
+                // global memory to LDS. DataType is the type of A, B, D and E, and is complex
+                // for the conjugating instances. As the epilogue instances, A, B and D are
+                // accessed with a scalar vector width of 1, so that one instance covers every
+                // stride order of the operands.
+                // op_a(A)[m..., k...] * op_b(B)[n..., k...] + D[m..., n...] = E[m..., n...]
+                // clang-format off
+                template <index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename DataType,
+                          typename AccDataType,
+                          typename DsDataType,
+                          typename AElementwiseOperation,
+                          typename BElementwiseOperation,
+                          typename CDEElementwiseOperation>
+                using device_contraction_unary_op_instance = std::tuple<
+                    //#################################| NumDimM| NumDimN| NumDimK|    AData|    BData|     AccData|    CShuffle|     DsData|    EData|                      A|                      B|                      CDE|                 GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths| CBlockTransfer|
+                    //#################################|        |        |        |     Type|     Type|        Type|    DataType|       Type|     Type|            Elementwise|            Elementwise|              Elementwise|       Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl|ScalarPerVector|
+                    DeviceContractionMultipleD_Xdl_CShuffle< NumDimM, NumDimN, NumDimK, DataType, DataType, AccDataType, AccDataType, DsDataType, DataType, AElementwiseOperation, BElementwiseOperation, CDEElementwiseOperation, UnaryOpGemmMNKPadding,        1,   256,   128,   128,    16,   4,   4,   32,   32,    2,    2, UnaryS<4, 64, 1>, UnaryS<1, 0, 2>, UnaryS<1, 0, 2>,              2,              1,              4,         1, UnaryS<4, 64, 1>, UnaryS<1, 0, 2>, UnaryS<1, 0, 2>,              2,              1,              4,         1,           1,           1,       UnaryS<1, 16, 1, 16>,               1>,
+                    DeviceContractionMultipleD_Xdl_CShuffle< NumDimM, NumDimN, NumDimK, DataType, DataType, AccDataType, AccDataType, DsDataType, DataType, AElementwiseOperation, BElementwiseOperation, CDEElementwiseOperation, UnaryOpGemmMNKPadding,        1,   256,   128,    64,    16,   4,   4,   32,   32,    2,    1, UnaryS<4, 64, 1>, UnaryS<1, 0, 2>, UnaryS<1, 0, 2>,              2,              1,              4,         1, UnaryS<4, 64, 1>, UnaryS<1, 0, 2>, UnaryS<1, 0, 2>,              2,              1,              4,         1,           1,           1,       UnaryS<1, 16, 1, 16>,               1>,
+                    DeviceContractionMultipleD_Xdl_CShuffle< NumDimM, NumDimN, NumDimK, DataType, DataType, AccDataType, AccDataType, DsDataType, DataType, AElementwiseOperation, BElementwiseOperation, CDEElementwiseOperation, UnaryOpGemmMNKPadding,        1,    64,    32,    32,    16,   4,   4,   32,   32,    1,    1, UnaryS<4, 16, 1>, UnaryS<1, 0, 2>, UnaryS<1, 0, 2>,              2,              1,              4,         1, UnaryS<4, 16, 1>, UnaryS<1, 0, 2>, UnaryS<1, 0, 2>,              2,              1,              4,         1,           1,           1,        UnaryS<1, 16, 1, 4>,               1>
+                    >;
+                // clang-format on
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // HIPTENSOR_CONTRACTION_UNARY_OP_INSTANCE_HPP
@@ -106,6 +106,31 @@ namespace ck
                 hipDoubleComplex beta_;
             };
 
+            // Complex conjugate, the HIPTENSOR_OP_CONJ operator of A or B. The complex
+            // contractions do not evaluate it element-wise: they flip the sign of the
+            // imaginary part as they load the operand.
+            struct Conjugate
+            {
+                template <typename Y, typename X>
+                __host__ __device__ void operator()(Y& y, const X& x) const;
+
+                template <>
+                __host__ __device__ void
+                    operator()<hipFloatComplex, hipFloatComplex>(hipFloatComplex&       y,
+                                                                 const hipFloatComplex& x) const
+                {
+                    y = hipConjf(x);
+                };
+
+                template <>
+                __host__ __device__ void
+                    operator()<hipDoubleComplex, hipDoubleComplex>(hipDoubleComplex&       y,
+                                                                   const hipDoubleComplex& x) const
+                {
+                    y = hipConj(x);
+                };
+            };
+
         } // namespace element_wise
     } // namespace tensor_operation
 } // namespace ck
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_ELEMENT_WISE_OPERATION_EPILOGUE_HPP
+#define HIPTENSOR_ELEMENT_WISE_OPERATION_EPILOGUE_HPP
+
+#include <element_wise_operation.hpp>
+
+#include "../contraction_epilogue.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace element_wise
+        {
+
+            // CDE op of contractions with an epilogue, applied to the accumulator before it
+            // is stored: e = activation(alpha * c + beta * d + bias). D0 is the C tensor and
+            // D1 the bias, broadcast by zero strides. Computes in float and converts to the
+            // type of E last, so f32 results may be stored as bf16 or f16.
+            struct Epilogue
+            {
+                Epilogue(float                 alpha,
+                         float                 beta,
+                         hiptensorActivation_t activation,
+                         float                 lower,
+                         float                 upper,
+                         bool                  hasBias)
+                    : alpha_(alpha)
+                    , beta_(beta)
+                    , activation_(activation)
+                    , lower_(lower)
+                    , upper_(upper)
+                    , hasBias_(hasBias)
+                {
+                }
+
+                template <typename E, typename C, typename D, typename Bias>
+                __host__ __device__ constexpr void
+                    operator()(E& e, const C& c, const D& d, const Bias& bias) const
+                {
+                    float x = alpha_ * type_convert<float>(c);
+                    if(beta_ != 0.0f)
+                    {
+                        x += beta_ * type_convert<float>(d);
+                    }
+                    if(hasBias_)
+                    {
+                        x += type_convert<float>(bias);
+                    }
+                    e = type_convert<E>(hiptensor::applyActivation(x, activation_, lower_, upper_));
+                }
+
+                float                 alpha_;
+                float                 beta_;
+                hiptensorActivation_t activation_;
+                float                 lower_;
+                float                 upper_;
+                bool                  hasBias_;
+            };
+
+        } // namespace element_wise
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // HIPTENSOR_ELEMENT_WISE_OPERATION_EPILOGUE_HPP
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "device_grouped_contraction_instance.hpp"
+#include "hiptensor_grouped_contraction_instances.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+
+                // A[m0, m1, ..., k0, k1, ...] * B[n0, n1, ..., k0, k1, ...], one per group
+                using device_grouped_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f64_f64_f64_f64_instance
+                    = device_grouped_contraction_f64_instance<6, 6, 6, F64_Tuple, Bilinear>;
+
+                void add_device_grouped_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f64_f64_f64_f64_instance(
+                    std::vector<std::unique_ptr<DeviceGroupedContractionMultipleD<6,
+                                                                                  6,
+                                                                                  6,
+                                                                                  F64,
+                                                                                  F64,
+                                                                                  F64_Tuple,
+                                                                                  F64,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  Bilinear>>>& instances)
+                {
+#if !HIPTENSOR_INSTANCE_PRUNED
+                    add_device_operation_instances(
+                        instances,
+                        device_grouped_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f64_f64_f64_f64_instance{});
+#endif // !HIPTENSOR_INSTANCE_PRUNED
+                }
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_GROUPED_CONTRACTION_INSTANCE_HPP
+#define HIPTENSOR_GROUPED_CONTRACTION_INSTANCE_HPP
+
+#include <device_grouped_contraction_multiple_d_xdl_cshuffle.hpp>
+
+#include "../contraction_types.hpp"
+#include "common.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+                template <index_t... Is>
+                using GroupedS = ck::Sequence<Is...>;
+
+                using F32         = float;
+                using F64         = double;
+                using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+                static constexpr auto GroupedGemmMNKPadding
+                    = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+                // Grouped contraction instance that exposes its block tile, so that the
+                // solution with the least padded work over all groups can be selected.
+                template <index_t MPerBlock, index_t NPerBlock, typename DeviceOpImpl>
+                struct BlockTiled : public DeviceOpImpl, public hiptensor::BlockTiledDeviceOp
+                {
+                    std::array<int32_t, 2> blockTile() const override
+                    {
+                        return {MPerBlock, NPerBlock};
+                    }
+                };
+
+                // As the batched instances, grouped instances read A and B with a scalar
+                // vector width of 1, so that groups of any stride order share one launch.
+                // A[m0, ..., k0, ...] * B[n0, ..., k0, ...] + D[m0, ..., n0, ...] = E[m0, ..., n0, ...]
+                // clang-format off
+                template <index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename DsDataType,
+                          typename CDEElementwiseOp>
+                using device_grouped_contraction_f32_instance = std::tuple<
+                    //#########|    M|    N|                                    | NumDimM| NumDimN| NumDimK| AData| BData| AccData| CShuffle|      DsData| EData|           A|           B|              CDE|                  GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|     ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|     BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths| CBlockTransfer|
+                    //#########| Tile| Tile|                                    |        |        |        |  Type|  Type|    Type| DataType|        Type|  Type| Elementwise| Elementwise|      Elementwise|        Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|      ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|      ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl|  ScalarPerVector|
+                    BlockTiled<  128,  128, DeviceGroupedContractionMultipleD_Xdl_CShuffle< NumDimM, NumDimN, NumDimK,   F32,   F32,     F32,      F32,  DsDataType,   F32, PassThrough, PassThrough, CDEElementwiseOp, GroupedGemmMNKPadding,        1,   256,   128,   128,    16,   4,   4,   32,   32,    2,    2, GroupedS<4, 64, 1>,  GroupedS<1, 0, 2>,  GroupedS<1, 0, 2>,              2,              1,              4,         1, GroupedS<4, 64, 1>,  GroupedS<1, 0, 2>,  GroupedS<1, 0, 2>,              2,              1,              4,         1,           1,           1,      GroupedS<1, 16, 1, 16>,               1>>,
+                    BlockTiled<   32,   32, DeviceGroupedContractionMultipleD_Xdl_CShuffle< NumDimM, NumDimN, NumDimK,   F32,   F32,     F32,      F32,  DsDataType,   F32, PassThrough, PassThrough, CDEElementwiseOp, GroupedGemmMNKPadding,        1,    64,    32,    32,    16,   4,   4,   32,   32,    1,    1, GroupedS<4, 16, 1>,  GroupedS<1, 0, 2>,  GroupedS<1, 0, 2>,              2,              1,              4,         1, GroupedS<4, 16, 1>,  GroupedS<1, 0, 2>,  GroupedS<1, 0, 2>,              2,              1,              4,         1,           1,           1,       GroupedS<1, 16, 1, 4>,               1>>
+                    >;
+
+                template <index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename DsDataType,
+                          typename CDEElementwiseOp>
+                using device_grouped_contraction_f64_instance = std::tuple<
+                    //#########|    M|    N|                                    | NumDimM| NumDimN| NumDimK| AData| BData| AccData| CShuffle|      DsData| EData|           A|           B|              CDE|                  GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|     ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|     BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths| CBlockTransfer|
+                    //#########| Tile| Tile|                                    |        |        |        |  Type|  Type|    Type| DataType|        Type|  Type| Elementwise| Elementwise|      Elementwise|        Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|      ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|      ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl|  ScalarPerVector|
+                    BlockTiled<  128,  128, DeviceGroupedContractionMultipleD_Xdl_CShuffle< NumDimM, NumDimN, NumDimK,   F64,   F64,     F64,      F64,  DsDataType,   F64, PassThrough, PassThrough, CDEElementwiseOp, GroupedGemmMNKPadding,        1,   256,   128,   128,    16,   2,   2,   16,   16,    4,    4, GroupedS<8, 32, 1>,  GroupedS<1, 0, 2>,  GroupedS<1, 0, 2>,              2,              1,              2,         1, GroupedS<8, 32, 1>,  GroupedS<1, 0, 2>,  GroupedS<1, 0, 2>,              2,              1,              2,         1,           1,           1,      GroupedS<1, 16, 1, 16>,               1>>,
+                    BlockTiled<   32,   32, DeviceGroupedContractionMultipleD_Xdl_CShuffle< NumDimM, NumDimN, NumDimK,   F64,   F64,     F64,      F64,  DsDataType,   F64, PassThrough, PassThrough, CDEElementwiseOp, GroupedGemmMNKPadding,        1,    64,    32,    32,    16,   2,   2,   16,   16,    2,    2,  GroupedS<8, 8, 1>,  GroupedS<1, 0, 2>,  GroupedS<1, 0, 2>,              2,              1,              2,         1,  GroupedS<8, 8, 1>,  GroupedS<1, 0, 2>,  GroupedS<1, 0, 2>,              2,              1,              2,         1,           1,           1,        GroupedS<1, 8, 1, 8>,               1>>
+                    >;
+                // clang-format on
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // HIPTENSOR_GROUPED_CONTRACTION_INSTANCE_HPP
@@ -0,0 +1,240 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef BATCHED_CONTRACTION_HPP
+#define BATCHED_CONTRACTION_HPP
+
+#include <device_batched_contraction_multiple_d.hpp>
+
+#include "../contraction_meta_traits.hpp"
+#include "common.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+                using F32         = float;
+                using F32_Tuple   = ck::Tuple<F32>;
+                using F64         = double;
+                using F64_Tuple   = ck::Tuple<F64>;
+                using Empty_Tuple = ck::Tuple<>;
+
+                using Bilinear    = element_wise::Bilinear;
+                using PassThrough = element_wise::PassThrough;
+                using Scale       = element_wise::Scale;
+
+                void add_device_batched_contraction_bilinear_g4_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_instance(
+                    std::vector<std::unique_ptr<DeviceBatchedContractionMultipleD<MaxNumDimsG,
+                                                                                  6,
+                                                                                  6,
+                                                                                  6,
+                                                                                  F32,
+                                                                                  F32,
+                                                                                  F32_Tuple,
+                                                                                  F32,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  Bilinear>>>& instances);
+
+                void add_device_batched_contraction_bilinear_g4_m6_n6_k6_xdl_c_shuffle_f64_f64_f64_f64_instance(
+                    std::vector<std::unique_ptr<DeviceBatchedContractionMultipleD<MaxNumDimsG,
+                                                                                  6,
+                                                                                  6,
+                                                                                  6,
+                                                                                  F64,
+                                                                                  F64,
+                                                                                  F64_Tuple,
+                                                                                  F64,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  Bilinear>>>& instances);
+
+                void add_device_batched_contraction_scale_g4_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_instance(
+                    std::vector<std::unique_ptr<DeviceBatchedContractionMultipleD<MaxNumDimsG,
+                                                                                  6,
+                                                                                  6,
+                                                                                  6,
+                                                                                  F32,
+                                                                                  F32,
+                                                                                  Empty_Tuple,
+                                                                                  F32,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  Scale>>>& instances);
+
+                void add_device_batched_contraction_scale_g4_m6_n6_k6_xdl_c_shuffle_f64_f64_f64_instance(
+                    std::vector<std::unique_ptr<DeviceBatchedContractionMultipleD<MaxNumDimsG,
+                                                                                  6,
+                                                                                  6,
+                                                                                  6,
+                                                                                  F64,
+                                                                                  F64,
+                                                                                  Empty_Tuple,
+                                                                                  F64,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  Scale>>>& instances);
+
+                // Batched contraction + Bilinear
+                template <index_t NumDimG,
+                          index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename ADataType,
+                          typename BDataType,
+                          typename EDataType>
+                struct DeviceOperationInstanceFactory<
+                    ck::tensor_operation::device::DeviceBatchedContractionMultipleD<
+                        NumDimG,
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<EDataType>,
+                        EDataType,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::Bilinear>>
+                {
+                    using DeviceOp = DeviceBatchedContractionMultipleD<
+                        NumDimG,
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<EDataType>,
+                        EDataType,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::Bilinear>;
+
+                    static auto GetInstances()
+                    {
+                        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+                        if constexpr(is_same_v<ADataType, float> && is_same_v<BDataType, float>
+                                     && is_same_v<EDataType, float>)
+                        {
+                            if constexpr(NumDimG == MaxNumDimsG && NumDimM == 6 && NumDimN == 6
+                                         && NumDimK == 6)
+                            {
+                                add_device_batched_contraction_bilinear_g4_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        if constexpr(is_same_v<ADataType, double> && is_same_v<BDataType, double>
+                                     && is_same_v<EDataType, double>)
+                        {
+                            if constexpr(NumDimG == MaxNumDimsG && NumDimM == 6 && NumDimN == 6
+                                         && NumDimK == 6)
+                            {
+                                add_device_batched_contraction_bilinear_g4_m6_n6_k6_xdl_c_shuffle_f64_f64_f64_f64_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        return op_ptrs;
+                    }
+                };
+
+                // Batched contraction + Scale
+                template <index_t NumDimG,
+                          index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename ADataType,
+                          typename BDataType,
+                          typename EDataType>
+                struct DeviceOperationInstanceFactory<
+                    ck::tensor_operation::device::DeviceBatchedContractionMultipleD<
+                        NumDimG,
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<>,
+                        EDataType,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::Scale>>
+                {
+                    using DeviceOp = DeviceBatchedContractionMultipleD<
+                        NumDimG,
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<>,
+                        EDataType,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::Scale>;
+
+                    static auto GetInstances()
+                    {
+                        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+                        if constexpr(is_same_v<ADataType, float> && is_same_v<BDataType, float>
+                                     && is_same_v<EDataType, float>)
+                        {
+                            if constexpr(NumDimG == MaxNumDimsG && NumDimM == 6 && NumDimN == 6
+                                         && NumDimK == 6)
+                            {
+                                add_device_batched_contraction_scale_g4_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        if constexpr(is_same_v<ADataType, double> && is_same_v<BDataType, double>
+                                     && is_same_v<EDataType, double>)
+                        {
+                            if constexpr(NumDimG == MaxNumDimsG && NumDimM == 6 && NumDimN == 6
+                                         && NumDimK == 6)
+                            {
+                                add_device_batched_contraction_scale_g4_m6_n6_k6_xdl_c_shuffle_f64_f64_f64_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        return op_ptrs;
+                    }
+                };
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // BATCHED_CONTRACTION_HPP
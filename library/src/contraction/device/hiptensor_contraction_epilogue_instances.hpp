@@ -0,0 +1,155 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CONTRACTION_EPILOGUE_HPP
+#define CONTRACTION_EPILOGUE_HPP
+
+#include "common.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+                using F32  = float;
+                using F16  = ck::half_t;
+                using BF16 = ck::bhalf_t;
+
+                using Epilogue    = element_wise::Epilogue;
+                using PassThrough = element_wise::PassThrough;
+
+                void add_device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_instance(
+                    std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                           6,
+                                                                           6,
+                                                                           F32,
+                                                                           F32,
+                                                                           ck::Tuple<F32, F32>,
+                                                                           F32,
+                                                                           PassThrough,
+                                                                           PassThrough,
+                                                                           Epilogue,
+                                                                           F32>>>& instances);
+
+                void add_device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_bf16_bf16_instance(
+                    std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                           6,
+                                                                           6,
+                                                                           F32,
+                                                                           F32,
+                                                                           ck::Tuple<BF16, F32>,
+                                                                           BF16,
+                                                                           PassThrough,
+                                                                           PassThrough,
+                                                                           Epilogue,
+                                                                           F32>>>& instances);
+
+                void add_device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_f16_f16_instance(
+                    std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                           6,
+                                                                           6,
+                                                                           F32,
+                                                                           F32,
+                                                                           ck::Tuple<F16, F32>,
+                                                                           F16,
+                                                                           PassThrough,
+                                                                           PassThrough,
+                                                                           Epilogue,
+                                                                           F32>>>& instances);
+
+                // Contraction + Epilogue, f32 A and B with f32, bf16 or f16 C and D
+                template <index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename ADataType,
+                          typename BDataType,
+                          typename EDataType,
+                          typename ComputeDataType>
+                struct DeviceOperationInstanceFactory<
+                    ck::tensor_operation::device::DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<EDataType, F32>,
+                        EDataType,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::Epilogue,
+                        ComputeDataType>>
+                {
+                    using DeviceOp = DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<EDataType, F32>,
+                        EDataType,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::PassThrough,
+                        ck::tensor_operation::element_wise::Epilogue,
+                        ComputeDataType>;
+
+                    static auto GetInstances()
+                    {
+                        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+                        if constexpr(is_same_v<ADataType, float> && is_same_v<BDataType, float>
+                                     && is_same_v<ComputeDataType, float>
+                                     && NumDimM == 6 && NumDimN == 6 && NumDimK == 6)
+                        {
+                            if constexpr(is_same_v<EDataType, float>)
+                            {
+                                add_device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<EDataType, ck::bhalf_t>)
+                            {
+                                add_device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_bf16_bf16_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<EDataType, ck::half_t>)
+                            {
+                                add_device_contraction_epilogue_m6_n6_k6_xdl_c_shuffle_f32_f32_f16_f16_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        return op_ptrs;
+                    }
+                };
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // CONTRACTION_EPILOGUE_HPP
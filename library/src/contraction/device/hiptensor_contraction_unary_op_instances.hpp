@@ -0,0 +1,509 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CONTRACTION_UNARY_OP_HPP
+#define CONTRACTION_UNARY_OP_HPP
+
+#include "common.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            namespace instance
+            {
+                using F32         = float;
+                using CF32        = hipFloatComplex;
+                using Empty_Tuple = ck::Tuple<>;
+                using F32_Tuple   = ck::Tuple<F32>;
+                using CF32_Tuple  = ck::Tuple<CF32>;
+
+                using Bilinear        = element_wise::Bilinear;
+                using BilinearComplex = element_wise::BilinearComplex;
+                using Conjugate       = element_wise::Conjugate;
+                using PassThrough     = element_wise::PassThrough;
+                using Scale           = element_wise::Scale;
+                using ScaleComplex    = element_wise::ScaleComplex;
+                using UnarySqrt       = element_wise::UnarySqrt;
+
+                void
+                    add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_sqrt_a_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               F32,
+                                                                               F32,
+                                                                               Empty_Tuple,
+                                                                               F32,
+                                                                               UnarySqrt,
+                                                                               PassThrough,
+                                                                               Scale,
+                                                                               F32>>>& instances);
+
+                void
+                    add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_sqrt_b_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               F32,
+                                                                               F32,
+                                                                               Empty_Tuple,
+                                                                               F32,
+                                                                               PassThrough,
+                                                                               UnarySqrt,
+                                                                               Scale,
+                                                                               F32>>>& instances);
+
+                void
+                    add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_sqrt_ab_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               F32,
+                                                                               F32,
+                                                                               Empty_Tuple,
+                                                                               F32,
+                                                                               UnarySqrt,
+                                                                               UnarySqrt,
+                                                                               Scale,
+                                                                               F32>>>& instances);
+
+                void
+                    add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_compute_cf32_conj_a_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               CF32,
+                                                                               CF32,
+                                                                               Empty_Tuple,
+                                                                               CF32,
+                                                                               Conjugate,
+                                                                               PassThrough,
+                                                                               ScaleComplex,
+                                                                               CF32>>>& instances);
+
+                void
+                    add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_compute_cf32_conj_b_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               CF32,
+                                                                               CF32,
+                                                                               Empty_Tuple,
+                                                                               CF32,
+                                                                               PassThrough,
+                                                                               Conjugate,
+                                                                               ScaleComplex,
+                                                                               CF32>>>& instances);
+
+                void
+                    add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_compute_cf32_conj_ab_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               CF32,
+                                                                               CF32,
+                                                                               Empty_Tuple,
+                                                                               CF32,
+                                                                               Conjugate,
+                                                                               Conjugate,
+                                                                               ScaleComplex,
+                                                                               CF32>>>& instances);
+
+                void
+                    add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_sqrt_a_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               F32,
+                                                                               F32,
+                                                                               F32_Tuple,
+                                                                               F32,
+                                                                               UnarySqrt,
+                                                                               PassThrough,
+                                                                               Bilinear,
+                                                                               F32>>>& instances);
+
+                void
+                    add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_sqrt_b_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               F32,
+                                                                               F32,
+                                                                               F32_Tuple,
+                                                                               F32,
+                                                                               PassThrough,
+                                                                               UnarySqrt,
+                                                                               Bilinear,
+                                                                               F32>>>& instances);
+
+                void
+                    add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_sqrt_ab_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               F32,
+                                                                               F32,
+                                                                               F32_Tuple,
+                                                                               F32,
+                                                                               UnarySqrt,
+                                                                               UnarySqrt,
+                                                                               Bilinear,
+                                                                               F32>>>& instances);
+
+                void
+                    add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_cf32_compute_cf32_conj_a_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               CF32,
+                                                                               CF32,
+                                                                               CF32_Tuple,
+                                                                               CF32,
+                                                                               Conjugate,
+                                                                               PassThrough,
+                                                                               BilinearComplex,
+                                                                               CF32>>>& instances);
+
+                void
+                    add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_cf32_compute_cf32_conj_b_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               CF32,
+                                                                               CF32,
+                                                                               CF32_Tuple,
+                                                                               CF32,
+                                                                               PassThrough,
+                                                                               Conjugate,
+                                                                               BilinearComplex,
+                                                                               CF32>>>& instances);
+
+                void
+                    add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_cf32_compute_cf32_conj_ab_instance(
+                        std::vector<std::unique_ptr<DeviceContractionMultipleD<6,
+                                                                               6,
+                                                                               6,
+                                                                               CF32,
+                                                                               CF32,
+                                                                               CF32_Tuple,
+                                                                               CF32,
+                                                                               Conjugate,
+                                                                               Conjugate,
+                                                                               BilinearComplex,
+                                                                               CF32>>>& instances);
+
+                // Contraction + Scale, with sqrt(A) and/or sqrt(B)
+                template <index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename ADataType,
+                          typename BDataType,
+                          typename EDataType,
+                          typename AElementwiseOperation,
+                          typename BElementwiseOperation,
+                          typename ComputeDataType>
+                struct DeviceOperationInstanceFactory<
+                    ck::tensor_operation::device::DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<>,
+                        EDataType,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        ck::tensor_operation::element_wise::Scale,
+                        ComputeDataType>>
+                {
+                    using DeviceOp = DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<>,
+                        EDataType,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        ck::tensor_operation::element_wise::Scale,
+                        ComputeDataType>;
+
+                    static auto GetInstances()
+                    {
+                        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+                        if constexpr(is_same_v<ADataType, float> && is_same_v<BDataType, float>
+                                     && is_same_v<EDataType, float>
+                                     && is_same_v<ComputeDataType, float> && NumDimM == 6
+                                     && NumDimN == 6 && NumDimK == 6)
+                        {
+                            if constexpr(is_same_v<AElementwiseOperation, UnarySqrt>
+                                         && is_same_v<BElementwiseOperation, PassThrough>)
+                            {
+                                add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_sqrt_a_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<AElementwiseOperation, PassThrough>
+                                              && is_same_v<BElementwiseOperation, UnarySqrt>)
+                            {
+                                add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_sqrt_b_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<AElementwiseOperation, UnarySqrt>
+                                              && is_same_v<BElementwiseOperation, UnarySqrt>)
+                            {
+                                add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_sqrt_ab_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        return op_ptrs;
+                    }
+                };
+
+                // Contraction + Bilinear, with sqrt(A) and/or sqrt(B)
+                template <index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename ADataType,
+                          typename BDataType,
+                          typename DsDataType,
+                          typename EDataType,
+                          typename AElementwiseOperation,
+                          typename BElementwiseOperation,
+                          typename ComputeDataType>
+                struct DeviceOperationInstanceFactory<
+                    ck::tensor_operation::device::DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<DsDataType>,
+                        EDataType,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        ck::tensor_operation::element_wise::Bilinear,
+                        ComputeDataType>>
+                {
+                    using DeviceOp = DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        ADataType,
+                        BDataType,
+                        ck::Tuple<DsDataType>,
+                        EDataType,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        ck::tensor_operation::element_wise::Bilinear,
+                        ComputeDataType>;
+
+                    static auto GetInstances()
+                    {
+                        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+                        if constexpr(is_same_v<ADataType, float> && is_same_v<BDataType, float>
+                                     && is_same_v<DsDataType, float> && is_same_v<EDataType, float>
+                                     && is_same_v<ComputeDataType, float> && NumDimM == 6
+                                     && NumDimN == 6 && NumDimK == 6)
+                        {
+                            if constexpr(is_same_v<AElementwiseOperation, UnarySqrt>
+                                         && is_same_v<BElementwiseOperation, PassThrough>)
+                            {
+                                add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_sqrt_a_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<AElementwiseOperation, PassThrough>
+                                              && is_same_v<BElementwiseOperation, UnarySqrt>)
+                            {
+                                add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_sqrt_b_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<AElementwiseOperation, UnarySqrt>
+                                              && is_same_v<BElementwiseOperation, UnarySqrt>)
+                            {
+                                add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_f32_f32_f32_f32_sqrt_ab_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        return op_ptrs;
+                    }
+                };
+
+                // Complex Contraction + Scale, with conj(A) and/or conj(B)
+                template <index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename ADataType,
+                          typename BDataType,
+                          typename EDataType,
+                          typename AElementwiseOperation,
+                          typename BElementwiseOperation,
+                          typename ComputeDataType>
+                struct DeviceOperationInstanceFactory<
+                    ck::tensor_operation::device::DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        HIP_vector_type<ADataType, 2>,
+                        HIP_vector_type<BDataType, 2>,
+                        ck::Tuple<>,
+                        HIP_vector_type<EDataType, 2>,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        ck::tensor_operation::element_wise::ScaleComplex,
+                        HIP_vector_type<ComputeDataType, 2>>>
+                {
+                    using DeviceOp = DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        HIP_vector_type<ADataType, 2>,
+                        HIP_vector_type<BDataType, 2>,
+                        ck::Tuple<>,
+                        HIP_vector_type<EDataType, 2>,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        ck::tensor_operation::element_wise::ScaleComplex,
+                        HIP_vector_type<ComputeDataType, 2>>;
+
+                    static auto GetInstances()
+                    {
+                        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+                        if constexpr(is_same_v<ADataType, float> && is_same_v<BDataType, float>
+                                     && is_same_v<EDataType, float>
+                                     && is_same_v<ComputeDataType, float> && NumDimM == 6
+                                     && NumDimN == 6 && NumDimK == 6)
+                        {
+                            if constexpr(is_same_v<AElementwiseOperation, Conjugate>
+                                         && is_same_v<BElementwiseOperation, PassThrough>)
+                            {
+                                add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_compute_cf32_conj_a_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<AElementwiseOperation, PassThrough>
+                                              && is_same_v<BElementwiseOperation, Conjugate>)
+                            {
+                                add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_compute_cf32_conj_b_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<AElementwiseOperation, Conjugate>
+                                              && is_same_v<BElementwiseOperation, Conjugate>)
+                            {
+                                add_device_contraction_scale_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_compute_cf32_conj_ab_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        return op_ptrs;
+                    }
+                };
+
+                // Complex Contraction + Bilinear, with conj(A) and/or conj(B)
+                template <index_t NumDimM,
+                          index_t NumDimN,
+                          index_t NumDimK,
+                          typename ADataType,
+                          typename BDataType,
+                          typename DsDataType,
+                          typename EDataType,
+                          typename AElementwiseOperation,
+                          typename BElementwiseOperation,
+                          typename ComputeDataType>
+                struct DeviceOperationInstanceFactory<
+                    ck::tensor_operation::device::DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        HIP_vector_type<ADataType, 2>,
+                        HIP_vector_type<BDataType, 2>,
+                        ck::Tuple<HIP_vector_type<DsDataType, 2>>,
+                        HIP_vector_type<EDataType, 2>,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        ck::tensor_operation::element_wise::BilinearComplex,
+                        HIP_vector_type<ComputeDataType, 2>>>
+                {
+                    using DeviceOp = DeviceContractionMultipleD<
+                        NumDimM,
+                        NumDimN,
+                        NumDimK,
+                        HIP_vector_type<ADataType, 2>,
+                        HIP_vector_type<BDataType, 2>,
+                        ck::Tuple<HIP_vector_type<DsDataType, 2>>,
+                        HIP_vector_type<EDataType, 2>,
+                        AElementwiseOperation,
+                        BElementwiseOperation,
+                        ck::tensor_operation::element_wise::BilinearComplex,
+                        HIP_vector_type<ComputeDataType, 2>>;
+
+                    static auto GetInstances()
+                    {
+                        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+                        if constexpr(is_same_v<ADataType, float> && is_same_v<BDataType, float>
+                                     && is_same_v<DsDataType, float> && is_same_v<EDataType, float>
+                                     && is_same_v<ComputeDataType, float> && NumDimM == 6
+                                     && NumDimN == 6 && NumDimK == 6)
+                        {
+                            if constexpr(is_same_v<AElementwiseOperation, Conjugate>
+                                         && is_same_v<BElementwiseOperation, PassThrough>)
+                            {
+                                add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_cf32_compute_cf32_conj_a_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<AElementwiseOperation, PassThrough>
+                                              && is_same_v<BElementwiseOperation, Conjugate>)
+                            {
+                                add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_cf32_compute_cf32_conj_b_instance(
+                                    op_ptrs);
+                            }
+                            else if constexpr(is_same_v<AElementwiseOperation, Conjugate>
+                                              && is_same_v<BElementwiseOperation, Conjugate>)
+                            {
+                                add_device_contraction_bilinear_m6_n6_k6_xdl_c_shuffle_cf32_cf32_cf32_cf32_compute_cf32_conj_ab_instance(
+                                    op_ptrs);
+                            }
+                        }
+
+                        return op_ptrs;
+                    }
+                };
+
+            } // namespace instance
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // CONTRACTION_UNARY_OP_HPP
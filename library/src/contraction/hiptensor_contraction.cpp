@@ -25,13 +25,20 @@
  *******************************************************************************/
 #include <hiptensor/hiptensor.hpp>
 
+#include "api_recorder.hpp"
+#include "contraction_batched_solution_instances.hpp"
+#include "contraction_epilogue.hpp"
+#include "contraction_operand_view.hpp"
 #include "contraction_selection.hpp"
 #include "contraction_solution.hpp"
 #include "contraction_solution_instances.hpp"
 #include "contraction_solution_registry.hpp"
+#include "device_scalars.hpp"
 #include "handle.hpp"
 #include "hip_device.hpp"
 #include "logger.hpp"
+#include "util.hpp"
+#include "workspace_arena.hpp"
 
 #include "hiptensor_options.hpp"
 
@@ -46,26 +53,53 @@ inline auto toContractionSolutionVec(std::vector<void*> const& v)
     return result;
 }
 
-inline auto toContractionSolutionVec(
-    std::unordered_map<std::size_t, hiptensor::ContractionSolution*> const& map)
+// Solutions for the operation and data types of a contraction descriptor, restricted
+// to the explicit candidates of the find, if any. Only the matching solution family
+// is instantiated. Descriptors with batch (Hadamard) modes are contracted by batched
+// solutions, with the batch modes as their batch dimensions.
+inline auto queryContractionSolutions(hiptensorContractionDescriptor_t const* desc,
+                                      hiptensorContractionFind_t const*       find)
 {
-    auto result = std::vector<hiptensor::ContractionSolution*>(map.size());
-    transform(map.begin(), map.end(), result.begin(), [](auto p) { return p.second; });
-    return result;
-}
+    hiptensor::ContractionSolutionRegistry* instances
+        = hiptensor::ContractionSolutionInstances::instance().get();
+    if(hiptensor::hasBatchModes(*desc))
+    {
+        instances = hiptensor::BatchedContractionSolutionInstances::instance().get();
+    }
 
-inline auto toVoidVec(std::vector<hiptensor::ContractionSolution*> const& v)
-{
-    auto result = std::vector<void*>(v.size());
-    transform(v.begin(), v.end(), result.begin(), [](auto* p) { return (void*)p; });
-    return result;
-}
+    // Epilogue solutions take C as their first D tensor, always typed as D
+    auto opCDE     = (hiptensor::ContractionOpId_t)desc->mContractionOpId;
+    auto typeC     = opCDE == hiptensor::ContractionOpId_t::EPILOGUE ? desc->mTensorDesc[3].mType
+                                                                     : desc->mTensorDesc[2].mType;
+    auto solutionQ = instances->querySolutions(opCDE,
+                                               desc->mTensorDesc[0].mType,
+                                               desc->mTensorDesc[1].mType,
+                                               typeC,
+                                               desc->mTensorDesc[3].mType,
+                                               desc->mComputeType);
+
+    // The unary operators of A and B are instantiated with the solutions, but are not part
+    // of the family key
+    auto opA       = desc->mTensorDesc[0].mUnaryOp;
+    auto opB       = desc->mTensorDesc[1].mUnaryOp;
+    auto solutions = solutionQ.solutionList();
+    solutions.erase(std::remove_if(solutions.begin(),
+                                   solutions.end(),
+                                   [opA, opB](hiptensor::ContractionSolution* solution) {
+                                       return solution->params()->opA() != opA
+                                              || solution->params()->opB() != opB;
+                                   }),
+                    solutions.end());
+    solutionQ = hiptensor::ContractionSolutionRegistry::Query{solutions};
+
+    if(!find->mCandidates.empty())
+    {
+        solutionQ = solutionQ
+                    && hiptensor::ContractionSolutionRegistry::Query{
+                        toContractionSolutionVec(find->mCandidates)};
+    }
 
-inline auto toVoidVec(std::unordered_map<std::size_t, hiptensor::ContractionSolution*> const& map)
-{
-    auto result = std::vector<void*>(map.size());
-    transform(map.begin(), map.end(), result.begin(), [](auto p) { return (void*)p.second; });
-    return result;
+    return solutionQ;
 }
 
 hiptensorStatus_t hiptensorInitContractionDescriptor(const hiptensorHandle_t*           handle,
@@ -144,80 +178,294 @@ hiptensorStatus_t hiptensorInitContractionDescriptor(const hiptensorHandle_t*
         return errorCode;
     }
 
-    if(descA->mUnaryOp != HIPTENSOR_OP_IDENTITY || descB->mUnaryOp != HIPTENSOR_OP_IDENTITY
-       || descD->mUnaryOp != HIPTENSOR_OP_IDENTITY
+    // A and B are loaded through their unary operators: square root for real tensors, and
+    // conjugation for complex ones. C and D only support the identity.
+    auto isComplex = [](const hiptensorTensorDescriptor_t* desc) {
+        return desc->mType == HIP_C_32F || desc->mType == HIP_C_64F;
+    };
+    auto isInputOp = [&isComplex](const hiptensorTensorDescriptor_t* desc) {
+        return desc->mUnaryOp == HIPTENSOR_OP_IDENTITY
+               || (desc->mUnaryOp == HIPTENSOR_OP_SQRT && !isComplex(desc))
+               || (desc->mUnaryOp == HIPTENSOR_OP_CONJ && isComplex(desc));
+    };
+    if(!isInputOp(descA) || !isInputOp(descB) || descD->mUnaryOp != HIPTENSOR_OP_IDENTITY
        || (descC && descC->mUnaryOp != HIPTENSOR_OP_IDENTITY))
     {
         auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
         snprintf(msg,
                  sizeof(msg),
-                 "Unsupported Operator Type Error : The supported Operator is "
-                 "HIPTENSOR_OP_IDENTITY (%s)",
+                 "Unsupported Operator Type Error : The supported Operators are "
+                 "HIPTENSOR_OP_IDENTITY, and HIPTENSOR_OP_SQRT (real) or HIPTENSOR_OP_CONJ "
+                 "(complex) on A and B (%s)",
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorInitContractionDescriptor", msg);
         return errorCode;
     }
 
+    // Store modes information in desc
+    int                  nModeA = descA->mLengths.size();
+    std::vector<int32_t> modeAV(modeA, modeA + nModeA);
+    int                  nModeB = descB->mLengths.size();
+    std::vector<int32_t> modeBV(modeB, modeB + nModeB);
+    int                  nModeD = descD->mLengths.size();
+    std::vector<int32_t> modeDV(modeD, modeD + nModeD);
+    std::vector<int32_t> modeCV;
+    if(descC != nullptr && modeC != nullptr)
+    {
+        modeCV.assign(modeC, modeC + descC->mLengths.size());
+    }
+
+    // Repeated modes of A and B select their diagonals, and their modes found in no other
+    // tensor are summed out by a pre-reduction of the diagonal view before the contraction
+    const hiptensorTensorDescriptor_t*       inputDescs[] = {descA, descB};
+    std::vector<int32_t> const*              inputModes[] = {&modeAV, &modeBV};
+    hiptensorTensorDescriptor_t              operandDescs[2];
+    std::vector<int32_t>                     operandModes[2];
+    std::vector<hiptensorTensorDescriptor_t> preReductionDescs(2);
+    std::vector<std::vector<int32_t>>        preReductionModes(2);
+    bool                                     hasPreReduction = false;
+    for(int i = 0; i < 2; i++)
+    {
+        hiptensor::ContractionOperandView view;
+        if(!hiptensor::contractionOperandView(&view,
+                                              inputDescs[i]->mLengths,
+                                              inputDescs[i]->mStrides,
+                                              *inputModes[i],
+                                              {*inputModes[1 - i], modeCV, modeDV}))
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Input Parameter Error : a repeated mode of %s has different lengths (%s)",
+                     i == 0 ? "A" : "B",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorInitContractionDescriptor", msg);
+            return errorCode;
+        }
+
+        operandDescs[i]          = *inputDescs[i];
+        operandDescs[i].mLengths = view.mLengths;
+        operandDescs[i].mStrides = view.mStrides;
+        operandModes[i]          = view.mModes;
+        if(!view.needsPreReduction())
+        {
+            continue;
+        }
+
+        // The pre-reduction would sum the operand as stored, before its unary operator
+        if(inputDescs[i]->mUnaryOp != HIPTENSOR_OP_IDENTITY)
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Operator Type Error : modes of %s with a unary operator must "
+                     "be in another tensor (%s)",
+                     i == 0 ? "A" : "B",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorInitContractionDescriptor", msg);
+            return errorCode;
+        }
+
+        // Pre-reductions of planar tensors would have to reduce each plane apart
+        if(inputDescs[i]->mPlaneStride != 0)
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Planar Tensor Error : modes of planar %s must be in another "
+                     "tensor (%s)",
+                     i == 0 ? "A" : "B",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorInitContractionDescriptor", msg);
+            return errorCode;
+        }
+
+        using hiptensor::HiptensorOptions;
+        auto& options = HiptensorOptions::instance();
+
+        preReductionDescs[i]     = operandDescs[i];
+        preReductionModes[i]     = view.mModes;
+        operandDescs[i].mLengths = view.mKeptLengths;
+        operandDescs[i].mStrides
+            = hiptensor::stridesFromLengths(view.mKeptLengths, options->isColMajorStrides());
+        operandModes[i] = view.mKeptModes;
+        hasPreReduction = true;
+    }
+
     if(descC == nullptr || modeC == nullptr)
     {
         // Use a scale contraction due to
         // tensor C-descriptor is empty
-
-        // Store modes information in desc
-        int                  nModeA = descA->mLengths.size();
-        std::vector<int32_t> modeAV(modeA, modeA + nModeA);
-        int                  nModeB = descB->mLengths.size();
-        std::vector<int32_t> modeBV(modeB, modeB + nModeB);
-        int                  nModeD = descD->mLengths.size();
-        std::vector<int32_t> modeDV(modeD, modeD + nModeD);
-
         auto contractionOp
             = typeCompute == HIPTENSOR_COMPUTE_C32F || typeCompute == HIPTENSOR_COMPUTE_C64F
                   ? hiptensor::ContractionOpId_t::SCALE_COMPLEX
                   : hiptensor::ContractionOpId_t::SCALE;
         *desc = {(int32_t)contractionOp,
                  typeCompute,
-                 {*descA,
-                  *descB,
+                 {operandDescs[0],
+                  operandDescs[1],
                   {hiptensor::NONE_TYPE,
                    std::vector<std::size_t>(descD->mLengths.size(), 0),
                    std::vector<std::size_t>(descD->mStrides.size(), 0)},
                   *descD},
                  {alignmentRequirementA, alignmentRequirementB, 0, alignmentRequirementD},
-                 {std::vector<std::vector<int32_t>>{modeAV, modeBV, modeDV}}};
+                 {std::vector<std::vector<int32_t>>{operandModes[0], operandModes[1], modeDV}}};
     }
     else
     {
         // Use a bilinear contraction due to
         // tensor C-descriptor is not empty
-
-        // Store modes information in desc
-        int                  nModeA = descA->mLengths.size();
-        std::vector<int32_t> modeAV(modeA, modeA + nModeA);
-        int                  nModeB = descB->mLengths.size();
-        std::vector<int32_t> modeBV(modeB, modeB + nModeB);
-        int                  nModeC = descC->mLengths.size();
-        std::vector<int32_t> modeCV(modeC, modeC + nModeC);
-        int                  nModeD = descD->mLengths.size();
-        std::vector<int32_t> modeDV(modeD, modeD + nModeD);
-
         auto contractionOp
             = typeCompute == HIPTENSOR_COMPUTE_C32F || typeCompute == HIPTENSOR_COMPUTE_C64F
                   ? hiptensor::ContractionOpId_t::BILINEAR_COMPLEX
                   : hiptensor::ContractionOpId_t::BILINEAR;
         *desc = {(int32_t)contractionOp,
                  typeCompute,
-                 {*descA, *descB, *descC, *descD},
+                 {operandDescs[0], operandDescs[1], *descC, *descD},
                  {alignmentRequirementA,
                   alignmentRequirementB,
                   alignmentRequirementC,
                   alignmentRequirementD},
-                 {std::vector<std::vector<int32_t>>{modeAV, modeBV, modeCV, modeDV}}};
+                 {std::vector<std::vector<int32_t>>{
+                     operandModes[0], operandModes[1], modeCV, modeDV}}};
+    }
+
+    if(hasPreReduction)
+    {
+        desc->mPreReductionDesc = std::move(preReductionDescs);
+        desc->mPreReductionMode = std::move(preReductionModes);
+    }
+
+    // An f32 contraction stored as half precision converts its output in an epilogue
+    if(descA->mType == HIP_R_32F && descB->mType == HIP_R_32F
+       && (descD->mType == HIP_R_16F || descD->mType == HIP_R_16BF)
+       && (descC == nullptr || descC->mType == descD->mType) && typeCompute == HIPTENSOR_COMPUTE_32F
+       && !hiptensor::hasBatchModes(*desc))
+    {
+        desc->mContractionOpId = (int32_t)hiptensor::ContractionOpId_t::EPILOGUE;
     }
 
     return HIPTENSOR_STATUS_SUCCESS;
 }
 
+hiptensorStatus_t
+    hiptensorContractionDescriptorSetEpilogue(const hiptensorHandle_t*           handle,
+                                              hiptensorContractionDescriptor_t*  desc,
+                                              const void*                        bias,
+                                              const hiptensorTensorDescriptor_t* descBias,
+                                              const int32_t                      modeBias[],
+                                              hiptensorActivation_t              activation,
+                                              float                              lower,
+                                              float                              upper)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=%p, desc=%p, bias=%p, descBias=%p, modeBias=%p, activation=0x%02X, "
+             "lower=%f, upper=%f",
+             handle,
+             desc,
+             bias,
+             descBias,
+             modeBias,
+             (unsigned int)activation,
+             lower,
+             upper);
+
+    logger->logAPITrace("hiptensorContractionDescriptorSetEpilogue", msg);
+
+    if(!handle || !desc)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 !handle ? "handle" : "desc",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionDescriptorSetEpilogue", msg);
+        return errorCode;
+    }
+
+    if((bias == nullptr) != (descBias == nullptr) || (bias == nullptr) != (modeBias == nullptr))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : bias, descBias and modeBias must all be given or all "
+                 "be nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionDescriptorSetEpilogue", msg);
+        return errorCode;
+    }
+
+    if(activation == HIPTENSOR_ACTIVATION_CLAMP && lower > upper)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : clamp bounds lower = %f > upper = %f (%s)",
+                 lower,
+                 upper,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionDescriptorSetEpilogue", msg);
+        return errorCode;
+    }
+
+    // The epilogue families contract f32 operands into f32, f16 or bf16 outputs
+    auto const& descD        = desc->mTensorDesc[3];
+    auto        planeStrides = hiptensor::planeStrides(*desc);
+    if(desc->mTensorDesc[0].mType != HIP_R_32F || desc->mTensorDesc[1].mType != HIP_R_32F
+       || desc->mComputeType != HIPTENSOR_COMPUTE_32F
+       || (descD.mType != HIP_R_32F && descD.mType != HIP_R_16F && descD.mType != HIP_R_16BF)
+       || (bias != nullptr && descBias->mType != HIP_R_32F)
+       || std::any_of(planeStrides.begin(), planeStrides.end(), [](auto s) { return s != 0; })
+       || hiptensor::hasBatchModes(*desc))
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Epilogue Error : epilogues need HIP_R_32F A, B and bias, "
+                 "HIPTENSOR_COMPUTE_32F and no planar or batch modes (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionDescriptorSetEpilogue", msg);
+        return errorCode;
+    }
+
+    hiptensorContractionEpilogue_t epilogue = {activation, lower, upper, bias};
+    if(bias != nullptr)
+    {
+        epilogue.mBiasDesc = *descBias;
+        epilogue.mBiasMode.assign(modeBias, modeBias + descBias->mLengths.size());
+
+        std::vector<std::size_t> biasStrides;
+        if(!hiptensor::epilogueBiasStrides(&biasStrides,
+                                           descBias->mLengths,
+                                           descBias->mStrides,
+                                           epilogue.mBiasMode,
+                                           descD.mLengths,
+                                           desc->mTensorMode.back()))
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Input Parameter Error : bias modes must be modes of D of the same "
+                     "lengths (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorContractionDescriptorSetEpilogue", msg);
+            return errorCode;
+        }
+    }
+
+    desc->mEpilogue        = std::move(epilogue);
+    desc->mContractionOpId = (int32_t)hiptensor::ContractionOpId_t::EPILOGUE;
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
 hiptensorStatus_t hiptensorInitContractionFind(const hiptensorHandle_t*    handle,
                                                hiptensorContractionFind_t* find,
                                                const hiptensorAlgo_t       algo)
@@ -258,17 +506,20 @@ hiptensorStatus_t hiptensorInitContractionFind(const hiptensorHandle_t*    handl
         return errorCode;
     }
 
+    // A workspace preference recorded for an earlier find at this address is stale
+    hiptensor::ApiRecorder::instance()->resetContractionFind(find);
+
     auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
 
     // Ensure current HIP device is same as the handle.
-    hiptensor::HipDevice currentDevice;
-    if((int)currentDevice.getDeviceId() != realHandle->getDevice().getDeviceId())
+    auto currentDeviceId = hiptensor::HipDevice::currentDeviceId();
+    if(currentDeviceId != realHandle->getDevice().getDeviceId())
     {
         auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
         snprintf(msg,
                  sizeof(msg),
                  "Device mismatch error: current device id: %d, handle device id: %d (%s)",
-                 (int)currentDevice.getDeviceId(),
+                 (int)currentDeviceId,
                  (int)realHandle->getDevice().getDeviceId(),
                  hiptensorGetErrorString(errorCode));
 
@@ -282,14 +533,10 @@ hiptensorStatus_t hiptensorInitContractionFind(const hiptensorHandle_t*    handl
         // Update the stored selection algorithm
         find->mSelectionAlgorithm = algo;
 
-        // For now, enumerate all known contraction kernels.
-        // Using the hipDevice, determine if the device supports F64
+        // Candidates are resolved from the contraction descriptor when
+        // planning, so that only the matching solution family is instantiated.
         auto& instances = hiptensor::ContractionSolutionInstances::instance();
-        auto  solnQ     = instances->allSolutions();
-
-        // Can do more checking for scale / bilinear, etc. if we need to.
-
-        if(solnQ.solutionCount() == 0)
+        if(!instances->hasSolutions())
         {
             // No kernels found!
             auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
@@ -301,8 +548,7 @@ hiptensorStatus_t hiptensorInitContractionFind(const hiptensorHandle_t*    handl
             return errorCode;
         }
 
-        // Extract the solutions to the candidates vector.
-        find->mCandidates = toVoidVec(solnQ.solutions());
+        find->mCandidates.clear();
 
         return HIPTENSOR_STATUS_SUCCESS;
     }
@@ -372,11 +618,12 @@ hiptensorStatus_t hiptensorContractionGetWorkspaceSize(const hiptensorHandle_t*
         return errorCode;
     }
 
+    hiptensor::ApiRecorder::instance()->recordContractionWorkspacePref(find, pref);
+
     *workspaceSize = 0u;
 
-    for(auto* candidate : find->mCandidates)
+    for(auto* solution : queryContractionSolutions(desc, find).solutionList())
     {
-        auto* solution = (hiptensor::ContractionSolution*)candidate;
         if(solution->initArgs(nullptr,
                               nullptr,
                               nullptr,
@@ -395,6 +642,8 @@ hiptensorStatus_t hiptensorContractionGetWorkspaceSize(const hiptensorHandle_t*
                               desc->mTensorDesc[3].mLengths,
                               desc->mTensorDesc[3].mStrides,
                               desc->mTensorMode[2],
+                              hiptensor::planeStrides(*desc),
+                              hiptensor::contractionEpilogue(*desc),
                               nullptr))
         {
             if(*workspaceSize == 0)
@@ -415,6 +664,11 @@ hiptensorStatus_t hiptensorContractionGetWorkspaceSize(const hiptensorHandle_t*
         }
     }
 
+    // Pre-reduced A and B are held in the workspace, ahead of the solution workspace
+    std::size_t preReductionSize = 0;
+    hiptensor::preReductionOffsets(*desc, &preReductionSize);
+    *workspaceSize += preReductionSize;
+
     return HIPTENSOR_STATUS_SUCCESS;
 }
 
@@ -476,17 +730,21 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
         return HIPTENSOR_STATUS_NOT_INITIALIZED;
     }
 
+    // The algo and preference recorded for an earlier plan at this address are stale, even
+    // if this plan fails to initialize
+    hiptensor::ApiRecorder::instance()->resetContractionPlan(plan);
+
     auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
 
     // Ensure current HIP device is same as the handle.
-    hiptensor::HipDevice currentDevice;
-    if((int)currentDevice.getDeviceId() != realHandle->getDevice().getDeviceId())
+    auto currentDeviceId = hiptensor::HipDevice::currentDeviceId();
+    if(currentDeviceId != realHandle->getDevice().getDeviceId())
     {
         auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
         snprintf(msg,
                  sizeof(msg),
                  "Device mismatch error: current device id: %d, handle device id: %d (%s)",
-                 (int)currentDevice.getDeviceId(),
+                 (int)currentDeviceId,
                  (int)realHandle->getDevice().getDeviceId(),
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorInitContractionPlan", msg);
@@ -496,21 +754,44 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
     // At this point, we need to format inputs for kernels as they will be tested via selection model.
     // Brute force method currently uses CK kernel format, so we will adjust inputs to that style.
 
-    // Convert to concrete contraction solutions
-    auto candidates = toContractionSolutionVec(find->mCandidates);
+    auto ADataType = desc->mTensorDesc[0].mType;
+    auto BDataType = desc->mTensorDesc[1].mType;
+    auto DDataType = desc->mTensorDesc[2].mType;
+    auto EDataType = desc->mTensorDesc[3].mType;
 
-    auto computeType = desc->mComputeType;
-    auto ADataType   = desc->mTensorDesc[0].mType;
-    auto BDataType   = desc->mTensorDesc[1].mType;
-    auto DDataType   = desc->mTensorDesc[2].mType;
-    auto EDataType   = desc->mTensorDesc[3].mType;
+    // The solutions are selected on the workspace left by the pre-reduced operands
+    std::size_t preReductionSize = 0;
+    hiptensor::preReductionOffsets(*desc, &preReductionSize);
+    auto solutionWorkspaceSize
+        = workspaceSize > preReductionSize ? workspaceSize - preReductionSize : uint64_t(0);
 
     // Query contraction solutions for the correct contraction operation and type
-    auto solutionQ = hiptensor::ContractionSolutionRegistry::Query{candidates}
-                         .query((hiptensor::ContractionOpId_t)desc->mContractionOpId)
-                         .query(ADataType, BDataType, DDataType, EDataType, computeType);
+    auto solutionQ  = queryContractionSolutions(desc, find);
+    auto candidates = solutionQ.solutionList();
+
+    // Batch modes are only supported by the real batched kernels
+    if(candidates.empty() && hiptensor::hasBatchModes(*desc))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "No batched contraction kernels for the batch modes of this operation and data "
+                 "types (%s)",
+                 hiptensorGetErrorString(HIPTENSOR_STATUS_NOT_SUPPORTED));
+        logger->logError("hiptensorInitContractionPlan", msg);
+        return HIPTENSOR_STATUS_NOT_SUPPORTED;
+    }
 
-    candidates = toContractionSolutionVec(solutionQ.solutions());
+    // The family may have been left out of an instance profile build
+    if(candidates.empty())
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "No contraction kernels were built for this operation and data types "
+                 "(see HIPTENSOR_INSTANCE_PROFILE) (%s)",
+                 hiptensorGetErrorString(HIPTENSOR_STATUS_NOT_SUPPORTED));
+        logger->logError("hiptensorInitContractionPlan", msg);
+        return HIPTENSOR_STATUS_NOT_SUPPORTED;
+    }
 
     // Measure timing for solution selection
     hipEvent_t startEvent, stopEvent;
@@ -519,34 +800,67 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
 
     CHECK_HIP_ERROR(hipEventRecord(startEvent));
 
+    // GEMV, outer product and dot contractions are bandwidth bound. Their specialized
+    // kernels are tried first, by brute force as the actor-critic model does not know them.
+    auto degenerateCandidates = std::vector<hiptensor::ContractionSolution*>{};
+    if(hiptensor::contractionShape(*desc) != hiptensor::ContractionShape_t::GEMM)
+    {
+        std::copy_if(candidates.begin(),
+                     candidates.end(),
+                     std::back_inserter(degenerateCandidates),
+                     [](hiptensor::ContractionSolution* solution) {
+                         return solution->isDegenerate();
+                     });
+    }
+
+    auto bruteForce = [&](std::vector<hiptensor::ContractionSolution*> const& solutions,
+                          hiptensor::ContractionSolution**                   winner) {
+        return hiptensor::bruteForceModel(winner,
+                                          solutions,
+                                          ADataType,
+                                          desc->mTensorDesc[0].mLengths,
+                                          desc->mTensorDesc[0].mStrides,
+                                          desc->mTensorMode[0],
+                                          BDataType,
+                                          desc->mTensorDesc[1].mLengths,
+                                          desc->mTensorDesc[1].mStrides,
+                                          desc->mTensorMode[1],
+                                          DDataType,
+                                          desc->mTensorDesc[2].mLengths,
+                                          desc->mTensorDesc[2].mStrides,
+                                          desc->mTensorMode[2],
+                                          EDataType,
+                                          desc->mTensorDesc[3].mLengths,
+                                          desc->mTensorDesc[3].mStrides,
+                                          desc->mTensorMode[2],
+                                          hiptensor::planeStrides(*desc),
+                                          hiptensor::contractionEpilogue(*desc),
+                                          desc->mComputeType,
+                                          solutionWorkspaceSize,
+                                          realHandle->workspaceArena());
+    };
+
     // Launch selection algorithm
     hiptensor::ContractionSolution* winner = nullptr;
     auto                            result = HIPTENSOR_STATUS_INTERNAL_ERROR;
-    if(find->mSelectionAlgorithm == HIPTENSOR_ALGO_DEFAULT
-       || find->mSelectionAlgorithm == HIPTENSOR_ALGO_DEFAULT_PATIENT)
-    {
-        result = hiptensor::bruteForceModel(&winner,
-                                            candidates,
-                                            ADataType,
-                                            desc->mTensorDesc[0].mLengths,
-                                            desc->mTensorDesc[0].mStrides,
-                                            desc->mTensorMode[0],
-                                            BDataType,
-                                            desc->mTensorDesc[1].mLengths,
-                                            desc->mTensorDesc[1].mStrides,
-                                            desc->mTensorMode[1],
-                                            DDataType,
-                                            desc->mTensorDesc[2].mLengths,
-                                            desc->mTensorDesc[2].mStrides,
-                                            desc->mTensorMode[2],
-                                            EDataType,
-                                            desc->mTensorDesc[3].mLengths,
-                                            desc->mTensorDesc[3].mStrides,
-                                            desc->mTensorMode[2],
-                                            desc->mComputeType,
-                                            workspaceSize);
-    }
-    else if(find->mSelectionAlgorithm == HIPTENSOR_ALGO_ACTOR_CRITIC)
+    if(!degenerateCandidates.empty())
+    {
+        result = bruteForce(degenerateCandidates, &winner);
+    }
+
+    // Otherwise, or if they cannot solve the problem, all candidates are selected from.
+    // The actor-critic model only knows the kernels of contractions without batch modes,
+    // epilogues or unary operators on A and B.
+    if(result != HIPTENSOR_STATUS_SUCCESS
+       && (find->mSelectionAlgorithm == HIPTENSOR_ALGO_DEFAULT
+           || find->mSelectionAlgorithm == HIPTENSOR_ALGO_DEFAULT_PATIENT
+           || hiptensor::hasBatchModes(*desc) || hiptensor::hasElementOps(*desc)
+           || desc->mContractionOpId == (int32_t)hiptensor::ContractionOpId_t::EPILOGUE))
+    {
+        result = bruteForce(candidates, &winner);
+    }
+    else if(result != HIPTENSOR_STATUS_SUCCESS
+            && find->mSelectionAlgorithm == HIPTENSOR_ALGO_ACTOR_CRITIC)
     {
         result = hiptensor::actorCriticModel(&winner,
                                              solutionQ.solutions(),
@@ -567,7 +881,7 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
                                              desc->mTensorDesc[3].mStrides,
                                              desc->mTensorMode[2],
                                              desc->mComputeType,
-                                             workspaceSize);
+                                             solutionWorkspaceSize);
     }
 
     CHECK_HIP_ERROR(hipEventRecord(stopEvent));
@@ -599,9 +913,41 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
              elapsedTimeMs);
     logger->logPerformanceTrace("hiptensorInitContractionPlan", msg);
 
+    // Workspace size of the winner, for library-managed workspace on execution
+    uint64_t winnerWorkspaceSize = 0;
+    if(winner->initArgs(nullptr,
+                        nullptr,
+                        nullptr,
+                        nullptr,
+                        nullptr,
+                        nullptr,
+                        desc->mTensorDesc[0].mLengths,
+                        desc->mTensorDesc[0].mStrides,
+                        desc->mTensorMode[0],
+                        desc->mTensorDesc[1].mLengths,
+                        desc->mTensorDesc[1].mStrides,
+                        desc->mTensorMode[1],
+                        desc->mTensorDesc[2].mLengths,
+                        desc->mTensorDesc[2].mStrides,
+                        desc->mTensorMode[2],
+                        desc->mTensorDesc[3].mLengths,
+                        desc->mTensorDesc[3].mStrides,
+                        desc->mTensorMode[2],
+                        hiptensor::planeStrides(*desc),
+                        hiptensor::contractionEpilogue(*desc),
+                        nullptr))
+    {
+        winnerWorkspaceSize = winner->workspaceSize();
+    }
+
     // Assign the contraction descriptor
     plan->mContractionDesc = *desc;
     plan->mSolution        = winner;
+    plan->mWorkspaceSize   = winnerWorkspaceSize + preReductionSize;
+    plan->mBatchedSolution = nullptr;
+    plan->mBatchedShape.clear();
+
+    hiptensor::ApiRecorder::instance()->recordContractionPlan(plan, find);
 
     return HIPTENSOR_STATUS_SUCCESS;
 }
@@ -626,12 +972,22 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
     char alphaMsg[32];
     char betaMsg[32];
 
+    // Scalars in device memory are not read on the host
+    auto deviceScalars
+        = handle != nullptr
+          && hiptensor::Handle::toHandle((int64_t*)handle->fields)->pointerMode()
+                 == HIPTENSOR_POINTER_MODE_DEVICE;
+
     if(plan != nullptr)
     {
         if(alpha == nullptr)
         {
             snprintf(alphaMsg, sizeof(alphaMsg), "alpha=NULL");
         }
+        else if(deviceScalars)
+        {
+            snprintf(alphaMsg, sizeof(alphaMsg), "alpha=%p", alpha);
+        }
         else
         {
             auto alphaValue = hiptensor::readVal<hiptensor::ScalarData>(
@@ -643,6 +999,10 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
         {
             snprintf(betaMsg, sizeof(betaMsg), "beta=NULL");
         }
+        else if(deviceScalars)
+        {
+            snprintf(betaMsg, sizeof(betaMsg), "beta=%p", beta);
+        }
         else
         {
             auto betaValue = hiptensor::readVal<hiptensor::ScalarData>(
@@ -731,36 +1091,184 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
     auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
 
     // Ensure current HIP device is same as the handle.
-    hiptensor::HipDevice currentDevice;
-    if((int)currentDevice.getDeviceId() != realHandle->getDevice().getDeviceId())
+    auto currentDeviceId = hiptensor::HipDevice::currentDeviceId();
+    if(currentDeviceId != realHandle->getDevice().getDeviceId())
     {
         auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
         snprintf(msg,
                  sizeof(msg),
                  "Device mismatch error: current device id: %d, handle device id: %d (%s)",
-                 (int)currentDevice.getDeviceId(),
+                 (int)currentDeviceId,
                  (int)realHandle->getDevice().getDeviceId(),
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorContraction", msg);
         return errorCode;
     }
 
+    hiptensor::ApiRecorder::instance()->recordContraction(
+        plan, alpha, beta, workspaceSize, deviceScalars, stream);
+
+    // Library-managed workspace, given back to the arena in stream order on return
+    hiptensor::WorkspaceArena::Allocation managedWorkspace;
+    if(workspace == nullptr && plan->mWorkspaceSize > 0)
+    {
+        managedWorkspace = realHandle->workspaceArena().allocate(plan->mWorkspaceSize, stream);
+        if(managedWorkspace.get() == nullptr)
+        {
+            auto errorCode = HIPTENSOR_STATUS_ALLOC_FAILED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unable to allocate workspace: req: %lu (%s)",
+                     plan->mWorkspaceSize,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorContraction", msg);
+            return errorCode;
+        }
+        workspace     = managedWorkspace.get();
+        workspaceSize = managedWorkspace.size();
+    }
+
+    // Modes of A or B found in no other tensor are first summed out into the workspace
+    auto const& desc = plan->mContractionDesc;
+    if(hiptensor::hasPreReduction(desc))
+    {
+        std::size_t preReductionSize = 0;
+        auto        offsets          = hiptensor::preReductionOffsets(desc, &preReductionSize);
+        if(workspace == nullptr || workspaceSize < preReductionSize)
+        {
+            auto errorCode = HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Insufficient workspace for the pre-reduced operands: req: %lu alloc: %lu "
+                     "(%s)",
+                     (unsigned long)preReductionSize,
+                     (unsigned long)workspaceSize,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorContraction", msg);
+            return errorCode;
+        }
+
+        hiptensor::LibraryScalars scalars(*realHandle, desc.mComputeType);
+
+        const void* operands[] = {A, B};
+        for(int i = 0; i < 2; i++)
+        {
+            if(!hiptensor::isPreReduced(desc, i))
+            {
+                continue;
+            }
+
+            auto* reduced   = (char*)workspace + offsets[i];
+            auto  errorCode = hiptensorReduction(handle,
+                                                scalars.one(),
+                                                operands[i],
+                                                &desc.mPreReductionDesc[i],
+                                                desc.mPreReductionMode[i].data(),
+                                                scalars.zero(),
+                                                reduced,
+                                                &desc.mTensorDesc[i],
+                                                desc.mTensorMode[i].data(),
+                                                reduced,
+                                                &desc.mTensorDesc[i],
+                                                desc.mTensorMode[i].data(),
+                                                HIPTENSOR_OP_ADD,
+                                                desc.mComputeType,
+                                                nullptr,
+                                                0,
+                                                stream);
+            if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                snprintf(msg,
+                         sizeof(msg),
+                         "Unable to sum out the modes of %s found in no other tensor (%s)",
+                         i == 0 ? "A" : "B",
+                         hiptensorGetErrorString(errorCode));
+                logger->logError("hiptensorContraction", msg);
+                return errorCode;
+            }
+            operands[i] = reduced;
+        }
+
+        A             = operands[0];
+        B             = operands[1];
+        workspace     = (char*)workspace + preReductionSize;
+        workspaceSize = workspaceSize - preReductionSize;
+    }
+
     auto*             cSolution = (hiptensor::ContractionSolution*)(plan->mSolution);
     hiptensorStatus_t errorCode = HIPTENSOR_STATUS_SUCCESS;
     float             time      = 0.0f;
+    auto              epilogue  = hiptensor::contractionEpilogue(plan->mContractionDesc);
+
+    // In device pointer mode the solution computes the unscaled product, and alpha and beta
+    // are applied by a second kernel that reads them from device memory. The product is
+    // written to D, unless D is C and C must be read after the contraction.
+    const void*                           solutionAlpha = alpha;
+    const void*                           solutionBeta  = beta;
+    void*                                 E             = D;
+    auto                                  stridesE      = desc.mTensorDesc[3].mStrides;
+    hipDoubleComplex                      one, zero;
+    hiptensor::WorkspaceArena::Allocation product;
+    if(deviceScalars)
+    {
+        auto planeStrides = hiptensor::planeStrides(desc);
+        if(desc.mContractionOpId == (int32_t)hiptensor::ContractionOpId_t::EPILOGUE
+           || std::any_of(planeStrides.cbegin(), planeStrides.cend(), [](std::size_t stride) {
+                  return stride != 0;
+              }))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Pointer Mode Error : device scalars are not supported by "
+                     "epilogues or planar tensors (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorContraction", msg);
+            return errorCode;
+        }
+
+        using hiptensor::ScalarData;
+        hiptensor::writeVal(&one, desc.mComputeType, ScalarData(desc.mComputeType, 1.0));
+        hiptensor::writeVal(&zero, desc.mComputeType, ScalarData(desc.mComputeType, 0.0));
+        solutionAlpha = &one;
+        solutionBeta  = &zero;
+
+        if(C != nullptr && C == D)
+        {
+            auto const& lengthsD = desc.mTensorDesc[3].mLengths;
+            product              = realHandle->workspaceArena().allocate(
+                hiptensor::elementsFromLengths(lengthsD)
+                    * hiptensor::hipDataTypeSize(desc.mTensorDesc[3].mType),
+                stream);
+            if(product.get() == nullptr)
+            {
+                auto errorCode = HIPTENSOR_STATUS_ALLOC_FAILED;
+                snprintf(msg,
+                         sizeof(msg),
+                         "Unable to allocate the unscaled product (%s)",
+                         hiptensorGetErrorString(errorCode));
+                logger->logError("hiptensorContraction", msg);
+                return errorCode;
+            }
+            E        = product.get();
+            stridesE = hiptensor::stridesFromLengths(lengthsD);
+        }
+    }
 
-    // Perform contraction with timing if LOG_LEVEL_PERF_TRACE
-    if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+    // Perform contraction with timing if LOG_LEVEL_PERF_TRACE. Captured work is not timed:
+    // timing repeats the kernel and waits for it on the host.
+    if((logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+       && !hiptensor::isStreamCapturing(stream))
     {
         using hiptensor::HiptensorOptions;
         auto& options = HiptensorOptions::instance();
 
-        std::tie(errorCode, time) = (*cSolution)(alpha,
+        std::tie(errorCode, time) = (*cSolution)(solutionAlpha,
                                                  A,
                                                  B,
-                                                 beta,
+                                                 solutionBeta,
                                                  C,
-                                                 D,
+                                                 E,
                                                  plan->mContractionDesc.mTensorDesc[0].mLengths,
                                                  plan->mContractionDesc.mTensorDesc[0].mStrides,
                                                  plan->mContractionDesc.mTensorMode[0],
@@ -771,8 +1279,10 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
                                                  plan->mContractionDesc.mTensorDesc[2].mStrides,
                                                  plan->mContractionDesc.mTensorMode[2],
                                                  plan->mContractionDesc.mTensorDesc[3].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[3].mStrides,
+                                                 stridesE,
                                                  plan->mContractionDesc.mTensorMode[2],
+                                                 hiptensor::planeStrides(plan->mContractionDesc),
+                                                 epilogue,
                                                  workspace,
                                                  workspaceSize,
                                                  StreamConfig{
@@ -812,12 +1322,12 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
     }
     else // Perform contraction without timing
     {
-        std::tie(errorCode, time) = (*cSolution)(alpha,
+        std::tie(errorCode, time) = (*cSolution)(solutionAlpha,
                                                  A,
                                                  B,
-                                                 beta,
+                                                 solutionBeta,
                                                  C,
-                                                 D,
+                                                 E,
                                                  plan->mContractionDesc.mTensorDesc[0].mLengths,
                                                  plan->mContractionDesc.mTensorDesc[0].mStrides,
                                                  plan->mContractionDesc.mTensorMode[0],
@@ -828,8 +1338,10 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
                                                  plan->mContractionDesc.mTensorDesc[2].mStrides,
                                                  plan->mContractionDesc.mTensorMode[2],
                                                  plan->mContractionDesc.mTensorDesc[3].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[3].mStrides,
+                                                 stridesE,
                                                  plan->mContractionDesc.mTensorMode[2],
+                                                 hiptensor::planeStrides(plan->mContractionDesc),
+                                                 epilogue,
                                                  workspace,
                                                  workspaceSize,
                                                  StreamConfig{stream, false});
@@ -854,5 +1366,29 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
         logger->logError("hiptensorContraction", msg);
     }
 
+    if(errorCode == HIPTENSOR_STATUS_SUCCESS && deviceScalars)
+    {
+        errorCode = hiptensor::applyDeviceScalars(alpha,
+                                                  E,
+                                                  stridesE,
+                                                  beta,
+                                                  C,
+                                                  desc.mTensorDesc[2].mStrides,
+                                                  D,
+                                                  desc.mTensorDesc[3].mLengths,
+                                                  desc.mTensorDesc[3].mStrides,
+                                                  desc.mTensorDesc[3].mType,
+                                                  desc.mComputeType,
+                                                  stream);
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unable to apply the device scalars (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorContraction", msg);
+        }
+    }
+
     return errorCode;
 }
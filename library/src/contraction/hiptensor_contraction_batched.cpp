@@ -0,0 +1,822 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <algorithm>
+#include <numeric>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "contraction_batched_solution_instances.hpp"
+#include "contraction_selection.hpp"
+#include "contraction_solution.hpp"
+#include "data_types.hpp"
+#include "handle.hpp"
+#include "hip_device.hpp"
+#include "logger.hpp"
+#include "util.hpp"
+#include "workspace_arena.hpp"
+
+#include "hiptensor_options.hpp"
+
+namespace
+{
+    // Lengths, strides and modes of a contraction operand with the batch mode appended
+    struct BatchedOperand
+    {
+        std::vector<std::size_t> mLengths;
+        std::vector<std::size_t> mStrides;
+        std::vector<int32_t>     mModes;
+    };
+
+    BatchedOperand appendBatchMode(hiptensorTensorDescriptor_t const& desc,
+                                   std::vector<int32_t> const&        modes,
+                                   int32_t                            batchMode,
+                                   int64_t                            batchCount,
+                                   int64_t                            batchStride)
+    {
+        BatchedOperand result{desc.mLengths, desc.mStrides, modes};
+        result.mLengths.push_back(batchCount);
+        result.mStrides.push_back(batchStride);
+        result.mModes.push_back(batchMode);
+        return result;
+    }
+
+    // Size in bytes of one element of a tensor plane
+    std::size_t planeElementBytes(hiptensorTensorDescriptor_t const& desc)
+    {
+        auto bytes = hiptensor::hipDataTypeSize(desc.mType);
+        return desc.mPlaneStride == 0 ? bytes : bytes / 2u;
+    }
+
+    template <typename T>
+    T* offsetBatch(T* ptr, int64_t batch, int64_t stride, std::size_t elementBytes)
+    {
+        using ByteT = std::conditional_t<std::is_const_v<T>, const char, char>;
+        return ptr == nullptr ? nullptr
+                              : (T*)((ByteT*)ptr + batch * stride * (int64_t)elementBytes);
+    }
+
+    // Operands of the batched kernels, with the batch mode appended
+    struct BatchedProblem
+    {
+        BatchedOperand mA;
+        BatchedOperand mB;
+        BatchedOperand mE;
+    };
+
+    // The batch shape of a plan, and the workspace size its batched solution is ranked within
+    std::vector<int64_t> batchedShape(int64_t  batchCount,
+                                      int64_t  strideA,
+                                      int64_t  strideB,
+                                      int64_t  strideC,
+                                      int64_t  strideD,
+                                      bool     hasC,
+                                      uint64_t workspaceSize)
+    {
+        return {batchCount, strideA, strideB, strideC, strideD, hasC, (int64_t)workspaceSize};
+    }
+
+    // The batched solutions and their operands, or no solutions if the batched kernels do
+    // not take the problem: they take interleaved operands, with C laid out as D, no
+    // epilogue and no unary operators
+    std::vector<hiptensor::ContractionSolution*>
+        batchedSolutions(hiptensorContractionDescriptor_t const& desc,
+                         bool                                    hasC,
+                         int64_t                                 batchCount,
+                         int64_t                                 strideA,
+                         int64_t                                 strideB,
+                         int64_t                                 strideC,
+                         int64_t                                 strideD,
+                         BatchedProblem*                         problem)
+    {
+        auto planeStrides = hiptensor::planeStrides(desc);
+        if(std::any_of(planeStrides.begin(), planeStrides.end(), [](auto s) { return s != 0; })
+           || (hasC && strideC != strideD)
+           || desc.mContractionOpId == (int32_t)hiptensor::ContractionOpId_t::EPILOGUE
+           || hiptensor::hasElementOps(desc))
+        {
+            return {};
+        }
+
+        // The batch mode is labelled apart from every mode of the plan
+        int32_t batchMode = 0;
+        for(int i = 0; i < 3; i++)
+        {
+            for(auto mode : desc.mTensorMode[i])
+            {
+                batchMode = std::max(batchMode, mode + 1);
+            }
+        }
+
+        problem->mA = appendBatchMode(
+            desc.mTensorDesc[0], desc.mTensorMode[0], batchMode, batchCount, strideA);
+        problem->mB = appendBatchMode(
+            desc.mTensorDesc[1], desc.mTensorMode[1], batchMode, batchCount, strideB);
+        problem->mE = appendBatchMode(
+            desc.mTensorDesc[3], desc.mTensorMode[2], batchMode, batchCount, strideD);
+
+        auto& instances = hiptensor::BatchedContractionSolutionInstances::instance();
+        return instances
+            ->querySolutions((hiptensor::ContractionOpId_t)desc.mContractionOpId,
+                             desc.mTensorDesc[0].mType,
+                             desc.mTensorDesc[1].mType,
+                             desc.mTensorDesc[2].mType,
+                             desc.mTensorDesc[3].mType,
+                             desc.mComputeType)
+            .solutionList();
+    }
+
+    // D is laid out as E by the batched kernels
+    bool initBatchedArgs(hiptensor::ContractionSolution* solution,
+                         BatchedProblem const&           problem,
+                         const void*                     alpha,
+                         const void*                     A,
+                         const void*                     B,
+                         const void*                     beta,
+                         const void*                     C,
+                         void*                           D)
+    {
+        return solution->initArgs(alpha,
+                                  A,
+                                  B,
+                                  beta,
+                                  C,
+                                  D,
+                                  problem.mA.mLengths,
+                                  problem.mA.mStrides,
+                                  problem.mA.mModes,
+                                  problem.mB.mLengths,
+                                  problem.mB.mStrides,
+                                  problem.mB.mModes,
+                                  problem.mE.mLengths,
+                                  problem.mE.mStrides,
+                                  problem.mE.mModes,
+                                  problem.mE.mLengths,
+                                  problem.mE.mStrides,
+                                  problem.mE.mModes,
+                                  hiptensor::PlaneStrides{},
+                                  hiptensor::ContractionEpilogue{},
+                                  nullptr);
+    }
+
+    // Ranks the batched solutions by brute force, as hiptensorInitContractionPlan ranks
+    // contractions with batch modes. Sets the winner to null if none solves the problem.
+    void rankBatchedSolutions(hiptensor::Handle*                                  realHandle,
+                              hiptensorContractionDescriptor_t const&             desc,
+                              std::vector<hiptensor::ContractionSolution*> const& solutions,
+                              BatchedProblem const&                               problem,
+                              bool                                                hasC,
+                              uint64_t                                            workspaceSize,
+                              hiptensor::ContractionSolution**                    winner)
+    {
+        *winner = nullptr;
+
+        auto candidates = std::vector<hiptensor::ContractionSolution*>{};
+        std::copy_if(solutions.begin(),
+                     solutions.end(),
+                     std::back_inserter(candidates),
+                     [&problem](hiptensor::ContractionSolution* solution) {
+                         return initBatchedArgs(solution,
+                                                problem,
+                                                nullptr,
+                                                nullptr,
+                                                nullptr,
+                                                nullptr,
+                                                nullptr,
+                                                nullptr);
+                     });
+        if(candidates.empty())
+        {
+            return;
+        }
+
+        // Ranked on densely packed batches, as the scratch tensors of the ranking are sized
+        // from the lengths alone
+        auto packed = [](BatchedOperand operand) {
+            if(operand.mStrides.back() != 0)
+            {
+                operand.mStrides.back() = hiptensor::elementsFromLengths(
+                    std::vector<std::size_t>(operand.mLengths.begin(),
+                                             operand.mLengths.end() - 1));
+            }
+            return operand;
+        };
+        auto rankA = packed(problem.mA);
+        auto rankB = packed(problem.mB);
+        auto rankE = packed(problem.mE);
+
+        if(hiptensor::bruteForceModel(winner,
+                                      candidates,
+                                      desc.mTensorDesc[0].mType,
+                                      rankA.mLengths,
+                                      rankA.mStrides,
+                                      rankA.mModes,
+                                      desc.mTensorDesc[1].mType,
+                                      rankB.mLengths,
+                                      rankB.mStrides,
+                                      rankB.mModes,
+                                      hasC ? desc.mTensorDesc[2].mType : hiptensor::NONE_TYPE,
+                                      rankE.mLengths,
+                                      rankE.mStrides,
+                                      rankE.mModes,
+                                      desc.mTensorDesc[3].mType,
+                                      rankE.mLengths,
+                                      rankE.mStrides,
+                                      rankE.mModes,
+                                      hiptensor::PlaneStrides{},
+                                      hiptensor::ContractionEpilogue{},
+                                      desc.mComputeType,
+                                      workspaceSize,
+                                      realHandle->workspaceArena())
+           != HIPTENSOR_STATUS_SUCCESS)
+        {
+            *winner = nullptr;
+        }
+    }
+
+    // Runs the whole batch with one launch of a batched solution, if one supports it.
+    // Returns HIPTENSOR_STATUS_NOT_SUPPORTED otherwise. The plan is only read.
+    hiptensorStatus_t runBatchedSolution(hiptensor::Handle*                realHandle,
+                                         const hiptensorContractionPlan_t* plan,
+                                         const void*                       alpha,
+                                         const void*                       A,
+                                         const void*                       B,
+                                         const void*                       beta,
+                                         const void*                       C,
+                                         void*                             D,
+                                         int64_t                           batchCount,
+                                         int64_t                           strideA,
+                                         int64_t                           strideB,
+                                         int64_t                           strideC,
+                                         int64_t                           strideD,
+                                         void*                             workspace,
+                                         uint64_t                          workspaceSize,
+                                         hipStream_t                       stream)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        auto const&    desc = plan->mContractionDesc;
+        BatchedProblem problem;
+        auto           solutions = batchedSolutions(
+            desc, C != nullptr, batchCount, strideA, strideB, strideC, strideD, &problem);
+        if(solutions.empty())
+        {
+            return HIPTENSOR_STATUS_NOT_SUPPORTED;
+        }
+
+        // The solution ranked at plan time is kept for its batch shape, unless less workspace
+        // is given than it was ranked within. Otherwise the first solution that supports the
+        // problem, and fits in the given workspace, is taken unranked.
+        hiptensor::ContractionSolution* solution = nullptr;
+        auto const&                     ranked   = plan->mBatchedShape;
+        auto                            shape    = batchedShape(
+            batchCount, strideA, strideB, strideC, strideD, C != nullptr, workspaceSize);
+        if(ranked.size() == shape.size()
+           && std::equal(shape.begin(), shape.end() - 1, ranked.begin())
+           && (workspace == nullptr || shape.back() >= ranked.back()))
+        {
+            solution = (hiptensor::ContractionSolution*)plan->mBatchedSolution;
+        }
+        else
+        {
+            for(auto* candidate : solutions)
+            {
+                if(initBatchedArgs(
+                       candidate, problem, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
+                   && (workspace == nullptr || candidate->workspaceSize() <= workspaceSize))
+                {
+                    solution = candidate;
+                    break;
+                }
+            }
+        }
+
+        // Arguments of the problem itself
+        if(solution == nullptr || !initBatchedArgs(solution, problem, alpha, A, B, beta, C, D))
+        {
+            return HIPTENSOR_STATUS_NOT_SUPPORTED;
+        }
+
+        // Library-managed workspace, given back to the arena in stream order on return
+        hiptensor::WorkspaceArena::Allocation managedWorkspace;
+        if(workspace == nullptr && solution->workspaceSize() > 0)
+        {
+            managedWorkspace
+                = realHandle->workspaceArena().allocate(solution->workspaceSize(), stream);
+            if(managedWorkspace.get() == nullptr)
+            {
+                return HIPTENSOR_STATUS_ALLOC_FAILED;
+            }
+            workspace     = managedWorkspace.get();
+            workspaceSize = managedWorkspace.size();
+        }
+
+        if(solution->workspaceSize() > workspaceSize)
+        {
+            return HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+        }
+
+        // Perform the batched contraction with timing if LOG_LEVEL_PERF_TRACE, unless the
+        // stream is captured
+        if((logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+           && !hiptensor::isStreamCapturing(stream))
+        {
+            using hiptensor::HiptensorOptions;
+            auto& options = HiptensorOptions::instance();
+
+            auto [errorCode, time] = (*solution)(alpha,
+                                                 A,
+                                                 B,
+                                                 beta,
+                                                 C,
+                                                 D,
+                                                 problem.mA.mLengths,
+                                                 problem.mA.mStrides,
+                                                 problem.mA.mModes,
+                                                 problem.mB.mLengths,
+                                                 problem.mB.mStrides,
+                                                 problem.mB.mModes,
+                                                 problem.mE.mLengths,
+                                                 problem.mE.mStrides,
+                                                 problem.mE.mModes,
+                                                 problem.mE.mLengths,
+                                                 problem.mE.mStrides,
+                                                 problem.mE.mModes,
+                                                 hiptensor::PlaneStrides{},
+                                                 hiptensor::ContractionEpilogue{},
+                                                 workspace,
+                                                 workspaceSize,
+                                                 StreamConfig{
+                                                     stream, // stream id
+                                                     true, // time_kernel
+                                                     0, // log_level
+                                                     options->coldRuns(), // cold_niters
+                                                     options->hotRuns(), // nrepeat
+                                                 });
+
+            if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+            {
+                // Batches are folded into m
+                int32_t m, n, k;
+                std::tie(m, n, k) = solution->problemDims();
+                auto flops        = std::size_t(2) * m * n * k;
+                auto bytes        = solution->problemBytes();
+
+                char msg[512];
+                snprintf(msg,
+                         sizeof(msg),
+                         "KernelId: %lu KernelName: %s, BatchCount: %ld, %0.3f ms, %0.3f TFlops, "
+                         "%0.3f GB/s",
+                         solution->uid(),
+                         solution->kernelName().c_str(),
+                         (long)batchCount,
+                         time,
+                         static_cast<float>(flops) / static_cast<float>(1.E9) / time,
+                         static_cast<float>(bytes) / static_cast<float>(1.E6) / time);
+                logger->logPerformanceTrace("hiptensorContractionBatched", msg);
+            }
+            return errorCode;
+        }
+
+        // Perform the batched contraction without timing
+        return std::get<0>((*solution)(alpha,
+                                       A,
+                                       B,
+                                       beta,
+                                       C,
+                                       D,
+                                       problem.mA.mLengths,
+                                       problem.mA.mStrides,
+                                       problem.mA.mModes,
+                                       problem.mB.mLengths,
+                                       problem.mB.mStrides,
+                                       problem.mB.mModes,
+                                       problem.mE.mLengths,
+                                       problem.mE.mStrides,
+                                       problem.mE.mModes,
+                                       problem.mE.mLengths,
+                                       problem.mE.mStrides,
+                                       problem.mE.mModes,
+                                       hiptensor::PlaneStrides{},
+                                       hiptensor::ContractionEpilogue{},
+                                       workspace,
+                                       workspaceSize,
+                                       StreamConfig{stream, false}));
+    }
+} // namespace
+
+hiptensorStatus_t hiptensorInitContractionPlanBatched(const hiptensorHandle_t*    handle,
+                                                      hiptensorContractionPlan_t* plan,
+                                                      const hiptensorContractionDescriptor_t* desc,
+                                                      const hiptensorContractionFind_t*       find,
+                                                      const uint64_t workspaceSize,
+                                                      int64_t        batchCount,
+                                                      int64_t        strideA,
+                                                      int64_t        strideB,
+                                                      int64_t        strideC,
+                                                      int64_t        strideD)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, plan=0x%llX, desc=0x%llX, find=0x%llX, workspaceSize=0x%04lX, "
+             "batchCount=%ld, strideA=%ld, strideB=%ld, strideC=%ld, strideD=%ld",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)plan,
+             (unsigned long long)desc,
+             (unsigned long long)find,
+             (unsigned long)workspaceSize,
+             (long)batchCount,
+             (long)strideA,
+             (long)strideB,
+             (long)strideC,
+             (long)strideD);
+
+    logger->logAPITrace("hiptensorInitContractionPlanBatched", msg);
+
+    // Batches of D must not overlap; operands are only addressed forwards
+    if(batchCount < 1 || strideA < 0 || strideB < 0 || strideC < 0 || strideD < 0
+       || (batchCount > 1 && strideD == 0))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : batchCount must be positive, batch strides "
+                 "non-negative and strideD non-zero (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitContractionPlanBatched", msg);
+        return errorCode;
+    }
+
+    if(auto errorCode = hiptensorInitContractionPlan(handle, plan, desc, find, workspaceSize);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    // Pre-reduced operands are summed out batch by batch, by the plan itself
+    auto hasC = desc->mTensorDesc[2].mType != hiptensor::NONE_TYPE;
+    plan->mBatchedShape
+        = batchedShape(batchCount, strideA, strideB, strideC, strideD, hasC, workspaceSize);
+
+    BatchedProblem problem;
+    auto           solutions
+        = batchCount > 1 && !hiptensor::hasPreReduction(*desc)
+              ? batchedSolutions(
+                  *desc, hasC, batchCount, strideA, strideB, strideC, strideD, &problem)
+              : std::vector<hiptensor::ContractionSolution*>{};
+    if(solutions.empty())
+    {
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+
+    hiptensor::ContractionSolution* winner = nullptr;
+    rankBatchedSolutions(realHandle, *desc, solutions, problem, hasC, workspaceSize, &winner);
+
+    // The workspace of the plan covers the batched solution as well
+    if(winner != nullptr
+       && initBatchedArgs(winner, problem, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr))
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "KernelId: %lu, KernelName: %s, BatchCount: %ld",
+                 winner->uid(),
+                 winner->kernelName().c_str(),
+                 (long)batchCount);
+        logger->logPerformanceTrace("hiptensorInitContractionPlanBatched", msg);
+
+        plan->mBatchedSolution = winner;
+        plan->mWorkspaceSize   = std::max<uint64_t>(plan->mWorkspaceSize, winner->workspaceSize());
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorContractionBatched(const hiptensorHandle_t*          handle,
+                                              const hiptensorContractionPlan_t* plan,
+                                              const void*                       alpha,
+                                              const void*                       A,
+                                              const void*                       B,
+                                              const void*                       beta,
+                                              const void*                       C,
+                                              void*                             D,
+                                              int64_t                           batchCount,
+                                              int64_t                           strideA,
+                                              int64_t                           strideB,
+                                              int64_t                           strideC,
+                                              int64_t                           strideD,
+                                              void*                             workspace,
+                                              uint64_t                          workspaceSize,
+                                              hipStream_t                       stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, plan=0x%llX, A=0x%llX, B=0x%llX, C=0x%llX, D=0x%llX, "
+             "batchCount=%ld, strideA=%ld, strideB=%ld, strideC=%ld, strideD=%ld, "
+             "workspace=0x%llX, workspaceSize=0x%04lX, stream=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)plan,
+             (unsigned long long)A,
+             (unsigned long long)B,
+             (unsigned long long)C,
+             (unsigned long long)D,
+             (long)batchCount,
+             (long)strideA,
+             (long)strideB,
+             (long)strideC,
+             (long)strideD,
+             (unsigned long long)workspace,
+             (unsigned long)workspaceSize,
+             (unsigned long long)stream);
+
+    logger->logAPITrace("hiptensorContractionBatched", msg);
+
+    if(handle == nullptr || plan == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "plan",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionBatched", msg);
+        return errorCode;
+    }
+
+    if(alpha == nullptr || A == nullptr || B == nullptr || D == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : alpha/A/B/D = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionBatched", msg);
+        return errorCode;
+    }
+
+    // Batches of D must not overlap; operands are only addressed forwards
+    if(batchCount < 1 || strideA < 0 || strideB < 0 || strideC < 0 || strideD < 0
+       || (batchCount > 1 && strideD == 0))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : batchCount must be positive, batch strides "
+                 "non-negative and strideD non-zero (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionBatched", msg);
+        return errorCode;
+    }
+
+    if(plan->mSolution == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Internal Error : solution = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionBatched", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+
+    // Ensure current HIP device is same as the handle.
+    auto currentDeviceId = hiptensor::HipDevice::currentDeviceId();
+    if(currentDeviceId != realHandle->getDevice().getDeviceId())
+    {
+        auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Device mismatch error: current device id: %d, handle device id: %d (%s)",
+                 (int)currentDeviceId,
+                 (int)realHandle->getDevice().getDeviceId(),
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionBatched", msg);
+        return errorCode;
+    }
+
+    auto const& desc = plan->mContractionDesc;
+
+    // Pre-reduced operands are summed out batch by batch, by the plan itself, and device
+    // scalars are applied to each batch after its contraction
+    if(batchCount > 1 && !hiptensor::hasPreReduction(desc)
+       && realHandle->pointerMode() == HIPTENSOR_POINTER_MODE_HOST)
+    {
+        auto errorCode = runBatchedSolution(realHandle,
+                                            plan,
+                                            alpha,
+                                            A,
+                                            B,
+                                            beta,
+                                            C,
+                                            D,
+                                            batchCount,
+                                            strideA,
+                                            strideB,
+                                            strideC,
+                                            strideD,
+                                            workspace,
+                                            workspaceSize,
+                                            stream);
+        if(errorCode != HIPTENSOR_STATUS_NOT_SUPPORTED)
+        {
+            if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                snprintf(msg,
+                         sizeof(msg),
+                         "Batched kernel is unable to solve the problem (%s)",
+                         hiptensorGetErrorString(errorCode));
+                logger->logError("hiptensorContractionBatched", msg);
+            }
+            return errorCode;
+        }
+    }
+
+    // No batched kernel for the problem: execute the plan once per batch
+    for(int64_t i = 0; i < batchCount; i++)
+    {
+        auto errorCode = hiptensorContraction(
+            handle,
+            plan,
+            alpha,
+            offsetBatch(A, i, strideA, planeElementBytes(desc.mTensorDesc[0])),
+            offsetBatch(B, i, strideB, planeElementBytes(desc.mTensorDesc[1])),
+            beta,
+            offsetBatch(C, i, strideC, planeElementBytes(desc.mTensorDesc[2])),
+            offsetBatch(D, i, strideD, planeElementBytes(desc.mTensorDesc[3])),
+            workspace,
+            workspaceSize,
+            stream);
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return errorCode;
+        }
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorContractionBatchedPointers(const hiptensorHandle_t*          handle,
+                                                      const hiptensorContractionPlan_t* plan,
+                                                      const void*                       alpha,
+                                                      const void* const                 A[],
+                                                      const void* const                 B[],
+                                                      const void*                       beta,
+                                                      const void* const                 C[],
+                                                      void* const                       D[],
+                                                      int64_t                           batchCount,
+                                                      void*                             workspace,
+                                                      uint64_t    workspaceSize,
+                                                      hipStream_t stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, plan=0x%llX, A=0x%llX, B=0x%llX, C=0x%llX, D=0x%llX, "
+             "batchCount=%ld, workspace=0x%llX, workspaceSize=0x%04lX, stream=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)plan,
+             (unsigned long long)A,
+             (unsigned long long)B,
+             (unsigned long long)C,
+             (unsigned long long)D,
+             (long)batchCount,
+             (unsigned long long)workspace,
+             (unsigned long)workspaceSize,
+             (unsigned long long)stream);
+
+    logger->logAPITrace("hiptensorContractionBatchedPointers", msg);
+
+    if(handle == nullptr || plan == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "plan",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionBatchedPointers", msg);
+        return errorCode;
+    }
+
+    if(A == nullptr || B == nullptr || D == nullptr || batchCount < 1)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : A/B/D = nullptr or batchCount < 1 (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionBatchedPointers", msg);
+        return errorCode;
+    }
+
+    // Pointer arrays with a constant, non-negative batch distance are a strided batch
+    auto const& desc         = plan->mContractionDesc;
+    auto        uniformStride = [batchCount](const void* const* ptrs, std::size_t elementBytes) {
+        if(ptrs == nullptr || batchCount == 1)
+        {
+            return int64_t(0);
+        }
+
+        auto delta = (const char*)ptrs[1] - (const char*)ptrs[0];
+        for(int64_t i = 1; i < batchCount; i++)
+        {
+            if((const char*)ptrs[i] - (const char*)ptrs[i - 1] != delta)
+            {
+                return int64_t(-1);
+            }
+        }
+        return delta >= 0 && delta % (std::ptrdiff_t)elementBytes == 0
+                   ? int64_t(delta / (std::ptrdiff_t)elementBytes)
+                   : int64_t(-1);
+    };
+
+    auto strideA = uniformStride(A, planeElementBytes(desc.mTensorDesc[0]));
+    auto strideB = uniformStride(B, planeElementBytes(desc.mTensorDesc[1]));
+    auto strideC = uniformStride(C, planeElementBytes(desc.mTensorDesc[2]));
+    auto strideD = uniformStride((const void* const*)D, planeElementBytes(desc.mTensorDesc[3]));
+
+    if(strideA >= 0 && strideB >= 0 && strideC >= 0 && strideD > 0)
+    {
+        return hiptensorContractionBatched(handle,
+                                           plan,
+                                           alpha,
+                                           A[0],
+                                           B[0],
+                                           beta,
+                                           C == nullptr ? nullptr : C[0],
+                                           D[0],
+                                           batchCount,
+                                           strideA,
+                                           strideB,
+                                           strideC,
+                                           strideD,
+                                           workspace,
+                                           workspaceSize,
+                                           stream);
+    }
+
+    // Non-uniform batches: execute the plan once per batch
+    for(int64_t i = 0; i < batchCount; i++)
+    {
+        auto errorCode = hiptensorContraction(handle,
+                                              plan,
+                                              alpha,
+                                              A[i],
+                                              B[i],
+                                              beta,
+                                              C == nullptr ? nullptr : C[i],
+                                              D[i],
+                                              workspace,
+                                              workspaceSize,
+                                              stream);
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return errorCode;
+        }
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
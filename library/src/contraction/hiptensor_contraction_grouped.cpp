@@ -0,0 +1,520 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <algorithm>
+#include <numeric>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "contraction_batched_solution_instances.hpp"
+#include "contraction_grouped_solution_instances.hpp"
+#include "contraction_solution.hpp"
+#include "contraction_solution_instances.hpp"
+#include "handle.hpp"
+#include "hip_device.hpp"
+#include "logger.hpp"
+#include "util.hpp"
+#include "workspace_arena.hpp"
+
+#include "hiptensor_options.hpp"
+
+namespace
+{
+    // Contraction group of the descriptor, with the operands of the API (A, B, C, D)
+    // given as the operands of the solutions (A, B, D, E)
+    hiptensor::ContractionGroup makeGroup(hiptensorContractionDescriptor_t const& desc,
+                                          const void*                             A,
+                                          const void*                             B,
+                                          const void*                             C,
+                                          void*                                   D)
+    {
+        return {A,
+                B,
+                C,
+                D,
+                desc.mTensorDesc[0].mLengths,
+                desc.mTensorDesc[0].mStrides,
+                desc.mTensorMode[0],
+                desc.mTensorDesc[1].mLengths,
+                desc.mTensorDesc[1].mStrides,
+                desc.mTensorMode[1],
+                desc.mTensorDesc[3].mLengths,
+                desc.mTensorDesc[3].mStrides,
+                desc.mTensorMode[2]};
+    }
+
+    // M and N extents of a group: the products of the E modes of A and of B
+    std::array<int64_t, 2> groupExtents(hiptensor::ContractionGroup const& group)
+    {
+        std::array<int64_t, 2> extents = {1, 1};
+        for(std::size_t i = 0; i < group.mEModes.size(); i++)
+        {
+            auto mode = group.mEModes[i];
+            auto inA  = std::find(group.mAModes.begin(), group.mAModes.end(), mode)
+                       != group.mAModes.end();
+            extents[inA ? 0 : 1] *= group.mELengths[i];
+        }
+        return extents;
+    }
+
+    // Estimated cost of running the groups with the block tile of a solution: the number
+    // of waves of tiles over the CUs, times the work of a tile.
+    int64_t groupedCost(std::vector<hiptensor::ContractionGroup> const& groups,
+                        std::array<int32_t, 2>                          tile,
+                        int                                             cuCount)
+    {
+        int64_t tiles = 0;
+        for(auto const& group : groups)
+        {
+            auto extents = groupExtents(group);
+            tiles += hiptensor::ceilDiv(extents[0], int64_t(tile[0]))
+                     * hiptensor::ceilDiv(extents[1], int64_t(tile[1]));
+        }
+        auto waves = hiptensor::ceilDiv(tiles, int64_t(std::max(cuCount, 1)));
+        return waves * tile[0] * tile[1];
+    }
+
+    // Selects the grouped solution with the least estimated cost over all the groups.
+    // Returns nullptr if none supports every group.
+    hiptensor::GroupedContractionSolution*
+        selectGroupedSolution(hiptensorContractionDescriptor_t const&         desc,
+                              std::vector<hiptensor::ContractionGroup> const& groups,
+                              const void*                                     alpha,
+                              const void*                                     beta,
+                              int                                             cuCount)
+    {
+        auto& instances = hiptensor::GroupedContractionSolutionInstances::instance();
+        auto  solutions = instances
+                             ->querySolutions((hiptensor::ContractionOpId_t)desc.mContractionOpId,
+                                              desc.mTensorDesc[0].mType,
+                                              desc.mTensorDesc[1].mType,
+                                              desc.mTensorDesc[2].mType,
+                                              desc.mTensorDesc[3].mType,
+                                              desc.mComputeType)
+                             .solutionList();
+
+        hiptensor::GroupedContractionSolution* winner   = nullptr;
+        int64_t                                bestCost = 0;
+        for(auto* solution : solutions)
+        {
+            auto* grouped = dynamic_cast<hiptensor::GroupedContractionSolution*>(solution);
+            if(grouped == nullptr || !grouped->initGroupedArgs(alpha, beta, groups, nullptr))
+            {
+                continue;
+            }
+
+            auto cost = groupedCost(groups, grouped->blockTile(), cuCount);
+            if(winner == nullptr || cost < bestCost)
+            {
+                winner   = grouped;
+                bestCost = cost;
+            }
+        }
+        return winner;
+    }
+
+    // Runs each group with the first contraction solution that supports it, for problems
+    // that no grouped solution supports
+    hiptensorStatus_t runGroupsOneByOne(hiptensor::Handle*                               realHandle,
+                                        hiptensorContractionDescriptor_t const* const    descs[],
+                                        std::vector<hiptensor::ContractionGroup> const& groups,
+                                        const void*                                      alpha,
+                                        const void*                                      beta,
+                                        void*                                            workspace,
+                                        uint64_t    workspaceSize,
+                                        hipStream_t stream)
+    {
+        for(std::size_t i = 0; i < groups.size(); i++)
+        {
+            auto const& desc         = *descs[i];
+            auto const& group        = groups[i];
+            auto        planeStrides = hiptensor::planeStrides(desc);
+
+            // Groups with batch modes are contracted by batched solutions
+            hiptensor::ContractionSolutionRegistry* instances
+                = hiptensor::ContractionSolutionInstances::instance().get();
+            if(hiptensor::hasBatchModes(desc))
+            {
+                instances = hiptensor::BatchedContractionSolutionInstances::instance().get();
+            }
+
+            auto initArgs = [&](hiptensor::ContractionSolution* solution, void* workspacePtr) {
+                return solution->initArgs(alpha,
+                                          group.mA,
+                                          group.mB,
+                                          beta,
+                                          group.mD,
+                                          group.mE,
+                                          group.mALengths,
+                                          group.mAStrides,
+                                          group.mAModes,
+                                          group.mBLengths,
+                                          group.mBStrides,
+                                          group.mBModes,
+                                          desc.mTensorDesc[2].mLengths,
+                                          desc.mTensorDesc[2].mStrides,
+                                          desc.mTensorMode[2],
+                                          group.mELengths,
+                                          group.mEStrides,
+                                          group.mEModes,
+                                          planeStrides,
+                                          hiptensor::ContractionEpilogue{},
+                                          workspacePtr);
+            };
+
+            auto solutions
+                = instances
+                      ->querySolutions((hiptensor::ContractionOpId_t)desc.mContractionOpId,
+                                       desc.mTensorDesc[0].mType,
+                                       desc.mTensorDesc[1].mType,
+                                       desc.mTensorDesc[2].mType,
+                                       desc.mTensorDesc[3].mType,
+                                       desc.mComputeType)
+                      .solutionList();
+
+            auto candidate = std::find_if(
+                solutions.begin(), solutions.end(), [&](auto* s) { return initArgs(s, nullptr); });
+            if(candidate == solutions.end())
+            {
+                return HIPTENSOR_STATUS_NOT_SUPPORTED;
+            }
+            auto* solution = *candidate;
+
+            // Library-managed workspace, given back to the arena in stream order
+            hiptensor::WorkspaceArena::Allocation managedWorkspace;
+            auto*                                 groupWorkspace     = workspace;
+            auto                                  groupWorkspaceSize = workspaceSize;
+            if(workspace == nullptr && solution->workspaceSize() > 0)
+            {
+                managedWorkspace
+                    = realHandle->workspaceArena().allocate(solution->workspaceSize(), stream);
+                if(managedWorkspace.get() == nullptr)
+                {
+                    return HIPTENSOR_STATUS_ALLOC_FAILED;
+                }
+                groupWorkspace     = managedWorkspace.get();
+                groupWorkspaceSize = managedWorkspace.size();
+            }
+
+            auto errorCode = std::get<0>((*solution)(alpha,
+                                                     group.mA,
+                                                     group.mB,
+                                                     beta,
+                                                     group.mD,
+                                                     group.mE,
+                                                     group.mALengths,
+                                                     group.mAStrides,
+                                                     group.mAModes,
+                                                     group.mBLengths,
+                                                     group.mBStrides,
+                                                     group.mBModes,
+                                                     desc.mTensorDesc[2].mLengths,
+                                                     desc.mTensorDesc[2].mStrides,
+                                                     desc.mTensorMode[2],
+                                                     group.mELengths,
+                                                     group.mEStrides,
+                                                     group.mEModes,
+                                                     planeStrides,
+                                                     hiptensor::ContractionEpilogue{},
+                                                     groupWorkspace,
+                                                     groupWorkspaceSize,
+                                                     StreamConfig{stream, false}));
+            if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return errorCode;
+            }
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+} // namespace
+
+hiptensorStatus_t hiptensorContractionGrouped(const hiptensorHandle_t*                      handle,
+                                              const hiptensorContractionDescriptor_t* const descs[],
+                                              const void*                                   alpha,
+                                              const void* const                             A[],
+                                              const void* const                             B[],
+                                              const void*                                   beta,
+                                              const void* const                             C[],
+                                              void* const                                   D[],
+                                              uint32_t    groupCount,
+                                              void*       workspace,
+                                              uint64_t    workspaceSize,
+                                              hipStream_t stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, descs=0x%llX, A=0x%llX, B=0x%llX, C=0x%llX, D=0x%llX, "
+             "groupCount=%u, workspace=0x%llX, workspaceSize=0x%04lX, stream=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)descs,
+             (unsigned long long)A,
+             (unsigned long long)B,
+             (unsigned long long)C,
+             (unsigned long long)D,
+             groupCount,
+             (unsigned long long)workspace,
+             (unsigned long)workspaceSize,
+             (unsigned long long)stream);
+
+    logger->logAPITrace("hiptensorContractionGrouped", msg);
+
+    if(handle == nullptr || descs == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "descs",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    if(alpha == nullptr || A == nullptr || B == nullptr || D == nullptr || groupCount == 0)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : alpha/A/B/D = nullptr or groupCount = 0 (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    // Every group is a contraction of the same operation and data types
+    for(uint32_t i = 0; i < groupCount; i++)
+    {
+        auto const* desc  = descs[i];
+        auto const* first = descs[0];
+        if(desc == nullptr || A[i] == nullptr || B[i] == nullptr || D[i] == nullptr
+           || desc->mContractionOpId != first->mContractionOpId
+           || desc->mComputeType != first->mComputeType
+           || std::any_of(std::begin(desc->mTensorDesc),
+                          std::end(desc->mTensorDesc),
+                          [&, t = 0](auto const& tensorDesc) mutable {
+                              return tensorDesc.mType != first->mTensorDesc[t++].mType;
+                          }))
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Input Parameter Error : group %u is missing operands, or differs from "
+                     "group 0 in operation or data types (%s)",
+                     i,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorContractionGrouped", msg);
+            return errorCode;
+        }
+    }
+
+    // Groups are contracted by the solutions directly, without the pre-reductions of a plan
+    if(std::any_of(descs, descs + groupCount, [](auto const* desc) {
+           return hiptensor::hasPreReduction(*desc);
+       }))
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Descriptor Error : modes of A or B must be in another tensor of "
+                 "their group (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    // Epilogue bias strides are bound to the output of a single descriptor
+    if(std::any_of(descs, descs + groupCount, [](auto const* desc) {
+           return desc->mContractionOpId == (int32_t)hiptensor::ContractionOpId_t::EPILOGUE;
+       }))
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Descriptor Error : groups can not have contraction epilogues (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    // Grouped kernels are only instantiated with identity operators on A and B
+    if(std::any_of(descs, descs + groupCount, [](auto const* desc) {
+           return hiptensor::hasElementOps(*desc);
+       }))
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Descriptor Error : groups can not have unary operators on A or B "
+                 "(%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+
+    // Ensure current HIP device is same as the handle.
+    auto currentDeviceId = hiptensor::HipDevice::currentDeviceId();
+    if(currentDeviceId != realHandle->getDevice().getDeviceId())
+    {
+        auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Device mismatch error: current device id: %d, handle device id: %d (%s)",
+                 (int)currentDeviceId,
+                 (int)realHandle->getDevice().getDeviceId(),
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    // Groups share alpha and beta, which the grouped kernels take by value
+    if(realHandle->pointerMode() == HIPTENSOR_POINTER_MODE_DEVICE)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Pointer Mode Error : grouped contractions do not support device "
+                 "scalars (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    std::vector<hiptensor::ContractionGroup> groups;
+    groups.reserve(groupCount);
+    for(uint32_t i = 0; i < groupCount; i++)
+    {
+        groups.push_back(makeGroup(*descs[i], A[i], B[i], C == nullptr ? nullptr : C[i], D[i]));
+    }
+
+    // Grouped kernels take interleaved operands without batch modes only
+    auto isGroupable = [](hiptensorContractionDescriptor_t const* desc) {
+        auto strides = hiptensor::planeStrides(*desc);
+        return std::all_of(strides.begin(), strides.end(), [](auto s) { return s == 0; })
+               && !hiptensor::hasBatchModes(*desc);
+    };
+
+    // Grouped kernels upload the arguments of the groups with a blocking copy from host
+    // memory, which can not be captured. Captured groups are contracted one by one.
+    hiptensor::GroupedContractionSolution* solution = nullptr;
+    if(std::all_of(descs, descs + groupCount, isGroupable) && !hiptensor::isStreamCapturing(stream))
+    {
+        solution = selectGroupedSolution(
+            *descs[0], groups, alpha, beta, realHandle->getDevice().cuCount());
+    }
+
+    hiptensorStatus_t errorCode = HIPTENSOR_STATUS_SUCCESS;
+    if(solution == nullptr)
+    {
+        // No grouped kernel for the problem: contract the groups one by one
+        errorCode = runGroupsOneByOne(
+            realHandle, descs, groups, alpha, beta, workspace, workspaceSize, stream);
+    }
+    else
+    {
+        // The workspace of grouped kernels holds the kernel arguments of the groups
+        solution->initGroupedArgs(alpha, beta, groups, nullptr);
+
+        hiptensor::WorkspaceArena::Allocation managedWorkspace;
+        if(workspace == nullptr && solution->workspaceSize() > 0)
+        {
+            managedWorkspace
+                = realHandle->workspaceArena().allocate(solution->workspaceSize(), stream);
+            workspace     = managedWorkspace.get();
+            workspaceSize = managedWorkspace.size();
+        }
+
+        if(solution->workspaceSize() > 0 && workspace == nullptr)
+        {
+            errorCode = HIPTENSOR_STATUS_ALLOC_FAILED;
+        }
+        // Perform the grouped contraction with timing if LOG_LEVEL_PERF_TRACE
+        else if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+        {
+            using hiptensor::HiptensorOptions;
+            auto& options = HiptensorOptions::instance();
+
+            float time;
+            std::tie(errorCode, time)
+                = solution->runGrouped(alpha,
+                                       beta,
+                                       groups,
+                                       workspace,
+                                       workspaceSize,
+                                       StreamConfig{
+                                           stream, // stream id
+                                           true, // time_kernel
+                                           0, // log_level
+                                           options->coldRuns(), // cold_niters
+                                           options->hotRuns(), // nrepeat
+                                       });
+
+            if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+            {
+                int32_t m, n, k;
+                std::tie(m, n, k) = solution->problemDims();
+                auto flops        = std::size_t(2) * m * n * k;
+                auto bytes        = solution->problemBytes();
+
+                snprintf(msg,
+                         sizeof(msg),
+                         "KernelId: %lu KernelName: %s, GroupCount: %u, %0.3f ms, %0.3f TFlops, "
+                         "%0.3f GB/s",
+                         solution->uid(),
+                         solution->kernelName().c_str(),
+                         groupCount,
+                         time,
+                         static_cast<float>(flops) / static_cast<float>(1.E9) / time,
+                         static_cast<float>(bytes) / static_cast<float>(1.E6) / time);
+                logger->logPerformanceTrace("hiptensorContractionGrouped", msg);
+            }
+        }
+        // Perform the grouped contraction without timing
+        else
+        {
+            errorCode = std::get<0>(solution->runGrouped(
+                alpha, beta, groups, workspace, workspaceSize, StreamConfig{stream, false}));
+        }
+    }
+
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unable to contract the groups (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+    }
+
+    return errorCode;
+}
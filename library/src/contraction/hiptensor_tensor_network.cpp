@@ -0,0 +1,451 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "contraction_path.hpp"
+#include "data_types.hpp"
+#include "device_scalars.hpp"
+#include "handle.hpp"
+#include "hip_device.hpp"
+#include "logger.hpp"
+#include "workspace_arena.hpp"
+
+namespace
+{
+    // Alignment of the intermediates in the workspace, in bytes
+    constexpr std::size_t IntermediateAlignment = 256u;
+
+    template <typename T>
+    T* offsetBytes(T* ptr, uint64_t bytes)
+    {
+        using ByteT = std::conditional_t<std::is_const_v<T>, const char, char>;
+        return ptr == nullptr ? nullptr : (T*)((ByteT*)ptr + bytes);
+    }
+} // namespace
+
+hiptensorStatus_t
+    hiptensorInitTensorNetworkPlan(const hiptensorHandle_t*                 handle,
+                                   hiptensorTensorNetworkPlan_t*            plan,
+                                   uint32_t                                 numInputs,
+                                   const hiptensorTensorDescriptor_t* const descInputs[],
+                                   const int32_t* const                     modeInputs[],
+                                   const hiptensorTensorDescriptor_t*       descOutput,
+                                   const int32_t                            modeOutput[],
+                                   hiptensorComputeType_t                   typeCompute,
+                                   hiptensorContractionPathAlgo_t           pathAlgo,
+                                   const hiptensorContractionFind_t*        find)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, plan=0x%llX, numInputs=%u, descInputs=0x%llX, modeInputs=0x%llX, "
+             "descOutput=0x%llX, modeOutput=0x%llX, typeCompute=0x%02X, pathAlgo=%d, find=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)plan,
+             numInputs,
+             (unsigned long long)descInputs,
+             (unsigned long long)modeInputs,
+             (unsigned long long)descOutput,
+             (unsigned long long)modeOutput,
+             (unsigned int)typeCompute,
+             (int)pathAlgo,
+             (unsigned long long)find);
+
+    logger->logAPITrace("hiptensorInitTensorNetworkPlan", msg);
+
+    if(handle == nullptr || plan == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "plan",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitTensorNetworkPlan", msg);
+        return errorCode;
+    }
+
+    if(numInputs < 2 || descInputs == nullptr || modeInputs == nullptr || descOutput == nullptr
+       || (modeOutput == nullptr && !descOutput->mLengths.empty())
+       || std::any_of(descInputs, descInputs + numInputs, [](auto* d) { return d == nullptr; })
+       || std::any_of(modeInputs, modeInputs + numInputs, [](auto* m) { return m == nullptr; }))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : the network needs at least two inputs, with their "
+                 "descriptors and modes, and the output descriptor (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitTensorNetworkPlan", msg);
+        return errorCode;
+    }
+
+    // Intermediates have the data type of the output
+    auto dataType = descOutput->mType;
+    if(std::any_of(descInputs, descInputs + numInputs, [dataType](auto* d) {
+           return d->mType != dataType;
+       }))
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Data Type Error : the inputs and the output of the network must "
+                 "have the same data type (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitTensorNetworkPlan", msg);
+        return errorCode;
+    }
+
+    // Modes of every tensor, and the extent of every mode
+    std::vector<std::vector<int32_t>>        inputModes(numInputs);
+    std::vector<int32_t>                     outputModes;
+    std::unordered_map<int32_t, std::size_t> extents;
+    bool                                     consistent = true;
+
+    auto addModes = [&](hiptensorTensorDescriptor_t const& desc,
+                        const int32_t*                     modes,
+                        std::vector<int32_t>*              result) {
+        for(std::size_t i = 0; i < desc.mLengths.size(); i++)
+        {
+            result->push_back(modes[i]);
+            auto extent = extents.emplace(modes[i], desc.mLengths[i]).first;
+            consistent &= extent->second == desc.mLengths[i];
+        }
+    };
+    for(uint32_t i = 0; i < numInputs; i++)
+    {
+        addModes(*descInputs[i], modeInputs[i], &inputModes[i]);
+    }
+    addModes(*descOutput, modeOutput, &outputModes);
+
+    hiptensor::ContractionPath path;
+    if(!consistent
+       || !hiptensor::findContractionPath(&path,
+                                          inputModes,
+                                          outputModes,
+                                          extents,
+                                          pathAlgo == HIPTENSOR_PATH_OPTIMAL
+                                              ? hiptensor::ContractionPathAlgo_t::OPTIMAL
+                                              : hiptensor::ContractionPathAlgo_t::GREEDY))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Invalid Network Error : every mode must have one extent, appear in two inputs "
+                 "or in an input and the output, and at most once per tensor (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitTensorNetworkPlan", msg);
+        return errorCode;
+    }
+
+    hiptensorContractionFind_t defaultFind;
+    if(find == nullptr)
+    {
+        hiptensorInitContractionFind(handle, &defaultFind, HIPTENSOR_ALGO_DEFAULT);
+        find = &defaultFind;
+    }
+
+    // Descriptors of the intermediates, packed with the default strides
+    auto const&                              steps = path.mSteps;
+    std::vector<hiptensorTensorDescriptor_t> intermediates(steps.size());
+    for(std::size_t s = 0; s + 1 < steps.size(); s++)
+    {
+        std::vector<int64_t> lengths;
+        for(auto mode : steps[s].mModes)
+        {
+            lengths.push_back(extents[mode]);
+        }
+        hiptensorInitTensorDescriptor(handle,
+                                      &intermediates[s],
+                                      lengths.size(),
+                                      lengths.data(),
+                                      nullptr,
+                                      dataType,
+                                      HIPTENSOR_OP_IDENTITY);
+    }
+
+    auto operandDesc = [&](int32_t operand) -> hiptensorTensorDescriptor_t const& {
+        return operand < (int32_t)numInputs ? *descInputs[operand]
+                                            : intermediates[operand - numInputs];
+    };
+    auto operandModes = [&](int32_t operand) -> std::vector<int32_t> const& {
+        return operand < (int32_t)numInputs ? inputModes[operand]
+                                            : steps[operand - numInputs].mModes;
+    };
+
+    // Plan the contraction of each step
+    plan->mNumInputs   = numInputs;
+    plan->mComputeType = typeCompute;
+    plan->mFlops       = path.mFlops;
+    plan->mSteps.assign(steps.size(), hiptensorTensorNetworkStep_t{});
+
+    auto alignment = (uint32_t)hiptensor::hipDataTypeSize(dataType);
+    for(std::size_t s = 0; s < steps.size(); s++)
+    {
+        auto& step        = plan->mSteps[s];
+        step.mOperands[0] = steps[s].mOperands[0];
+        step.mOperands[1] = steps[s].mOperands[1];
+
+        auto const& descA  = operandDesc(step.mOperands[0]);
+        auto const& descB  = operandDesc(step.mOperands[1]);
+        auto const& descD  = s + 1 < steps.size() ? intermediates[s] : *descOutput;
+        auto const& modesA = operandModes(step.mOperands[0]);
+        auto const& modesB = operandModes(step.mOperands[1]);
+        auto const& modesD = steps[s].mModes;
+
+        hiptensorContractionDescriptor_t desc;
+        uint64_t                         workspaceSize = 0;
+
+        auto errorCode = hiptensorInitContractionDescriptor(handle,
+                                                            &desc,
+                                                            &descA,
+                                                            modesA.data(),
+                                                            alignment,
+                                                            &descB,
+                                                            modesB.data(),
+                                                            alignment,
+                                                            nullptr,
+                                                            nullptr,
+                                                            0,
+                                                            &descD,
+                                                            modesD.data(),
+                                                            alignment,
+                                                            typeCompute);
+        if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            errorCode = hiptensorContractionGetWorkspaceSize(
+                handle, &desc, find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize);
+        }
+        if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            errorCode
+                = hiptensorInitContractionPlan(handle, &step.mPlan, &desc, find, workspaceSize);
+        }
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unable to plan contraction %zu of %zu of the network (%s)",
+                     s + 1,
+                     steps.size(),
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorInitTensorNetworkPlan", msg);
+            return errorCode;
+        }
+    }
+
+    // Each intermediate lives from the step producing it to the step consuming it
+    std::vector<std::size_t>            sizes;
+    std::vector<std::array<int32_t, 2>> lifetimes;
+    for(std::size_t s = 0; s + 1 < steps.size(); s++)
+    {
+        sizes.push_back((std::size_t)steps[s].mElements * hiptensor::hipDataTypeSize(dataType));
+        lifetimes.push_back({(int32_t)s, (int32_t)s});
+    }
+    for(std::size_t s = 0; s < steps.size(); s++)
+    {
+        for(auto operand : steps[s].mOperands)
+        {
+            if(operand >= (int32_t)numInputs)
+            {
+                lifetimes[operand - numInputs][1] = (int32_t)s;
+            }
+        }
+    }
+
+    std::size_t intermediateSize = 0;
+    auto        offsets
+        = hiptensor::planBufferOffsets(sizes, lifetimes, IntermediateAlignment, &intermediateSize);
+
+    uint64_t stepWorkspaceSize = 0;
+    for(std::size_t s = 0; s < steps.size(); s++)
+    {
+        plan->mSteps[s].mResultOffset = s < offsets.size() ? offsets[s] : 0u;
+        stepWorkspaceSize = std::max(stepWorkspaceSize, plan->mSteps[s].mPlan.mWorkspaceSize);
+    }
+    plan->mIntermediateSize = intermediateSize;
+    plan->mWorkspaceSize    = intermediateSize + stepWorkspaceSize;
+
+    snprintf(msg,
+             sizeof(msg),
+             "Contractions: %zu, %0.3f GFlops, Intermediates: %lu bytes, Workspace: %lu bytes",
+             steps.size(),
+             path.mFlops / 1.E9,
+             (unsigned long)plan->mIntermediateSize,
+             (unsigned long)plan->mWorkspaceSize);
+    logger->logPerformanceTrace("hiptensorInitTensorNetworkPlan", msg);
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorTensorNetwork(const hiptensorHandle_t*            handle,
+                                         const hiptensorTensorNetworkPlan_t* plan,
+                                         const void*                         alpha,
+                                         const void* const                   inputs[],
+                                         void*                               output,
+                                         void*                               workspace,
+                                         uint64_t                            workspaceSize,
+                                         hipStream_t                         stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, plan=0x%llX, alpha=0x%llX, inputs=0x%llX, output=0x%llX, "
+             "workspace=0x%llX, workspaceSize=0x%04lX, stream=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)plan,
+             (unsigned long long)alpha,
+             (unsigned long long)inputs,
+             (unsigned long long)output,
+             (unsigned long long)workspace,
+             (unsigned long)workspaceSize,
+             (unsigned long long)stream);
+
+    logger->logAPITrace("hiptensorTensorNetwork", msg);
+
+    if(handle == nullptr || plan == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "plan",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorTensorNetwork", msg);
+        return errorCode;
+    }
+
+    if(alpha == nullptr || inputs == nullptr || output == nullptr
+       || std::any_of(inputs, inputs + plan->mNumInputs, [](auto* p) { return p == nullptr; }))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : alpha/inputs/output = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorTensorNetwork", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+
+    // Ensure current HIP device is same as the handle.
+    auto currentDeviceId = hiptensor::HipDevice::currentDeviceId();
+    if(currentDeviceId != realHandle->getDevice().getDeviceId())
+    {
+        auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Device mismatch error: current device id: %d, handle device id: %d (%s)",
+                 (int)currentDeviceId,
+                 (int)realHandle->getDevice().getDeviceId(),
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorTensorNetwork", msg);
+        return errorCode;
+    }
+
+    // Library-managed workspace, given back to the arena in stream order on return
+    hiptensor::WorkspaceArena::Allocation managedWorkspace;
+    if(workspace == nullptr && plan->mWorkspaceSize > 0)
+    {
+        managedWorkspace = realHandle->workspaceArena().allocate(plan->mWorkspaceSize, stream);
+        workspace        = managedWorkspace.get();
+        workspaceSize    = managedWorkspace.size();
+    }
+
+    if(workspaceSize < plan->mWorkspaceSize || (plan->mWorkspaceSize > 0 && workspace == nullptr))
+    {
+        auto errorCode = workspace == nullptr ? HIPTENSOR_STATUS_ALLOC_FAILED
+                                              : HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Insufficient workspace: req: %lu alloc: %lu (%s)",
+                 (unsigned long)plan->mWorkspaceSize,
+                 (unsigned long)workspaceSize,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorTensorNetwork", msg);
+        return errorCode;
+    }
+
+    // The intermediate contractions are unscaled, alpha scales the last one
+    hiptensor::LibraryScalars scalars(*realHandle, plan->mComputeType);
+
+    auto stepWorkspace     = offsetBytes(workspace, plan->mIntermediateSize);
+    auto stepWorkspaceSize = workspaceSize - plan->mIntermediateSize;
+    auto operand           = [&](int32_t index) -> const void* {
+        if(index < (int32_t)plan->mNumInputs)
+        {
+            return inputs[index];
+        }
+        return offsetBytes(workspace, plan->mSteps[index - plan->mNumInputs].mResultOffset);
+    };
+
+    for(std::size_t s = 0; s < plan->mSteps.size(); s++)
+    {
+        auto const& step   = plan->mSteps[s];
+        auto        isLast = s + 1 == plan->mSteps.size();
+
+        auto errorCode
+            = hiptensorContraction(handle,
+                                   &step.mPlan,
+                                   isLast ? alpha : scalars.one(),
+                                   operand(step.mOperands[0]),
+                                   operand(step.mOperands[1]),
+                                   nullptr,
+                                   nullptr,
+                                   isLast ? output : offsetBytes(workspace, step.mResultOffset),
+                                   stepWorkspace,
+                                   stepWorkspaceSize,
+                                   stream);
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unable to execute contraction %zu of %zu of the network (%s)",
+                     s + 1,
+                     plan->mSteps.size(),
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorTensorNetwork", msg);
+            return errorCode;
+        }
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
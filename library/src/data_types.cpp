@@ -361,6 +361,10 @@ namespace hiptensor
         {
             return "HIPTENSOR_OP_SQRT";
         }
+        else if(opType == HIPTENSOR_OP_CONJ)
+        {
+            return "HIPTENSOR_OP_CONJ";
+        }
         else if(opType == HIPTENSOR_OP_ADD)
         {
             return "HIPTENSOR_OP_ADD";
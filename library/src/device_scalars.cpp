@@ -0,0 +1,371 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <numeric>
+
+#include <hip/hip_runtime.h>
+
+#include "device_scalars.hpp"
+#include "handle.hpp"
+#include "util.hpp"
+
+namespace hiptensor
+{
+    // Device constants passed by the library to its own operations in device pointer mode.
+    // Zero has all bits clear in every type, and the real one of single and double
+    // precision is the real part of the complex one.
+    __device__ uint16_t DeviceOneF16    = 0x3C00;
+    __device__ uint16_t DeviceOneBF16   = 0x3F80;
+    __device__ float    DeviceOneC32[2] = {1.0f, 0.0f};
+    __device__ double   DeviceOneC64[2] = {1.0, 0.0};
+    __device__ double   DeviceZero[2]   = {0.0, 0.0};
+
+    // Threads per block of the device scalars kernel
+    static constexpr int32_t DeviceScalarsBlockSize = 256;
+
+    // Lengths and strides of the tensors scaled by the device scalars kernel, in elements
+    struct DeviceScalarsDesc
+    {
+        int32_t mRank;
+        int64_t mElements;
+        int64_t mLengths[DeviceScalarsMaxRank];
+        int64_t mStridesT[DeviceScalarsMaxRank];
+        int64_t mStridesC[DeviceScalarsMaxRank];
+        int64_t mStridesD[DeviceScalarsMaxRank];
+    };
+
+    // Type the scaling is computed in
+    template <typename DataT>
+    struct DeviceScalarsAcc
+    {
+        using type = float;
+    };
+
+    template <>
+    struct DeviceScalarsAcc<double>
+    {
+        using type = double;
+    };
+
+    template <>
+    struct DeviceScalarsAcc<hipFloatComplex>
+    {
+        using type = hipFloatComplex;
+    };
+
+    template <>
+    struct DeviceScalarsAcc<hipDoubleComplex>
+    {
+        using type = hipDoubleComplex;
+    };
+
+    // Complex vector types multiply and add element-wise, so the scaling goes through
+    // these overloads
+    template <typename T>
+    __device__ inline T scalarMul(T a, T b)
+    {
+        return a * b;
+    }
+
+    template <>
+    __device__ inline hipFloatComplex scalarMul(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCmulf(a, b);
+    }
+
+    template <>
+    __device__ inline hipDoubleComplex scalarMul(hipDoubleComplex a, hipDoubleComplex b)
+    {
+        return hipCmul(a, b);
+    }
+
+    template <typename T>
+    __device__ inline T scalarAdd(T a, T b)
+    {
+        return a + b;
+    }
+
+    template <>
+    __device__ inline hipFloatComplex scalarAdd(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCaddf(a, b);
+    }
+
+    template <>
+    __device__ inline hipDoubleComplex scalarAdd(hipDoubleComplex a, hipDoubleComplex b)
+    {
+        return hipCadd(a, b);
+    }
+
+    template <typename T>
+    __device__ inline bool scalarIsZero(T a)
+    {
+        return a == T(0);
+    }
+
+    template <>
+    __device__ inline bool scalarIsZero(hipFloatComplex a)
+    {
+        return hipCrealf(a) == 0.0f && hipCimagf(a) == 0.0f;
+    }
+
+    template <>
+    __device__ inline bool scalarIsZero(hipDoubleComplex a)
+    {
+        return hipCreal(a) == 0.0 && hipCimag(a) == 0.0;
+    }
+
+    /**
+     * \brief This function computes D = alpha * T + beta * C with a thread per element,
+     *        the first mode fastest. alpha and beta are read from device memory, and C is
+     *        not read when it is nullptr or beta is zero.
+     */
+    template <typename DataT, typename ScalarT>
+    __global__ void scaleByDeviceScalars(ScalarT const*    alpha,
+                                         DataT const*      t,
+                                         ScalarT const*    beta,
+                                         DataT const*      c,
+                                         DataT*            d,
+                                         DeviceScalarsDesc desc)
+    {
+        using AccT = typename DeviceScalarsAcc<DataT>::type;
+
+        int64_t index = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(index >= desc.mElements)
+        {
+            return;
+        }
+
+        int64_t offsetT = 0, offsetC = 0, offsetD = 0;
+        for(int i = 0; i < desc.mRank; i++)
+        {
+            auto coord = index % desc.mLengths[i];
+            index /= desc.mLengths[i];
+            offsetT += coord * desc.mStridesT[i];
+            offsetC += coord * desc.mStridesC[i];
+            offsetD += coord * desc.mStridesD[i];
+        }
+
+        auto value = scalarMul(static_cast<AccT>(*alpha), static_cast<AccT>(t[offsetT]));
+        if(c != nullptr)
+        {
+            auto betaAcc = static_cast<AccT>(*beta);
+            if(!scalarIsZero(betaAcc))
+            {
+                value = scalarAdd(value, scalarMul(betaAcc, static_cast<AccT>(c[offsetC])));
+            }
+        }
+        d[offsetD] = static_cast<DataT>(value);
+    }
+
+    namespace
+    {
+        struct DeviceScalarsArgs
+        {
+            void const*       mAlpha;
+            void const*       mT;
+            void const*       mBeta;
+            void const*       mC;
+            void*             mD;
+            DeviceScalarsDesc mDesc;
+            hipStream_t       mStream;
+        };
+
+        template <typename DataT, typename ScalarT>
+        hiptensorStatus_t launchDeviceScalars(DeviceScalarsArgs const& args)
+        {
+            auto blocks = ceilDiv(args.mDesc.mElements, int64_t(DeviceScalarsBlockSize));
+            hipLaunchKernelGGL((scaleByDeviceScalars<DataT, ScalarT>),
+                               dim3(blocks),
+                               dim3(DeviceScalarsBlockSize),
+                               0,
+                               args.mStream,
+                               static_cast<ScalarT const*>(args.mAlpha),
+                               static_cast<DataT const*>(args.mT),
+                               static_cast<ScalarT const*>(args.mBeta),
+                               static_cast<DataT const*>(args.mC),
+                               static_cast<DataT*>(args.mD),
+                               args.mDesc);
+
+            return hipGetLastError() == hipSuccess ? HIPTENSOR_STATUS_SUCCESS
+                                                   : HIPTENSOR_STATUS_HIP_ERROR;
+        }
+
+        // Real tensors are scaled by real scalars of any precision
+        template <typename DataT>
+        hiptensorStatus_t launchRealDeviceScalars(DeviceScalarsArgs const& args,
+                                                  hiptensorComputeType_t   typeScalar)
+        {
+            switch(typeScalar)
+            {
+            case HIPTENSOR_COMPUTE_16F:
+                return launchDeviceScalars<DataT, _Float16>(args);
+            case HIPTENSOR_COMPUTE_16BF:
+                return launchDeviceScalars<DataT, hip_bfloat16>(args);
+            case HIPTENSOR_COMPUTE_32F:
+                return launchDeviceScalars<DataT, float>(args);
+            case HIPTENSOR_COMPUTE_64F:
+                return launchDeviceScalars<DataT, double>(args);
+            default:
+                return HIPTENSOR_STATUS_NOT_SUPPORTED;
+            }
+        }
+    } // namespace
+
+    hiptensorStatus_t applyDeviceScalars(void const*                     alpha,
+                                         void const*                     T,
+                                         std::vector<std::size_t> const& stridesT,
+                                         void const*                     beta,
+                                         void const*                     C,
+                                         std::vector<std::size_t> const& stridesC,
+                                         void*                           D,
+                                         std::vector<std::size_t> const& lengths,
+                                         std::vector<std::size_t> const& stridesD,
+                                         hipDataType                     typeD,
+                                         hiptensorComputeType_t          typeScalar,
+                                         hipStream_t                     stream)
+    {
+        if(lengths.size() > DeviceScalarsMaxRank)
+        {
+            return HIPTENSOR_STATUS_NOT_SUPPORTED;
+        }
+
+        DeviceScalarsArgs args = {alpha, T, beta, C, D, {}, stream};
+        args.mDesc.mRank       = (int32_t)lengths.size();
+        args.mDesc.mElements   = (int64_t)elementsFromLengths(lengths);
+        for(std::size_t i = 0; i < lengths.size(); i++)
+        {
+            args.mDesc.mLengths[i]  = lengths[i];
+            args.mDesc.mStridesT[i] = stridesT[i];
+            args.mDesc.mStridesC[i] = C != nullptr ? stridesC[i] : 0;
+            args.mDesc.mStridesD[i] = stridesD[i];
+        }
+
+        if(args.mDesc.mElements == 0)
+        {
+            return HIPTENSOR_STATUS_SUCCESS;
+        }
+
+        switch(typeD)
+        {
+        case HIP_R_16F:
+            return launchRealDeviceScalars<_Float16>(args, typeScalar);
+        case HIP_R_16BF:
+            return launchRealDeviceScalars<hip_bfloat16>(args, typeScalar);
+        case HIP_R_32F:
+            return launchRealDeviceScalars<float>(args, typeScalar);
+        case HIP_R_64F:
+            return launchRealDeviceScalars<double>(args, typeScalar);
+        case HIP_C_32F:
+            return typeScalar == HIPTENSOR_COMPUTE_C32F
+                       ? launchDeviceScalars<hipFloatComplex, hipFloatComplex>(args)
+                       : HIPTENSOR_STATUS_NOT_SUPPORTED;
+        case HIP_C_64F:
+            return typeScalar == HIPTENSOR_COMPUTE_C64F
+                       ? launchDeviceScalars<hipDoubleComplex, hipDoubleComplex>(args)
+                       : HIPTENSOR_STATUS_NOT_SUPPORTED;
+        default:
+            return HIPTENSOR_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    ScalarData readDeviceScalar(void const* value, hiptensorComputeType_t type, hipStream_t stream)
+    {
+        std::size_t bytes = sizeof(float);
+        switch(type)
+        {
+        case HIPTENSOR_COMPUTE_8U:
+        case HIPTENSOR_COMPUTE_8I:
+            bytes = sizeof(uint8_t);
+            break;
+        case HIPTENSOR_COMPUTE_16F:
+        case HIPTENSOR_COMPUTE_16BF:
+            bytes = sizeof(uint16_t);
+            break;
+        case HIPTENSOR_COMPUTE_64F:
+        case HIPTENSOR_COMPUTE_C32F:
+            bytes = sizeof(double);
+            break;
+        case HIPTENSOR_COMPUTE_C64F:
+            bytes = sizeof(hipDoubleComplex);
+            break;
+        default:
+            break;
+        }
+
+        // Large enough for a scalar of any type
+        hipDoubleComplex host = {};
+        if(hipMemcpyAsync(&host, value, bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+        {
+            return ScalarData(type, 0.0);
+        }
+        return readVal<ScalarData>(&host, type);
+    }
+
+    LibraryScalars::LibraryScalars(Handle const& handle, hiptensorComputeType_t type)
+    {
+        writeVal(&mHostOne, type, ScalarData(type, 1.0));
+        writeVal(&mHostZero, type, ScalarData(type, 0.0));
+
+        if(handle.pointerMode() == HIPTENSOR_POINTER_MODE_DEVICE)
+        {
+            void* one  = nullptr;
+            void* zero = nullptr;
+            switch(type)
+            {
+            case HIPTENSOR_COMPUTE_16F:
+                (void)hipGetSymbolAddress(&one, HIP_SYMBOL(DeviceOneF16));
+                break;
+            case HIPTENSOR_COMPUTE_16BF:
+                (void)hipGetSymbolAddress(&one, HIP_SYMBOL(DeviceOneBF16));
+                break;
+            case HIPTENSOR_COMPUTE_64F:
+            case HIPTENSOR_COMPUTE_C64F:
+                (void)hipGetSymbolAddress(&one, HIP_SYMBOL(DeviceOneC64));
+                break;
+            default:
+                (void)hipGetSymbolAddress(&one, HIP_SYMBOL(DeviceOneC32));
+                break;
+            }
+            (void)hipGetSymbolAddress(&zero, HIP_SYMBOL(DeviceZero));
+
+            mDeviceOne  = one;
+            mDeviceZero = zero;
+        }
+    }
+
+    void const* LibraryScalars::one() const
+    {
+        return mDeviceOne != nullptr ? mDeviceOne : &mHostOne;
+    }
+
+    void const* LibraryScalars::zero() const
+    {
+        return mDeviceZero != nullptr ? mDeviceZero : &mHostZero;
+    }
+
+} // namespace hiptensor
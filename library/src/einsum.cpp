@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+
+#include "einsum.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Canonical label of a mode: a-z, then A-Z
+        char canonicalLabel(int32_t mode)
+        {
+            return mode < 26 ? char('a' + mode) : char('A' + mode - 26);
+        }
+
+        // Number of uses of each mode by all tensors of the list
+        std::map<int32_t, int32_t> modeUses(std::vector<std::vector<int32_t>> const& tensors)
+        {
+            std::map<int32_t, int32_t> uses;
+            for(auto const& modes : tensors)
+            {
+                for(auto mode : modes)
+                {
+                    uses[mode]++;
+                }
+            }
+            return uses;
+        }
+    } // namespace
+
+    bool parseEinsum(char const* expression, EinsumExpression* result)
+    {
+        if(expression == nullptr || result == nullptr)
+        {
+            return false;
+        }
+
+        std::string text;
+        for(auto c = expression; *c != '\0'; c++)
+        {
+            if(!std::isspace((unsigned char)*c))
+            {
+                text.push_back(*c);
+            }
+        }
+
+        auto arrow        = text.find("->");
+        auto inputsText   = text.substr(0, arrow);
+        auto hasOutput    = arrow != std::string::npos;
+        auto outputLabels = hasOutput ? text.substr(arrow + 2) : std::string();
+
+        // Labels of the inputs and of the output
+        std::vector<std::string> inputLabels(1);
+        for(auto c : inputsText)
+        {
+            if(c == ',')
+            {
+                inputLabels.emplace_back();
+            }
+            else if(std::isalpha((unsigned char)c))
+            {
+                inputLabels.back().push_back(c);
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        if(!hasOutput)
+        {
+            std::map<char, int32_t> uses;
+            for(auto const& labels : inputLabels)
+            {
+                for(auto c : labels)
+                {
+                    uses[c]++;
+                }
+            }
+            for(auto const& [label, count] : uses)
+            {
+                if(count == 1)
+                {
+                    outputLabels.push_back(label);
+                }
+            }
+        }
+
+        if(!std::all_of(outputLabels.begin(), outputLabels.end(), [](char c) {
+               return std::isalpha((unsigned char)c);
+           }))
+        {
+            return false;
+        }
+
+        // Rename the labels in order of first appearance
+        std::map<char, int32_t> modes;
+        auto                    toModes = [&modes](std::string const& labels) {
+            std::vector<int32_t> result;
+            for(auto c : labels)
+            {
+                result.push_back(modes.emplace(c, (int32_t)modes.size()).first->second);
+            }
+            return result;
+        };
+
+        EinsumExpression parsed;
+        for(auto const& labels : inputLabels)
+        {
+            parsed.mInputModes.push_back(toModes(labels));
+        }
+
+        auto inputModeCount = modes.size();
+        parsed.mOutputModes = toModes(outputLabels);
+
+        // Output labels must be distinct and come from the inputs
+        auto outputUses = modeUses({parsed.mOutputModes});
+        if(modes.size() != inputModeCount
+           || std::any_of(outputUses.begin(), outputUses.end(), [](auto const& use) {
+                  return use.second > 1;
+              }))
+        {
+            return false;
+        }
+
+        for(std::size_t i = 0; i < parsed.mInputModes.size(); i++)
+        {
+            if(i > 0)
+            {
+                parsed.mCanonical.push_back(',');
+            }
+            for(auto mode : parsed.mInputModes[i])
+            {
+                parsed.mCanonical.push_back(canonicalLabel(mode));
+            }
+        }
+        parsed.mCanonical += "->";
+        for(auto mode : parsed.mOutputModes)
+        {
+            parsed.mCanonical.push_back(canonicalLabel(mode));
+        }
+
+        *result = std::move(parsed);
+        return true;
+    }
+
+    EinsumOp_t einsumOperation(EinsumExpression const& expression)
+    {
+        auto const& inputs = expression.mInputModes;
+        if(inputs.size() == 1)
+        {
+            return modeUses({inputs[0]}).size() == expression.mOutputModes.size()
+                       ? EinsumOp_t::PERMUTATION
+                       : EinsumOp_t::REDUCTION;
+        }
+        return inputs.size() == 2 ? EinsumOp_t::CONTRACTION : EinsumOp_t::TENSOR_NETWORK;
+    }
+
+    bool hasRepeatedModes(EinsumExpression const& expression)
+    {
+        return std::any_of(
+            expression.mInputModes.begin(), expression.mInputModes.end(), [](auto const& modes) {
+                auto uses = modeUses({modes});
+                return uses.size() != modes.size();
+            });
+    }
+
+    bool hasSummedInputModes(EinsumExpression const& expression)
+    {
+        if(expression.mInputModes.size() < 2)
+        {
+            return false;
+        }
+
+        auto tensors = expression.mInputModes;
+        tensors.push_back(expression.mOutputModes);
+        auto uses = modeUses(tensors);
+        return std::any_of(
+            uses.begin(), uses.end(), [](auto const& use) { return use.second == 1; });
+    }
+
+} // namespace hiptensor
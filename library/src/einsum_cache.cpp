@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "einsum_cache.hpp"
+
+namespace hiptensor
+{
+    std::shared_ptr<EinsumCache::Entry const> EinsumCache::find(std::string const& key) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto found = mEntries.find(key);
+        return found == mEntries.end() ? nullptr : found->second;
+    }
+
+    std::shared_ptr<EinsumCache::Entry const>
+        EinsumCache::insert(std::string const& key, std::shared_ptr<Entry const> entry)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if(mEntries.size() >= MaxEntries && mEntries.find(key) == mEntries.end())
+        {
+            mEntries.clear();
+        }
+        return mEntries.emplace(key, std::move(entry)).first->second;
+    }
+
+    void EinsumCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.clear();
+    }
+
+    std::size_t EinsumCache::size() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mEntries.size();
+    }
+
+} // namespace hiptensor
@@ -24,16 +24,26 @@
  *
  *******************************************************************************/
 
+#include <hiptensor/hiptensor_types.hpp>
+
 #include "handle.hpp"
 
 namespace hiptensor
 {
-    Handle Handle::createHandle(int64_t* buff)
+    Handle::Handle()
+        : mDevice(HipDevice::current())
+    {
+    }
+
+    static_assert(sizeof(Handle) <= sizeof(hiptensorHandle_t::fields),
+                  "Handle must fit in hiptensorHandle_t");
+
+    Handle* Handle::createHandle(int64_t* buff)
     {
         auto handle = toHandle(buff);
         new(handle) Handle();
 
-        return *handle;
+        return handle;
     }
 
     void Handle::destroyHandle(int64_t* buff)
@@ -47,9 +57,29 @@ namespace hiptensor
         return reinterpret_cast<Handle*>(buff);
     }
 
-    HipDevice Handle::getDevice()
+    HipDevice const& Handle::getDevice() const
     {
         return mDevice;
     }
 
+    WorkspaceArena& Handle::workspaceArena()
+    {
+        return mWorkspaceArena;
+    }
+
+    EinsumCache& Handle::einsumCache()
+    {
+        return mEinsumCache;
+    }
+
+    hiptensorPointerMode_t Handle::pointerMode() const
+    {
+        return mPointerMode;
+    }
+
+    void Handle::setPointerMode(hiptensorPointerMode_t mode)
+    {
+        mPointerMode = mode;
+    }
+
 } // namespace hiptensor
@@ -24,20 +24,28 @@
  *
  *******************************************************************************/
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "hip_device.hpp"
 #include <hiptensor/internal/hiptensor_utility.hpp>
 
 namespace hiptensor
 {
     HipDevice::HipDevice()
-        : mDeviceId(-1)
+        : HipDevice(currentDeviceId())
+    {
+    }
+
+    HipDevice::HipDevice(hipDevice_t deviceId)
+        : mDeviceId(deviceId)
         , mGcnArch(hipGcnArch_t::UNSUPPORTED_ARCH)
         , mWarpSize(hipWarpSize_t::UNSUPPORTED_WARP_SIZE)
         , mSharedMemSize(0)
         , mCuCount(0)
         , mMaxFreqMhz(0)
     {
-        CHECK_HIP_ERROR(hipGetDevice(&mDeviceId));
         CHECK_HIP_ERROR(hipGetDeviceProperties(&mProps, mDeviceId));
 
         mArch = mProps.arch;
@@ -77,12 +85,48 @@ namespace hiptensor
         mMaxFreqMhz    = static_cast<int>(static_cast<double>(mProps.clockRate) / 1000.0);
     }
 
+    hipDevice_t HipDevice::currentDeviceId()
+    {
+        hipDevice_t deviceId;
+        CHECK_HIP_ERROR(hipGetDevice(&deviceId));
+        return deviceId;
+    }
+
+    HipDevice const& HipDevice::instance(hipDevice_t deviceId)
+    {
+        // Sized once for all visible devices, so that entries never move
+        struct DeviceCache
+        {
+            DeviceCache()
+            {
+                int deviceCount = 0;
+                CHECK_HIP_ERROR(hipGetDeviceCount(&deviceCount));
+                mInitFlags = std::vector<std::once_flag>(deviceCount);
+                mDevices.resize(deviceCount);
+            }
+
+            std::vector<std::once_flag>             mInitFlags;
+            std::vector<std::unique_ptr<HipDevice>> mDevices;
+        };
+        static DeviceCache cache;
+
+        std::call_once(cache.mInitFlags.at(deviceId), [deviceId]() {
+            cache.mDevices[deviceId] = std::make_unique<HipDevice>(deviceId);
+        });
+        return *cache.mDevices[deviceId];
+    }
+
+    HipDevice const& HipDevice::current()
+    {
+        return instance(currentDeviceId());
+    }
+
     hipDevice_t HipDevice::getDeviceId() const
     {
         return mDeviceId;
     }
 
-    hipDeviceProp_t HipDevice::getDeviceProps() const
+    hipDeviceProp_t const& HipDevice::getDeviceProps() const
     {
         return mProps;
     }
@@ -125,13 +169,26 @@ namespace hiptensor
                 || mGcnArch == HipDevice::hipGcnArch_t::GFX942);
     }
 
+    bool isStreamCapturing(hipStream_t stream)
+    {
+        // The legacy null stream can not be captured. Querying it while another stream
+        // is captured fails, and leaves a sticky error to clear.
+        auto status = hipStreamCaptureStatusNone;
+        if(hipStreamIsCapturing(stream, &status) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return false;
+        }
+        return status != hipStreamCaptureStatusNone;
+    }
+
     // Need to check the host device target support statically before hip modules attempt
     // to load any kernels. Not safe to proceed if the host device is unsupported.
     struct HipStaticDeviceGuard
     {
         static bool testSupportedDevice()
         {
-            auto device = HipDevice();
+            auto const& device = HipDevice::current();
 
             if((device.getGcnArch() == HipDevice::hipGcnArch_t::UNSUPPORTED_ARCH)
                || (device.warpSize() == HipDevice::hipWarpSize_t::UNSUPPORTED_WARP_SIZE))
@@ -104,6 +104,81 @@ hiptensorStatus_t hiptensorDestroy(hiptensorHandle_t* handle)
     return HIPTENSOR_STATUS_SUCCESS;
 }
 
+hiptensorStatus_t hiptensorSetPointerMode(hiptensorHandle_t* handle, hiptensorPointerMode_t mode)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, mode=0x%02X",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned int)mode);
+    logger->logAPITrace("hiptensorSetPointerMode", msg);
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorSetPointerMode", msg);
+        return errorCode;
+    }
+
+    if(mode != HIPTENSOR_POINTER_MODE_HOST && mode != HIPTENSOR_POINTER_MODE_DEVICE)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Invalid Value Error : mode is not a pointer mode (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorSetPointerMode", msg);
+        return errorCode;
+    }
+
+    hiptensor::Handle::toHandle(handle->fields)->setPointerMode(mode);
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorGetPointerMode(const hiptensorHandle_t* handle,
+                                          hiptensorPointerMode_t*  mode)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, mode=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)mode);
+    logger->logAPITrace("hiptensorGetPointerMode", msg);
+
+    if(handle == nullptr || mode == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "mode",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorGetPointerMode", msg);
+        return errorCode;
+    }
+
+    *mode = hiptensor::Handle::toHandle((int64_t*)handle->fields)->pointerMode();
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
 hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     handle,
                                                 hiptensorTensorDescriptor_t* desc,
                                                 const uint32_t               numModes,
@@ -155,7 +230,8 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
     if((lens == nullptr && strides != nullptr)
        || ((dataType != HIP_R_16F) && (dataType != HIP_R_16BF) && (dataType != HIP_R_32F)
            && (dataType != HIP_R_64F) && (dataType != HIP_C_32F) && (dataType != HIP_C_64F))
-       || ((unaryOp != HIPTENSOR_OP_IDENTITY) && (unaryOp != HIPTENSOR_OP_SQRT)))
+       || ((unaryOp != HIPTENSOR_OP_IDENTITY) && (unaryOp != HIPTENSOR_OP_SQRT)
+           && (unaryOp != HIPTENSOR_OP_CONJ)))
     {
         auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
         if(lens == nullptr && strides != nullptr)
@@ -165,11 +241,13 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
                      "Tensor Initialization Error : lens = nullptr and strides != nullptr (%s)",
                      hiptensorGetErrorString(errorCode));
         }
-        else if((unaryOp != HIPTENSOR_OP_IDENTITY) && (unaryOp != HIPTENSOR_OP_SQRT))
+        else if((unaryOp != HIPTENSOR_OP_IDENTITY) && (unaryOp != HIPTENSOR_OP_SQRT)
+                && (unaryOp != HIPTENSOR_OP_CONJ))
         {
             snprintf(msg,
                      sizeof(msg),
-                     "Tensor Initialization Error : op != identity / op != unarysquare (%s) ",
+                     "Tensor Initialization Error : op != identity / op != unarysquare / op != "
+                     "conj (%s) ",
                      hiptensorGetErrorString(errorCode));
         }
         else
@@ -189,6 +267,12 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
         return HIPTENSOR_STATUS_ARCH_MISMATCH;
     }
 
+    // The conjugate of a real tensor is the tensor itself
+    if(unaryOp == HIPTENSOR_OP_CONJ && dataType != HIP_C_32F && dataType != HIP_C_64F)
+    {
+        unaryOp = HIPTENSOR_OP_IDENTITY;
+    }
+
     if(strides)
     {
         // Construct with both given lengths and strides
@@ -219,6 +303,91 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
     return HIPTENSOR_STATUS_SUCCESS;
 }
 
+hiptensorStatus_t hiptensorInitPlanarTensorDescriptor(const hiptensorHandle_t*     handle,
+                                                      hiptensorTensorDescriptor_t* desc,
+                                                      const uint32_t               numModes,
+                                                      const int64_t                lens[],
+                                                      const int64_t                strides[],
+                                                      hipDataType                  dataType,
+                                                      hiptensorOperator_t          unaryOp,
+                                                      const int64_t                planeStride)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[256];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, desc=0x%llX, numModes=0x%02X, lens=0x%llX, strides=0x%llX,"
+             "dataType=0x%02X, unaryOp=0x%02X, planeStride=%lld",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)desc,
+             (unsigned int)numModes,
+             (unsigned long long)lens,
+             (unsigned long long)strides,
+             (unsigned int)dataType,
+             (unsigned int)unaryOp,
+             (long long)planeStride);
+    logger->logAPITrace("hiptensorInitPlanarTensorDescriptor", msg);
+
+    if(((dataType != HIP_C_32F) && (dataType != HIP_C_64F)) || planeStride < 0)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        if(planeStride < 0)
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Tensor Initialization Error : planeStride < 0 (%s)",
+                     hiptensorGetErrorString(errorCode));
+        }
+        else
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Tensor Initialization Error : planar datatype should be complex (%s)",
+                     hiptensorGetErrorString(errorCode));
+        }
+        logger->logError("hiptensorInitPlanarTensorDescriptor", msg);
+        return errorCode;
+    }
+
+    auto errorCode = hiptensorInitTensorDescriptor(
+        handle, desc, numModes, lens, strides, dataType, unaryOp);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    // The imaginary plane must start past the span of the real plane, and starts right
+    // after it when planeStride is zero
+    std::size_t planeSpan = 1;
+    for(std::size_t i = 0; i < desc->mLengths.size(); i++)
+    {
+        planeSpan += (desc->mLengths[i] - 1) * desc->mStrides[i];
+    }
+
+    if(static_cast<std::size_t>(planeStride) > 0
+       && static_cast<std::size_t>(planeStride) < planeSpan)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Tensor Initialization Error : planeStride %lld overlaps the real plane of "
+                 "%zu elements (%s)",
+                 (long long)planeStride,
+                 planeSpan,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitPlanarTensorDescriptor", msg);
+        return errorCode;
+    }
+
+    desc->mPlaneStride = planeStride > 0 ? static_cast<std::size_t>(planeStride) : planeSpan;
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
 const char* hiptensorGetErrorString(const hiptensorStatus_t error)
 {
     using hiptensor::Logger;
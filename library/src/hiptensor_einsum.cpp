@@ -0,0 +1,532 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <algorithm>
+#include <string>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "data_types.hpp"
+#include "device_scalars.hpp"
+#include "einsum.hpp"
+#include "einsum_cache.hpp"
+#include "handle.hpp"
+#include "hip_device.hpp"
+#include "logger.hpp"
+
+#include "contraction/contraction_operand_view.hpp"
+
+namespace
+{
+    using EinsumEntry = hiptensor::EinsumCache::Entry;
+
+    // Cache key of an expression: the canonical expression, then the type, unary op,
+    // plane stride, lengths and strides of every operand, then the compute type
+    std::string einsumKey(hiptensor::EinsumExpression const&       expression,
+                          uint32_t                                 numInputs,
+                          const hiptensorTensorDescriptor_t* const descInputs[],
+                          const hiptensorTensorDescriptor_t*       descOutput,
+                          hiptensorComputeType_t                   typeCompute)
+    {
+        auto key    = expression.mCanonical;
+        auto append = [&key](char separator, auto value) {
+            key.push_back(separator);
+            key += std::to_string(value);
+        };
+        auto appendDesc = [&](hiptensorTensorDescriptor_t const& desc) {
+            append(';', (int)desc.mType);
+            append(' ', (int)desc.mUnaryOp);
+            append(' ', desc.mPlaneStride);
+            for(auto length : desc.mLengths)
+            {
+                append(' ', length);
+            }
+            for(auto stride : desc.mStrides)
+            {
+                append('/', stride);
+            }
+        };
+
+        for(uint32_t i = 0; i < numInputs; i++)
+        {
+            appendDesc(*descInputs[i]);
+        }
+        appendDesc(*descOutput);
+        append(';', (int)typeCompute);
+        return key;
+    }
+
+    // Scalar type of a permutation computed in the given type
+    bool permutationScalarType(hiptensorComputeType_t typeCompute, hipDataType* typeScalar)
+    {
+        for(auto type : {HIP_R_16F, HIP_R_32F})
+        {
+            if(hiptensor::convertToComputeType(type) == typeCompute)
+            {
+                *typeScalar = type;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Plans a parsed expression, with the plans of the operation it is routed to
+    hiptensorStatus_t planEinsum(const hiptensorHandle_t*                 handle,
+                                 EinsumEntry*                             entry,
+                                 uint32_t                                 numInputs,
+                                 const hiptensorTensorDescriptor_t* const descInputs[],
+                                 const hiptensorTensorDescriptor_t*       descOutput,
+                                 hiptensorComputeType_t                   typeCompute)
+    {
+        auto const& expression = entry->mExpression;
+        auto const& modeOutput = expression.mOutputModes;
+
+        entry->mOp            = hiptensor::einsumOperation(expression);
+        entry->mWorkspaceSize = 0;
+
+        // Repeated modes of a single input select its diagonal
+        if(numInputs == 1)
+        {
+            hiptensor::ContractionOperandView view;
+            if(!hiptensor::contractionOperandView(&view,
+                                                  descInputs[0]->mLengths,
+                                                  descInputs[0]->mStrides,
+                                                  expression.mInputModes[0],
+                                                  {}))
+            {
+                return HIPTENSOR_STATUS_INVALID_VALUE;
+            }
+            entry->mInputView          = *descInputs[0];
+            entry->mInputView.mLengths = view.mLengths;
+            entry->mInputView.mStrides = view.mStrides;
+            entry->mInputViewModes     = view.mModes;
+        }
+
+        switch(entry->mOp)
+        {
+        case hiptensor::EinsumOp_t::PERMUTATION:
+        {
+            hipDataType typeScalar;
+            return permutationScalarType(typeCompute, &typeScalar)
+                       ? HIPTENSOR_STATUS_SUCCESS
+                       : HIPTENSOR_STATUS_NOT_SUPPORTED;
+        }
+        case hiptensor::EinsumOp_t::REDUCTION:
+        {
+            uint64_t workspaceSize = 0;
+
+            auto errorCode = hiptensorReductionGetWorkspaceSize(handle,
+                                                                nullptr,
+                                                                &entry->mInputView,
+                                                                entry->mInputViewModes.data(),
+                                                                nullptr,
+                                                                descOutput,
+                                                                modeOutput.data(),
+                                                                nullptr,
+                                                                descOutput,
+                                                                modeOutput.data(),
+                                                                HIPTENSOR_OP_ADD,
+                                                                typeCompute,
+                                                                &workspaceSize);
+            entry->mWorkspaceSize = workspaceSize;
+            return errorCode;
+        }
+        case hiptensor::EinsumOp_t::CONTRACTION:
+        {
+            auto alignment = hiptensor::hipDataTypeSize(descOutput->mType);
+
+            hiptensorContractionDescriptor_t desc;
+            hiptensorContractionFind_t       find;
+            uint64_t                         workspaceSize = 0;
+
+            auto errorCode = hiptensorInitContractionDescriptor(handle,
+                                                                &desc,
+                                                                descInputs[0],
+                                                                expression.mInputModes[0].data(),
+                                                                alignment,
+                                                                descInputs[1],
+                                                                expression.mInputModes[1].data(),
+                                                                alignment,
+                                                                nullptr,
+                                                                nullptr,
+                                                                0,
+                                                                descOutput,
+                                                                modeOutput.data(),
+                                                                alignment,
+                                                                typeCompute);
+            if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+            {
+                errorCode = hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT);
+            }
+            if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+            {
+                errorCode = hiptensorContractionGetWorkspaceSize(
+                    handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize);
+            }
+            if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+            {
+                errorCode = hiptensorInitContractionPlan(
+                    handle, &entry->mContractionPlan, &desc, &find, workspaceSize);
+            }
+            entry->mWorkspaceSize = entry->mContractionPlan.mWorkspaceSize;
+            return errorCode;
+        }
+        case hiptensor::EinsumOp_t::TENSOR_NETWORK:
+        {
+            std::vector<const int32_t*> modeInputs;
+            for(auto const& modes : expression.mInputModes)
+            {
+                modeInputs.push_back(modes.data());
+            }
+
+            auto errorCode = hiptensorInitTensorNetworkPlan(handle,
+                                                            &entry->mNetworkPlan,
+                                                            numInputs,
+                                                            descInputs,
+                                                            modeInputs.data(),
+                                                            descOutput,
+                                                            modeOutput.data(),
+                                                            typeCompute,
+                                                            HIPTENSOR_PATH_OPTIMAL,
+                                                            nullptr);
+            entry->mWorkspaceSize = entry->mNetworkPlan.mWorkspaceSize;
+            return errorCode;
+        }
+        }
+        return HIPTENSOR_STATUS_INTERNAL_ERROR;
+    }
+
+    // Finds the cached plan of an expression, or parses, plans and caches it. Planning
+    // times kernels on the null stream, so it is not done while the stream is captured.
+    hiptensorStatus_t einsumEntry(const hiptensorHandle_t*                 handle,
+                                  const char*                              expression,
+                                  uint32_t                                 numInputs,
+                                  const hiptensorTensorDescriptor_t* const descInputs[],
+                                  const hiptensorTensorDescriptor_t*       descOutput,
+                                  hiptensorComputeType_t                   typeCompute,
+                                  std::shared_ptr<EinsumEntry const>*      entry,
+                                  bool                                     capturing,
+                                  char const*                              apiName)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+        char  msg[512];
+
+        auto logError = [&](hiptensorStatus_t errorCode, char const* reason) {
+            snprintf(msg,
+                     sizeof(msg),
+                     "%s \"%s\" (%s)",
+                     reason,
+                     expression,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        };
+
+        auto parsed = std::make_shared<EinsumEntry>();
+        if(!hiptensor::parseEinsum(expression, &parsed->mExpression)
+           || parsed->mExpression.mInputModes.size() != numInputs)
+        {
+            return logError(HIPTENSOR_STATUS_INVALID_VALUE,
+                            "Invalid Expression Error : malformed expression, or one not "
+                            "matching numInputs");
+        }
+
+        auto const& inputModes = parsed->mExpression.mInputModes;
+        for(uint32_t i = 0; i <= numInputs; i++)
+        {
+            auto const* desc  = i < numInputs ? descInputs[i] : descOutput;
+            auto const& modes = i < numInputs ? inputModes[i] : parsed->mExpression.mOutputModes;
+            if(desc->mLengths.size() != modes.size())
+            {
+                return logError(HIPTENSOR_STATUS_INVALID_VALUE,
+                                "Invalid Expression Error : a descriptor does not have as many "
+                                "modes as its labels in");
+            }
+        }
+
+        // Contractions take the diagonals and sums of their inputs, tensor networks do not
+        if(numInputs > 2
+           && (hiptensor::hasRepeatedModes(parsed->mExpression)
+               || hiptensor::hasSummedInputModes(parsed->mExpression)))
+        {
+            return logError(HIPTENSOR_STATUS_NOT_SUPPORTED,
+                            "Unsupported Expression Error : labels repeated in one input, or "
+                            "summed over a single input, of a product of more than two inputs in");
+        }
+
+        auto key = einsumKey(parsed->mExpression, numInputs, descInputs, descOutput, typeCompute);
+        auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+        auto& cache     = realHandle->einsumCache();
+        if((*entry = cache.find(key)) != nullptr)
+        {
+            return HIPTENSOR_STATUS_SUCCESS;
+        }
+
+        if(capturing)
+        {
+            return logError(HIPTENSOR_STATUS_NOT_SUPPORTED,
+                            "Stream Capture Error : expressions must be planned before the "
+                            "stream is captured, for instance by "
+                            "hiptensorEinsumGetWorkspaceSize. Unplanned expression");
+        }
+
+        if(auto errorCode
+           = planEinsum(handle, parsed.get(), numInputs, descInputs, descOutput, typeCompute);
+           errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return logError(errorCode, "Unable to plan the expression");
+        }
+
+        snprintf(msg,
+                 sizeof(msg),
+                 "Planned \"%s\" as %s, workspace: %lu bytes",
+                 parsed->mExpression.mCanonical.c_str(),
+                 parsed->mOp == hiptensor::EinsumOp_t::PERMUTATION  ? "permutation"
+                 : parsed->mOp == hiptensor::EinsumOp_t::REDUCTION  ? "reduction"
+                 : parsed->mOp == hiptensor::EinsumOp_t::CONTRACTION ? "contraction"
+                                                                      : "tensor network",
+                 (unsigned long)parsed->mWorkspaceSize);
+        logger->logHeuristics(apiName, msg);
+
+        *entry = cache.insert(key, std::move(parsed));
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+} // namespace
+
+hiptensorStatus_t
+    hiptensorEinsumGetWorkspaceSize(const hiptensorHandle_t*                 handle,
+                                    const char*                              expression,
+                                    uint32_t                                 numInputs,
+                                    const hiptensorTensorDescriptor_t* const descInputs[],
+                                    const hiptensorTensorDescriptor_t*       descOutput,
+                                    hiptensorComputeType_t                   typeCompute,
+                                    uint64_t*                                workspaceSize)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=%p, expression=%s, numInputs=%u, descInputs=%p, descOutput=%p, "
+             "typeCompute=0x%02X, workspaceSize=%p",
+             handle,
+             expression == nullptr ? "NULL" : expression,
+             numInputs,
+             descInputs,
+             descOutput,
+             (unsigned int)typeCompute,
+             workspaceSize);
+
+    logger->logAPITrace("hiptensorEinsumGetWorkspaceSize", msg);
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorEinsumGetWorkspaceSize", msg);
+        return errorCode;
+    }
+
+    if(expression == nullptr || descInputs == nullptr || descOutput == nullptr
+       || workspaceSize == nullptr
+       || std::any_of(descInputs, descInputs + numInputs, [](auto* d) { return d == nullptr; }))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : expression/descInputs/descOutput/workspaceSize = "
+                 "nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorEinsumGetWorkspaceSize", msg);
+        return errorCode;
+    }
+
+    std::shared_ptr<EinsumEntry const> entry;
+
+    auto errorCode = einsumEntry(handle,
+                                 expression,
+                                 numInputs,
+                                 descInputs,
+                                 descOutput,
+                                 typeCompute,
+                                 &entry,
+                                 false,
+                                 "hiptensorEinsumGetWorkspaceSize");
+
+    *workspaceSize = errorCode == HIPTENSOR_STATUS_SUCCESS ? entry->mWorkspaceSize : 0u;
+    return errorCode;
+}
+
+hiptensorStatus_t hiptensorEinsum(const hiptensorHandle_t*                 handle,
+                                  const char*                              expression,
+                                  const void*                              alpha,
+                                  uint32_t                                 numInputs,
+                                  const void* const                        inputs[],
+                                  const hiptensorTensorDescriptor_t* const descInputs[],
+                                  void*                                    output,
+                                  const hiptensorTensorDescriptor_t*       descOutput,
+                                  hiptensorComputeType_t                   typeCompute,
+                                  void*                                    workspace,
+                                  uint64_t                                 workspaceSize,
+                                  hipStream_t                              stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=%p, expression=%s, alpha=%p, numInputs=%u, inputs=%p, descInputs=%p, "
+             "output=%p, descOutput=%p, typeCompute=0x%02X, workspace=%p, workspaceSize=%lu, "
+             "stream=%p",
+             handle,
+             expression == nullptr ? "NULL" : expression,
+             alpha,
+             numInputs,
+             inputs,
+             descInputs,
+             output,
+             descOutput,
+             (unsigned int)typeCompute,
+             workspace,
+             (unsigned long)workspaceSize,
+             stream);
+
+    logger->logAPITrace("hiptensorEinsum", msg);
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorEinsum", msg);
+        return errorCode;
+    }
+
+    if(expression == nullptr || alpha == nullptr || inputs == nullptr || descInputs == nullptr
+       || output == nullptr || descOutput == nullptr
+       || std::any_of(inputs, inputs + numInputs, [](auto* p) { return p == nullptr; })
+       || std::any_of(descInputs, descInputs + numInputs, [](auto* d) { return d == nullptr; }))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : expression/alpha/inputs/descInputs/output/descOutput = "
+                 "nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorEinsum", msg);
+        return errorCode;
+    }
+
+    std::shared_ptr<EinsumEntry const> entry;
+    if(auto errorCode = einsumEntry(handle,
+                                    expression,
+                                    numInputs,
+                                    descInputs,
+                                    descOutput,
+                                    typeCompute,
+                                    &entry,
+                                    hiptensor::isStreamCapturing(stream),
+                                    "hiptensorEinsum");
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    auto const& modeOutput = entry->mExpression.mOutputModes;
+
+    switch(entry->mOp)
+    {
+    case hiptensor::EinsumOp_t::PERMUTATION:
+    {
+        hipDataType typeScalar = HIP_R_32F;
+        permutationScalarType(typeCompute, &typeScalar);
+        return hiptensorPermutation(handle,
+                                    alpha,
+                                    inputs[0],
+                                    &entry->mInputView,
+                                    entry->mInputViewModes.data(),
+                                    output,
+                                    descOutput,
+                                    modeOutput.data(),
+                                    typeScalar,
+                                    stream);
+    }
+    case hiptensor::EinsumOp_t::REDUCTION:
+    {
+        // The output is overwritten, so C is the output scaled by zero
+        hiptensor::LibraryScalars scalars(
+            *hiptensor::Handle::toHandle((int64_t*)handle->fields), typeCompute);
+        return hiptensorReduction(handle,
+                                  alpha,
+                                  inputs[0],
+                                  &entry->mInputView,
+                                  entry->mInputViewModes.data(),
+                                  scalars.zero(),
+                                  output,
+                                  descOutput,
+                                  modeOutput.data(),
+                                  output,
+                                  descOutput,
+                                  modeOutput.data(),
+                                  HIPTENSOR_OP_ADD,
+                                  typeCompute,
+                                  workspace,
+                                  workspaceSize,
+                                  stream);
+    }
+    case hiptensor::EinsumOp_t::CONTRACTION:
+        return hiptensorContraction(handle,
+                                    &entry->mContractionPlan,
+                                    alpha,
+                                    inputs[0],
+                                    inputs[1],
+                                    nullptr,
+                                    nullptr,
+                                    output,
+                                    workspace,
+                                    workspaceSize,
+                                    stream);
+    case hiptensor::EinsumOp_t::TENSOR_NETWORK:
+        return hiptensorTensorNetwork(handle,
+                                      &entry->mNetworkPlan,
+                                      alpha,
+                                      inputs,
+                                      output,
+                                      workspace,
+                                      workspaceSize,
+                                      stream);
+    }
+    return HIPTENSOR_STATUS_INTERNAL_ERROR;
+}
@@ -0,0 +1,639 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "handle.hpp"
+#include "hip_device.hpp"
+#include "logger.hpp"
+#include "operation_graph.hpp"
+
+namespace
+{
+    using hiptensor::OperationGraph;
+
+    // Logs and returns INVALID_VALUE unless the tensor id is in the graph, and an
+    // intermediate read by the node has been written by a node added before.
+    hiptensorStatus_t checkTensor(OperationGraph const& graph,
+                                  int32_t               id,
+                                  bool                  isInput,
+                                  char const*           name,
+                                  char const*           apiName)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        char msg[512];
+        if(id < 0 || id >= (int32_t)graph.tensorCount())
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Input Parameter Error : %s = %d is not a tensor of the graph (%s)",
+                     name,
+                     (int)id,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        auto const& tensor = graph.tensor(id);
+        if(isInput && tensor.mData == nullptr && !tensor.mWritten)
+        {
+            auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Input Parameter Error : intermediate %s = %d is read before it is written "
+                     "(%s)",
+                     name,
+                     (int)id,
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    bool sameLayout(hiptensorTensorDescriptor_t const& lhs, hiptensorTensorDescriptor_t const& rhs)
+    {
+        return lhs.mType == rhs.mType && lhs.mLengths == rhs.mLengths
+               && lhs.mStrides == rhs.mStrides && lhs.mPlaneStride == rhs.mPlaneStride;
+    }
+
+    // Copies the modes of a tensor, one per dimension of its descriptor
+    std::vector<int32_t> copyModes(OperationGraph const& graph, int32_t id, const int32_t modes[])
+    {
+        if(id == OperationGraph::NoTensor || modes == nullptr)
+        {
+            return {};
+        }
+        auto rank = graph.tensor(id).mDesc.mLengths.size();
+        return std::vector<int32_t>(modes, modes + rank);
+    }
+} // namespace
+
+hiptensorStatus_t hiptensorCreateOperationGraph(const hiptensorHandle_t*    handle,
+                                                hiptensorOperationGraph_t** graph,
+                                                uint32_t                    numStreams)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, graph=0x%llX, numStreams=%u",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)graph,
+             numStreams);
+
+    logger->logAPITrace("hiptensorCreateOperationGraph", msg);
+
+    if(handle == nullptr || graph == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "graph",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorCreateOperationGraph", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+
+    // Ensure current HIP device is same as the handle: the streams of the pool are
+    // created on it.
+    auto currentDeviceId = hiptensor::HipDevice::currentDeviceId();
+    if(currentDeviceId != realHandle->getDevice().getDeviceId())
+    {
+        auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Device mismatch error: current device id: %d, handle device id: %d (%s)",
+                 (int)currentDeviceId,
+                 (int)realHandle->getDevice().getDeviceId(),
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorCreateOperationGraph", msg);
+        return errorCode;
+    }
+
+    *graph = new hiptensorOperationGraph_t(numStreams);
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorDestroyOperationGraph(hiptensorOperationGraph_t* graph)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg, sizeof(msg), "graph=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)graph);
+    logger->logAPITrace("hiptensorDestroyOperationGraph", msg);
+
+    if(graph == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : graph = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorDestroyOperationGraph", msg);
+        return errorCode;
+    }
+
+    delete graph;
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorOperationGraphAddTensor(hiptensorOperationGraph_t*         graph,
+                                                   const hiptensorTensorDescriptor_t* desc,
+                                                   void*                              data,
+                                                   int32_t*                           tensorId)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "graph=0x%0*llX, desc=0x%llX, data=0x%llX, tensorId=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)graph,
+             (unsigned long long)desc,
+             (unsigned long long)data,
+             (unsigned long long)tensorId);
+
+    logger->logAPITrace("hiptensorOperationGraphAddTensor", msg);
+
+    if(graph == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : graph = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphAddTensor", msg);
+        return errorCode;
+    }
+
+    if(desc == nullptr || tensorId == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : %s = nullptr (%s)",
+                 desc == nullptr ? "desc" : "tensorId",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphAddTensor", msg);
+        return errorCode;
+    }
+
+    *tensorId = graph->addTensor(*desc, data);
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorOperationGraphAddContraction(hiptensorOperationGraph_t*        graph,
+                                                        const hiptensorContractionPlan_t* plan,
+                                                        const void*                       alpha,
+                                                        int32_t                           tensorA,
+                                                        int32_t                           tensorB,
+                                                        const void*                       beta,
+                                                        int32_t                           tensorC,
+                                                        int32_t                           tensorD,
+                                                        int32_t*                          nodeId)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "graph=0x%0*llX, plan=0x%llX, alpha=0x%llX, tensorA=%d, tensorB=%d, beta=0x%llX, "
+             "tensorC=%d, tensorD=%d, nodeId=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)graph,
+             (unsigned long long)plan,
+             (unsigned long long)alpha,
+             (int)tensorA,
+             (int)tensorB,
+             (unsigned long long)beta,
+             (int)tensorC,
+             (int)tensorD,
+             (unsigned long long)nodeId);
+
+    logger->logAPITrace("hiptensorOperationGraphAddContraction", msg);
+
+    if(graph == nullptr || plan == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 graph == nullptr ? "graph" : "plan",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphAddContraction", msg);
+        return errorCode;
+    }
+
+    auto hasC = tensorC != OperationGraph::NoTensor;
+    if(alpha == nullptr || (hasC && beta == nullptr))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : %s = nullptr (%s)",
+                 alpha == nullptr ? "alpha" : "beta",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphAddContraction", msg);
+        return errorCode;
+    }
+
+    // D is checked last, so that C may be D
+    auto apiName   = "hiptensorOperationGraphAddContraction";
+    auto errorCode = checkTensor(*graph, tensorA, true, "tensorA", apiName);
+    if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+    {
+        errorCode = checkTensor(*graph, tensorB, true, "tensorB", apiName);
+    }
+    if(errorCode == HIPTENSOR_STATUS_SUCCESS && hasC)
+    {
+        errorCode = checkTensor(*graph, tensorC, true, "tensorC", apiName);
+    }
+    if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+    {
+        errorCode = checkTensor(*graph, tensorD, false, "tensorD", apiName);
+    }
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    // The tensors are given to the plan's solution as laid out in its descriptors
+    auto const& planDescs = plan->mContractionDesc.mTensorDesc;
+    int32_t     ids[]     = {tensorA, tensorB, tensorC, tensorD};
+    for(std::size_t i = 0; i < planDescs.size() && i < 4u; i++)
+    {
+        if(ids[i] != OperationGraph::NoTensor
+           && !sameLayout(graph->tensor(ids[i]).mDesc, planDescs[i]))
+        {
+            errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Input Parameter Error : tensor %d does not have the data type, lengths "
+                     "and strides of operand %c of the plan (%s)",
+                     (int)ids[i],
+                     "ABCD"[i],
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorOperationGraphAddContraction", msg);
+            return errorCode;
+        }
+    }
+
+    OperationGraph::Node node = {};
+    node.mKind                = OperationGraph::NodeKind_t::CONTRACTION;
+    node.mInputs              = {tensorA, tensorB, tensorC};
+    node.mOutput              = tensorD;
+    node.mAlpha               = alpha;
+    node.mBeta                = hasC ? beta : nullptr;
+    node.mPlan                = *plan;
+
+    auto id = graph->addNode(std::move(node));
+    if(nodeId != nullptr)
+    {
+        *nodeId = id;
+    }
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorOperationGraphAddPermutation(hiptensorOperationGraph_t* graph,
+                                                        const void*                alpha,
+                                                        int32_t                    tensorA,
+                                                        const int32_t              modeA[],
+                                                        int32_t                    tensorB,
+                                                        const int32_t              modeB[],
+                                                        hipDataType                typeScalar,
+                                                        int32_t*                   nodeId)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "graph=0x%0*llX, alpha=0x%llX, tensorA=%d, modeA=0x%llX, tensorB=%d, modeB=0x%llX, "
+             "typeScalar=0x%02X, nodeId=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)graph,
+             (unsigned long long)alpha,
+             (int)tensorA,
+             (unsigned long long)modeA,
+             (int)tensorB,
+             (unsigned long long)modeB,
+             (unsigned int)typeScalar,
+             (unsigned long long)nodeId);
+
+    logger->logAPITrace("hiptensorOperationGraphAddPermutation", msg);
+
+    if(graph == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : graph = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphAddPermutation", msg);
+        return errorCode;
+    }
+
+    if(alpha == nullptr || modeA == nullptr || modeB == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : alpha/modeA/modeB = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphAddPermutation", msg);
+        return errorCode;
+    }
+
+    auto apiName   = "hiptensorOperationGraphAddPermutation";
+    auto errorCode = checkTensor(*graph, tensorA, true, "tensorA", apiName);
+    if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+    {
+        errorCode = checkTensor(*graph, tensorB, false, "tensorB", apiName);
+    }
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    OperationGraph::Node node = {};
+    node.mKind                = OperationGraph::NodeKind_t::PERMUTATION;
+    node.mInputs              = {tensorA, OperationGraph::NoTensor, OperationGraph::NoTensor};
+    node.mOutput              = tensorB;
+    node.mAlpha               = alpha;
+    node.mModeA               = copyModes(*graph, tensorA, modeA);
+    node.mModeD               = copyModes(*graph, tensorB, modeB);
+    node.mTypeScalar          = typeScalar;
+
+    auto id = graph->addNode(std::move(node));
+    if(nodeId != nullptr)
+    {
+        *nodeId = id;
+    }
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorOperationGraphAddReduction(hiptensorOperationGraph_t* graph,
+                                                      const void*                alpha,
+                                                      int32_t                    tensorA,
+                                                      const int32_t              modeA[],
+                                                      const void*                beta,
+                                                      int32_t                    tensorC,
+                                                      const int32_t              modeC[],
+                                                      int32_t                    tensorD,
+                                                      const int32_t              modeD[],
+                                                      hiptensorOperator_t        opReduce,
+                                                      hiptensorComputeType_t     typeCompute,
+                                                      int32_t*                   nodeId)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "graph=0x%0*llX, alpha=0x%llX, tensorA=%d, modeA=0x%llX, beta=0x%llX, tensorC=%d, "
+             "modeC=0x%llX, tensorD=%d, modeD=0x%llX, opReduce=0x%02X, typeCompute=0x%02X, "
+             "nodeId=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)graph,
+             (unsigned long long)alpha,
+             (int)tensorA,
+             (unsigned long long)modeA,
+             (unsigned long long)beta,
+             (int)tensorC,
+             (unsigned long long)modeC,
+             (int)tensorD,
+             (unsigned long long)modeD,
+             (unsigned int)opReduce,
+             (unsigned int)typeCompute,
+             (unsigned long long)nodeId);
+
+    logger->logAPITrace("hiptensorOperationGraphAddReduction", msg);
+
+    if(graph == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : graph = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphAddReduction", msg);
+        return errorCode;
+    }
+
+    auto hasC = tensorC != OperationGraph::NoTensor;
+    if(alpha == nullptr || modeA == nullptr || modeD == nullptr
+       || (hasC && (beta == nullptr || modeC == nullptr)))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : alpha/modeA/modeD, or beta/modeC with C = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphAddReduction", msg);
+        return errorCode;
+    }
+
+    // D is checked last, so that C may be D
+    auto apiName   = "hiptensorOperationGraphAddReduction";
+    auto errorCode = checkTensor(*graph, tensorA, true, "tensorA", apiName);
+    if(errorCode == HIPTENSOR_STATUS_SUCCESS && hasC)
+    {
+        errorCode = checkTensor(*graph, tensorC, true, "tensorC", apiName);
+    }
+    if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+    {
+        errorCode = checkTensor(*graph, tensorD, false, "tensorD", apiName);
+    }
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    OperationGraph::Node node = {};
+    node.mKind                = OperationGraph::NodeKind_t::REDUCTION;
+    node.mInputs              = {tensorA, OperationGraph::NoTensor, tensorC};
+    node.mOutput              = tensorD;
+    node.mAlpha               = alpha;
+    node.mBeta                = hasC ? beta : nullptr;
+    node.mModeA               = copyModes(*graph, tensorA, modeA);
+    node.mModeC               = copyModes(*graph, tensorC, modeC);
+    node.mModeD               = copyModes(*graph, tensorD, modeD);
+    node.mOpReduce            = opReduce;
+    node.mTypeCompute         = typeCompute;
+
+    auto id = graph->addNode(std::move(node));
+    if(nodeId != nullptr)
+    {
+        *nodeId = id;
+    }
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorOperationGraphGetWorkspaceSize(hiptensorOperationGraph_t* graph,
+                                                          uint64_t* workspaceSize)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "graph=0x%0*llX, workspaceSize=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)graph,
+             (unsigned long long)workspaceSize);
+
+    logger->logAPITrace("hiptensorOperationGraphGetWorkspaceSize", msg);
+
+    if(graph == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : graph = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphGetWorkspaceSize", msg);
+        return errorCode;
+    }
+
+    if(workspaceSize == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : workspaceSize = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphGetWorkspaceSize", msg);
+        return errorCode;
+    }
+
+    *workspaceSize = graph->schedule().mWorkspaceSize;
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorOperationGraphExecute(const hiptensorHandle_t*   handle,
+                                                 hiptensorOperationGraph_t* graph,
+                                                 void*                      workspace,
+                                                 uint64_t                   workspaceSize,
+                                                 hipStream_t                stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    snprintf(msg,
+             sizeof(msg),
+             "handle=0x%0*llX, graph=0x%llX, workspace=0x%llX, workspaceSize=0x%04lX, "
+             "stream=0x%llX",
+             2 * (int)sizeof(void*),
+             (unsigned long long)handle,
+             (unsigned long long)graph,
+             (unsigned long long)workspace,
+             (unsigned long)workspaceSize,
+             (unsigned long long)stream);
+
+    logger->logAPITrace("hiptensorOperationGraphExecute", msg);
+
+    if(handle == nullptr || graph == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "graph",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphExecute", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+
+    // Ensure current HIP device is same as the handle.
+    auto currentDeviceId = hiptensor::HipDevice::currentDeviceId();
+    if(currentDeviceId != realHandle->getDevice().getDeviceId())
+    {
+        auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Device mismatch error: current device id: %d, handle device id: %d (%s)",
+                 (int)currentDeviceId,
+                 (int)realHandle->getDevice().getDeviceId(),
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphExecute", msg);
+        return errorCode;
+    }
+
+    auto requiredSize = graph->schedule().mWorkspaceSize;
+    if(workspace != nullptr && workspaceSize < requiredSize)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Insufficient workspace: req: %lu alloc: %lu (%s)",
+                 (unsigned long)requiredSize,
+                 (unsigned long)workspaceSize,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphExecute", msg);
+        return errorCode;
+    }
+
+    auto errorCode = graph->execute(handle, workspace, workspaceSize, stream);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unable to execute the operation graph (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorOperationGraphExecute", msg);
+    }
+    return errorCode;
+}
@@ -42,6 +42,7 @@ namespace hiptensor
         , mInputFilename("")
         , mOutputFilename("")
         , mColMajorStrides(HIPTENSOR_DEFAULT_STRIDES_COL_MAJOR)
+        , mComplexAlgo(ComplexAlgo_t::AUTO)
     {
         // Override HIPTENSOR_DEFAULT_STRIDES_COL_MAJOR with environment variable if present
         if(const char* stride_env = std::getenv("HIPTENSOR_DEFAULT_STRIDES_COL_MAJOR"))
@@ -57,6 +58,12 @@ namespace hiptensor
                 mColMajorStrides = false;
             }
         }
+
+        // Complex contraction algorithm: AUTO, 4M, 3M or INTERLEAVED
+        if(const char* algo_env = std::getenv("HIPTENSOR_COMPLEX_ALGO"))
+        {
+            setComplexAlgo(algo_env);
+        }
     }
 
     void HiptensorOptions::setOstream(std::string file)
@@ -141,6 +148,27 @@ namespace hiptensor
         mOutputFilename = file;
     }
 
+    void HiptensorOptions::setComplexAlgo(std::string val)
+    {
+        std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+        if(val.compare("AUTO") == 0)
+        {
+            mComplexAlgo = ComplexAlgo_t::AUTO;
+        }
+        else if(val.compare("4M") == 0)
+        {
+            mComplexAlgo = ComplexAlgo_t::STANDARD_4M;
+        }
+        else if(val.compare("3M") == 0)
+        {
+            mComplexAlgo = ComplexAlgo_t::GAUSS_3M;
+        }
+        else if(val.compare("INTERLEAVED") == 0)
+        {
+            mComplexAlgo = ComplexAlgo_t::INTERLEAVED;
+        }
+    }
+
     HiptensorOStream& HiptensorOptions::ostream()
     {
         return mOstream;
@@ -176,6 +204,11 @@ namespace hiptensor
         return mValidate;
     }
 
+    ComplexAlgo_t HiptensorOptions::complexAlgo()
+    {
+        return mComplexAlgo;
+    }
+
     int32_t HiptensorOptions::hotRuns()
     {
         return mHotRuns;
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_API_RECORDER_HPP
+#define HIPTENSOR_API_RECORDER_HPP
+
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime_api.h>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    // Kind of public API call captured in a trace record
+    enum struct ApiRecordKind_t : uint32_t
+    {
+        CONTRACTION = 1,
+        PERMUTATION = 2,
+        REDUCTION   = 3,
+    };
+
+    // Problem description of a single tensor operand. No data pointers are kept.
+    struct ApiRecordTensor
+    {
+        hipDataType              mType;
+        hiptensorOperator_t      mUnaryOp;
+        std::vector<std::size_t> mLengths;
+        std::vector<std::size_t> mStrides;
+        std::vector<int32_t>     mModes;
+        std::size_t              mPlaneStride;
+    };
+
+    // Self-contained description of one public call, sufficient to rebuild
+    // the problem with synthetic data.
+    //
+    // Operand ordering in mTensors:
+    // - CONTRACTION: A, B, C, D (C has NONE_TYPE for scale contractions)
+    // - PERMUTATION: A, B
+    // - REDUCTION:   A, C, D
+    struct ApiRecord
+    {
+        ApiRecordKind_t              mKind;
+        std::vector<ApiRecordTensor> mTensors;
+
+        // Contraction: compute type; reduction: typeCompute; permutation: typeScalar
+        hiptensorComputeType_t mComputeType;
+        hipDataType            mScalarType;
+
+        // Contraction: ContractionOpId_t; reduction: opReduce
+        int32_t mOpId;
+
+        // Scalars are stored as (real, imag) pairs in double precision
+        double mAlpha[2];
+        double mBeta[2];
+
+        // Contraction only
+        hiptensorAlgo_t               mAlgo;
+        hiptensorWorksizePreference_t mWorksizePref;
+
+        uint64_t mWorkspaceSize;
+    };
+
+    // Binary trace format helpers.
+    // A trace is a header (magic + version) followed by a sequence of records.
+    bool writeApiTraceHeader(FILE* stream);
+    bool readApiTraceHeader(FILE* stream);
+    bool writeApiRecord(FILE* stream, ApiRecord const& record);
+    bool readApiRecord(FILE* stream, ApiRecord& record);
+
+    // Reads every record of a trace file. Returns false if the file cannot be
+    // opened or is not a hiptensor trace.
+    bool readApiTrace(const char* fileName, std::vector<ApiRecord>& records);
+
+    // Records public API calls to a binary trace when enabled, either through
+    // the HIPTENSOR_API_RECORD=<file> environment variable, or openTrace().
+    class ApiRecorder : public LazySingleton<ApiRecorder>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<ApiRecorder> std::make_unique<ApiRecorder>();
+
+        ~ApiRecorder();
+
+        bool openTrace(const char* fileName);
+        void closeTrace();
+        bool isEnabled() const;
+
+        // Contraction calls are captured over the find / workspace / plan / execute sequence
+        // so that the record emitted on execution carries the algo and workspace preference.
+        // Finds and plans are keyed by address, and forgotten when they are re-initialized.
+        void resetContractionFind(hiptensorContractionFind_t const* find);
+        void resetContractionPlan(hiptensorContractionPlan_t const* plan);
+        void recordContractionWorkspacePref(hiptensorContractionFind_t const* find,
+                                            hiptensorWorksizePreference_t     pref);
+        void recordContractionPlan(hiptensorContractionPlan_t const* plan,
+                                   hiptensorContractionFind_t const* find);
+        // Scalars in device memory (device pointer mode) are read once the work queued on
+        // the stream has completed.
+        void recordContraction(hiptensorContractionPlan_t const* plan,
+                               void const*                       alpha,
+                               void const*                       beta,
+                               uint64_t                          workspaceSize,
+                               bool                              deviceScalars,
+                               hipStream_t                       stream);
+
+        void recordPermutation(void const*                        alpha,
+                               hiptensorTensorDescriptor_t const* descA,
+                               int32_t const*                     modeA,
+                               hiptensorTensorDescriptor_t const* descB,
+                               int32_t const*                     modeB,
+                               hipDataType                        typeScalar,
+                               bool                               deviceScalars,
+                               hipStream_t                        stream);
+
+        void recordReduction(void const*                        alpha,
+                             hiptensorTensorDescriptor_t const* descA,
+                             int32_t const*                     modeA,
+                             void const*                        beta,
+                             hiptensorTensorDescriptor_t const* descC,
+                             int32_t const*                     modeC,
+                             hiptensorTensorDescriptor_t const* descD,
+                             int32_t const*                     modeD,
+                             hiptensorOperator_t                opReduce,
+                             hiptensorComputeType_t             typeCompute,
+                             uint64_t                           workspaceSize,
+                             bool                               deviceScalars,
+                             hipStream_t                        stream);
+
+    private:
+        ApiRecorder();
+        ApiRecorder(ApiRecorder const&)            = delete;
+        ApiRecorder& operator=(ApiRecorder const&) = delete;
+
+        void write(ApiRecord const& record);
+
+    private:
+        FILE* mStream;
+
+        // Opaque object addresses are only used as in-process keys, never recorded
+        std::unordered_map<void const*, hiptensorWorksizePreference_t> mFindPrefs;
+        std::unordered_map<void const*, std::pair<hiptensorAlgo_t, hiptensorWorksizePreference_t>>
+            mPlanInfo;
+
+        mutable std::mutex mMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_API_RECORDER_HPP
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_DEVICE_SCALARS_HPP
+#define HIPTENSOR_DEVICE_SCALARS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hip/hip_runtime_api.h>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "data_types.hpp"
+
+namespace hiptensor
+{
+    struct Handle;
+
+    // Most modes of the tensors scaled by applyDeviceScalars
+    static constexpr int32_t DeviceScalarsMaxRank = 32;
+
+    // Scales the unscaled result T of an operation by scalars in device memory, read by
+    // the kernel in stream order: D = alpha * T + beta * C. T, C and D have the lengths of
+    // D and their own strides. C may be nullptr, or alias D with the same strides; it is
+    // not read when beta is zero. Complex tensors are scaled by complex scalars of the same
+    // precision, real tensors by real scalars of any precision.
+    hiptensorStatus_t applyDeviceScalars(void const*                     alpha,
+                                         void const*                     T,
+                                         std::vector<std::size_t> const& stridesT,
+                                         void const*                     beta,
+                                         void const*                     C,
+                                         std::vector<std::size_t> const& stridesC,
+                                         void*                           D,
+                                         std::vector<std::size_t> const& lengths,
+                                         std::vector<std::size_t> const& stridesD,
+                                         hipDataType                     typeD,
+                                         hiptensorComputeType_t          typeScalar,
+                                         hipStream_t                     stream);
+
+    // Reads a scalar in device memory on the host, once the work queued on the stream
+    // has completed
+    ScalarData readDeviceScalar(void const* value, hiptensorComputeType_t type, hipStream_t stream);
+
+    // One and zero as the library passes them to its own operations: host values, or
+    // device constants when the handle is in device pointer mode
+    class LibraryScalars
+    {
+    public:
+        LibraryScalars(Handle const& handle, hiptensorComputeType_t type);
+
+        void const* one() const;
+        void const* zero() const;
+
+    private:
+        hipDoubleComplex mHostOne;
+        hipDoubleComplex mHostZero;
+
+        // Device constants, or nullptr in host pointer mode
+        void const* mDeviceOne  = nullptr;
+        void const* mDeviceZero = nullptr;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_DEVICE_SCALARS_HPP
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_EINSUM_HPP
+#define HIPTENSOR_EINSUM_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hiptensor
+{
+    // Einsum expression such as "abcd,bdef->acef", with its labels renamed to modes
+    // 0, 1, 2... in order of first appearance.
+    struct EinsumExpression
+    {
+        std::vector<std::vector<int32_t>> mInputModes;
+        std::vector<int32_t>              mOutputModes;
+
+        // The expression written with the renamed labels and an explicit output, equal
+        // for all expressions that only differ in the choice of labels
+        std::string mCanonical;
+    };
+
+    // Operation computing an einsum expression
+    enum struct EinsumOp_t : int32_t
+    {
+        // One input, the output holding all of its distinct modes in another order
+        PERMUTATION,
+        // One input, summed over the modes missing from the output
+        REDUCTION,
+        // Two inputs
+        CONTRACTION,
+        // Three or more inputs, contracted pairwise
+        TENSOR_NETWORK,
+    };
+
+    // Parses an einsum expression. Labels are ASCII letters, inputs are separated by
+    // commas and spaces are ignored. Without "->", the output holds the labels used
+    // once, in alphabetical order. Returns false if the expression is malformed, or an
+    // output label is repeated or missing from the inputs.
+    bool parseEinsum(char const* expression, EinsumExpression* result);
+
+    EinsumOp_t einsumOperation(EinsumExpression const& expression);
+
+    // Modes used more than once by one input, which select a diagonal of the input.
+    // Tensor networks do not support them.
+    bool hasRepeatedModes(EinsumExpression const& expression);
+
+    // Modes of an input of a product in no other tensor, summed out of that input.
+    // Tensor networks do not support them.
+    bool hasSummedInputModes(EinsumExpression const& expression);
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_EINSUM_HPP
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_EINSUM_CACHE_HPP
+#define HIPTENSOR_EINSUM_CACHE_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "einsum.hpp"
+
+namespace hiptensor
+{
+    // Plans of the einsum expressions run on a handle, keyed by the canonical
+    // expression, the operand descriptors and the compute type. Entries are never
+    // modified once inserted, so they may be used without holding the lock.
+    class EinsumCache
+    {
+    public:
+        struct Entry
+        {
+            EinsumOp_t       mOp;
+            EinsumExpression mExpression;
+
+            // Diagonal view of the input of EinsumOp_t::PERMUTATION and REDUCTION, with
+            // its repeated modes merged
+            hiptensorTensorDescriptor_t mInputView;
+            std::vector<int32_t>        mInputViewModes;
+
+            // Plan of EinsumOp_t::CONTRACTION
+            hiptensorContractionPlan_t mContractionPlan;
+            // Plan of EinsumOp_t::TENSOR_NETWORK
+            hiptensorTensorNetworkPlan_t mNetworkPlan;
+
+            uint64_t mWorkspaceSize;
+        };
+
+        // Entries held before the cache is emptied, bounding its size for workloads
+        // with ever changing shapes
+        static constexpr std::size_t MaxEntries = 1024;
+
+        EinsumCache()  = default;
+        ~EinsumCache() = default;
+
+        EinsumCache(EinsumCache const&)            = delete;
+        EinsumCache& operator=(EinsumCache const&) = delete;
+
+        // Returns nullptr if the key has no entry
+        std::shared_ptr<Entry const> find(std::string const& key) const;
+
+        // Returns the entry of the key, which is the given one unless another thread
+        // inserted the key first
+        std::shared_ptr<Entry const> insert(std::string const&           key,
+                                            std::shared_ptr<Entry const> entry);
+
+        void        clear();
+        std::size_t size() const;
+
+    private:
+        std::unordered_map<std::string, std::shared_ptr<Entry const>> mEntries;
+
+        mutable std::mutex mMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_EINSUM_CACHE_HPP
@@ -31,7 +31,11 @@
 
 #include <hip/hip_runtime_api.h>
 
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "einsum_cache.hpp"
 #include "hip_device.hpp"
+#include "workspace_arena.hpp"
 
 namespace hiptensor
 {
@@ -39,17 +43,34 @@ namespace hiptensor
     struct Handle
     {
     public:
-        Handle()  = default;
+        Handle();
         ~Handle() = default;
 
-        static Handle  createHandle(int64_t* buff); // Calls constructor for all member variables
+        static Handle* createHandle(int64_t* buff); // Calls constructor for all member variables
         static void    destroyHandle(int64_t* buff); // Calls destructor for all member variables
         static Handle* toHandle(int64_t* buff); // Reinterprets input buffer as Handle class
 
-        HipDevice getDevice();
+        HipDevice const& getDevice() const;
+
+        // Library-managed device memory: workspace, selection scratch and temporaries
+        WorkspaceArena& workspaceArena();
+
+        // Plans of the einsum expressions run on the handle
+        EinsumCache& einsumCache();
+
+        // Location of the alpha and beta scalars of the operations run on the handle
+        hiptensorPointerMode_t pointerMode() const;
+        void                   setPointerMode(hiptensorPointerMode_t mode);
 
     private:
-        HipDevice mDevice;
+        Handle(Handle const&)            = delete;
+        Handle& operator=(Handle const&) = delete;
+
+        // Cached properties of the device current at handle creation
+        HipDevice const&       mDevice;
+        WorkspaceArena         mWorkspaceArena;
+        EinsumCache            mEinsumCache;
+        hiptensorPointerMode_t mPointerMode = HIPTENSOR_POINTER_MODE_HOST;
     };
 } // namespace hiptensor
 
@@ -51,12 +51,20 @@ namespace hiptensor
         };
 
         HipDevice();
+        explicit HipDevice(hipDevice_t deviceId);
         ~HipDevice() = default;
 
-        hipDevice_t     getDeviceId() const;
-        hipDeviceProp_t getDeviceProps() const;
-        hipDeviceArch_t getDeviceArch() const;
-        hipGcnArch_t    getGcnArch() const;
+        // Id of the device current to the calling thread. Does not query properties.
+        static hipDevice_t currentDeviceId();
+
+        // Process-wide properties of each device, queried once on first use
+        static HipDevice const& instance(hipDevice_t deviceId);
+        static HipDevice const& current();
+
+        hipDevice_t            getDeviceId() const;
+        hipDeviceProp_t const& getDeviceProps() const;
+        hipDeviceArch_t        getDeviceArch() const;
+        hipGcnArch_t           getGcnArch() const;
 
         int warpSize() const;
         int sharedMemSize() const;
@@ -76,6 +84,10 @@ namespace hiptensor
         int             mMaxFreqMhz;
     };
 
+    // Whether work queued on the stream is being captured into a graph. Such work must
+    // not synchronize with the host, allocate outside the graph or be timed.
+    bool isStreamCapturing(hipStream_t stream);
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_HIP_DEVICE_HPP
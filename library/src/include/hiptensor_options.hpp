@@ -34,6 +34,19 @@
 
 namespace hiptensor
 {
+    // Algorithm used for contractions of complex types
+    // - AUTO:        interleaved when bandwidth-bound, 3M when compute-bound, 4M otherwise
+    // - STANDARD_4M: four real contractions
+    // - GAUSS_3M:    three real contractions, (Ar+Ai)(Br+Bi) minus Ar*Br and Ai*Bi
+    // - INTERLEAVED: one pass over the interleaved operands, without planar copies
+    enum struct ComplexAlgo_t : uint32_t
+    {
+        AUTO        = 0,
+        STANDARD_4M = 1,
+        GAUSS_3M    = 2,
+        INTERLEAVED = 3,
+    };
+
     struct HiptensorOptions : public LazySingleton<HiptensorOptions>
     {
         // For static initialization
@@ -57,6 +70,7 @@ namespace hiptensor
         void setColdRuns(int runs);
         void setInputYAMLFilename(std::string file);
         void setOutputStreamFilename(std::string file);
+        void setComplexAlgo(std::string val);
 
         HiptensorOStream& ostream();
 
@@ -68,6 +82,8 @@ namespace hiptensor
         bool performValidation();
         bool isColMajorStrides();
 
+        ComplexAlgo_t complexAlgo();
+
         int32_t hotRuns();
         int32_t coldRuns();
 
@@ -82,6 +98,8 @@ namespace hiptensor
         bool mValidate;
         bool mColMajorStrides;
 
+        ComplexAlgo_t mComplexAlgo;
+
         int32_t mHotRuns, mColdRuns;
 
         std::string mInputFilename, mOutputFilename;
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_KERNEL_MODULES_HPP
+#define HIPTENSOR_KERNEL_MODULES_HPP
+
+#include <array>
+#include <mutex>
+#include <string>
+
+#include "singleton.hpp"
+
+// Exports a kernel module entry point with C linkage so it can be found by name
+#define HIPTENSOR_KERNEL_MODULE_ENTRY extern "C" __attribute__((visibility("default")))
+
+namespace hiptensor
+{
+    // Separately loadable kernel instance modules, one per operation
+    enum struct KernelModule_t : uint32_t
+    {
+        CONTRACTION = 0,
+        PERMUTATION = 1,
+        REDUCTION   = 2,
+        COUNT       = 3,
+    };
+
+    // Opens kernel modules with dlopen on first use. Modules are looked up in
+    // HIPTENSOR_KERNEL_MODULE_PATH if set, otherwise next to the hiptensor library.
+    // Modules are never closed: registries keep generators and device ops that
+    // live in the module's code for the lifetime of the process.
+    class KernelModules : public LazySingleton<KernelModules>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<KernelModules> std::make_unique<KernelModules>();
+
+        ~KernelModules() = default;
+
+        // Returns the address of an entry point of the module, loading the
+        // module if needed. Returns nullptr if the module or symbol is missing.
+        void* symbol(KernelModule_t module, const char* name);
+
+        // File name of the module, e.g. libhiptensor_contraction_kernels.so
+        static const char* moduleName(KernelModule_t module);
+
+    private:
+        KernelModules();
+        KernelModules(KernelModules const&)            = delete;
+        KernelModules& operator=(KernelModules const&) = delete;
+
+        void*       open(KernelModule_t module);
+        std::string modulePath(KernelModule_t module) const;
+
+    private:
+        std::array<void*, static_cast<uint32_t>(KernelModule_t::COUNT)> mHandles;
+        std::string                                                     mSearchPath;
+
+        std::mutex mMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_KERNEL_MODULES_HPP
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_OPERATION_GRAPH_HPP
+#define HIPTENSOR_OPERATION_GRAPH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <hip/hip_runtime_api.h>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+namespace hiptensor
+{
+    // DAG of contractions, permutations and reductions over the tensors of a graph,
+    // run on a pool of streams.
+    //
+    // Nodes are ordered by the tensors they use, as if run in the order they were
+    // added: a node runs after the last writer of the tensors it reads, and a writer
+    // after the readers and the writer of its output that precede it. Independent
+    // nodes are spread over the streams and ordered with events. Intermediates, the
+    // tensors without user memory, are placed in the workspace, where tensors that
+    // are not live at the same time share memory.
+    class OperationGraph
+    {
+    public:
+        enum struct NodeKind_t : int32_t
+        {
+            CONTRACTION,
+            PERMUTATION,
+            REDUCTION,
+        };
+
+        // Operand that a node does not use
+        static constexpr int32_t NoTensor = -1;
+
+        // Streams of the pool, unless given on creation
+        static constexpr uint32_t DefaultStreamCount = 4u;
+
+        struct Tensor
+        {
+            hiptensorTensorDescriptor_t mDesc;
+            // User memory, or nullptr for an intermediate
+            void* mData;
+            // Bytes spanned by the tensor
+            std::size_t mBytes;
+            // Whether a node added so far writes the tensor
+            bool mWritten;
+        };
+
+        struct Node
+        {
+            NodeKind_t mKind;
+            // A, B and C, or NoTensor. Permutations read A, reductions A and C.
+            std::array<int32_t, 3> mInputs;
+            // D, or B of a permutation
+            int32_t mOutput;
+            // Read when the graph is executed
+            void const* mAlpha;
+            void const* mBeta;
+
+            // CONTRACTION
+            hiptensorContractionPlan_t mPlan;
+
+            // PERMUTATION and REDUCTION: modes of A, C and the output
+            std::vector<int32_t> mModeA;
+            std::vector<int32_t> mModeC;
+            std::vector<int32_t> mModeD;
+            // PERMUTATION
+            hipDataType mTypeScalar;
+            // REDUCTION
+            hiptensorOperator_t    mOpReduce;
+            hiptensorComputeType_t mTypeCompute;
+        };
+
+        struct Schedule
+        {
+            // Nodes in launch order, each after the nodes it depends on
+            std::vector<int32_t> mOrder;
+            // Stream of each node, by node
+            std::vector<int32_t> mStreams;
+            // Nodes of other streams that each node waits for, by node
+            std::vector<std::vector<int32_t>> mWaits;
+            // Whether a node is waited for, by node
+            std::vector<bool> mSignals;
+            // Workspace offset of each intermediate, by tensor
+            std::vector<std::size_t> mTensorOffsets;
+            // Workspace offset of the contraction workspace of each node, by node
+            std::vector<std::size_t> mNodeWorkspaceOffsets;
+            // Streams used, from the first of the pool
+            int32_t mStreamCount;
+            // Workspace holding the intermediates and the contraction workspaces
+            std::size_t mWorkspaceSize;
+        };
+
+        explicit OperationGraph(uint32_t streamCount);
+        ~OperationGraph();
+
+        OperationGraph(OperationGraph const&)            = delete;
+        OperationGraph& operator=(OperationGraph const&) = delete;
+
+        int32_t addTensor(hiptensorTensorDescriptor_t const& desc, void* data);
+        int32_t addNode(Node node);
+
+        std::size_t   tensorCount() const;
+        std::size_t   nodeCount() const;
+        Tensor const& tensor(int32_t id) const;
+
+        // Schedule of the nodes added so far, computed again after a node is added
+        Schedule const& schedule();
+
+        // Runs the nodes, ordered after the work queued on the stream. The work queued on
+        // the stream afterwards is ordered after all nodes.
+        hiptensorStatus_t execute(hiptensorHandle_t const* handle,
+                                  void*                    workspace,
+                                  uint64_t                 workspaceSize,
+                                  hipStream_t              stream);
+
+    private:
+        hiptensorStatus_t runNode(hiptensorHandle_t const* handle,
+                                  int32_t                  node,
+                                  void*                    workspace,
+                                  hipStream_t              stream) const;
+
+        void computeSchedule();
+
+    private:
+        uint32_t            mStreamCount;
+        std::vector<Tensor> mTensors;
+        std::vector<Node>   mNodes;
+
+        Schedule mSchedule;
+        bool     mScheduled = false;
+
+        // Created on first use
+        std::vector<hipStream_t> mStreams;
+        std::vector<hipEvent_t>  mNodeEvents;
+        std::vector<hipEvent_t>  mJoinEvents;
+        hipEvent_t               mForkEvent = nullptr;
+
+        std::mutex mMutex;
+    };
+
+    // Bytes spanned by a tensor, including the imaginary plane of planar tensors
+    std::size_t tensorSpanBytes(hiptensorTensorDescriptor_t const& desc);
+
+} // namespace hiptensor
+
+// Opaque operation graph of the API
+struct hiptensorOperationGraph_t : public hiptensor::OperationGraph
+{
+    using hiptensor::OperationGraph::OperationGraph;
+};
+
+#endif // HIPTENSOR_OPERATION_GRAPH_HPP
@@ -0,0 +1,190 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_SOLUTION_BITSET_HPP
+#define HIPTENSOR_SOLUTION_BITSET_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace hiptensor
+{
+    // @cond
+    // Set of dense solution indices within a solution registry.
+    // Registries precompute one bitset per queryable attribute so that queries
+    // reduce to word-wise ANDs. Storage is inline up to InlineBits solutions,
+    // so copies and set operations on typical registries do not allocate.
+    class SolutionBitset
+    {
+    public:
+        using Word                           = uint64_t;
+        static constexpr uint32_t WordBits   = 64u;
+        static constexpr uint32_t InlineBits = 4096u;
+
+        SolutionBitset() = default;
+
+        // Number of addressable bits
+        uint32_t size() const
+        {
+            return mSize;
+        }
+
+        // Grows to hold at least size bits. New bits are cleared.
+        void resize(uint32_t size)
+        {
+            if(size <= mSize)
+            {
+                return;
+            }
+
+            auto oldWords = wordCount();
+            mSize         = size;
+            if(mSize > InlineBits)
+            {
+                if(mHeap.empty())
+                {
+                    mHeap.assign(mInline.begin(), mInline.begin() + oldWords);
+                }
+                mHeap.resize(wordCount(), 0u);
+            }
+        }
+
+        // Sets every bit in [0, size)
+        void setAll(uint32_t size)
+        {
+            resize(size);
+            auto* words = data();
+            std::fill(words, words + wordCount(), ~Word(0));
+            clearTail();
+        }
+
+        void set(uint32_t index)
+        {
+            if(index >= mSize)
+            {
+                resize(index + 1u);
+            }
+            data()[index / WordBits] |= Word(1) << (index % WordBits);
+        }
+
+        bool test(uint32_t index) const
+        {
+            return index < mSize && (data()[index / WordBits] >> (index % WordBits)) & 1u;
+        }
+
+        uint32_t count() const
+        {
+            uint32_t result = 0u;
+            auto*    words  = data();
+            for(uint32_t i = 0; i < wordCount(); i++)
+            {
+                result += __builtin_popcountll(words[i]);
+            }
+            return result;
+        }
+
+        bool any() const
+        {
+            auto* words = data();
+            return std::any_of(words, words + wordCount(), [](Word w) { return w != 0u; });
+        }
+
+        // Bits beyond other's size are treated as cleared
+        SolutionBitset& operator&=(SolutionBitset const& other)
+        {
+            auto  common = std::min(wordCount(), other.wordCount());
+            auto* lhs    = data();
+            auto* rhs    = other.data();
+            for(uint32_t i = 0; i < common; i++)
+            {
+                lhs[i] &= rhs[i];
+            }
+            std::fill(lhs + common, lhs + wordCount(), Word(0));
+            return *this;
+        }
+
+        SolutionBitset& operator|=(SolutionBitset const& other)
+        {
+            resize(other.mSize);
+            auto* lhs = data();
+            auto* rhs = other.data();
+            for(uint32_t i = 0; i < other.wordCount(); i++)
+            {
+                lhs[i] |= rhs[i];
+            }
+            return *this;
+        }
+
+        // Visits set bits in ascending index order
+        template <typename Func>
+        void forEach(Func&& func) const
+        {
+            auto* words = data();
+            for(uint32_t i = 0; i < wordCount(); i++)
+            {
+                for(auto word = words[i]; word != 0u; word &= word - 1u)
+                {
+                    func(i * WordBits + __builtin_ctzll(word));
+                }
+            }
+        }
+
+    private:
+        uint32_t wordCount() const
+        {
+            return (mSize + WordBits - 1u) / WordBits;
+        }
+
+        Word* data()
+        {
+            return mSize > InlineBits ? mHeap.data() : mInline.data();
+        }
+
+        Word const* data() const
+        {
+            return mSize > InlineBits ? mHeap.data() : mInline.data();
+        }
+
+        void clearTail()
+        {
+            if(auto tail = mSize % WordBits; tail != 0u)
+            {
+                data()[wordCount() - 1u] &= (Word(1) << tail) - 1u;
+            }
+        }
+
+    private:
+        uint32_t                                mSize   = 0u;
+        std::array<Word, InlineBits / WordBits> mInline = {};
+        std::vector<Word>                       mHeap;
+    };
+    // @endcond
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_SOLUTION_BITSET_HPP
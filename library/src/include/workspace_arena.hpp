@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_WORKSPACE_ARENA_HPP
+#define HIPTENSOR_WORKSPACE_ARENA_HPP
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <hip/hip_runtime_api.h>
+
+namespace hiptensor
+{
+    // Caching, stream-ordered device memory arena.
+    //
+    // Allocations are rounded up to a size class and returned to the arena when
+    // released, instead of being freed. A released block is handed out again right
+    // away on the stream it was released on, and on other streams once the work
+    // queued before its release has completed. hipMalloc is only called when no
+    // cached block fits, and hipFree only on trim() or destruction.
+    //
+    // A graph may be replayed long after its capture, so requests made while the stream
+    // is captured bypass the cache: they are allocated and freed by graph memory nodes.
+    class WorkspaceArena
+    {
+    public:
+        // Move-only ownership of an arena block. The block is released on the
+        // stream it was allocated for when the allocation goes out of scope, so it
+        // may be destroyed right after queuing the work that uses it.
+        class Allocation
+        {
+        public:
+            Allocation() = default;
+            Allocation(Allocation&& other);
+            Allocation& operator=(Allocation&& other);
+            ~Allocation();
+
+            void*  get() const;
+            size_t size() const;
+            void   reset();
+
+        private:
+            friend class WorkspaceArena;
+            Allocation(WorkspaceArena* arena,
+                       void*           ptr,
+                       size_t          size,
+                       hipStream_t     stream,
+                       bool            captured = false);
+
+            WorkspaceArena* mArena    = nullptr;
+            void*           mPtr      = nullptr;
+            size_t          mSize     = 0;
+            hipStream_t     mStream   = nullptr;
+            bool            mCaptured = false;
+        };
+
+        WorkspaceArena() = default;
+        ~WorkspaceArena();
+
+        WorkspaceArena(WorkspaceArena const&)            = delete;
+        WorkspaceArena& operator=(WorkspaceArena const&) = delete;
+
+        // Returns an empty allocation if device memory is exhausted, even after
+        // freeing the idle blocks.
+        Allocation allocate(size_t bytes, hipStream_t stream);
+
+        // Frees the idle blocks, waiting for their pending work if needed
+        void trim();
+
+        // Device memory held by the arena, and the part of it currently in use
+        size_t reservedBytes() const;
+        size_t usedBytes() const;
+
+        // Size actually reserved for a request of the given size
+        static size_t sizeClass(size_t bytes);
+
+    private:
+        struct Block
+        {
+            size_t      mSize;
+            hipStream_t mStream;
+            hipEvent_t  mReleaseEvent;
+            bool        mInUse;
+        };
+
+        void release(void* ptr, hipStream_t stream);
+        void freeIdleBlocks();
+
+    private:
+        std::unordered_map<void*, Block> mBlocks;
+        std::multimap<size_t, void*>     mIdleBlocks;
+
+        size_t mReservedBytes = 0;
+        size_t mUsedBytes     = 0;
+
+        mutable std::mutex mMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_WORKSPACE_ARENA_HPP
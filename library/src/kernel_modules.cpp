@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <dlfcn.h>
+
+#include "kernel_modules.hpp"
+#include "logger.hpp"
+
+namespace hiptensor
+{
+    KernelModules::KernelModules()
+        : mHandles{}
+    {
+        if(const char* pathEnv = std::getenv("HIPTENSOR_KERNEL_MODULE_PATH"))
+        {
+            mSearchPath = pathEnv;
+        }
+        else
+        {
+            // Default to the directory holding the hiptensor library itself
+            Dl_info info;
+            if(dladdr(reinterpret_cast<void*>(&KernelModules::moduleName), &info) != 0
+               && info.dli_fname != nullptr)
+            {
+                mSearchPath = info.dli_fname;
+                mSearchPath = mSearchPath.substr(0, mSearchPath.find_last_of('/') + 1);
+            }
+        }
+
+        if(!mSearchPath.empty() && mSearchPath.back() != '/')
+        {
+            mSearchPath += '/';
+        }
+    }
+
+    void* KernelModules::symbol(KernelModule_t module, const char* name)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if(auto* handle = open(module))
+        {
+            return dlsym(handle, name);
+        }
+        return nullptr;
+    }
+
+    /* static */
+    const char* KernelModules::moduleName(KernelModule_t module)
+    {
+        switch(module)
+        {
+        case KernelModule_t::CONTRACTION:
+            return "libhiptensor_contraction_kernels.so";
+        case KernelModule_t::PERMUTATION:
+            return "libhiptensor_permutation_kernels.so";
+        case KernelModule_t::REDUCTION:
+            return "libhiptensor_reduction_kernels.so";
+        default:
+            return "";
+        }
+    }
+
+    void* KernelModules::open(KernelModule_t module)
+    {
+        auto& handle = mHandles[static_cast<uint32_t>(module)];
+        if(handle == nullptr)
+        {
+            auto path = modulePath(module);
+            handle    = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+            if(handle == nullptr)
+            {
+                char msg[2048];
+                snprintf(msg, sizeof(msg), "Unable to load kernel module: %s", dlerror());
+                Logger::instance()->logError("KernelModules", msg);
+            }
+        }
+        return handle;
+    }
+
+    std::string KernelModules::modulePath(KernelModule_t module) const
+    {
+        return mSearchPath + moduleName(module);
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,559 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <algorithm>
+#include <numeric>
+#include <set>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+#include "data_types.hpp"
+#include "device_scalars.hpp"
+#include "handle.hpp"
+#include "operation_graph.hpp"
+#include "workspace_arena.hpp"
+
+#include "contraction/contraction_path.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Alignment of the intermediates and contraction workspaces, in bytes
+        constexpr std::size_t BufferAlignment = 256u;
+
+        template <typename T>
+        T* offsetBytes(T* ptr, std::size_t bytes)
+        {
+            return ptr == nullptr ? nullptr : (T*)((char*)ptr + bytes);
+        }
+    } // namespace
+
+    std::size_t tensorSpanBytes(hiptensorTensorDescriptor_t const& desc)
+    {
+        std::size_t span = 1u;
+        for(std::size_t i = 0; i < desc.mLengths.size(); i++)
+        {
+            if(desc.mLengths[i] == 0)
+            {
+                return 0u;
+            }
+            span += (desc.mLengths[i] - 1u) * desc.mStrides[i];
+        }
+
+        // The planes of planar complex tensors hold real elements
+        auto elementBytes = hipDataTypeSize(desc.mType);
+        if(desc.mPlaneStride != 0)
+        {
+            return (desc.mPlaneStride + span) * (elementBytes / 2u);
+        }
+        return span * elementBytes;
+    }
+
+    OperationGraph::OperationGraph(uint32_t streamCount)
+        : mStreamCount(streamCount == 0 ? DefaultStreamCount : streamCount)
+    {
+    }
+
+    OperationGraph::~OperationGraph()
+    {
+        for(auto stream : mStreams)
+        {
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+        for(auto event : mNodeEvents)
+        {
+            if(event != nullptr)
+            {
+                CHECK_HIP_ERROR(hipEventDestroy(event));
+            }
+        }
+        for(auto event : mJoinEvents)
+        {
+            CHECK_HIP_ERROR(hipEventDestroy(event));
+        }
+        if(mForkEvent != nullptr)
+        {
+            CHECK_HIP_ERROR(hipEventDestroy(mForkEvent));
+        }
+    }
+
+    int32_t OperationGraph::addTensor(hiptensorTensorDescriptor_t const& desc, void* data)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTensors.push_back(Tensor{desc, data, tensorSpanBytes(desc), false});
+        mScheduled = false;
+        return (int32_t)mTensors.size() - 1;
+    }
+
+    int32_t OperationGraph::addNode(Node node)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTensors[node.mOutput].mWritten = true;
+        mNodes.push_back(std::move(node));
+        mScheduled = false;
+        return (int32_t)mNodes.size() - 1;
+    }
+
+    std::size_t OperationGraph::tensorCount() const
+    {
+        return mTensors.size();
+    }
+
+    std::size_t OperationGraph::nodeCount() const
+    {
+        return mNodes.size();
+    }
+
+    OperationGraph::Tensor const& OperationGraph::tensor(int32_t id) const
+    {
+        return mTensors.at(id);
+    }
+
+    OperationGraph::Schedule const& OperationGraph::schedule()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if(!mScheduled)
+        {
+            computeSchedule();
+            mScheduled = true;
+        }
+        return mSchedule;
+    }
+
+    void OperationGraph::computeSchedule()
+    {
+        auto nodeCount   = (int32_t)mNodes.size();
+        auto tensorCount = (int32_t)mTensors.size();
+
+        // Data dependencies, in the order the nodes were added
+        std::vector<std::set<int32_t>>    deps(nodeCount);
+        std::vector<int32_t>              lastWriter(tensorCount, NoTensor);
+        std::vector<std::vector<int32_t>> readers(tensorCount);
+        for(int32_t n = 0; n < nodeCount; n++)
+        {
+            auto const& node = mNodes[n];
+            for(auto t : node.mInputs)
+            {
+                if(t != NoTensor)
+                {
+                    if(lastWriter[t] != NoTensor)
+                    {
+                        deps[n].insert(lastWriter[t]);
+                    }
+                    readers[t].push_back(n);
+                }
+            }
+
+            auto out = node.mOutput;
+            if(lastWriter[out] != NoTensor)
+            {
+                deps[n].insert(lastWriter[out]);
+            }
+            for(auto r : readers[out])
+            {
+                if(r != n)
+                {
+                    deps[n].insert(r);
+                }
+            }
+            lastWriter[out] = n;
+            readers[out].clear();
+        }
+
+        // Nodes of a level only depend on nodes of lower levels, so they may run at the
+        // same time
+        std::vector<int32_t> levels(nodeCount, 0);
+        for(int32_t n = 0; n < nodeCount; n++)
+        {
+            for(auto d : deps[n])
+            {
+                levels[n] = std::max(levels[n], levels[d] + 1);
+            }
+        }
+
+        // Buffers of the workspace: the intermediates, then the contraction workspaces.
+        // A buffer lives from the lowest to the highest level of its users, so buffers used
+        // by nodes of the same level never share memory.
+        struct Buffer
+        {
+            std::size_t          mSize;
+            std::vector<int32_t> mUsers;
+        };
+        std::vector<Buffer>  buffers;
+        std::vector<int32_t> tensorBuffers(tensorCount, NoTensor);
+        std::vector<int32_t> nodeBuffers(nodeCount, NoTensor);
+        for(int32_t t = 0; t < tensorCount; t++)
+        {
+            if(mTensors[t].mData == nullptr)
+            {
+                tensorBuffers[t] = (int32_t)buffers.size();
+                buffers.push_back({mTensors[t].mBytes, {}});
+            }
+        }
+        for(int32_t n = 0; n < nodeCount; n++)
+        {
+            auto const& node = mNodes[n];
+            for(auto t : node.mInputs)
+            {
+                if(t != NoTensor && tensorBuffers[t] != NoTensor)
+                {
+                    buffers[tensorBuffers[t]].mUsers.push_back(n);
+                }
+            }
+            if(tensorBuffers[node.mOutput] != NoTensor)
+            {
+                buffers[tensorBuffers[node.mOutput]].mUsers.push_back(n);
+            }
+            if(node.mKind == NodeKind_t::CONTRACTION && node.mPlan.mWorkspaceSize > 0)
+            {
+                nodeBuffers[n] = (int32_t)buffers.size();
+                buffers.push_back({node.mPlan.mWorkspaceSize, {n}});
+            }
+        }
+
+        std::vector<std::size_t>            sizes;
+        std::vector<std::array<int32_t, 2>> lifetimes;
+        for(auto const& buffer : buffers)
+        {
+            // Unused intermediates take no memory
+            sizes.push_back(buffer.mUsers.empty() ? 0u : buffer.mSize);
+            std::array<int32_t, 2> lifetime = {0, -1};
+            if(!buffer.mUsers.empty())
+            {
+                lifetime = {levels[buffer.mUsers.front()], levels[buffer.mUsers.front()]};
+                for(auto n : buffer.mUsers)
+                {
+                    lifetime[0] = std::min(lifetime[0], levels[n]);
+                    lifetime[1] = std::max(lifetime[1], levels[n]);
+                }
+            }
+            lifetimes.push_back(lifetime);
+        }
+
+        std::size_t workspaceSize = 0;
+        auto offsets = planBufferOffsets(sizes, lifetimes, BufferAlignment, &workspaceSize);
+
+        // Levels do not order nodes of different streams. A buffer reusing the memory of
+        // another is first written after all users of the other have run.
+        for(std::size_t x = 0; x < buffers.size(); x++)
+        {
+            for(std::size_t y = 0; y < buffers.size(); y++)
+            {
+                if(sizes[x] == 0 || sizes[y] == 0 || lifetimes[x][1] >= lifetimes[y][0]
+                   || offsets[x] + sizes[x] <= offsets[y] || offsets[y] + sizes[y] <= offsets[x])
+                {
+                    continue;
+                }
+
+                // Users of an intermediate run after its first writer, its first user
+                auto firstUser = buffers[y].mUsers.front();
+                for(auto n : buffers[x].mUsers)
+                {
+                    deps[firstUser].insert(n);
+                }
+            }
+        }
+
+        // Launch order: by level, then in the order the nodes were added
+        Schedule schedule;
+        schedule.mOrder.resize(nodeCount);
+        std::iota(schedule.mOrder.begin(), schedule.mOrder.end(), 0);
+        std::stable_sort(schedule.mOrder.begin(),
+                         schedule.mOrder.end(),
+                         [&levels](auto lhs, auto rhs) { return levels[lhs] < levels[rhs]; });
+
+        // A node continues the stream of a dependency launched last on it, without an
+        // event. Otherwise it takes a stream not used yet by its level, the least recently
+        // used one, so that the nodes of a level run on different streams.
+        auto                 streamCount = (int32_t)mStreamCount;
+        std::vector<int32_t> tails(streamCount, NoTensor);
+        std::vector<int32_t> tailPositions(streamCount, -1);
+        std::vector<int32_t> levelUse(streamCount, 0);
+        std::vector<int32_t> levelOfUse(streamCount, -1);
+        std::vector<int32_t> positions(nodeCount, 0);
+
+        schedule.mStreams.assign(nodeCount, 0);
+        schedule.mWaits.assign(nodeCount, {});
+        schedule.mSignals.assign(nodeCount, false);
+        schedule.mStreamCount = 0;
+        for(int32_t i = 0; i < nodeCount; i++)
+        {
+            auto n     = schedule.mOrder[i];
+            auto level = levels[n];
+
+            auto useAtLevel = [&](int32_t s) { return levelOfUse[s] == level ? levelUse[s] : 0; };
+
+            int32_t stream = NoTensor;
+            for(int32_t s = 0; s < streamCount; s++)
+            {
+                if(tails[s] != NoTensor && deps[n].count(tails[s]) != 0
+                   && (stream == NoTensor || tailPositions[s] > tailPositions[stream]))
+                {
+                    stream = s;
+                }
+            }
+            if(stream == NoTensor)
+            {
+                stream = 0;
+                for(int32_t s = 1; s < streamCount; s++)
+                {
+                    if(std::make_pair(useAtLevel(s), tailPositions[s])
+                       < std::make_pair(useAtLevel(stream), tailPositions[stream]))
+                    {
+                        stream = s;
+                    }
+                }
+            }
+
+            // Streams run in order: only the last dependency launched on each other stream
+            // is waited for
+            std::vector<int32_t> waits(streamCount, NoTensor);
+            for(auto d : deps[n])
+            {
+                auto s = schedule.mStreams[d];
+                if(s != stream && (waits[s] == NoTensor || positions[d] > positions[waits[s]]))
+                {
+                    waits[s] = d;
+                }
+            }
+            for(auto d : waits)
+            {
+                if(d != NoTensor)
+                {
+                    schedule.mWaits[n].push_back(d);
+                    schedule.mSignals[d] = true;
+                }
+            }
+
+            levelUse[stream]      = useAtLevel(stream) + 1;
+            levelOfUse[stream]    = level;
+            tails[stream]         = n;
+            tailPositions[stream] = i;
+            positions[n]          = i;
+            schedule.mStreams[n]  = stream;
+            schedule.mStreamCount = std::max(schedule.mStreamCount, stream + 1);
+        }
+
+        schedule.mTensorOffsets.assign(tensorCount, 0u);
+        for(int32_t t = 0; t < tensorCount; t++)
+        {
+            if(tensorBuffers[t] != NoTensor)
+            {
+                schedule.mTensorOffsets[t] = offsets[tensorBuffers[t]];
+            }
+        }
+        schedule.mNodeWorkspaceOffsets.assign(nodeCount, 0u);
+        for(int32_t n = 0; n < nodeCount; n++)
+        {
+            if(nodeBuffers[n] != NoTensor)
+            {
+                schedule.mNodeWorkspaceOffsets[n] = offsets[nodeBuffers[n]];
+            }
+        }
+        schedule.mWorkspaceSize = workspaceSize;
+
+        mSchedule = std::move(schedule);
+    }
+
+    hiptensorStatus_t OperationGraph::runNode(hiptensorHandle_t const* handle,
+                                              int32_t                  n,
+                                              void*                    workspace,
+                                              hipStream_t              stream) const
+    {
+        auto const& node = mNodes[n];
+
+        auto data = [&](int32_t t) -> void* {
+            if(t == NoTensor)
+            {
+                return nullptr;
+            }
+            return mTensors[t].mData != nullptr
+                       ? mTensors[t].mData
+                       : offsetBytes(workspace, mSchedule.mTensorOffsets[t]);
+        };
+
+        auto const& descA = mTensors[node.mInputs[0]].mDesc;
+        auto const& descD = mTensors[node.mOutput].mDesc;
+
+        switch(node.mKind)
+        {
+        case NodeKind_t::CONTRACTION:
+        {
+            auto  nodeWorkspaceSize = node.mPlan.mWorkspaceSize;
+            void* nodeWorkspace     = nullptr;
+            if(nodeWorkspaceSize > 0)
+            {
+                nodeWorkspace = offsetBytes(workspace, mSchedule.mNodeWorkspaceOffsets[n]);
+            }
+            return hiptensorContraction(handle,
+                                        &node.mPlan,
+                                        node.mAlpha,
+                                        data(node.mInputs[0]),
+                                        data(node.mInputs[1]),
+                                        node.mBeta,
+                                        data(node.mInputs[2]),
+                                        data(node.mOutput),
+                                        nodeWorkspace,
+                                        nodeWorkspaceSize,
+                                        stream);
+        }
+        case NodeKind_t::PERMUTATION:
+        {
+            return hiptensorPermutation(handle,
+                                        node.mAlpha,
+                                        data(node.mInputs[0]),
+                                        &descA,
+                                        node.mModeA.data(),
+                                        data(node.mOutput),
+                                        &descD,
+                                        node.mModeD.data(),
+                                        node.mTypeScalar,
+                                        stream);
+        }
+        case NodeKind_t::REDUCTION:
+        {
+            // Without C, the reduction overwrites D
+            auto        hasC  = node.mInputs[2] != NoTensor;
+            auto const& descC = hasC ? mTensors[node.mInputs[2]].mDesc : descD;
+
+            LibraryScalars scalars(*Handle::toHandle((int64_t*)handle->fields),
+                                   node.mTypeCompute);
+            return hiptensorReduction(handle,
+                                      node.mAlpha,
+                                      data(node.mInputs[0]),
+                                      &descA,
+                                      node.mModeA.data(),
+                                      hasC ? node.mBeta : scalars.zero(),
+                                      data(node.mInputs[2]),
+                                      &descC,
+                                      hasC ? node.mModeC.data() : node.mModeD.data(),
+                                      data(node.mOutput),
+                                      &descD,
+                                      node.mModeD.data(),
+                                      node.mOpReduce,
+                                      node.mTypeCompute,
+                                      nullptr,
+                                      0,
+                                      stream);
+        }
+        }
+        return HIPTENSOR_STATUS_INTERNAL_ERROR;
+    }
+
+    hiptensorStatus_t OperationGraph::execute(hiptensorHandle_t const* handle,
+                                              void*                    workspace,
+                                              uint64_t                 workspaceSize,
+                                              hipStream_t              stream)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if(!mScheduled)
+        {
+            computeSchedule();
+            mScheduled = true;
+        }
+        auto const& schedule = mSchedule;
+
+        // Library-managed workspace, given back to the arena in stream order once all
+        // streams have joined the stream
+        WorkspaceArena::Allocation managedWorkspace;
+        if(workspace == nullptr && schedule.mWorkspaceSize > 0)
+        {
+            auto& arena      = Handle::toHandle((int64_t*)handle->fields)->workspaceArena();
+            managedWorkspace = arena.allocate(schedule.mWorkspaceSize, stream);
+            workspace        = managedWorkspace.get();
+            workspaceSize    = managedWorkspace.size();
+            if(workspace == nullptr)
+            {
+                return HIPTENSOR_STATUS_ALLOC_FAILED;
+            }
+        }
+        if(workspaceSize < schedule.mWorkspaceSize)
+        {
+            return HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+        }
+
+        while(mStreams.size() < (std::size_t)schedule.mStreamCount)
+        {
+            hipStream_t poolStream;
+            hipEvent_t  joinEvent;
+            CHECK_HIP_ERROR(hipStreamCreateWithFlags(&poolStream, hipStreamNonBlocking));
+            CHECK_HIP_ERROR(hipEventCreateWithFlags(&joinEvent, hipEventDisableTiming));
+            mStreams.push_back(poolStream);
+            mJoinEvents.push_back(joinEvent);
+        }
+        if(mForkEvent == nullptr)
+        {
+            CHECK_HIP_ERROR(hipEventCreateWithFlags(&mForkEvent, hipEventDisableTiming));
+        }
+        mNodeEvents.resize(mNodes.size(), nullptr);
+
+        // Fork the streams of the pool from the stream. Event waits are captured as graph
+        // edges, so the graph may be captured on the stream.
+        CHECK_HIP_ERROR(hipEventRecord(mForkEvent, stream));
+        for(int32_t s = 0; s < schedule.mStreamCount; s++)
+        {
+            CHECK_HIP_ERROR(hipStreamWaitEvent(mStreams[s], mForkEvent, 0));
+        }
+
+        auto errorCode = HIPTENSOR_STATUS_SUCCESS;
+        for(auto n : schedule.mOrder)
+        {
+            auto nodeStream = mStreams[schedule.mStreams[n]];
+            for(auto w : schedule.mWaits[n])
+            {
+                CHECK_HIP_ERROR(hipStreamWaitEvent(nodeStream, mNodeEvents[w], 0));
+            }
+
+            errorCode = runNode(handle, n, workspace, nodeStream);
+            if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                break;
+            }
+
+            if(schedule.mSignals[n])
+            {
+                if(mNodeEvents[n] == nullptr)
+                {
+                    CHECK_HIP_ERROR(
+                        hipEventCreateWithFlags(&mNodeEvents[n], hipEventDisableTiming));
+                }
+                CHECK_HIP_ERROR(hipEventRecord(mNodeEvents[n], nodeStream));
+            }
+        }
+
+        // Join the streams back, also on failure, so that a capture is left consistent
+        for(int32_t s = 0; s < schedule.mStreamCount; s++)
+        {
+            CHECK_HIP_ERROR(hipEventRecord(mJoinEvents[s], mStreams[s]));
+            CHECK_HIP_ERROR(hipStreamWaitEvent(stream, mJoinEvents[s], 0));
+        }
+
+        return errorCode;
+    }
+
+} // namespace hiptensor
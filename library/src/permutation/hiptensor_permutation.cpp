@@ -25,6 +25,10 @@
  *******************************************************************************/
 #include <hiptensor/hiptensor.hpp>
 
+#include "api_recorder.hpp"
+#include "device_scalars.hpp"
+#include "handle.hpp"
+#include "hip_device.hpp"
 #include "logger.hpp"
 #include "permutation_solution.hpp"
 #include "permutation_solution_instances.hpp"
@@ -112,6 +116,49 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
         return errorCode;
     }
 
+    // Planar complex tensors are permuted one plane at a time, as real tensors. Unary ops
+    // would have to mix the planes, so only identity ops are supported on them.
+    if(descA->mPlaneStride != 0 || descB->mPlaneStride != 0)
+    {
+        if(descA->mType != HIP_C_32F || descB->mType != HIP_C_32F || descA->mPlaneStride == 0
+           || descB->mPlaneStride == 0 || descA->mUnaryOp != HIPTENSOR_OP_IDENTITY
+           || descB->mUnaryOp != HIPTENSOR_OP_IDENTITY)
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Planar Tensor Error : A and B must both be planar HIP_C_32F "
+                     "tensors with identity ops (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorPermutation", msg);
+            return errorCode;
+        }
+
+        auto planeA         = *descA;
+        auto planeB         = *descB;
+        planeA.mType        = HIP_R_32F;
+        planeB.mType        = HIP_R_32F;
+        planeA.mPlaneStride = 0;
+        planeB.mPlaneStride = 0;
+
+        auto errorCode = hiptensorPermutation(
+            handle, alpha, A, &planeA, modeA, B, &planeB, modeB, typeScalar, stream);
+        if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            errorCode = hiptensorPermutation(handle,
+                                             alpha,
+                                             static_cast<const float*>(A) + descA->mPlaneStride,
+                                             &planeA,
+                                             modeA,
+                                             static_cast<float*>(B) + descB->mPlaneStride,
+                                             &planeB,
+                                             modeB,
+                                             typeScalar,
+                                             stream);
+        }
+        return errorCode;
+    }
+
     if(descA->mType != HIP_R_16F && descA->mType != HIP_R_32F)
     {
         auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
@@ -147,8 +194,36 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
         return errorCode;
     }
 
+    // In device pointer mode the permutation is unscaled, and alpha is applied to B by a
+    // second kernel that reads it from device memory. It must not go through the op of B.
+    auto deviceScalars = hiptensor::Handle::toHandle((int64_t*)handle->fields)->pointerMode()
+                         == HIPTENSOR_POINTER_MODE_DEVICE;
+    if(deviceScalars && descB->mUnaryOp != HIPTENSOR_OP_IDENTITY)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Pointer Mode Error : device scalars are not supported with a unary "
+                 "operator on B (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorPermutation", msg);
+        return errorCode;
+    }
+
+    hiptensor::ApiRecorder::instance()->recordPermutation(
+        alpha, descA, modeA, descB, modeB, typeScalar, deviceScalars, stream);
+
+    auto             computeScalar = hiptensor::convertToComputeType(typeScalar);
+    const void*      solutionAlpha = alpha;
+    hipDoubleComplex one;
+    if(deviceScalars)
+    {
+        hiptensor::writeVal(&one, computeScalar, hiptensor::ScalarData(computeScalar, 1.0));
+        solutionAlpha = &one;
+    }
+
     auto& instances = hiptensor::PermutationSolutionInstances::instance();
-    auto  solutions = instances->query(alpha,
+    auto  solutions = instances->query(solutionAlpha,
                                       descA,
                                       modeA,
                                       descB,
@@ -159,7 +234,7 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
     bool canRun = false;
     for(auto pSolution : solutions)
     {
-        canRun = pSolution->initArgs(alpha,
+        canRun = pSolution->initArgs(solutionAlpha,
                                      A,
                                      B,
                                      descA->mLengths,
@@ -172,8 +247,10 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
 
         if(canRun)
         {
-            // Perform permutation with timing if LOG_LEVEL_PERF_TRACE
-            if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+            // Perform permutation with timing if LOG_LEVEL_PERF_TRACE, unless the stream is
+            // captured
+            if((logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+               && !hiptensor::isStreamCapturing(stream))
             {
                 using hiptensor::HiptensorOptions;
                 auto& options = HiptensorOptions::instance();
@@ -221,6 +298,31 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
                 }
             }
 
+            if(deviceScalars)
+            {
+                auto errorCode = hiptensor::applyDeviceScalars(alpha,
+                                                               B,
+                                                               descB->mStrides,
+                                                               nullptr,
+                                                               nullptr,
+                                                               {},
+                                                               B,
+                                                               descB->mLengths,
+                                                               descB->mStrides,
+                                                               descB->mType,
+                                                               computeScalar,
+                                                               stream);
+                if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+                {
+                    snprintf(msg,
+                             sizeof(msg),
+                             "Unable to apply the device scalars (%s)",
+                             hiptensorGetErrorString(errorCode));
+                    logger->logError("hiptensorPermutation", msg);
+                }
+                return errorCode;
+            }
+
             return HIPTENSOR_STATUS_SUCCESS;
         }
     }
@@ -34,14 +34,16 @@ namespace hiptensor
 {
     void PermutationSolutionInstances::PermutationSolution2DFloatThroughSquareInstances()
     {
-        // Register all the solutions exactly once
+        // Register all the solution families exactly once
         // 2d Permutation
-        registerSolutions(
-            enumeratePermutationSolutions<ck::Tuple<float>,
-                                          ck::Tuple<float>,
-                                          ck::tensor_operation::element_wise::PassThrough,
-                                          ck::tensor_operation::element_wise::UnarySquare,
-                                          ck::tensor_operation::element_wise::Scale,
-                                          2>());
+#if !HIPTENSOR_INSTANCE_PRUNED
+        registerSolutionFamily(
+            permutationSolutionFamily<ck::Tuple<float>,
+                                      ck::Tuple<float>,
+                                      ck::tensor_operation::element_wise::PassThrough,
+                                      ck::tensor_operation::element_wise::UnarySquare,
+                                      ck::tensor_operation::element_wise::Scale,
+                                      2>());
+#endif // !HIPTENSOR_INSTANCE_PRUNED
     }
 } // namespace hiptensor
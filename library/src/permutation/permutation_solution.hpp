@@ -30,6 +30,7 @@
 #include <functional>
 #include <memory>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 // CK includes
@@ -135,6 +136,15 @@ namespace hiptensor
         std::unique_ptr<ck::tensor_operation::device::BaseInvoker>  mInvokerPtr;
     };
 
+    // Solutions enumerated by one enumeratePermutationSolutions instantiation.
+    // Params carry the type, element-wise ops and rank shared by the whole family
+    // so that registries can defer instantiating device ops until they are queried.
+    struct PermutationSolutionFamily
+    {
+        std::unique_ptr<PermutationSolutionParams> mParams;
+        std::function<std::unordered_map<Uid, std::unique_ptr<PermutationSolution>>()> mGenerate;
+    };
+
 } // namespace hiptensor
 
 #include "permutation_solution_impl.hpp"
@@ -213,6 +213,30 @@ namespace hiptensor
         return result;
     }
 
+    template <typename InDataTypeTuple,
+              typename OutDataTypeTuple,
+              typename Aop,
+              typename Bop,
+              typename Scale,
+              ck::index_t NumDim>
+    PermutationSolutionFamily permutationSolutionFamily()
+    {
+        using PermutationOp = ck::tensor_operation::device::DeviceElementwise<
+            InDataTypeTuple,
+            OutDataTypeTuple,
+            ck::tensor_operation::element_wise::UnaryCombinedOp<Aop, Scale, Bop>,
+            NumDim>;
+
+        // Params only depend on the op type, no device op is constructed here
+        return {std::make_unique<PermutationSolutionParamsImpl<PermutationOp>>(),
+                &enumeratePermutationSolutions<InDataTypeTuple,
+                                               OutDataTypeTuple,
+                                               Aop,
+                                               Bop,
+                                               Scale,
+                                               NumDim>};
+    }
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_PERMUTATION_SOLUTION_IMPL_HPP
@@ -29,9 +29,19 @@
 
 #include <memory>
 
+#include "kernel_modules.hpp"
 #include "permutation_solution_registry.hpp"
 #include "singleton.hpp"
 
+namespace hiptensor
+{
+    class PermutationSolutionInstances;
+}
+
+// Entry point of the permutation kernel module: registers the device instance families
+HIPTENSOR_KERNEL_MODULE_ENTRY void
+    hiptensorRegisterPermutationKernels(hiptensor::PermutationSolutionInstances* instances);
+
 namespace hiptensor
 {
     class PermutationSolutionInstances : public PermutationSolutionRegistry,
@@ -42,6 +52,9 @@ namespace hiptensor
         friend std::unique_ptr<PermutationSolutionInstances>
             std::make_unique<PermutationSolutionInstances>();
 
+        // Registers the device instance families from within the kernel module
+        friend void ::hiptensorRegisterPermutationKernels(PermutationSolutionInstances* instances);
+
         ~PermutationSolutionInstances() = default;
 
     private:
@@ -95,6 +108,9 @@ namespace hiptensor
         void PermutationSolution6DHalfSquareThroughInstances();
         void PermutationSolution6DHalfThroughSquareInstances();
         void PermutationSolution6DHalfThroughThroughInstances();
+        // Registers every device instance family exactly once
+        void registerInstances();
+
         // Singleton: only one instance
         PermutationSolutionInstances();
         PermutationSolutionInstances(PermutationSolutionInstances const&)            = delete;
@@ -40,7 +40,7 @@ namespace hiptensor
                                            const hiptensorTensorDescriptor_t* descB,
                                            const int32_t                      modeB[],
                                            const hipDataType                  typeScalar,
-                                           PermutationInstanceType_t          instanceType) const
+                                           PermutationInstanceType_t          instanceType)
     {
         int  nDims      = descA->mLengths.size();
         auto ADataType  = descA->mType;
@@ -70,25 +70,49 @@ namespace hiptensor
         bool usePassThroughIfAlphaIsOne
             = (alphaValue == 1.0F && AOp == HIPTENSOR_OP_IDENTITY && BOp == HIPTENSOR_OP_IDENTITY
                && instanceType == PermutationInstanceType_t::Device);
-        auto scale     = usePassThroughIfAlphaIsOne ? hiptensor::PermutationOpId_t::PASS_THROUGH
-                                                    : hiptensor::PermutationOpId_t::SCALE;
-        auto hashCodes = ck::tensor_operation::device::instance::getHashCodeOfBestPerfInstances(
-            ADataType, BDataType, AOp, BOp, scale, nDims, instanceParams);
-        std::vector<PermutationSolution*> solutions;
-        for(auto hashCode : hashCodes)
-        {
-            if(auto solution = mAllSolutions.find(hashCode); solution != mAllSolutions.end())
+        auto scale = usePassThroughIfAlphaIsOne ? hiptensor::PermutationOpId_t::PASS_THROUGH
+                                                : hiptensor::PermutationOpId_t::SCALE;
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto findSolutions = [&](hiptensor::PermutationOpId_t scaleOp) {
+            auto hashCodes
+                = ck::tensor_operation::device::instance::getHashCodeOfBestPerfInstances(
+                    ADataType, BDataType, AOp, BOp, scaleOp, nDims, instanceParams);
+
+            // Only the family that may hold the selected instances is instantiated
+            loadFamilies(Hash{}(ADataType, BDataType, AOp, BOp, scaleOp, nDims));
+
+            std::vector<PermutationSolution*> solutions;
+            for(auto hashCode : hashCodes)
             {
-                solutions.push_back(solution->second.get());
+                if(auto solution = mAllSolutions.find(hashCode); solution != mAllSolutions.end())
+                {
+                    solutions.push_back(solution->second.get());
+                }
             }
+            return solutions;
+        };
+
+        auto solutions = findSolutions(scale);
+
+        // Noop instances may be pruned from the build. Scaling by 1.0 gives the same result.
+        if(solutions.empty() && scale == hiptensor::PermutationOpId_t::PASS_THROUGH)
+        {
+            solutions = findSolutions(hiptensor::PermutationOpId_t::SCALE);
         }
 
         return solutions;
     }
 
-    void PermutationSolutionRegistry::registerSolutions(
-        std::unordered_map<Uid, std::unique_ptr<PermutationSolution>>&& solutions)
+    PermutationSolutionRegistry::PermutationSolutionRegistry()
+        : mPendingFamilies(0u)
     {
+    }
+
+    void PermutationSolutionRegistry::registerSolutions(SolutionMap&& solutions)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
         for(auto&& solution : solutions)
         {
             // Register with the query then take ownership
@@ -96,9 +120,64 @@ namespace hiptensor
         }
     }
 
+    void PermutationSolutionRegistry::registerSolutionFamily(PermutationSolutionFamily&& family)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto familyIndex = static_cast<uint32_t>(mFamilies.size());
+        mFamilies.push_back({std::move(family.mGenerate), false});
+        mPendingFamilies++;
+
+        auto const& params     = *family.mParams;
+        auto        familyHash = Hash{}(params.typeIn(),
+                                 params.typeOut(),
+                                 params.opA(),
+                                 params.opB(),
+                                 params.opScale(),
+                                 params.dim());
+        mFamilyIndex[familyHash].push_back(familyIndex);
+    }
+
     uint32_t PermutationSolutionRegistry::solutionCount() const
     {
+        std::lock_guard<std::mutex> lock(mMutex);
         return mAllSolutions.size();
     }
 
+    bool PermutationSolutionRegistry::hasSolutions() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return !mAllSolutions.empty() || mPendingFamilies != 0u;
+    }
+
+    void PermutationSolutionRegistry::loadFamilies(std::size_t familyHash)
+    {
+        if(mPendingFamilies == 0u)
+        {
+            return;
+        }
+
+        if(auto families = mFamilyIndex.find(familyHash); families != mFamilyIndex.end())
+        {
+            for(auto familyIndex : families->second)
+            {
+                auto& family = mFamilies[familyIndex];
+                if(family.mLoaded)
+                {
+                    continue;
+                }
+
+                family.mLoaded = true;
+                mPendingFamilies--;
+
+                for(auto&& solution : family.mGenerate())
+                {
+                    mAllSolutions.insert(std::move(solution));
+                }
+
+                // Release the generator's captures
+                family.mGenerate = nullptr;
+            }
+        }
+    }
+
 } // namespace hiptensor
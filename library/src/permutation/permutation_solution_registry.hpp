@@ -27,7 +27,9 @@
 #ifndef HIPTENSOR_PERMUTATION_SOLUTION_REGISTRY_HPP
 #define HIPTENSOR_PERMUTATION_SOLUTION_REGISTRY_HPP
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -38,20 +40,27 @@
 namespace hiptensor
 {
     class PermutationSolution;
+    struct PermutationSolutionFamily;
 
     class PermutationSolutionRegistry
     {
+    public:
+        using SolutionMap       = std::unordered_map<Uid, std::unique_ptr<PermutationSolution>>;
+        using SolutionGenerator = std::function<SolutionMap()>;
+
     protected:
-        // Move only
-        PermutationSolutionRegistry()                                              = default;
-        PermutationSolutionRegistry(PermutationSolutionRegistry&&)                 = default;
-        PermutationSolutionRegistry& operator=(PermutationSolutionRegistry&&)      = default;
+        // Non-movable: solutions and families are guarded by the registry mutex
+        PermutationSolutionRegistry();
+        PermutationSolutionRegistry(PermutationSolutionRegistry&&)                 = delete;
+        PermutationSolutionRegistry& operator=(PermutationSolutionRegistry&&)      = delete;
         PermutationSolutionRegistry(PermutationSolutionRegistry const&)            = delete;
         PermutationSolutionRegistry& operator=(PermutationSolutionRegistry const&) = delete;
 
         // Import permutation solutions for the registry to manage
-        void registerSolutions(
-            std::unordered_map<Uid, std::unique_ptr<PermutationSolution>>&& solutions);
+        void registerSolutions(SolutionMap&& solutions);
+
+        // Defer a family of solutions until the first query that may select them
+        void registerSolutionFamily(PermutationSolutionFamily&& family);
 
     public:
         virtual ~PermutationSolutionRegistry() = default;
@@ -62,11 +71,32 @@ namespace hiptensor
                                                 const hiptensorTensorDescriptor_t* descB,
                                                 const int32_t                      modeB[],
                                                 const hipDataType                  typeScalar,
-                                                PermutationInstanceType_t instanceType) const;
-        uint32_t                          solutionCount() const;
+                                                PermutationInstanceType_t          instanceType);
+
+        // Number of solutions instantiated so far
+        uint32_t solutionCount() const;
+
+        // True if any solution is registered, instantiated or not
+        bool hasSolutions() const;
 
     private:
-        std::unordered_map<Uid, std::unique_ptr<PermutationSolution>> mAllSolutions;
+        struct Family
+        {
+            SolutionGenerator mGenerate;
+            bool              mLoaded;
+        };
+
+        void loadFamilies(std::size_t familyHash);
+
+    private:
+        SolutionMap mAllSolutions;
+
+        // Deferred families, keyed by type, element-wise ops and rank
+        std::vector<Family>                                    mFamilies;
+        std::unordered_map<std::size_t, std::vector<uint32_t>> mFamilyIndex;
+        uint32_t                                               mPendingFamilies;
+
+        mutable std::mutex mMutex;
     };
 
 } // namespace hiptensor
@@ -27,6 +27,8 @@
 #include <set>
 #include <unordered_set>
 
+#include "api_recorder.hpp"
+#include "device_scalars.hpp"
 #include "handle.hpp"
 #include "hip_device.hpp"
 #include "logger.hpp"
@@ -218,6 +220,112 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
 
     logger->logAPITrace("hiptensorReduction", msg);
 
+    // Planar complex tensors are summed one plane at a time, as real tensors. Only a sum
+    // keeps the planes independent, and only real alpha and beta scale each plane alone.
+    if(descA && descC && descD
+       && (descA->mPlaneStride != 0 || descC->mPlaneStride != 0 || descD->mPlaneStride != 0))
+    {
+        auto realType    = descA->mType == HIP_C_32F ? HIP_R_32F : HIP_R_64F;
+        auto realCompute = realType == HIP_R_32F ? HIPTENSOR_COMPUTE_32F : HIPTENSOR_COMPUTE_64F;
+        auto isPlanar    = [descA](const hiptensorTensorDescriptor_t* desc) {
+            return desc->mType == descA->mType && desc->mPlaneStride != 0
+                   && desc->mUnaryOp == HIPTENSOR_OP_IDENTITY;
+        };
+
+        if((descA->mType != HIP_C_32F && descA->mType != HIP_C_64F) || !isPlanar(descA)
+           || !isPlanar(descC) || !isPlanar(descD) || opReduce != HIPTENSOR_OP_ADD
+           || (typeCompute != realCompute
+               && typeCompute
+                      != (realType == HIP_R_32F ? HIPTENSOR_COMPUTE_C32F : HIPTENSOR_COMPUTE_C64F)))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Planar Tensor Error : A, C and D must all be planar complex "
+                     "tensors of one type with identity ops, reduced with HIPTENSOR_OP_ADD (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError("hiptensorReduction", msg);
+            return errorCode;
+        }
+
+        // Complex scalars are accepted when their imaginary parts are zero. In device pointer
+        // mode they can not be checked without a host sync, so they must be given as real.
+        if(handle && typeCompute != realCompute)
+        {
+            auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+            auto imagPart   = [realType](const void* scalar) {
+                return realType == HIP_R_32F ? double(static_cast<const float*>(scalar)[1])
+                                             : static_cast<const double*>(scalar)[1];
+            };
+            if(realHandle->pointerMode() == HIPTENSOR_POINTER_MODE_DEVICE
+               || (alpha && imagPart(alpha) != 0.0) || (beta && imagPart(beta) != 0.0))
+            {
+                auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+                snprintf(msg,
+                         sizeof(msg),
+                         "Unsupported Planar Tensor Error : alpha and beta of a planar "
+                         "reduction must be real host scalars (%s)",
+                         hiptensorGetErrorString(errorCode));
+                logger->logError("hiptensorReduction", msg);
+                return errorCode;
+            }
+        }
+
+        auto planeA = *descA;
+        auto planeC = *descC;
+        auto planeD = *descD;
+        for(auto* plane : {&planeA, &planeC, &planeD})
+        {
+            plane->mType        = realType;
+            plane->mPlaneStride = 0;
+        }
+
+        auto imagPlane = [elementBytes = hiptensor::hipDataTypeSize(realType)](
+                             const void* ptr, std::size_t planeStride) -> const void* {
+            return ptr ? static_cast<const char*>(ptr) + planeStride * elementBytes : nullptr;
+        };
+
+        // A complex scalar read at real precision is its real part
+        auto errorCode = hiptensorReduction(handle,
+                                            alpha,
+                                            A,
+                                            &planeA,
+                                            modeA,
+                                            beta,
+                                            C,
+                                            &planeC,
+                                            modeC,
+                                            D,
+                                            &planeD,
+                                            modeD,
+                                            opReduce,
+                                            realCompute,
+                                            workspace,
+                                            workspaceSize,
+                                            stream);
+        if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            errorCode = hiptensorReduction(handle,
+                                           alpha,
+                                           imagPlane(A, descA->mPlaneStride),
+                                           &planeA,
+                                           modeA,
+                                           beta,
+                                           imagPlane(C, descC->mPlaneStride),
+                                           &planeC,
+                                           modeC,
+                                           const_cast<void*>(imagPlane(D, descD->mPlaneStride)),
+                                           &planeD,
+                                           modeD,
+                                           opReduce,
+                                           realCompute,
+                                           workspace,
+                                           workspaceSize,
+                                           stream);
+        }
+        return errorCode;
+    }
+
     if(auto errorCode = checkReductionInputData(handle,
                                                 alpha,
                                                 A,
@@ -239,8 +347,25 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
         return errorCode;
     }
 
+    auto realHandle    = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto deviceScalars = realHandle->pointerMode() == HIPTENSOR_POINTER_MODE_DEVICE;
+
+    hiptensor::ApiRecorder::instance()->recordReduction(alpha,
+                                                        descA,
+                                                        modeA,
+                                                        beta,
+                                                        descC,
+                                                        modeC,
+                                                        descD,
+                                                        modeD,
+                                                        opReduce,
+                                                        typeCompute,
+                                                        workspaceSize,
+                                                        deviceScalars,
+                                                        stream);
+
     auto& instances = hiptensor::ReductionSolutionInstances::instance();
-    if(instances->solutionCount() == 0)
+    if(!instances->hasSolutions())
     {
         auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
         snprintf(msg,
@@ -284,36 +409,73 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
         return errorCode;
     }
 
-    double alphaD;
-    if(alpha != nullptr)
+    // In device pointer mode the reduction is unscaled, and alpha and beta are applied by a
+    // second kernel that reads them from device memory. The reduction is written to D,
+    // unless D is C and C must be read after the reduction.
+    void*                                 E        = D;
+    auto                                  stridesE = descD->mStrides;
+    hiptensor::WorkspaceArena::Allocation reduced;
+
+    double alphaD = 1.0;
+    double betaD  = 0.0;
+    if(deviceScalars)
     {
-        alphaD = hiptensor::readVal<double>(alpha, typeCompute);
+        if(C != nullptr && C == D)
+        {
+            reduced = realHandle->workspaceArena().allocate(
+                hiptensor::elementsFromLengths(descD->mLengths)
+                    * hiptensor::hipDataTypeSize(descD->mType),
+                stream);
+            if(reduced.get() == nullptr)
+            {
+                auto errorCode = HIPTENSOR_STATUS_ALLOC_FAILED;
+                snprintf(msg,
+                         sizeof(msg),
+                         "Unable to allocate the unscaled reduction (%s)",
+                         hiptensorGetErrorString(errorCode));
+                logger->logError("hiptensorReduction", msg);
+                return errorCode;
+            }
+            E        = reduced.get();
+            stridesE = hiptensor::stridesFromLengths(descD->mLengths);
+        }
     }
-    double betaD;
-    if(beta != nullptr)
+    else
     {
-        betaD = hiptensor::readVal<double>(beta, typeCompute);
-    }
+        if(alpha != nullptr)
+        {
+            alphaD = hiptensor::readVal<double>(alpha, typeCompute);
+        }
+        if(beta != nullptr)
+        {
+            betaD = hiptensor::readVal<double>(beta, typeCompute);
+        }
 
-    if(C && C != D)
-    {
-        // CK API can only process $D = alpha * reduce(A) + beta * D$
-        // Need to copy C to D if C != D
-        CHECK_HIP_ERROR(hipMemcpy(D,
-                                  C,
-                                  hiptensor::elementsFromLengths(descC->mLengths)
-                                      * hiptensor::hipDataTypeSize(descC->mType),
-                                  hipMemcpyDeviceToDevice));
+        if(C && C != D)
+        {
+            // CK API can only process $D = alpha * reduce(A) + beta * D$
+            // Need to copy C to D if C != D
+            CHECK_HIP_ERROR(hipMemcpyAsync(D,
+                                           C,
+                                           hiptensor::elementsFromLengths(descC->mLengths)
+                                               * hiptensor::hipDataTypeSize(descC->mType),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+        }
     }
 
-    for(auto [_, pSolution] : solutionQ.solutions())
+    // Captured work is not timed: timing repeats the kernel and waits for it on the host
+    auto timed = (logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+                 && !hiptensor::isStreamCapturing(stream);
+
+    for(auto* pSolution : solutionQ.solutionList())
     {
         using hiptensor::HiptensorOptions;
         auto& options = HiptensorOptions::instance();
 
         // Perform reduction with timing if LOG_LEVEL_PERF_TRACE
         auto streamConfig =
-            (logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE) ?
+            timed ?
             StreamConfig{
                 stream, // stream id
                 true, // time_kernel
@@ -326,12 +488,12 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
                                                 descA->mStrides,
                                                 {modeA, modeA + descA->mLengths.size()},
                                                 descD->mLengths,
-                                                descD->mStrides,
+                                                stridesE,
                                                 {modeD, modeD + descD->mLengths.size()},
                                                 alphaD,
                                                 betaD,
                                                 A,
-                                                D,
+                                                E,
                                                 opReduce,
                                                 streamConfig);
         if(isSupported)
@@ -340,7 +502,7 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
             {
                 return HIPTENSOR_STATUS_CK_ERROR;
             }
-            if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+            if(timed)
             {
 
                 int  n     = pSolution->problemDim();
@@ -367,6 +529,31 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
                 logger->logPerformanceTrace("hiptensorReduction", msg);
             }
 
+            if(deviceScalars)
+            {
+                auto errorCode = hiptensor::applyDeviceScalars(alpha,
+                                                               E,
+                                                               stridesE,
+                                                               beta,
+                                                               C,
+                                                               descC->mStrides,
+                                                               D,
+                                                               descD->mLengths,
+                                                               descD->mStrides,
+                                                               descD->mType,
+                                                               typeCompute,
+                                                               stream);
+                if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+                {
+                    snprintf(msg,
+                             sizeof(msg),
+                             "Unable to apply the device scalars (%s)",
+                             hiptensorGetErrorString(errorCode));
+                    logger->logError("hiptensorReduction", msg);
+                }
+                return errorCode;
+            }
+
             return HIPTENSOR_STATUS_SUCCESS;
         }
     }
@@ -87,7 +87,7 @@ hiptensorStatus_t hiptensorReductionReference(const void*
                                   hipMemcpyHostToHost));
     }
 
-    for(auto [_, pSolution] : solutionQ.solutions())
+    for(auto* pSolution : solutionQ.solutionList())
     {
         // Perform reduction with timing if LOG_LEVEL_PERF_TRACE
         auto streamConfig        = StreamConfig{stream, false};
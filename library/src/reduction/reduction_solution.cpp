@@ -37,7 +37,12 @@ namespace hiptensor
         , mValid(false)
         , mDeviceOp(std::move(deviceOp))
         , mParams(std::move(params))
+        , mRegistry(nullptr)
+        , mRegistryIndex(0u)
     {
+        // Convert CK uid string into binary once; it is queried on every registry lookup.
+        std::istringstream converter(mDeviceOp->GetTypeIdHashCode());
+        converter >> std::hex >> mUid;
     }
 
     ReductionSolution::ReductionSolution(ReductionSolution&& other)
@@ -48,6 +53,9 @@ namespace hiptensor
         , mParams(std::move(other.mParams))
         , mInvokerArgPtr(std::move(other.mInvokerArgPtr))
         , mInvokerPtr(std::move(other.mInvokerPtr))
+        , mUid(other.mUid)
+        , mRegistry(other.mRegistry)
+        , mRegistryIndex(other.mRegistryIndex)
     {
     }
 
@@ -64,6 +72,10 @@ namespace hiptensor
             mDeviceOp      = std::move(other.mDeviceOp);
             mInvokerArgPtr = std::move(other.mInvokerArgPtr);
             mInvokerPtr    = std::move(other.mInvokerPtr);
+
+            mUid           = other.mUid;
+            mRegistry      = other.mRegistry;
+            mRegistryIndex = other.mRegistryIndex;
         }
         return *this;
     }
@@ -114,11 +126,17 @@ namespace hiptensor
 
     size_t ReductionSolution::uid() const
     {
-        // Convert CK uid string into binary.
-        std::istringstream converter(mDeviceOp->GetTypeIdHashCode());
-        size_t             value;
-        converter >> std::hex >> value;
-        return value;
+        return mUid;
+    }
+
+    ReductionSolutionRegistry* ReductionSolution::registry() const
+    {
+        return mRegistry;
+    }
+
+    uint32_t ReductionSolution::registryIndex() const
+    {
+        return mRegistryIndex;
     }
 
     uint32_t ReductionSolution::threadDim() const
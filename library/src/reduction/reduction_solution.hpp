@@ -39,9 +39,14 @@
 
 namespace hiptensor
 {
+    class ReductionSolutionRegistry;
+
     class ReductionSolution
     {
     public:
+        // Assigns the registry index
+        friend class ReductionSolutionRegistry;
+
         // Due to unique_ptr ownership of members,
         // ReductionSolutions should also be considered unique.
         // This means disabling default and copy ctor
@@ -95,6 +100,10 @@ namespace hiptensor
         // Unique ID for the kernel
         size_t uid() const;
 
+        // Owning registry and dense index within it, if registered
+        ReductionSolutionRegistry* registry() const;
+        uint32_t                   registryIndex() const;
+
         // Get Number of threads across dimension
         uint32_t threadDim() const;
 
@@ -125,6 +134,13 @@ namespace hiptensor
         std::unique_ptr<ck::tensor_operation::device::BaseOperator> mDeviceOp;
         std::unique_ptr<ck::tensor_operation::device::BaseArgument> mInvokerArgPtr;
         std::unique_ptr<ck::tensor_operation::device::BaseInvoker>  mInvokerPtr;
+
+        // Cached kernel uid
+        size_t mUid;
+
+        // Registry index
+        ReductionSolutionRegistry* mRegistry;
+        uint32_t                   mRegistryIndex;
     };
 
     template <typename InDataType,
@@ -137,6 +153,25 @@ namespace hiptensor
               bool                OutputIndex>
     auto enumerateReductionSolutions();
 
+    // Solutions enumerated by one enumerateReductionSolutions instantiation.
+    // Params carry the solution hash shared by the whole family so that
+    // registries can defer instantiating device ops until they are queried.
+    struct ReductionSolutionFamily
+    {
+        std::unique_ptr<ReductionSolutionParams>                         mParams;
+        std::function<std::vector<std::unique_ptr<ReductionSolution>>()> mGenerate;
+    };
+
+    template <typename InDataType,
+              typename AccDataType,
+              typename OutDataType,
+              int                 Rank,
+              int                 NumReduceDim,
+              hiptensorOperator_t opReduce,
+              bool                PropagateNan,
+              bool                OutputIndex>
+    ReductionSolutionFamily reductionSolutionFamily();
+
 } // namespace hiptensor
 
 #include "reduction_solution_impl.hpp"
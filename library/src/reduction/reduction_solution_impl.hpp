@@ -285,6 +285,47 @@ namespace hiptensor
         return result;
     }
 
+    template <typename InDataType,
+              typename AccDataType,
+              typename OutDataType,
+              int                 Rank,
+              int                 NumReduceDim,
+              hiptensorOperator_t opReduce,
+              bool                PropagateNan,
+              bool                OutputIndex>
+    ReductionSolutionFamily reductionSolutionFamily()
+    {
+        constexpr auto ReduceOpId = convertHiptensorReduceOperatorToCk<opReduce>();
+
+        using ReduceOperation = typename ck::reduce_binary_operator<ReduceOpId>::opType;
+        using InElementwiseOperation =
+            typename ck::reduce_unary_operator<ReduceOpId, true, true>::InElementwiseOperation;
+        using AccElementwiseOperation =
+            typename ck::reduce_unary_operator<ReduceOpId, true, true>::AccElementwiseOperation;
+
+        using DeviceOp = ck::tensor_operation::device::DeviceReduce<InDataType,
+                                                                    AccDataType,
+                                                                    OutDataType,
+                                                                    Rank,
+                                                                    NumReduceDim,
+                                                                    ReduceOperation,
+                                                                    InElementwiseOperation,
+                                                                    AccElementwiseOperation,
+                                                                    PropagateNan,
+                                                                    OutputIndex>;
+
+        // Params only depend on the op type, no device op is constructed here
+        return {std::make_unique<ReductionSolutionParamsImpl<DeviceOp>>(),
+                &enumerateReductionSolutions<InDataType,
+                                             AccDataType,
+                                             OutDataType,
+                                             Rank,
+                                             NumReduceDim,
+                                             opReduce,
+                                             PropagateNan,
+                                             OutputIndex>};
+    }
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_REDUCTION_SOLUTION_IMPL_HPP
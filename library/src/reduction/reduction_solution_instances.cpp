@@ -25,104 +25,24 @@
  *******************************************************************************/
 
 #include "reduction_solution_instances.hpp"
-#include "hiptensor/internal/types.hpp"
 #include "reduction_solution.hpp"
-
-// Ensure access to
-// #include "device/hiptensor_reduction_scale_instances.hpp"
+#include "kernel_modules.hpp"
 
 namespace hiptensor
 {
     ReductionSolutionInstances::ReductionSolutionInstances()
     {
-
-        // add entries to mSolutionQuery
-        genReductionSolution1x1BF16F32Instances();
-        genReductionSolution2x1BF16F32Instances();
-        genReductionSolution2x2BF16F32Instances();
-        genReductionSolution3x1BF16F32Instances();
-        genReductionSolution3x2BF16F32Instances();
-        genReductionSolution3x3BF16F32Instances();
-        genReductionSolution4x1BF16F32Instances();
-        genReductionSolution4x2BF16F32Instances();
-        genReductionSolution4x3BF16F32Instances();
-        genReductionSolution4x4BF16F32Instances();
-        genReductionSolution5x1BF16F32Instances();
-        genReductionSolution5x2BF16F32Instances();
-        genReductionSolution5x3BF16F32Instances();
-        genReductionSolution5x4BF16F32Instances();
-        genReductionSolution5x5BF16F32Instances();
-        genReductionSolution6x1BF16F32Instances();
-        genReductionSolution6x2BF16F32Instances();
-        genReductionSolution6x3BF16F32Instances();
-        genReductionSolution6x4BF16F32Instances();
-        genReductionSolution6x5BF16F32Instances();
-        genReductionSolution6x6BF16F32Instances();
-
-        genReductionSolution1x1F16F32Instances();
-        genReductionSolution2x1F16F32Instances();
-        genReductionSolution2x2F16F32Instances();
-        genReductionSolution3x1F16F32Instances();
-        genReductionSolution3x2F16F32Instances();
-        genReductionSolution3x3F16F32Instances();
-        genReductionSolution4x1F16F32Instances();
-        genReductionSolution4x2F16F32Instances();
-        genReductionSolution4x3F16F32Instances();
-        genReductionSolution4x4F16F32Instances();
-        genReductionSolution5x1F16F32Instances();
-        genReductionSolution5x2F16F32Instances();
-        genReductionSolution5x3F16F32Instances();
-        genReductionSolution5x4F16F32Instances();
-        genReductionSolution5x5F16F32Instances();
-        genReductionSolution6x1F16F32Instances();
-        genReductionSolution6x2F16F32Instances();
-        genReductionSolution6x3F16F32Instances();
-        genReductionSolution6x4F16F32Instances();
-        genReductionSolution6x5F16F32Instances();
-        genReductionSolution6x6F16F32Instances();
-
-        genReductionSolution1x1F32F32Instances();
-        genReductionSolution2x1F32F32Instances();
-        genReductionSolution2x2F32F32Instances();
-        genReductionSolution3x1F32F32Instances();
-        genReductionSolution3x2F32F32Instances();
-        genReductionSolution3x3F32F32Instances();
-        genReductionSolution4x1F32F32Instances();
-        genReductionSolution4x2F32F32Instances();
-        genReductionSolution4x3F32F32Instances();
-        genReductionSolution4x4F32F32Instances();
-        genReductionSolution5x1F32F32Instances();
-        genReductionSolution5x2F32F32Instances();
-        genReductionSolution5x3F32F32Instances();
-        genReductionSolution5x4F32F32Instances();
-        genReductionSolution5x5F32F32Instances();
-        genReductionSolution6x1F32F32Instances();
-        genReductionSolution6x2F32F32Instances();
-        genReductionSolution6x3F32F32Instances();
-        genReductionSolution6x4F32F32Instances();
-        genReductionSolution6x5F32F32Instances();
-        genReductionSolution6x6F32F32Instances();
-
-        genReductionSolution1x1F64F64Instances();
-        genReductionSolution2x1F64F64Instances();
-        genReductionSolution2x2F64F64Instances();
-        genReductionSolution3x1F64F64Instances();
-        genReductionSolution3x2F64F64Instances();
-        genReductionSolution3x3F64F64Instances();
-        genReductionSolution4x1F64F64Instances();
-        genReductionSolution4x2F64F64Instances();
-        genReductionSolution4x3F64F64Instances();
-        genReductionSolution4x4F64F64Instances();
-        genReductionSolution5x1F64F64Instances();
-        genReductionSolution5x2F64F64Instances();
-        genReductionSolution5x3F64F64Instances();
-        genReductionSolution5x4F64F64Instances();
-        genReductionSolution5x5F64F64Instances();
-        genReductionSolution6x1F64F64Instances();
-        genReductionSolution6x2F64F64Instances();
-        genReductionSolution6x3F64F64Instances();
-        genReductionSolution6x4F64F64Instances();
-        genReductionSolution6x5F64F64Instances();
-        genReductionSolution6x6F64F64Instances();
+#if HIPTENSOR_KERNEL_MODULES
+        // Device instances are packaged in a separate module, opened on first use.
+        // If the module is missing the registry stays empty.
+        using EntryT = void (*)(ReductionSolutionInstances*);
+        if(auto entry = reinterpret_cast<EntryT>(KernelModules::instance()->symbol(
+               KernelModule_t::REDUCTION, "hiptensorRegisterReductionKernels")))
+        {
+            entry(this);
+        }
+#else
+        registerInstances();
+#endif // HIPTENSOR_KERNEL_MODULES
     }
 } // namespace hiptensor
@@ -29,42 +29,57 @@
 
 #include <memory>
 
+#include "kernel_modules.hpp"
 #include "reduction_solution_registry.hpp"
 #include "singleton.hpp"
 
+// Instance sources left out by HIPTENSOR_INSTANCE_PROFILE register nothing
+#if HIPTENSOR_INSTANCE_PRUNED
+#define REG_REDUCTION_SOLUTION(dim_count, reduced_dim_count, type, computeType)
+#else
 #define REG_REDUCTION_SOLUTION(dim_count, reduced_dim_count, type, computeType) \
-    registerSolutions(enumerateReductionSolutions<type,                         \
-                                                  computeType,                  \
-                                                  type,                         \
-                                                  dim_count,                    \
-                                                  reduced_dim_count,            \
-                                                  HIPTENSOR_OP_ADD,             \
-                                                  true,                         \
-                                                  false>());                    \
-    registerSolutions(enumerateReductionSolutions<type,                         \
-                                                  computeType,                  \
-                                                  type,                         \
-                                                  dim_count,                    \
-                                                  reduced_dim_count,            \
-                                                  HIPTENSOR_OP_MUL,             \
-                                                  true,                         \
-                                                  false>());                    \
-    registerSolutions(enumerateReductionSolutions<type,                         \
-                                                  computeType,                  \
-                                                  type,                         \
-                                                  dim_count,                    \
-                                                  reduced_dim_count,            \
-                                                  HIPTENSOR_OP_MIN,             \
-                                                  true,                         \
-                                                  false>());                    \
-    registerSolutions(enumerateReductionSolutions<type,                         \
-                                                  computeType,                  \
-                                                  type,                         \
-                                                  dim_count,                    \
-                                                  reduced_dim_count,            \
-                                                  HIPTENSOR_OP_MAX,             \
-                                                  true,                         \
-                                                  false>());
+    registerSolutionFamily(reductionSolutionFamily<type,                        \
+                                                   computeType,                 \
+                                                   type,                        \
+                                                   dim_count,                   \
+                                                   reduced_dim_count,           \
+                                                   HIPTENSOR_OP_ADD,            \
+                                                   true,                        \
+                                                   false>());                   \
+    registerSolutionFamily(reductionSolutionFamily<type,                        \
+                                                   computeType,                 \
+                                                   type,                        \
+                                                   dim_count,                   \
+                                                   reduced_dim_count,           \
+                                                   HIPTENSOR_OP_MUL,            \
+                                                   true,                        \
+                                                   false>());                   \
+    registerSolutionFamily(reductionSolutionFamily<type,                        \
+                                                   computeType,                 \
+                                                   type,                        \
+                                                   dim_count,                   \
+                                                   reduced_dim_count,           \
+                                                   HIPTENSOR_OP_MIN,            \
+                                                   true,                        \
+                                                   false>());                   \
+    registerSolutionFamily(reductionSolutionFamily<type,                        \
+                                                   computeType,                 \
+                                                   type,                        \
+                                                   dim_count,                   \
+                                                   reduced_dim_count,           \
+                                                   HIPTENSOR_OP_MAX,            \
+                                                   true,                        \
+                                                   false>());
+#endif // HIPTENSOR_INSTANCE_PRUNED
+
+namespace hiptensor
+{
+    class ReductionSolutionInstances;
+}
+
+// Entry point of the reduction kernel module: registers the device instance families
+HIPTENSOR_KERNEL_MODULE_ENTRY void
+    hiptensorRegisterReductionKernels(hiptensor::ReductionSolutionInstances* instances);
 
 namespace hiptensor
 {
@@ -76,9 +91,15 @@ namespace hiptensor
         friend std::unique_ptr<ReductionSolutionInstances>
             std::make_unique<ReductionSolutionInstances>();
 
+        // Registers the device instance families from within the kernel module
+        friend void ::hiptensorRegisterReductionKernels(ReductionSolutionInstances* instances);
+
         ~ReductionSolutionInstances() = default;
 
     private:
+        // Registers every device instance family exactly once
+        void registerInstances();
+
         // Singleton: only one instance
         ReductionSolutionInstances();
         ReductionSolutionInstances(ReductionSolutionInstances const&)            = delete;
@@ -35,8 +35,9 @@ namespace hiptensor
 
     // @cond
     ReductionSolutionRegistry::Query::Query(Query const& other)
-        : mAllSolutions(other.mAllSolutions)
-        , mSolutionHash(other.mSolutionHash)
+        : mRegistry(other.mRegistry)
+        , mAll(other.mAll)
+        , mSelection(other.mSelection)
     {
     }
 
@@ -45,8 +46,11 @@ namespace hiptensor
     {
         if(&other != this)
         {
-            mAllSolutions = other.mAllSolutions;
-            mSolutionHash = other.mSolutionHash;
+            mRegistry         = other.mRegistry;
+            mAll              = other.mAll;
+            mSelection        = other.mSelection;
+            mSolutionMapValid = false;
+            mSolutionMap.clear();
         }
 
         return *this;
@@ -62,52 +66,95 @@ namespace hiptensor
                                                 bool                   propagateNan,
                                                 bool                   outputIndex) const
     {
-        auto solutionHash = hashSolution(
-            typeIn, typeAcc, typeOut, rank, numReduceDim, opReduce, propagateNan, outputIndex);
-
-        if(auto solutions = mSolutionHash.find(solutionHash); solutions != mSolutionHash.end())
-        {
-            return Query(mSolutionHash.at(solutionHash));
-        }
-
-        return Query();
+        return query(hashSolution(
+            typeIn, typeAcc, typeOut, rank, numReduceDim, opReduce, propagateNan, outputIndex));
     }
 
     ReductionSolutionRegistry::Query
         ReductionSolutionRegistry::Query::operator||(Query const& other) const
     {
+        if(mRegistry == nullptr || other.mAll)
+        {
+            return other;
+        }
+
         auto newQuery = *this;
-        newQuery.addSolutions(other.mAllSolutions);
+        if(!mAll && other.mRegistry == mRegistry)
+        {
+            newQuery.mSelection |= other.mSelection;
+        }
         return newQuery;
     }
 
     ReductionSolutionRegistry::Query
         ReductionSolutionRegistry::Query::operator&&(Query const& other) const
     {
-        auto newQuery = Query();
-
-        // Add only if both queries have the solution
-        for(auto& solutionPair : other.mAllSolutions)
+        if(other.mRegistry != mRegistry)
         {
-            if(auto solution = mAllSolutions.find(solutionPair.first);
-               solution != mAllSolutions.end())
-            {
-                newQuery.addSolution(solutionPair.second);
-            }
+            return Query();
+        }
+        else if(mAll)
+        {
+            return other;
+        }
+        else if(other.mAll)
+        {
+            return *this;
         }
 
+        // Keep only solutions present in both queries
+        auto newQuery = *this;
+        newQuery.mSelection &= other.mSelection;
         return newQuery;
     }
 
     std::unordered_map<ReductionSolutionRegistry::Query::Uid, ReductionSolution*> const&
         ReductionSolutionRegistry::Query::solutions() const
     {
-        return mAllSolutions;
+        if(mRegistry == nullptr)
+        {
+            return mSolutionMap;
+        }
+
+        std::lock_guard<std::mutex> lock(mRegistry->mMutex);
+        if(!mSolutionMapValid)
+        {
+            auto& selected = selection();
+            mSolutionMap.clear();
+            mSolutionMap.reserve(selected.count());
+            selected.forEach([this](uint32_t index) {
+                auto* solution = mRegistry->mSolutionIndex[index];
+                mSolutionMap.emplace(solution->uid(), solution);
+            });
+            mSolutionMapValid = true;
+        }
+
+        return mSolutionMap;
+    }
+
+    std::vector<ReductionSolution*> ReductionSolutionRegistry::Query::solutionList() const
+    {
+        auto result = std::vector<ReductionSolution*>();
+        if(mRegistry != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(mRegistry->mMutex);
+            auto&                       selected = selection();
+            result.reserve(selected.count());
+            selected.forEach(
+                [&](uint32_t index) { result.push_back(mRegistry->mSolutionIndex[index]); });
+        }
+        return result;
     }
 
     uint32_t ReductionSolutionRegistry::Query::solutionCount() const
     {
-        return mAllSolutions.size();
+        if(mRegistry == nullptr)
+        {
+            return 0u;
+        }
+
+        std::lock_guard<std::mutex> lock(mRegistry->mMutex);
+        return selection().count();
     }
 
     ///////////////
@@ -116,19 +163,62 @@ namespace hiptensor
 
     ReductionSolutionRegistry::Query::Query(std::vector<ReductionSolution*> const& solutions)
     {
-        addSolutions(solutions);
+        for(auto* solution : solutions)
+        {
+            if(mRegistry == nullptr)
+            {
+                mRegistry = solution->registry();
+            }
+
+            if(solution->registry() == mRegistry && mRegistry != nullptr)
+            {
+                mSelection.set(solution->registryIndex());
+            }
+        }
+    }
+
+    ReductionSolutionRegistry::Query::Query(ReductionSolutionRegistry* registry,
+                                            SolutionBitset const&      selection)
+        : mRegistry(registry)
+        , mSelection(selection)
+    {
     }
 
     ReductionSolutionRegistry::Query ReductionSolutionRegistry::Query::query(HashId queryHash) const
     {
-        if(auto solutions = mSolutionHash.find(queryHash); solutions != mSolutionHash.end())
+        if(mRegistry != nullptr)
         {
-            return Query(mSolutionHash.at(queryHash));
+            std::lock_guard<std::mutex> lock(mRegistry->mMutex);
+
+            // Only families that may match are instantiated
+            mRegistry->loadFamilies(queryHash);
+
+            auto& attributes = mRegistry->mAttributeIndex;
+            if(auto attribute = attributes.find(queryHash); attribute != attributes.end())
+            {
+                auto newQuery = Query(mRegistry, attribute->second);
+                if(!mAll)
+                {
+                    newQuery.mSelection &= mSelection;
+                }
+                return newQuery;
+            }
         }
 
         return Query();
     }
 
+    SolutionBitset const& ReductionSolutionRegistry::Query::selection() const
+    {
+        if(mAll)
+        {
+            mRegistry->loadAllFamilies();
+            return mRegistry->mIndexedSolutions;
+        }
+
+        return mSelection;
+    }
+
     /* static */
     ReductionSolutionRegistry::Query::HashId
         ReductionSolutionRegistry::Query::hashSolution(hipDataType            typeIn,
@@ -144,16 +234,69 @@ namespace hiptensor
             typeIn, typeAcc, typeOut, rank, numReduceDim, opReduce, propagateNan, outputIndex);
     }
 
-    void ReductionSolutionRegistry::Query::addSolution(ReductionSolution* solution)
+    /////////////////////////////////////////
+    /// Class ReductionSolutionRegistry ///
+    /////////////////////////////////////////
+
+    ReductionSolutionRegistry::ReductionSolutionRegistry()
+        : mPendingFamilies(0u)
+    {
+        mSolutionQuery.mRegistry = this;
+        mSolutionQuery.mAll      = true;
+    }
+
+    void ReductionSolutionRegistry::registerSolutions(
+        std::vector<std::unique_ptr<ReductionSolution>>&& solutions)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for(auto&& solution : solutions)
+        {
+            // Index the solution then take ownership
+            indexSolution(solution.get());
+            mSolutionStorage.push_back(std::move(solution));
+        }
+    }
+
+    void ReductionSolutionRegistry::registerSolutionFamily(ReductionSolutionFamily&& family)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto familyIndex = static_cast<uint32_t>(mFamilies.size());
+        mFamilies.push_back({std::move(family.mGenerate), false});
+        mPendingFamilies++;
+
+        // Same key as the solution hash of every member of the family
+        auto familyHash = std::hash<hiptensor::ReductionSolutionParams>{}(*family.mParams);
+        mFamilyIndex[familyHash].push_back(familyIndex);
+    }
+
+    uint32_t ReductionSolutionRegistry::solutionCount() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mSolutionStorage.size();
+    }
+
+    bool ReductionSolutionRegistry::hasSolutions() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return !mSolutionStorage.empty() || mPendingFamilies != 0u;
+    }
+
+    void ReductionSolutionRegistry::indexSolution(ReductionSolution* solution)
     {
         // Acquire unique ID and category ID per solution
         auto solutionUid = solution->uid();
+        auto index       = static_cast<uint32_t>(mSolutionIndex.size());
 
-        if(auto const& result = mAllSolutions.emplace(std::make_pair(solutionUid, solution));
-           result.second == true)
+        if(auto const& result = mUidIndex.emplace(solutionUid, index); result.second == true)
         {
             auto solutionHash = std::hash<hiptensor::ReductionSolution>{}(*solution);
-            mSolutionHash[solutionHash].push_back(solution);
+
+            solution->mRegistry      = this;
+            solution->mRegistryIndex = index;
+            mSolutionIndex.push_back(solution);
+            mIndexedSolutions.set(index);
+
+            mAttributeIndex[solutionHash].set(index);
         }
         else
         {
@@ -163,42 +306,52 @@ namespace hiptensor
         }
     }
 
-    void ReductionSolutionRegistry::Query::addSolutions(
-        std::vector<ReductionSolution*> const& solutions)
+    void ReductionSolutionRegistry::loadFamilies(Query::HashId attribute)
     {
-        for(auto* soln : solutions)
+        if(mPendingFamilies == 0u)
         {
-            addSolution(soln);
+            return;
+        }
+
+        if(auto families = mFamilyIndex.find(attribute); families != mFamilyIndex.end())
+        {
+            for(auto familyIndex : families->second)
+            {
+                loadFamily(mFamilies[familyIndex]);
+            }
         }
     }
 
-    void ReductionSolutionRegistry::Query::addSolutions(
-        std::unordered_map<Uid, ReductionSolution*> const& solutions)
+    void ReductionSolutionRegistry::loadAllFamilies()
     {
-        for(auto& solutionPair : solutions)
+        for(auto& family : mFamilies)
         {
-            addSolution(solutionPair.second);
+            if(mPendingFamilies == 0u)
+            {
+                break;
+            }
+            loadFamily(family);
         }
     }
 
-    /////////////////////////////////////////
-    /// Class ReductionSolutionRegistry ///
-    /////////////////////////////////////////
-
-    void ReductionSolutionRegistry::registerSolutions(
-        std::vector<std::unique_ptr<ReductionSolution>>&& solutions)
+    void ReductionSolutionRegistry::loadFamily(Family& family)
     {
-        for(auto&& solution : solutions)
+        if(family.mLoaded)
         {
-            // Register with the query then take ownership
-            mSolutionQuery.addSolution(solution.get());
+            return;
+        }
+
+        family.mLoaded = true;
+        mPendingFamilies--;
+
+        for(auto&& solution : family.mGenerate())
+        {
+            indexSolution(solution.get());
             mSolutionStorage.push_back(std::move(solution));
         }
-    }
 
-    uint32_t ReductionSolutionRegistry::solutionCount() const
-    {
-        return mSolutionStorage.size();
+        // Release the generator's captures
+        family.mGenerate = nullptr;
     }
     // @endcond
 
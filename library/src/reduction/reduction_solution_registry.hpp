@@ -27,18 +27,22 @@
 #ifndef HIPTENSOR_REDUCTION_SOLUTION_REGISTRY_HPP
 #define HIPTENSOR_REDUCTION_SOLUTION_REGISTRY_HPP
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
 #include "data_types.hpp"
 #include "reduction_types.hpp"
 #include "singleton.hpp"
+#include "solution_bitset.hpp"
 
 namespace hiptensor
 {
     // @cond
     class ReductionSolution;
+    struct ReductionSolutionFamily;
 
     class ReductionSolutionRegistry
     {
@@ -77,15 +81,24 @@ namespace hiptensor
             // Full map of Uid to ReductionSolution*
             std::unordered_map<Uid, ReductionSolution*> const& solutions() const;
 
+            // Solutions in registration order
+            std::vector<ReductionSolution*> solutionList() const;
+
             uint32_t solutionCount() const;
 
-            // Internal ctor
+            // Internal ctor. Solutions must belong to the same registry.
             Query(std::vector<ReductionSolution*> const& solutions);
 
         private:
+            Query(ReductionSolutionRegistry* registry, SolutionBitset const& selection);
+
             // Query by explicit hash
             Query query(HashId queryHash) const;
 
+            // Selected solutions. Instantiates every pending family of an
+            // all-solutions query. Registry lock must be held.
+            SolutionBitset const& selection() const;
+
             // Hashing helpers
             static HashId hashSolution(hipDataType            typeIn,
                                        hiptensorComputeType_t typeAcc,
@@ -96,32 +109,40 @@ namespace hiptensor
                                        bool                   propagateNan,
                                        bool                   outputIndex);
 
-            // Adding solutions to the query
-            void addSolution(ReductionSolution* solution);
-            void addSolutions(std::vector<ReductionSolution*> const& solutions);
-            void addSolutions(std::unordered_map<Uid, ReductionSolution*> const& solutions);
-
         private: // members
-            // This is the has of all solutions, by unique Uid
-            // [Key = KernelUid, element = ReductionSolution*]
-            std::unordered_map<Uid, ReductionSolution*> mAllSolutions;
+            // Registry that assigned the dense solution indices
+            ReductionSolutionRegistry* mRegistry = nullptr;
+
+            // Selects every solution of the registry, including families
+            // that have not been instantiated yet
+            bool mAll = false;
+
+            // Selected solutions, by dense registry index
+            SolutionBitset mSelection;
 
-            // This is the contextual query hash
-            // [Key = Query hash, Element = ReductionSolution*]
-            std::unordered_map<HashId, std::vector<ReductionSolution*>> mSolutionHash;
+            // Uid map materialized on first call to solutions()
+            mutable std::unordered_map<Uid, ReductionSolution*> mSolutionMap;
+            mutable bool                                        mSolutionMapValid = false;
         };
 
+        // Generates the solutions of one family
+        using SolutionGenerator = std::function<std::vector<std::unique_ptr<ReductionSolution>>()>;
+
     protected:
-        // Move only
-        ReductionSolutionRegistry()                                            = default;
-        ReductionSolutionRegistry(ReductionSolutionRegistry&&)                 = default;
-        ReductionSolutionRegistry& operator=(ReductionSolutionRegistry&&)      = default;
+        // Queries keep a pointer back to the registry index, so
+        // registries are neither copyable nor movable.
+        ReductionSolutionRegistry();
+        ReductionSolutionRegistry(ReductionSolutionRegistry&&)                 = delete;
+        ReductionSolutionRegistry& operator=(ReductionSolutionRegistry&&)      = delete;
         ReductionSolutionRegistry(ReductionSolutionRegistry const&)            = delete;
         ReductionSolutionRegistry& operator=(ReductionSolutionRegistry const&) = delete;
 
         // Import reduction solutions for the registry to manage
         void registerSolutions(std::vector<std::unique_ptr<ReductionSolution>>&& solutions);
 
+        // Defer a family of solutions until the first query that may select them
+        void registerSolutionFamily(ReductionSolutionFamily&& family);
+
     public:
         virtual ~ReductionSolutionRegistry() = default;
 
@@ -131,11 +152,53 @@ namespace hiptensor
             return mSolutionQuery.query(ts...);
         }
 
+        // Solutions instantiated so far
         uint32_t solutionCount() const;
 
+        // True if any solution or pending family is registered
+        bool hasSolutions() const;
+
+    private:
+        struct Family
+        {
+            SolutionGenerator mGenerate;
+            bool              mLoaded;
+        };
+
+        // Assigns the next dense index to the solution and records it
+        // in its attribute bitset.
+        void indexSolution(ReductionSolution* solution);
+
+        // Instantiates pending families having the attribute, or all of them.
+        // Registry lock must be held.
+        void loadFamilies(Query::HashId attribute);
+        void loadAllFamilies();
+        void loadFamily(Family& family);
+
     private:
         std::vector<std::unique_ptr<ReductionSolution>> mSolutionStorage;
-        Query                                           mSolutionQuery;
+
+        // Dense index -> solution
+        std::vector<ReductionSolution*> mSolutionIndex;
+
+        // Unique kernel Uid -> dense index
+        std::unordered_map<Query::Uid, uint32_t> mUidIndex;
+
+        // Attribute hash -> solutions having that attribute
+        std::unordered_map<Query::HashId, SolutionBitset> mAttributeIndex;
+
+        // Every indexed solution
+        SolutionBitset mIndexedSolutions;
+
+        // Families not instantiated at registration
+        std::vector<Family>                                      mFamilies;
+        std::unordered_map<Query::HashId, std::vector<uint32_t>> mFamilyIndex;
+        uint32_t                                                 mPendingFamilies;
+
+        // Guards the index and family loading
+        mutable std::mutex mMutex;
+
+        Query mSolutionQuery;
     };
     // @endcond
 
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+#include "hip_device.hpp"
+#include "workspace_arena.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Small requests share one size class; above it, classes are powers of two
+        // until the large block granularity is reached.
+        constexpr size_t MinBlockSize   = 256u;
+        constexpr size_t LargeBlockSize = 64u << 20;
+        constexpr size_t LargeBlockStep = 2u << 20;
+    }
+
+    WorkspaceArena::Allocation::Allocation(WorkspaceArena* arena,
+                                           void*           ptr,
+                                           size_t          size,
+                                           hipStream_t     stream,
+                                           bool            captured)
+        : mArena(arena)
+        , mPtr(ptr)
+        , mSize(size)
+        , mStream(stream)
+        , mCaptured(captured)
+    {
+    }
+
+    WorkspaceArena::Allocation::Allocation(Allocation&& other)
+        : mArena(other.mArena)
+        , mPtr(other.mPtr)
+        , mSize(other.mSize)
+        , mStream(other.mStream)
+        , mCaptured(other.mCaptured)
+    {
+        other.mArena = nullptr;
+        other.mPtr   = nullptr;
+        other.mSize  = 0;
+    }
+
+    WorkspaceArena::Allocation& WorkspaceArena::Allocation::operator=(Allocation&& other)
+    {
+        if(this != &other)
+        {
+            reset();
+            mArena    = other.mArena;
+            mPtr      = other.mPtr;
+            mSize     = other.mSize;
+            mStream   = other.mStream;
+            mCaptured = other.mCaptured;
+
+            other.mArena = nullptr;
+            other.mPtr   = nullptr;
+            other.mSize  = 0;
+        }
+        return *this;
+    }
+
+    WorkspaceArena::Allocation::~Allocation()
+    {
+        reset();
+    }
+
+    void* WorkspaceArena::Allocation::get() const
+    {
+        return mPtr;
+    }
+
+    size_t WorkspaceArena::Allocation::size() const
+    {
+        return mSize;
+    }
+
+    void WorkspaceArena::Allocation::reset()
+    {
+        if(mCaptured && mPtr != nullptr)
+        {
+            CHECK_HIP_ERROR(hipFreeAsync(mPtr, mStream));
+        }
+        else if(mArena != nullptr && mPtr != nullptr)
+        {
+            mArena->release(mPtr, mStream);
+        }
+        mArena    = nullptr;
+        mPtr      = nullptr;
+        mSize     = 0;
+        mCaptured = false;
+    }
+
+    WorkspaceArena::~WorkspaceArena()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for(auto& [ptr, block] : mBlocks)
+        {
+            if(block.mReleaseEvent != nullptr)
+            {
+                CHECK_HIP_ERROR(hipEventSynchronize(block.mReleaseEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(block.mReleaseEvent));
+            }
+            CHECK_HIP_ERROR(hipFree(ptr));
+        }
+    }
+
+    size_t WorkspaceArena::sizeClass(size_t bytes)
+    {
+        if(bytes <= MinBlockSize)
+        {
+            return MinBlockSize;
+        }
+        else if(bytes > LargeBlockSize)
+        {
+            return (bytes + LargeBlockStep - 1) / LargeBlockStep * LargeBlockStep;
+        }
+
+        size_t size = MinBlockSize;
+        while(size < bytes)
+        {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    WorkspaceArena::Allocation WorkspaceArena::allocate(size_t bytes, hipStream_t stream)
+    {
+        if(bytes == 0)
+        {
+            return Allocation();
+        }
+
+        if(isStreamCapturing(stream))
+        {
+            void* ptr = nullptr;
+            if(hipMallocAsync(&ptr, bytes, stream) != hipSuccess)
+            {
+                (void)hipGetLastError();
+                return Allocation();
+            }
+            return Allocation(this, ptr, bytes, stream, true);
+        }
+
+        auto size = sizeClass(bytes);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // Prefer a block released on this stream: stream order makes it safe to reuse
+        // without waiting. Otherwise take any block whose pending work has completed.
+        auto range = mIdleBlocks.equal_range(size);
+        auto reuse = mIdleBlocks.end();
+        for(auto it = range.first; it != range.second; it++)
+        {
+            auto& block = mBlocks.at(it->second);
+            if(block.mStream == stream)
+            {
+                reuse = it;
+                break;
+            }
+            else if(reuse == mIdleBlocks.end() && hipEventQuery(block.mReleaseEvent) == hipSuccess)
+            {
+                reuse = it;
+            }
+        }
+
+        void* ptr = nullptr;
+        if(reuse != mIdleBlocks.end())
+        {
+            ptr = reuse->second;
+            mIdleBlocks.erase(reuse);
+        }
+        else
+        {
+            if(hipMalloc(&ptr, size) != hipSuccess)
+            {
+                // Clear the sticky error and give cached memory back before retrying
+                (void)hipGetLastError();
+                freeIdleBlocks();
+                if(hipMalloc(&ptr, size) != hipSuccess)
+                {
+                    (void)hipGetLastError();
+                    return Allocation();
+                }
+            }
+            mBlocks[ptr] = Block{size, stream, nullptr, false};
+            mReservedBytes += size;
+        }
+
+        auto& block   = mBlocks.at(ptr);
+        block.mInUse  = true;
+        block.mStream = stream;
+        mUsedBytes += size;
+
+        return Allocation(this, ptr, size, stream);
+    }
+
+    void WorkspaceArena::release(void* ptr, hipStream_t stream)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto& block = mBlocks.at(ptr);
+        if(block.mReleaseEvent == nullptr)
+        {
+            CHECK_HIP_ERROR(
+                hipEventCreateWithFlags(&block.mReleaseEvent, hipEventDisableTiming));
+        }
+
+        // Marks the point after which the block is no longer used by queued work
+        CHECK_HIP_ERROR(hipEventRecord(block.mReleaseEvent, stream));
+        block.mStream = stream;
+        block.mInUse  = false;
+        mUsedBytes -= block.mSize;
+
+        mIdleBlocks.emplace(block.mSize, ptr);
+    }
+
+    void WorkspaceArena::trim()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        freeIdleBlocks();
+    }
+
+    void WorkspaceArena::freeIdleBlocks()
+    {
+        for(auto& [size, ptr] : mIdleBlocks)
+        {
+            auto& block = mBlocks.at(ptr);
+            if(block.mReleaseEvent != nullptr)
+            {
+                CHECK_HIP_ERROR(hipEventSynchronize(block.mReleaseEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(block.mReleaseEvent));
+            }
+            CHECK_HIP_ERROR(hipFree(ptr));
+
+            mReservedBytes -= size;
+            mBlocks.erase(ptr);
+        }
+        mIdleBlocks.clear();
+    }
+
+    size_t WorkspaceArena::reservedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mReservedBytes;
+    }
+
+    size_t WorkspaceArena::usedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mUsedBytes;
+    }
+
+} // namespace hiptensor
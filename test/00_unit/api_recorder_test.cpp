@@ -0,0 +1,223 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <cstdio>
+#include <iostream>
+
+// hiptensor includes
+#include "api_recorder.hpp"
+#include "data_types.hpp"
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool apiRecordRoundTripTest()
+{
+    std::string fname = std::tmpnam(nullptr);
+
+    hiptensor::ApiRecord record;
+    record.mKind    = hiptensor::ApiRecordKind_t::REDUCTION;
+    record.mTensors = {{HIP_R_32F, HIPTENSOR_OP_IDENTITY, {4, 5, 6}, {1, 4, 20}, {'a', 'b', 'c'}},
+                       {HIP_R_32F, HIPTENSOR_OP_IDENTITY, {4}, {1}, {'a'}},
+                       {HIP_R_32F, HIPTENSOR_OP_IDENTITY, {4}, {1}, {'a'}}};
+    record.mComputeType   = HIPTENSOR_COMPUTE_32F;
+    record.mScalarType    = hiptensor::NONE_TYPE;
+    record.mOpId          = HIPTENSOR_OP_ADD;
+    record.mAlpha[0]      = 1.5;
+    record.mAlpha[1]      = 0.0;
+    record.mBeta[0]       = -2.0;
+    record.mBeta[1]       = 0.0;
+    record.mAlgo          = HIPTENSOR_ALGO_DEFAULT;
+    record.mWorksizePref  = HIPTENSOR_WORKSPACE_RECOMMENDED;
+    record.mWorkspaceSize = 128;
+
+    FILE* fp = fopen(fname.c_str(), "wb");
+    if(fp == nullptr)
+    {
+        std::cout << " Failed to Open File. Check Permissions!";
+        return false;
+    }
+    bool written = hiptensor::writeApiTraceHeader(fp) && hiptensor::writeApiRecord(fp, record)
+                   && hiptensor::writeApiRecord(fp, record);
+    fclose(fp);
+
+    std::vector<hiptensor::ApiRecord> records;
+    bool read = hiptensor::readApiTrace(fname.c_str(), records);
+    std::remove(fname.c_str());
+
+    if(!written || !read || records.size() != 2)
+    {
+        return false;
+    }
+
+    auto const& result = records[1];
+    return result.mKind == record.mKind && result.mTensors.size() == 3
+           && result.mTensors[0].mLengths == record.mTensors[0].mLengths
+           && result.mTensors[0].mStrides == record.mTensors[0].mStrides
+           && result.mTensors[0].mModes == record.mTensors[0].mModes
+           && result.mTensors[2].mModes == record.mTensors[2].mModes
+           && result.mOpId == record.mOpId && result.mAlpha[0] == record.mAlpha[0]
+           && result.mBeta[0] == record.mBeta[0]
+           && result.mWorkspaceSize == record.mWorkspaceSize;
+}
+
+bool apiRecorderPermutationTest()
+{
+    std::string fname = std::tmpnam(nullptr);
+
+    auto& recorder = hiptensor::ApiRecorder::instance();
+    if(!recorder->openTrace(fname.c_str()) || !recorder->isEnabled())
+    {
+        return false;
+    }
+
+    hiptensorTensorDescriptor_t descA = {HIP_R_32F, {8, 16}, {1, 8}, HIPTENSOR_OP_IDENTITY};
+    hiptensorTensorDescriptor_t descB = {HIP_R_32F, {16, 8}, {1, 16}, HIPTENSOR_OP_IDENTITY};
+    int32_t                     modeA[] = {'m', 'n'};
+    int32_t                     modeB[] = {'n', 'm'};
+    float                       alpha   = 2.0f;
+
+    recorder->recordPermutation(&alpha, &descA, modeA, &descB, modeB, HIP_R_32F, false, nullptr);
+    recorder->closeTrace();
+
+    std::vector<hiptensor::ApiRecord> records;
+    bool read = hiptensor::readApiTrace(fname.c_str(), records);
+    std::remove(fname.c_str());
+
+    return read && !recorder->isEnabled() && records.size() == 1
+           && records[0].mKind == hiptensor::ApiRecordKind_t::PERMUTATION
+           && records[0].mTensors.size() == 2 && records[0].mTensors[1].mModes[0] == 'n'
+           && records[0].mTensors[1].mLengths == descB.mLengths
+           && records[0].mScalarType == HIP_R_32F && records[0].mAlpha[0] == 2.0;
+}
+
+// Re-initialized finds and plans at the same address do not keep the algo and workspace
+// preference recorded for the earlier ones
+bool apiRecorderStaleKeysTest()
+{
+    std::string fname = std::tmpnam(nullptr);
+
+    auto& recorder = hiptensor::ApiRecorder::instance();
+    if(!recorder->openTrace(fname.c_str()))
+    {
+        return false;
+    }
+
+    hiptensorTensorDescriptor_t desc = {HIP_R_32F, {8, 8}, {1, 8}, HIPTENSOR_OP_IDENTITY};
+
+    hiptensorContractionPlan_t plan;
+    plan.mContractionDesc.mContractionOpId = 0;
+    plan.mContractionDesc.mComputeType     = HIPTENSOR_COMPUTE_32F;
+    plan.mContractionDesc.mTensorDesc      = {desc, desc, desc, desc};
+    plan.mContractionDesc.mTensorMode      = {{'m', 'k'}, {'n', 'k'}, {'m', 'n'}, {'m', 'n'}};
+
+    hiptensorContractionFind_t find;
+    find.mSelectionAlgorithm = HIPTENSOR_ALGO_ACTOR_CRITIC;
+
+    float alpha = 1.0f, beta = 0.0f;
+
+    // Planned with the preference of the find
+    recorder->recordContractionWorkspacePref(&find, HIPTENSOR_WORKSPACE_MIN);
+    recorder->recordContractionPlan(&plan, &find);
+    recorder->recordContraction(&plan, &alpha, &beta, 0, false, nullptr);
+
+    // The find is re-initialized, and the plan with it
+    recorder->resetContractionFind(&find);
+    recorder->resetContractionPlan(&plan);
+    find.mSelectionAlgorithm = HIPTENSOR_ALGO_DEFAULT;
+    recorder->recordContractionPlan(&plan, &find);
+    recorder->recordContraction(&plan, &alpha, &beta, 0, false, nullptr);
+
+    // The plan is re-initialized, and fails
+    recorder->resetContractionPlan(&plan);
+    find.mSelectionAlgorithm = HIPTENSOR_ALGO_ACTOR_CRITIC;
+    recorder->recordContraction(&plan, &alpha, &beta, 0, false, nullptr);
+    recorder->closeTrace();
+
+    std::vector<hiptensor::ApiRecord> records;
+    bool read = hiptensor::readApiTrace(fname.c_str(), records);
+    std::remove(fname.c_str());
+
+    return read && records.size() == 3 && records[0].mAlgo == HIPTENSOR_ALGO_ACTOR_CRITIC
+           && records[0].mWorksizePref == HIPTENSOR_WORKSPACE_MIN
+           && records[1].mAlgo == HIPTENSOR_ALGO_DEFAULT
+           && records[1].mWorksizePref == HIPTENSOR_WORKSPACE_RECOMMENDED
+           && records[2].mAlgo == HIPTENSOR_ALGO_DEFAULT
+           && records[2].mWorksizePref == HIPTENSOR_WORKSPACE_RECOMMENDED;
+}
+
+bool apiTraceInvalidFileTest()
+{
+    std::string fname = std::tmpnam(nullptr);
+
+    FILE* fp = fopen(fname.c_str(), "wb");
+    if(fp == nullptr)
+    {
+        std::cout << " Failed to Open File. Check Permissions!";
+        return false;
+    }
+    fputs("not a trace", fp);
+    fclose(fp);
+
+    std::vector<hiptensor::ApiRecord> records;
+    bool read = hiptensor::readApiTrace(fname.c_str(), records);
+    std::remove(fname.c_str());
+
+    return !read && records.empty() && !hiptensor::readApiTrace(nullptr, records);
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = apiRecordRoundTripTest();
+    totalPass &= testPass;
+    std::cout << "apiRecordRoundTrip: ";
+    printBool(testPass);
+
+    testPass = apiRecorderPermutationTest();
+    totalPass &= testPass;
+    std::cout << "apiRecorderPermutation: ";
+    printBool(testPass);
+
+    testPass = apiRecorderStaleKeysTest();
+    totalPass &= testPass;
+    std::cout << "apiRecorderStaleKeys: ";
+    printBool(testPass);
+
+    testPass = apiTraceInvalidFileTest();
+    totalPass &= testPass;
+    std::cout << "apiTraceInvalidFile: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
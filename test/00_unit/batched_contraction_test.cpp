@@ -0,0 +1,332 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "contraction/contraction_cpu_reference.hpp"
+#include "unit_test_helpers.hpp"
+
+// D[m, n] = alpha * A[m, k] * B[n, k] + beta * C[m, n] for each batch, in f32
+constexpr int64_t M = 32, N = 32, K = 16, Batches = 4;
+
+// The batch strides a plan is ranked for
+struct BatchStrides
+{
+    int64_t mA, mB, mC, mD;
+};
+
+struct BatchedProblem
+{
+    // Planned for a single batch, or with the batched kernels ranked for the given strides
+    explicit BatchedProblem(BatchStrides const* strides = nullptr)
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorCreate(&mHandle));
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&mStream, hipStreamNonBlocking));
+
+        int64_t lensA[] = {M, K};
+        int64_t lensB[] = {N, K};
+        int64_t lensD[] = {M, N};
+
+        hiptensorTensorDescriptor_t descA, descB, descD;
+        CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+            mHandle, &descA, 2, lensA, nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+        CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+            mHandle, &descB, 2, lensB, nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+        CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+            mHandle, &descD, 2, lensD, nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+        int32_t modeA[] = {'m', 'k'};
+        int32_t modeB[] = {'n', 'k'};
+        int32_t modeD[] = {'m', 'n'};
+
+        hiptensorContractionDescriptor_t desc;
+        CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(mHandle,
+                                                                 &desc,
+                                                                 &descA,
+                                                                 modeA,
+                                                                 0,
+                                                                 &descB,
+                                                                 modeB,
+                                                                 0,
+                                                                 &descD,
+                                                                 modeD,
+                                                                 0,
+                                                                 &descD,
+                                                                 modeD,
+                                                                 0,
+                                                                 HIPTENSOR_COMPUTE_32F));
+
+        hiptensorContractionFind_t find;
+        CHECK_HIPTENSOR_ERROR(
+            hiptensorInitContractionFind(mHandle, &find, HIPTENSOR_ALGO_DEFAULT));
+
+        uint64_t workspaceSize = 0;
+        CHECK_HIPTENSOR_ERROR(hiptensorContractionGetWorkspaceSize(
+            mHandle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize));
+        if(strides == nullptr)
+        {
+            CHECK_HIPTENSOR_ERROR(
+                hiptensorInitContractionPlan(mHandle, &mPlan, &desc, &find, workspaceSize));
+        }
+        else
+        {
+            CHECK_HIPTENSOR_ERROR(hiptensorInitContractionPlanBatched(mHandle,
+                                                                      &mPlan,
+                                                                      &desc,
+                                                                      &find,
+                                                                      workspaceSize,
+                                                                      Batches,
+                                                                      strides->mA,
+                                                                      strides->mB,
+                                                                      strides->mC,
+                                                                      strides->mD));
+        }
+        mWorkspaceSize = workspaceSize;
+    }
+
+    ~BatchedProblem()
+    {
+        CHECK_HIP_ERROR(hipStreamDestroy(mStream));
+        CHECK_HIPTENSOR_ERROR(hiptensorDestroy(mHandle));
+    }
+
+    // The CPU reference of one batch
+    void reference(float const* A, float const* B, float const* C, float* D) const
+    {
+        auto const& desc = mPlan.mContractionDesc;
+        CHECK_HIPTENSOR_ERROR(hiptensorContractionReference(&mPlan,
+                                                            &mAlpha,
+                                                            A,
+                                                            B,
+                                                            &mBeta,
+                                                            C,
+                                                            D,
+                                                            desc.mTensorDesc[0].mLengths,
+                                                            desc.mTensorDesc[0].mStrides,
+                                                            desc.mTensorMode[0],
+                                                            desc.mTensorDesc[1].mLengths,
+                                                            desc.mTensorDesc[1].mStrides,
+                                                            desc.mTensorMode[1],
+                                                            desc.mTensorDesc[3].mLengths,
+                                                            desc.mTensorDesc[3].mStrides,
+                                                            desc.mTensorMode[3],
+                                                            desc.mTensorDesc[3].mLengths,
+                                                            desc.mTensorDesc[3].mStrides,
+                                                            desc.mTensorMode[3],
+                                                            HIP_R_32F,
+                                                            HIP_R_32F,
+                                                            HIP_R_32F,
+                                                            HIP_R_32F,
+                                                            nullptr));
+    }
+
+    hiptensorHandle_t*         mHandle = nullptr;
+    hipStream_t                mStream;
+    hiptensorContractionPlan_t mPlan;
+    uint64_t                   mWorkspaceSize = 0;
+    float                      mAlpha         = 1.5f;
+    float                      mBeta  = -0.5f;
+};
+
+// A strided batch. Batches of A are padded apart. A C shared by all batches is not laid
+// out as D, so it takes the per-batch fallback; otherwise the batch is a single launch of
+// the batched kernel ranked at plan time, or of an unranked one for a plan of one batch.
+bool stridedTest(bool sharedC, bool planBatched)
+{
+    int64_t strideA = M * K + 64;
+    int64_t strideB = N * K;
+    int64_t strideD = M * N;
+    int64_t strideC = sharedC ? 0 : strideD;
+
+    auto           strides = BatchStrides{strideA, strideB, strideC, strideD};
+    BatchedProblem problem(planBatched ? &strides : nullptr);
+
+    // The shape ranked at plan time, and its winner unless C is shared
+    auto const& shape  = problem.mPlan.mBatchedShape;
+    void*       ranked = problem.mPlan.mBatchedSolution;
+    bool        pass   = true;
+    if(planBatched)
+    {
+        pass &= shape
+                    == std::vector<int64_t>{Batches,
+                                            strideA,
+                                            strideB,
+                                            strideC,
+                                            strideD,
+                                            1,
+                                            (int64_t)problem.mWorkspaceSize}
+                && (ranked == nullptr) == sharedC;
+    }
+    else
+    {
+        pass &= shape.empty() && ranked == nullptr;
+    }
+
+    auto hostA = values(Batches * strideA, 1);
+    auto hostB = values(Batches * strideB, 2);
+    auto hostC = values(sharedC ? M * N : Batches * strideD, 3);
+
+    auto A = toDevice(hostA);
+    auto B = toDevice(hostB);
+    auto C = toDevice(hostC);
+    auto D = toDevice(std::vector<float>(Batches * strideD, 0.0f));
+
+    std::vector<float> expected(Batches * strideD);
+    for(int64_t i = 0; i < Batches; i++)
+    {
+        problem.reference(hostA.data() + i * strideA,
+                          hostB.data() + i * strideB,
+                          hostC.data() + i * strideC,
+                          expected.data() + i * strideD);
+    }
+
+    // Executions leave the plan as it was planned
+    for(int run = 0; run < 2; run++)
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorContractionBatched(problem.mHandle,
+                                                          &problem.mPlan,
+                                                          &problem.mAlpha,
+                                                          A,
+                                                          B,
+                                                          &problem.mBeta,
+                                                          C,
+                                                          D,
+                                                          Batches,
+                                                          strideA,
+                                                          strideB,
+                                                          strideC,
+                                                          strideD,
+                                                          nullptr,
+                                                          0,
+                                                          problem.mStream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(problem.mStream));
+        pass &= nearlyEqual(toHost(D, Batches * strideD), expected);
+        pass &= problem.mPlan.mBatchedSolution == ranked;
+    }
+
+    for(auto* ptr : {A, B, C, D})
+    {
+        CHECK_HIP_ERROR(hipFree(ptr));
+    }
+    return pass;
+}
+
+// Pointer arrays into single allocations. Equally spaced batches are run as a strided batch
+// in a single launch, batches in reverse order one at a time.
+bool pointersTest(bool reversed)
+{
+    auto           strides = BatchStrides{M * K, N * K, M * N, M * N};
+    BatchedProblem problem(&strides);
+
+    auto hostA = values(Batches * M * K, 4);
+    auto hostB = values(Batches * N * K, 5);
+    auto hostC = values(Batches * M * N, 6);
+
+    auto A = toDevice(hostA);
+    auto B = toDevice(hostB);
+    auto C = toDevice(hostC);
+    auto D = toDevice(std::vector<float>(Batches * M * N, 0.0f));
+
+    std::vector<void const*> ptrA, ptrB, ptrC;
+    std::vector<void*>       ptrD;
+    std::vector<float>       expected(Batches * M * N);
+    for(int64_t i = 0; i < Batches; i++)
+    {
+        auto batch = reversed ? Batches - 1 - i : i;
+        ptrA.push_back(A + batch * M * K);
+        ptrB.push_back(B + batch * N * K);
+        ptrC.push_back(C + batch * M * N);
+        ptrD.push_back(D + batch * M * N);
+        problem.reference(hostA.data() + batch * M * K,
+                          hostB.data() + batch * N * K,
+                          hostC.data() + batch * M * N,
+                          expected.data() + batch * M * N);
+    }
+
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionBatchedPointers(problem.mHandle,
+                                                              &problem.mPlan,
+                                                              &problem.mAlpha,
+                                                              ptrA.data(),
+                                                              ptrB.data(),
+                                                              &problem.mBeta,
+                                                              ptrC.data(),
+                                                              ptrD.data(),
+                                                              Batches,
+                                                              nullptr,
+                                                              0,
+                                                              problem.mStream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(problem.mStream));
+
+    bool pass = nearlyEqual(toHost(D, Batches * M * N), expected);
+
+    for(auto* ptr : {A, B, C, D})
+    {
+        CHECK_HIP_ERROR(hipFree(ptr));
+    }
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = stridedTest(false, true);
+    totalPass &= testPass;
+    std::cout << "stridedSingleLaunch: ";
+    printBool(testPass);
+
+    testPass = stridedTest(false, false);
+    totalPass &= testPass;
+    std::cout << "stridedUnranked: ";
+    printBool(testPass);
+
+    testPass = stridedTest(true, true);
+    totalPass &= testPass;
+    std::cout << "stridedPerBatch: ";
+    printBool(testPass);
+
+    testPass = pointersTest(false);
+    totalPass &= testPass;
+    std::cout << "pointersSingleLaunch: ";
+    printBool(testPass);
+
+    testPass = pointersTest(true);
+    totalPass &= testPass;
+    std::cout << "pointersPerBatch: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
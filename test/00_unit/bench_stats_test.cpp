@@ -0,0 +1,141 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+// hiptensor includes
+#include "bench/bench_stats.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool nearlyEqual(double a, double b)
+{
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+bool benchStatsTest()
+{
+    // 1..100 shuffled, so that the percentiles fall on known ranks
+    std::vector<double> samples;
+    for(int i = 0; i < 100; i++)
+    {
+        samples.push_back(static_cast<double>((i * 37) % 100 + 1));
+    }
+
+    auto stats = hiptensor::computeStats(samples);
+    return stats.mSamples == 100 && nearlyEqual(stats.mMinMs, 1.0)
+           && nearlyEqual(stats.mMedianMs, 50.5) && nearlyEqual(stats.mP90Ms, 90.1)
+           && nearlyEqual(stats.mP99Ms, 99.01) && nearlyEqual(stats.mMeanMs, 50.5)
+           && hiptensor::computeStats({}).mSamples == 0
+           && nearlyEqual(hiptensor::percentile({3.0}, 99.0), 3.0);
+}
+
+bool benchResultsRoundTripTest()
+{
+    hiptensor::BenchResult result;
+    result.mOperation    = "contraction";
+    result.mProblem      = "contraction COMPUTE_32F op=1 R_32F[0:4/1,1:4/4] alpha=1,0 \"q\"";
+    result.mStatus       = "HIPTENSOR_STATUS_SUCCESS";
+    result.mStats        = hiptensor::computeStats({0.5, 0.25, 1.0});
+    result.mTflops       = 12.5;
+    result.mGBps         = 900.0;
+    result.mPctPeakFlops = 25.0;
+    result.mPctPeakBw    = 50.0;
+    std::vector<hiptensor::BenchResult> results{result, result};
+    results[1].mOperation = "reduction";
+
+    bool pass = true;
+    for(auto format : {hiptensor::BenchFormat_t::CSV, hiptensor::BenchFormat_t::JSON})
+    {
+        std::string fname = std::tmpnam(nullptr);
+
+        std::vector<hiptensor::BenchResult> loaded;
+        bool written = hiptensor::writeBenchResults(fname, format, results);
+        bool read    = hiptensor::readBenchResults(fname, format, loaded);
+        std::remove(fname.c_str());
+
+        pass &= written && read && loaded.size() == 2 && loaded[0].mProblem == result.mProblem
+                && loaded[1].mOperation == "reduction" && loaded[0].mStatus == result.mStatus
+                && loaded[0].mStats.mSamples == 3
+                && nearlyEqual(loaded[0].mStats.mMedianMs, 0.5)
+                && nearlyEqual(loaded[1].mTflops, 12.5)
+                && nearlyEqual(loaded[1].mPctPeakBw, 50.0);
+    }
+
+    return pass && hiptensor::benchFormatFromFileName("out.json") == hiptensor::BenchFormat_t::JSON
+           && hiptensor::benchFormatFromFileName("out.csv") == hiptensor::BenchFormat_t::CSV;
+}
+
+bool benchCompareTest()
+{
+    auto make = [](std::string problem, double medianMs) {
+        hiptensor::BenchResult result;
+        result.mOperation       = "permutation";
+        result.mProblem         = problem;
+        result.mStats.mSamples  = 1;
+        result.mStats.mMedianMs = medianMs;
+        return result;
+    };
+
+    std::vector<hiptensor::BenchResult> base{make("a", 1.0), make("b", 1.0), make("c", 1.0)};
+    std::vector<hiptensor::BenchResult> current{
+        make("a", 1.04), make("b", 1.2), make("c", 0.5), make("new", 1.0)};
+
+    auto comparisons = hiptensor::compareBenchResults(base, current, 5.0);
+    return comparisons.size() == 3 && !comparisons[0].mRegression && comparisons[1].mRegression
+           && nearlyEqual(comparisons[1].mChangePct, 20.0) && !comparisons[2].mRegression
+           && nearlyEqual(comparisons[2].mChangePct, -50.0);
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = benchStatsTest();
+    totalPass &= testPass;
+    std::cout << "benchStats: ";
+    printBool(testPass);
+
+    testPass = benchResultsRoundTripTest();
+    totalPass &= testPass;
+    std::cout << "benchResultsRoundTrip: ";
+    printBool(testPass);
+
+    testPass = benchCompareTest();
+    totalPass &= testPass;
+    std::cout << "benchCompare: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
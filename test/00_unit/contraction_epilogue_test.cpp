@@ -0,0 +1,123 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include "contraction/contraction_epilogue.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+using Lengths = std::vector<std::size_t>;
+using Modes   = std::vector<int32_t>;
+
+bool near(float value, float expected)
+{
+    return std::fabs(value - expected) <= 1e-4f;
+}
+
+bool activationTest()
+{
+    using hiptensor::applyActivation;
+    return applyActivation(-2.0f, HIPTENSOR_ACTIVATION_NONE, 0.0f, 0.0f) == -2.0f
+           && applyActivation(-2.0f, HIPTENSOR_ACTIVATION_RELU, 0.0f, 0.0f) == 0.0f
+           && applyActivation(3.0f, HIPTENSOR_ACTIVATION_RELU, 0.0f, 0.0f) == 3.0f
+           && near(applyActivation(0.0f, HIPTENSOR_ACTIVATION_GELU, 0.0f, 0.0f), 0.0f)
+           && near(applyActivation(1.0f, HIPTENSOR_ACTIVATION_GELU, 0.0f, 0.0f), 0.841192f)
+           && near(applyActivation(0.0f, HIPTENSOR_ACTIVATION_SILU, 0.0f, 0.0f), 0.0f)
+           && near(applyActivation(1.0f, HIPTENSOR_ACTIVATION_SILU, 0.0f, 0.0f), 0.731059f)
+           && applyActivation(-5.0f, HIPTENSOR_ACTIVATION_CLAMP, -1.0f, 6.0f) == -1.0f
+           && applyActivation(7.0f, HIPTENSOR_ACTIVATION_CLAMP, -1.0f, 6.0f) == 6.0f
+           && applyActivation(2.5f, HIPTENSOR_ACTIVATION_CLAMP, -1.0f, 6.0f) == 2.5f;
+}
+
+bool broadcastBiasTest()
+{
+    // Bias over n of D[m, n, p]: broadcast over m and p
+    std::vector<std::size_t> strides;
+    return hiptensor::epilogueBiasStrides(&strides, {5}, {1}, {1}, {4, 5, 6}, {0, 1, 2})
+           && strides == Lengths{0, 1, 0};
+}
+
+bool permutedBiasTest()
+{
+    // Bias[p, m] of D[m, n, p], in the order of the modes of D
+    std::vector<std::size_t> strides;
+    return hiptensor::epilogueBiasStrides(&strides, {6, 4}, {1, 6}, {2, 0}, {4, 5, 6}, {0, 1, 2})
+           && strides == Lengths{6, 0, 1};
+}
+
+bool missingModeTest()
+{
+    std::vector<std::size_t> strides;
+    return !hiptensor::epilogueBiasStrides(&strides, {5}, {1}, {3}, {4, 5}, {0, 1});
+}
+
+bool mismatchedLengthTest()
+{
+    std::vector<std::size_t> strides;
+    return !hiptensor::epilogueBiasStrides(&strides, {3}, {1}, {1}, {4, 5}, {0, 1});
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = activationTest();
+    totalPass &= testPass;
+    std::cout << "activation: ";
+    printBool(testPass);
+
+    testPass = broadcastBiasTest();
+    totalPass &= testPass;
+    std::cout << "broadcastBias: ";
+    printBool(testPass);
+
+    testPass = permutedBiasTest();
+    totalPass &= testPass;
+    std::cout << "permutedBias: ";
+    printBool(testPass);
+
+    testPass = missingModeTest();
+    totalPass &= testPass;
+    std::cout << "missingMode: ";
+    printBool(testPass);
+
+    testPass = mismatchedLengthTest();
+    totalPass &= testPass;
+    std::cout << "mismatchedLength: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
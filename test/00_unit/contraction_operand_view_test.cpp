@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include "contraction/contraction_operand_view.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+using Lengths = std::vector<std::size_t>;
+using Modes   = std::vector<int32_t>;
+
+bool plainOperandTest()
+{
+    // ik,kj->ij: A is contracted as is
+    hiptensor::ContractionOperandView view;
+    return hiptensor::contractionOperandView(&view, {4, 5}, {1, 4}, {0, 2}, {{2, 1}, {0, 1}})
+           && view.mModes == Modes{0, 2} && view.mStrides == Lengths{1, 4}
+           && !view.mHasRepeatedModes && !view.needsPreReduction();
+}
+
+bool diagonalTest()
+{
+    // iij,jk->ik: the diagonal of A has the summed stride of its repeated mode
+    hiptensor::ContractionOperandView view;
+    return hiptensor::contractionOperandView(
+               &view, {3, 3, 5}, {1, 3, 9}, {0, 0, 1}, {{1, 2}, {0, 2}})
+           && view.mModes == Modes{0, 1} && view.mLengths == Lengths{3, 5}
+           && view.mStrides == Lengths{4, 9} && view.mHasRepeatedModes
+           && !view.needsPreReduction();
+}
+
+bool summedModeTest()
+{
+    // ijl,jk->ik: l is only in A and summed out, keeping the order of the other modes
+    hiptensor::ContractionOperandView view;
+    return hiptensor::contractionOperandView(
+               &view, {3, 5, 7}, {1, 3, 15}, {0, 1, 3}, {{1, 2}, {0, 2}})
+           && view.needsPreReduction() && view.mKeptModes == Modes{0, 1}
+           && view.mKeptLengths == Lengths{3, 5} && view.mModes == Modes{0, 1, 3};
+}
+
+bool traceTest()
+{
+    // iij,j->: the diagonal of A is summed out entirely but for j
+    hiptensor::ContractionOperandView view;
+    return hiptensor::contractionOperandView(&view, {6, 6, 2}, {1, 6, 36}, {0, 0, 1}, {{1}, {}})
+           && view.mStrides == Lengths{7, 36} && view.needsPreReduction()
+           && view.mKeptModes == Modes{1};
+}
+
+bool mismatchedLengthsTest()
+{
+    hiptensor::ContractionOperandView view;
+    return !hiptensor::contractionOperandView(&view, {3, 4}, {1, 3}, {0, 0}, {{0}});
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = plainOperandTest();
+    totalPass &= testPass;
+    std::cout << "plainOperand: ";
+    printBool(testPass);
+
+    testPass = diagonalTest();
+    totalPass &= testPass;
+    std::cout << "diagonal: ";
+    printBool(testPass);
+
+    testPass = summedModeTest();
+    totalPass &= testPass;
+    std::cout << "summedMode: ";
+    printBool(testPass);
+
+    testPass = traceTest();
+    totalPass &= testPass;
+    std::cout << "trace: ";
+    printBool(testPass);
+
+    testPass = mismatchedLengthsTest();
+    totalPass &= testPass;
+    std::cout << "mismatchedLengths: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
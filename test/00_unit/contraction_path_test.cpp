@@ -0,0 +1,199 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+// hiptensor includes
+#include "contraction/contraction_path.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+using Modes   = std::vector<std::vector<int32_t>>;
+using Extents = std::unordered_map<int32_t, std::size_t>;
+
+// Every operand is used once, operands precede their use, and the last step is the output
+bool isValidPath(hiptensor::ContractionPath const& path,
+                 std::size_t                       inputCount,
+                 std::vector<int32_t> const&       outputModes)
+{
+    std::vector<int> uses(inputCount + path.mSteps.size(), 0);
+    for(std::size_t s = 0; s < path.mSteps.size(); s++)
+    {
+        for(auto operand : path.mSteps[s].mOperands)
+        {
+            if(operand < 0 || operand >= (int32_t)(inputCount + s) || uses[operand]++ > 0)
+            {
+                return false;
+            }
+        }
+    }
+    return path.mSteps.size() == inputCount - 1 && path.mSteps.back().mModes == outputModes;
+}
+
+bool matrixChainTest(hiptensor::ContractionPathAlgo_t algo)
+{
+    // ij,jk,kl->il with i=10, j=1000, k=5, l=500: (AB)C is 200x cheaper than A(BC)
+    Modes   inputs  = {{0, 1}, {1, 2}, {2, 3}};
+    Extents extents = {{0, 10}, {1, 1000}, {2, 5}, {3, 500}};
+
+    hiptensor::ContractionPath path;
+    return hiptensor::findContractionPath(&path, inputs, {0, 3}, extents, algo)
+           && isValidPath(path, inputs.size(), {0, 3}) && path.mSteps[0].mOperands[0] == 0
+           && path.mSteps[0].mOperands[1] == 1
+           && path.mSteps[0].mModes == std::vector<int32_t>{0, 2}
+           && path.mFlops == 2.0 * 10 * 1000 * 5 + 2.0 * 10 * 5 * 500 && path.mElements == 50.0;
+}
+
+bool batchModeTest()
+{
+    // bij,bjk,bkl->bil: the batch mode is kept by every intermediate
+    Modes   inputs  = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}};
+    Extents extents = {{0, 4}, {1, 8}, {2, 16}, {3, 32}, {4, 8}};
+
+    hiptensor::ContractionPath path;
+    auto                       found = hiptensor::findContractionPath(
+        &path, inputs, {0, 1, 4}, extents, hiptensor::ContractionPathAlgo_t::OPTIMAL);
+    return found && isValidPath(path, inputs.size(), {0, 1, 4})
+           && path.mSteps[0].mModes.front() == 0;
+}
+
+bool invalidNetworkTest()
+{
+    Extents extents = {{0, 2}, {1, 3}, {2, 4}, {3, 5}};
+
+    hiptensor::ContractionPath path;
+    auto                       greedy = hiptensor::ContractionPathAlgo_t::GREEDY;
+    return
+        // Mode 2 is in a single input and not in the output
+        !hiptensor::findContractionPath(&path, {{0, 1}, {1, 2}}, {0}, extents, greedy)
+        // Output mode 3 is in no input
+        && !hiptensor::findContractionPath(&path, {{0, 1}, {1, 2}}, {0, 2, 3}, extents, greedy)
+        // Repeated mode within an input
+        && !hiptensor::findContractionPath(&path, {{0, 0}, {0, 1}}, {1}, extents, greedy)
+        // Mode without an extent
+        && !hiptensor::findContractionPath(&path, {{0, 7}, {7, 1}}, {0, 1}, extents, greedy)
+        // Single input
+        && !hiptensor::findContractionPath(&path, {{0, 1}}, {0, 1}, extents, greedy);
+}
+
+bool optimalNotWorseTest()
+{
+    std::mt19937                       gen(1234);
+    std::uniform_int_distribution<int> extentDist(2, 64);
+
+    for(int trial = 0; trial < 20; trial++)
+    {
+        // Random ring of 8 tensors, each sharing a mode with its neighbours, plus an
+        // open mode on every other tensor
+        Modes                inputs(8);
+        std::vector<int32_t> output;
+        Extents              extents;
+        for(int32_t t = 0; t < 8; t++)
+        {
+            inputs[t] = {t, (t + 1) % 8};
+            if(t % 2 == 0)
+            {
+                inputs[t].push_back(100 + t);
+                output.push_back(100 + t);
+            }
+        }
+        for(auto const& input : inputs)
+        {
+            for(auto mode : input)
+            {
+                extents[mode] = extentDist(gen);
+            }
+        }
+
+        hiptensor::ContractionPath greedy, optimal;
+        if(!hiptensor::findContractionPath(
+               &greedy, inputs, output, extents, hiptensor::ContractionPathAlgo_t::GREEDY)
+           || !hiptensor::findContractionPath(
+               &optimal, inputs, output, extents, hiptensor::ContractionPathAlgo_t::OPTIMAL)
+           || !isValidPath(greedy, inputs.size(), output)
+           || !isValidPath(optimal, inputs.size(), output) || optimal.mFlops > greedy.mFlops)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool bufferReuseTest()
+{
+    // The first and last buffers are never live together, so they share memory
+    std::size_t total   = 0;
+    auto        offsets = hiptensor::planBufferOffsets(
+        {100, 100, 100}, {{{0, 1}}, {{1, 2}}, {{2, 3}}}, 64, &total);
+
+    return offsets[0] == offsets[2] && offsets[1] != offsets[0] && offsets[1] % 64 == 0
+           && total == 256;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = matrixChainTest(hiptensor::ContractionPathAlgo_t::GREEDY);
+    totalPass &= testPass;
+    std::cout << "matrixChain (greedy): ";
+    printBool(testPass);
+
+    testPass = matrixChainTest(hiptensor::ContractionPathAlgo_t::OPTIMAL);
+    totalPass &= testPass;
+    std::cout << "matrixChain (optimal): ";
+    printBool(testPass);
+
+    testPass = batchModeTest();
+    totalPass &= testPass;
+    std::cout << "batchMode: ";
+    printBool(testPass);
+
+    testPass = invalidNetworkTest();
+    totalPass &= testPass;
+    std::cout << "invalidNetwork: ";
+    printBool(testPass);
+
+    testPass = optimalNotWorseTest();
+    totalPass &= testPass;
+    std::cout << "optimalNotWorse: ";
+    printBool(testPass);
+
+    testPass = bufferReuseTest();
+    totalPass &= testPass;
+    std::cout << "bufferReuse: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,249 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "device_scalars.hpp"
+#include "handle.hpp"
+#include "unit_test_helpers.hpp"
+
+using Lengths = std::vector<std::size_t>;
+
+bool scaleInPlaceTest()
+{
+    // D = alpha * D, with D as T
+    auto alpha = toDevice(std::vector<float>{2.0f});
+    auto d     = toDevice(std::vector<float>{1, 2, 3, 4, 5, 6});
+
+    auto status = hiptensor::applyDeviceScalars(alpha,
+                                                d,
+                                                {1, 2},
+                                                nullptr,
+                                                nullptr,
+                                                {},
+                                                d,
+                                                {2, 3},
+                                                {1, 2},
+                                                HIP_R_32F,
+                                                HIPTENSOR_COMPUTE_32F,
+                                                nullptr);
+    auto result = toHost(d, 6);
+
+    CHECK_HIP_ERROR(hipFree(alpha));
+    CHECK_HIP_ERROR(hipFree(d));
+    return status == HIPTENSOR_STATUS_SUCCESS
+           && result == std::vector<float>{2, 4, 6, 8, 10, 12};
+}
+
+bool stridedBilinearTest()
+{
+    // D[m, n] = alpha * T[m, n] + beta * C[m, n], with T packed and D = C row-major
+    auto alpha = toDevice(std::vector<double>{2.0});
+    auto beta  = toDevice(std::vector<double>{-1.0});
+    auto t     = toDevice(std::vector<float>{1, 2, 3, 4, 5, 6});
+    auto d     = toDevice(std::vector<float>{10, 20, 30, 40, 50, 60});
+
+    auto status = hiptensor::applyDeviceScalars(alpha,
+                                                t,
+                                                {1, 2},
+                                                beta,
+                                                d,
+                                                {3, 1},
+                                                d,
+                                                {2, 3},
+                                                {3, 1},
+                                                HIP_R_32F,
+                                                HIPTENSOR_COMPUTE_64F,
+                                                nullptr);
+    auto result = toHost(d, 6);
+
+    CHECK_HIP_ERROR(hipFree(alpha));
+    CHECK_HIP_ERROR(hipFree(beta));
+    CHECK_HIP_ERROR(hipFree(t));
+    CHECK_HIP_ERROR(hipFree(d));
+
+    // T[m, n] = 1 + m + 2n is read at m + 2n, D[m, n] at 3m + n
+    return status == HIPTENSOR_STATUS_SUCCESS
+           && result == std::vector<float>{-8, -14, -20, -36, -42, -48};
+}
+
+bool zeroBetaTest()
+{
+    // C is not read when beta is zero, so its NaNs do not reach D
+    auto nan   = std::numeric_limits<float>::quiet_NaN();
+    auto alpha = toDevice(std::vector<float>{3.0f});
+    auto beta  = toDevice(std::vector<float>{0.0f});
+    auto t     = toDevice(std::vector<float>{1, 2});
+    auto c     = toDevice(std::vector<float>{nan, nan});
+    auto d     = toDevice(std::vector<float>{0, 0});
+
+    auto status = hiptensor::applyDeviceScalars(alpha,
+                                                t,
+                                                {1},
+                                                beta,
+                                                c,
+                                                {1},
+                                                d,
+                                                {2},
+                                                {1},
+                                                HIP_R_32F,
+                                                HIPTENSOR_COMPUTE_32F,
+                                                nullptr);
+    auto result = toHost(d, 2);
+
+    for(auto* ptr : {alpha, beta, t, c, d})
+    {
+        CHECK_HIP_ERROR(hipFree(ptr));
+    }
+    return status == HIPTENSOR_STATUS_SUCCESS && result == std::vector<float>{3, 6};
+}
+
+bool complexTest()
+{
+    // i * (1 + 2i) = -2 + i
+    auto alpha = toDevice(std::vector<hipFloatComplex>{make_hipFloatComplex(0.0f, 1.0f)});
+    auto d     = toDevice(std::vector<hipFloatComplex>{make_hipFloatComplex(1.0f, 2.0f)});
+
+    auto status = hiptensor::applyDeviceScalars(alpha,
+                                                d,
+                                                {1},
+                                                nullptr,
+                                                nullptr,
+                                                {},
+                                                d,
+                                                {1},
+                                                {1},
+                                                HIP_C_32F,
+                                                HIPTENSOR_COMPUTE_C32F,
+                                                nullptr);
+    auto result = toHost(d, 1);
+
+    CHECK_HIP_ERROR(hipFree(alpha));
+    CHECK_HIP_ERROR(hipFree(d));
+    return status == HIPTENSOR_STATUS_SUCCESS && hipCrealf(result[0]) == -2.0f
+           && hipCimagf(result[0]) == 1.0f;
+}
+
+bool mismatchedComplexScalarTest()
+{
+    return hiptensor::applyDeviceScalars(nullptr,
+                                         nullptr,
+                                         {1},
+                                         nullptr,
+                                         nullptr,
+                                         {},
+                                         nullptr,
+                                         {1},
+                                         {1},
+                                         HIP_C_32F,
+                                         HIPTENSOR_COMPUTE_32F,
+                                         nullptr)
+           == HIPTENSOR_STATUS_NOT_SUPPORTED;
+}
+
+bool pointerModeTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hiptensorPointerMode_t mode = HIPTENSOR_POINTER_MODE_DEVICE;
+
+    bool pass = hiptensorGetPointerMode(handle, &mode) == HIPTENSOR_STATUS_SUCCESS
+                && mode == HIPTENSOR_POINTER_MODE_HOST;
+
+    pass &= hiptensorSetPointerMode(handle, HIPTENSOR_POINTER_MODE_DEVICE)
+            == HIPTENSOR_STATUS_SUCCESS;
+    pass &= hiptensorGetPointerMode(handle, &mode) == HIPTENSOR_STATUS_SUCCESS
+            && mode == HIPTENSOR_POINTER_MODE_DEVICE;
+    pass &= hiptensorSetPointerMode(handle, (hiptensorPointerMode_t)7)
+            == HIPTENSOR_STATUS_INVALID_VALUE;
+
+    // The library passes device constants to its own operations in device pointer mode
+    auto const& realHandle = *hiptensor::Handle::toHandle(handle->fields);
+
+    hiptensor::LibraryScalars deviceScalars(realHandle, HIPTENSOR_COMPUTE_32F);
+    float                     one  = 0.0f;
+    float                     zero = 1.0f;
+    CHECK_HIP_ERROR(hipMemcpy(&one, deviceScalars.one(), sizeof(float), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(&zero, deviceScalars.zero(), sizeof(float), hipMemcpyDeviceToHost));
+    pass &= one == 1.0f && zero == 0.0f;
+
+    CHECK_HIPTENSOR_ERROR(hiptensorSetPointerMode(handle, HIPTENSOR_POINTER_MODE_HOST));
+    hiptensor::LibraryScalars hostScalars(realHandle, HIPTENSOR_COMPUTE_32F);
+    pass &= *static_cast<float const*>(hostScalars.one()) == 1.0f
+            && *static_cast<float const*>(hostScalars.zero()) == 0.0f;
+
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = scaleInPlaceTest();
+    totalPass &= testPass;
+    std::cout << "scaleInPlace: ";
+    printBool(testPass);
+
+    testPass = stridedBilinearTest();
+    totalPass &= testPass;
+    std::cout << "stridedBilinear: ";
+    printBool(testPass);
+
+    testPass = zeroBetaTest();
+    totalPass &= testPass;
+    std::cout << "zeroBeta: ";
+    printBool(testPass);
+
+    testPass = complexTest();
+    totalPass &= testPass;
+    std::cout << "complex: ";
+    printBool(testPass);
+
+    testPass = mismatchedComplexScalarTest();
+    totalPass &= testPass;
+    std::cout << "mismatchedComplexScalar: ";
+    printBool(testPass);
+
+    testPass = pointerModeTest();
+    totalPass &= testPass;
+    std::cout << "pointerMode: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
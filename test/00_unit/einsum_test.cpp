@@ -0,0 +1,221 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include "einsum.hpp"
+#include "unit_test_helpers.hpp"
+
+using Modes = std::vector<int32_t>;
+
+bool explicitOutputTest()
+{
+    hiptensor::EinsumExpression expression;
+    return hiptensor::parseEinsum("abcd, bdef -> acef", &expression)
+           && expression.mInputModes.size() == 2 && expression.mInputModes[0] == Modes{0, 1, 2, 3}
+           && expression.mInputModes[1] == Modes{1, 3, 4, 5}
+           && expression.mOutputModes == Modes{0, 2, 4, 5}
+           && expression.mCanonical == "abcd,bdef->acef"
+           && hiptensor::einsumOperation(expression) == hiptensor::EinsumOp_t::CONTRACTION;
+}
+
+bool implicitOutputTest()
+{
+    // Labels used once, in alphabetical order
+    hiptensor::EinsumExpression expression;
+    return hiptensor::parseEinsum("kj,ji", &expression) && expression.mOutputModes == Modes{2, 0}
+           && expression.mCanonical == "ab,bc->ca";
+}
+
+bool canonicalTest()
+{
+    // Expressions only differing in their labels share the canonical expression
+    hiptensor::EinsumExpression lhs, rhs, other;
+    return hiptensor::parseEinsum("ij,jk->ik", &lhs) && hiptensor::parseEinsum("xy,yZ->xZ", &rhs)
+           && hiptensor::parseEinsum("ij,jk->ki", &other) && lhs.mCanonical == rhs.mCanonical
+           && lhs.mCanonical != other.mCanonical;
+}
+
+bool operationTest()
+{
+    // A diagonal is copied by a permutation, and a trace summed by a reduction
+    hiptensor::EinsumExpression permutation, reduction, diagonal, trace, network;
+    return hiptensor::parseEinsum("abc->cab", &permutation)
+           && hiptensor::einsumOperation(permutation) == hiptensor::EinsumOp_t::PERMUTATION
+           && hiptensor::parseEinsum("abc->b", &reduction)
+           && hiptensor::einsumOperation(reduction) == hiptensor::EinsumOp_t::REDUCTION
+           && hiptensor::parseEinsum("iij->ji", &diagonal)
+           && hiptensor::einsumOperation(diagonal) == hiptensor::EinsumOp_t::PERMUTATION
+           && hiptensor::parseEinsum("ii->", &trace)
+           && hiptensor::einsumOperation(trace) == hiptensor::EinsumOp_t::REDUCTION
+           && hiptensor::parseEinsum("ab,bc,cd->ad", &network)
+           && hiptensor::einsumOperation(network) == hiptensor::EinsumOp_t::TENSOR_NETWORK;
+}
+
+bool repeatedAndSummedModesTest()
+{
+    hiptensor::EinsumExpression trace, summed, batch;
+    return hiptensor::parseEinsum("ii->", &trace) && hiptensor::hasRepeatedModes(trace)
+           && hiptensor::parseEinsum("ab,bc->c", &summed)
+           && hiptensor::hasSummedInputModes(summed)
+           && hiptensor::parseEinsum("bij,bjk->bik", &batch) && !hiptensor::hasRepeatedModes(batch)
+           && !hiptensor::hasSummedInputModes(batch);
+}
+
+bool invalidExpressionTest()
+{
+    hiptensor::EinsumExpression expression;
+    return !hiptensor::parseEinsum("ab,bc->ad", &expression)
+           && !hiptensor::parseEinsum("ab,bc->aa", &expression)
+           && !hiptensor::parseEinsum("a1,1b->ab", &expression)
+           && !hiptensor::parseEinsum("...a,a->...", &expression)
+           && !hiptensor::parseEinsum(nullptr, &expression);
+}
+
+// "ij->ji" is routed to a permutation, with scalars of the compute type. It is planned and
+// run on the device, and compared with the transpose on the host.
+template <typename DataT, typename ScalarT>
+bool permutationTest(hipDataType type, hiptensorComputeType_t typeCompute)
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    constexpr int64_t M = 24, N = 40;
+
+    int64_t lensX[]    = {M, N};
+    int64_t lensY[]    = {N, M};
+    int64_t stridesX[] = {1, M};
+    int64_t stridesY[] = {1, N};
+
+    hiptensorTensorDescriptor_t descX, descY;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descX, 2, lensX, stridesX, type, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descY, 2, lensY, stridesY, type, HIPTENSOR_OP_IDENTITY));
+
+    auto hostX = values<DataT>(M * N, 1);
+    auto X     = toDevice(hostX);
+    auto Y     = toDevice(std::vector<DataT>(M * N, DataT(0.0f)));
+
+    ScalarT alpha = ScalarT(2.0f);
+
+    void const*                        inputs[]     = {X};
+    hiptensorTensorDescriptor_t const* descInputs[] = {&descX};
+
+    uint64_t workspaceSize = 0;
+    bool     pass          = hiptensorEinsumGetWorkspaceSize(
+                    handle, "ij->ji", 1, descInputs, &descY, typeCompute, &workspaceSize)
+                == HIPTENSOR_STATUS_SUCCESS;
+
+    void* workspace = nullptr;
+    if(workspaceSize > 0)
+    {
+        CHECK_HIP_ERROR(hipMalloc(&workspace, workspaceSize));
+    }
+    pass = pass
+           && hiptensorEinsum(handle,
+                              "ij->ji",
+                              &alpha,
+                              1,
+                              inputs,
+                              descInputs,
+                              Y,
+                              &descY,
+                              typeCompute,
+                              workspace,
+                              workspaceSize,
+                              nullptr)
+                  == HIPTENSOR_STATUS_SUCCESS;
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    std::vector<DataT> expected(M * N);
+    for(int64_t m = 0; m < M; m++)
+    {
+        for(int64_t n = 0; n < N; n++)
+        {
+            expected[n + m * N] = DataT(2.0f * float(hostX[m + n * M]));
+        }
+    }
+    pass = pass && nearlyEqual(toHost(Y, M * N), expected, roundingTolerance(type));
+
+    CHECK_HIP_ERROR(hipFree(X));
+    CHECK_HIP_ERROR(hipFree(Y));
+    CHECK_HIP_ERROR(hipFree(workspace));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = explicitOutputTest();
+    totalPass &= testPass;
+    std::cout << "explicitOutput: ";
+    printBool(testPass);
+
+    testPass = implicitOutputTest();
+    totalPass &= testPass;
+    std::cout << "implicitOutput: ";
+    printBool(testPass);
+
+    testPass = canonicalTest();
+    totalPass &= testPass;
+    std::cout << "canonical: ";
+    printBool(testPass);
+
+    testPass = operationTest();
+    totalPass &= testPass;
+    std::cout << "operation: ";
+    printBool(testPass);
+
+    testPass = repeatedAndSummedModesTest();
+    totalPass &= testPass;
+    std::cout << "repeatedAndSummedModes: ";
+    printBool(testPass);
+
+    testPass = invalidExpressionTest();
+    totalPass &= testPass;
+    std::cout << "invalidExpression: ";
+    printBool(testPass);
+
+    testPass = permutationTest<float, float>(HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+    totalPass &= testPass;
+    std::cout << "permutationF32: ";
+    printBool(testPass);
+
+    testPass = permutationTest<_Float16, _Float16>(HIP_R_16F, HIPTENSOR_COMPUTE_16F);
+    totalPass &= testPass;
+    std::cout << "permutationF16: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "contraction/contraction_cpu_reference.hpp"
+#include "unit_test_helpers.hpp"
+
+// D[m, n] = activation(alpha * A[m, k] * B[n, k] + beta * C[m, n] + bias[n]), with f32 A
+// and B and D of DataT. Without an epilogue, an f16 or bf16 D takes the conversion alone.
+template <typename DataT>
+bool epilogueTest(hipDataType typeD, bool setEpilogue, hiptensorActivation_t activation)
+{
+    constexpr int64_t M = 64, N = 48, K = 32;
+
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    int64_t lensA[]    = {M, K};
+    int64_t lensB[]    = {N, K};
+    int64_t lensD[]    = {M, N};
+    int64_t lensBias[] = {N};
+
+    hiptensorTensorDescriptor_t descA, descB, descD, descBias;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descA, 2, lensA, nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descB, 2, lensB, nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descD, 2, lensD, nullptr, typeD, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descBias, 1, lensBias, nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+    int32_t modeA[]    = {'m', 'k'};
+    int32_t modeB[]    = {'n', 'k'};
+    int32_t modeD[]    = {'m', 'n'};
+    int32_t modeBias[] = {'n'};
+
+    auto hostA    = values(M * K, 1);
+    auto hostB    = values(N * K, 2);
+    auto hostBias = values(N, 3);
+    auto valuesC  = values(M * N, 4);
+
+    std::vector<DataT> hostC(valuesC.begin(), valuesC.end());
+
+    auto A    = toDevice(hostA);
+    auto B    = toDevice(hostB);
+    auto C    = toDevice(hostC);
+    auto D    = toDevice(std::vector<DataT>(M * N, DataT(0.0f)));
+    auto bias = toDevice(hostBias);
+
+    hiptensorContractionDescriptor_t desc;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(handle,
+                                                             &desc,
+                                                             &descA,
+                                                             modeA,
+                                                             0,
+                                                             &descB,
+                                                             modeB,
+                                                             0,
+                                                             &descD,
+                                                             modeD,
+                                                             0,
+                                                             &descD,
+                                                             modeD,
+                                                             0,
+                                                             HIPTENSOR_COMPUTE_32F));
+    if(setEpilogue)
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorContractionDescriptorSetEpilogue(
+            handle, &desc, bias, &descBias, modeBias, activation, -0.5f, 0.75f));
+    }
+
+    hiptensorContractionFind_t find;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT));
+
+    uint64_t workspaceSize = 0;
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionGetWorkspaceSize(
+        handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize));
+
+    hiptensorContractionPlan_t plan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionPlan(handle, &plan, &desc, &find, workspaceSize));
+
+    float alpha = 1.25f;
+    float beta  = 0.5f;
+    CHECK_HIPTENSOR_ERROR(
+        hiptensorContraction(handle, &plan, &alpha, A, B, &beta, C, D, nullptr, 0, 0));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    // The reference applies the epilogue of the plan on the host, reading the bias back.
+    // The f32 to f16 or bf16 conversion has no reference outside the epilogue.
+    std::vector<DataT> expected(M * N, DataT(0.0f));
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionReference(&plan,
+                                                        &alpha,
+                                                        hostA.data(),
+                                                        hostB.data(),
+                                                        &beta,
+                                                        hostC.data(),
+                                                        expected.data(),
+                                                        desc.mTensorDesc[0].mLengths,
+                                                        desc.mTensorDesc[0].mStrides,
+                                                        desc.mTensorMode[0],
+                                                        desc.mTensorDesc[1].mLengths,
+                                                        desc.mTensorDesc[1].mStrides,
+                                                        desc.mTensorMode[1],
+                                                        desc.mTensorDesc[2].mLengths,
+                                                        desc.mTensorDesc[2].mStrides,
+                                                        desc.mTensorMode[2],
+                                                        desc.mTensorDesc[3].mLengths,
+                                                        desc.mTensorDesc[3].mStrides,
+                                                        desc.mTensorMode[3],
+                                                        HIP_R_32F,
+                                                        HIP_R_32F,
+                                                        typeD,
+                                                        typeD,
+                                                        nullptr));
+
+    bool pass = nearlyEqual(toHost(D, M * N), expected, roundingTolerance(typeD));
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(B));
+    CHECK_HIP_ERROR(hipFree(C));
+    CHECK_HIP_ERROR(hipFree(D));
+    CHECK_HIP_ERROR(hipFree(bias));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    const std::pair<hiptensorActivation_t, const char*> activations[]
+        = {{HIPTENSOR_ACTIVATION_NONE, "None"},
+           {HIPTENSOR_ACTIVATION_RELU, "Relu"},
+           {HIPTENSOR_ACTIVATION_GELU, "Gelu"},
+           {HIPTENSOR_ACTIVATION_SILU, "Silu"},
+           {HIPTENSOR_ACTIVATION_CLAMP, "Clamp"}};
+
+    for(auto const& [activation, name] : activations)
+    {
+        testPass = epilogueTest<float>(HIP_R_32F, true, activation);
+        totalPass &= testPass;
+        std::cout << "biasF32" << name << ": ";
+        printBool(testPass);
+
+        testPass = epilogueTest<_Float16>(HIP_R_16F, true, activation);
+        totalPass &= testPass;
+        std::cout << "biasF16" << name << ": ";
+        printBool(testPass);
+
+        testPass = epilogueTest<hip_bfloat16>(HIP_R_16BF, true, activation);
+        totalPass &= testPass;
+        std::cout << "biasBF16" << name << ": ";
+        printBool(testPass);
+    }
+
+    testPass = epilogueTest<_Float16>(HIP_R_16F, false, HIPTENSOR_ACTIVATION_NONE);
+    totalPass &= testPass;
+    std::cout << "conversionF16: ";
+    printBool(testPass);
+
+    testPass = epilogueTest<hip_bfloat16>(HIP_R_16BF, false, HIPTENSOR_ACTIVATION_NONE);
+    totalPass &= testPass;
+    std::cout << "conversionBF16: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
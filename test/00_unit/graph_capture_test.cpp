@@ -0,0 +1,514 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "hip_device.hpp"
+#include "unit_test_helpers.hpp"
+#include "workspace_arena.hpp"
+
+// Captures the work queued by enqueue on the stream, and instantiates it. Returns a null
+// graph if the work fails or the capture is invalidated.
+hipGraphExec_t capture(hipStream_t stream, std::function<hiptensorStatus_t()> const& enqueue)
+{
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    auto status = enqueue();
+
+    hipGraph_t graph = nullptr;
+    if(hipStreamEndCapture(stream, &graph) != hipSuccess || status != HIPTENSOR_STATUS_SUCCESS)
+    {
+        (void)hipGetLastError();
+        if(graph != nullptr)
+        {
+            CHECK_HIP_ERROR(hipGraphDestroy(graph));
+        }
+        return nullptr;
+    }
+
+    hipGraphExec_t exec = nullptr;
+    CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    return exec;
+}
+
+void replay(hipGraphExec_t exec, hipStream_t stream)
+{
+    CHECK_HIP_ERROR(hipGraphLaunch(exec, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+}
+
+bool arenaCaptureTest()
+{
+    hiptensor::WorkspaceArena arena;
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    bool pass = !hiptensor::isStreamCapturing(stream) && !hiptensor::isStreamCapturing(nullptr);
+
+    // Captured requests are allocated by the graph, not taken from the cache
+    auto exec = capture(stream, [&]() {
+        pass &= hiptensor::isStreamCapturing(stream);
+
+        auto allocation = arena.allocate(1000, stream);
+        pass &= allocation.get() != nullptr && arena.reservedBytes() == 0
+                && arena.usedBytes() == 0;
+        return HIPTENSOR_STATUS_SUCCESS;
+    });
+    pass &= exec != nullptr && !hiptensor::isStreamCapturing(stream);
+
+    if(exec != nullptr)
+    {
+        replay(exec, stream);
+        replay(exec, stream);
+        CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    }
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return pass && arena.reservedBytes() == 0;
+}
+
+bool permutationCaptureTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    // B[n, m] = 2 * A[m, n], with the first mode fastest
+    constexpr int64_t M = 4, N = 3;
+
+    int32_t modeA[]    = {'m', 'n'};
+    int32_t modeB[]    = {'n', 'm'};
+    int64_t lensA[]    = {M, N};
+    int64_t lensB[]    = {N, M};
+    int64_t stridesA[] = {1, M};
+    int64_t stridesB[] = {1, N};
+
+    hiptensorTensorDescriptor_t descA, descB;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descA, 2, lensA, stridesA, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descB, 2, lensB, stridesB, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+    std::vector<float> hostA(M * N);
+    for(std::size_t i = 0; i < hostA.size(); i++)
+    {
+        hostA[i] = float(i);
+    }
+    auto  A     = toDevice(hostA);
+    auto  B     = toDevice(std::vector<float>(M * N, 0.0f));
+    float alpha = 2.0f;
+
+    auto exec = capture(stream, [&]() {
+        return hiptensorPermutation(
+            handle, &alpha, A, &descA, modeA, B, &descB, modeB, HIP_R_32F, stream);
+    });
+
+    // The graph reads A when it is replayed, not when it is captured
+    bool pass = exec != nullptr;
+    for(int run = 0; pass && run < 2; run++)
+    {
+        for(auto& a : hostA)
+        {
+            a += 1.0f;
+        }
+        CHECK_HIP_ERROR(
+            hipMemcpy(A, hostA.data(), hostA.size() * sizeof(float), hipMemcpyHostToDevice));
+        replay(exec, stream);
+
+        std::vector<float> expected(M * N);
+        for(int64_t m = 0; m < M; m++)
+        {
+            for(int64_t n = 0; n < N; n++)
+            {
+                expected[n + m * N] = alpha * hostA[m + n * M];
+            }
+        }
+        pass &= nearlyEqual(toHost(B, M * N), expected);
+    }
+
+    if(exec != nullptr)
+    {
+        CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    }
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(B));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+bool reductionCaptureTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    // D[m] = alpha * sum_n A[m, n] + beta * C[m], with C copied to D in the graph
+    constexpr int64_t M = 8, N = 16;
+
+    int32_t modeA[]    = {'m', 'n'};
+    int32_t modeD[]    = {'m'};
+    int64_t lensA[]    = {M, N};
+    int64_t lensD[]    = {M};
+    int64_t stridesA[] = {1, M};
+    int64_t stridesD[] = {1};
+
+    hiptensorTensorDescriptor_t descA, descD;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descA, 2, lensA, stridesA, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descD, 1, lensD, stridesD, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+    std::vector<float> hostA(M * N), hostC(M);
+    for(std::size_t i = 0; i < hostA.size(); i++)
+    {
+        hostA[i] = float(i % 7);
+    }
+    for(std::size_t i = 0; i < hostC.size(); i++)
+    {
+        hostC[i] = float(i);
+    }
+    auto  A     = toDevice(hostA);
+    auto  C     = toDevice(hostC);
+    auto  D     = toDevice(std::vector<float>(M, 0.0f));
+    float alpha = 0.5f;
+    float beta  = -1.0f;
+
+    auto exec = capture(stream, [&]() {
+        return hiptensorReduction(handle,
+                                  &alpha,
+                                  A,
+                                  &descA,
+                                  modeA,
+                                  &beta,
+                                  C,
+                                  &descD,
+                                  modeD,
+                                  D,
+                                  &descD,
+                                  modeD,
+                                  HIPTENSOR_OP_ADD,
+                                  HIPTENSOR_COMPUTE_32F,
+                                  nullptr,
+                                  0,
+                                  stream);
+    });
+
+    // D is overwritten from C on each replay, so replays give the same result
+    std::vector<float> expected(M);
+    for(int64_t m = 0; m < M; m++)
+    {
+        float sum = 0.0f;
+        for(int64_t n = 0; n < N; n++)
+        {
+            sum += hostA[m + n * M];
+        }
+        expected[m] = alpha * sum + beta * hostC[m];
+    }
+
+    bool pass = exec != nullptr;
+    for(int run = 0; pass && run < 2; run++)
+    {
+        replay(exec, stream);
+        pass &= nearlyEqual(toHost(D, M), expected);
+    }
+
+    if(exec != nullptr)
+    {
+        CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    }
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(C));
+    CHECK_HIP_ERROR(hipFree(D));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+// With summedMode, A has a mode s found in no other tensor. It is summed out into the
+// workspace first, so the captured contraction always takes workspace from the arena.
+bool contractionCaptureTest(bool summedMode)
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    // D[m, n] = alpha * A[m, k, s] * B[n, k] + beta * C[m, n]
+    constexpr int64_t M = 32, N = 32, K = 32;
+
+    int64_t S     = summedMode ? 4 : 1;
+    int     rankA = summedMode ? 3 : 2;
+
+    int32_t modeA[]    = {'m', 'k', 's'};
+    int32_t modeB[]    = {'n', 'k'};
+    int32_t modeD[]    = {'m', 'n'};
+    int64_t lensA[]    = {M, K, S};
+    int64_t lensB[]    = {N, K};
+    int64_t lensD[]    = {M, N};
+    int64_t stridesA[] = {1, M, M * K};
+    int64_t stridesB[] = {1, N};
+    int64_t stridesD[] = {1, M};
+
+    hiptensorTensorDescriptor_t descA, descB, descD;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descA, rankA, lensA, stridesA, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descB, 2, lensB, stridesB, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descD, 2, lensD, stridesD, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+    // Plans are selected before the capture: selection times kernels
+    hiptensorContractionDescriptor_t desc;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(handle,
+                                                             &desc,
+                                                             &descA,
+                                                             modeA,
+                                                             0,
+                                                             &descB,
+                                                             modeB,
+                                                             0,
+                                                             &descD,
+                                                             modeD,
+                                                             0,
+                                                             &descD,
+                                                             modeD,
+                                                             0,
+                                                             HIPTENSOR_COMPUTE_32F));
+
+    hiptensorContractionFind_t find;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT));
+
+    uint64_t workspaceSize = 0;
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionGetWorkspaceSize(
+        handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize));
+
+    hiptensorContractionPlan_t plan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionPlan(handle, &plan, &desc, &find, workspaceSize));
+
+    std::vector<float> hostA(M * K * S), hostB(N * K), hostC(M * N);
+    for(std::size_t i = 0; i < hostA.size(); i++)
+    {
+        hostA[i] = float(i % 5) - 2.0f;
+    }
+    for(std::size_t i = 0; i < hostB.size(); i++)
+    {
+        hostB[i] = float(i % 3) * 0.5f;
+    }
+    for(std::size_t i = 0; i < hostC.size(); i++)
+    {
+        hostC[i] = float(i % 4);
+    }
+    auto  A     = toDevice(hostA);
+    auto  B     = toDevice(hostB);
+    auto  C     = toDevice(hostC);
+    auto  D     = toDevice(std::vector<float>(M * N, 0.0f));
+    float alpha = 1.5f;
+    float beta  = 2.0f;
+
+    // The library-managed workspace is allocated and freed by the graph
+    auto exec = capture(stream, [&]() {
+        return hiptensorContraction(
+            handle, &plan, &alpha, A, B, &beta, C, D, nullptr, workspaceSize, stream);
+    });
+
+    bool pass = exec != nullptr && (!summedMode || plan.mWorkspaceSize > 0);
+    for(int run = 0; pass && run < 2; run++)
+    {
+        for(auto& a : hostA)
+        {
+            a *= -1.0f;
+        }
+        CHECK_HIP_ERROR(
+            hipMemcpy(A, hostA.data(), hostA.size() * sizeof(float), hipMemcpyHostToDevice));
+        replay(exec, stream);
+
+        std::vector<float> expected(M * N);
+        for(int64_t m = 0; m < M; m++)
+        {
+            for(int64_t n = 0; n < N; n++)
+            {
+                float sum = 0.0f;
+                for(int64_t k = 0; k < K; k++)
+                {
+                    for(int64_t i = 0; i < S; i++)
+                    {
+                        sum += hostA[m + k * M + i * M * K] * hostB[n + k * N];
+                    }
+                }
+                expected[m + n * M] = alpha * sum + beta * hostC[m + n * M];
+            }
+        }
+        pass &= nearlyEqual(toHost(D, M * N), expected);
+    }
+
+    if(exec != nullptr)
+    {
+        CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    }
+    for(auto* ptr : {A, B, C, D})
+    {
+        CHECK_HIP_ERROR(hipFree(ptr));
+    }
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+bool unplannedEinsumCaptureTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    int64_t lens[] = {4, 4};
+
+    hiptensorTensorDescriptor_t desc;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &desc, 2, lens, nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+    auto  A     = toDevice(std::vector<float>(16, 1.0f));
+    auto  B     = toDevice(std::vector<float>(16, 0.0f));
+    float alpha = 1.0f;
+
+    void const*                        inputs[]     = {A};
+    hiptensorTensorDescriptor_t const* descInputs[] = {&desc};
+
+    // An expression can not be planned while capturing. The capture is left valid.
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    auto status = hiptensorEinsum(handle,
+                                  "ij->ji",
+                                  &alpha,
+                                  1,
+                                  inputs,
+                                  descInputs,
+                                  B,
+                                  &desc,
+                                  HIPTENSOR_COMPUTE_32F,
+                                  nullptr,
+                                  0,
+                                  stream);
+    hipGraph_t graph = nullptr;
+    bool       pass  = hipStreamEndCapture(stream, &graph) == hipSuccess
+                && status == HIPTENSOR_STATUS_NOT_SUPPORTED;
+    if(graph != nullptr)
+    {
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    }
+
+    // Once planned, the expression is captured from the cache
+    uint64_t workspaceSize = 0;
+    CHECK_HIPTENSOR_ERROR(hiptensorEinsumGetWorkspaceSize(handle,
+                                                          "ij->ji",
+                                                          1,
+                                                          descInputs,
+                                                          &desc,
+                                                          HIPTENSOR_COMPUTE_32F,
+                                                          &workspaceSize));
+    auto exec = capture(stream, [&]() {
+        return hiptensorEinsum(handle,
+                               "ij->ji",
+                               &alpha,
+                               1,
+                               inputs,
+                               descInputs,
+                               B,
+                               &desc,
+                               HIPTENSOR_COMPUTE_32F,
+                               nullptr,
+                               0,
+                               stream);
+    });
+    pass &= exec != nullptr;
+    if(exec != nullptr)
+    {
+        replay(exec, stream);
+        pass &= toHost(B, 16) == std::vector<float>(16, 1.0f);
+        CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    }
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(B));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = arenaCaptureTest();
+    totalPass &= testPass;
+    std::cout << "arenaCapture: ";
+    printBool(testPass);
+
+    testPass = permutationCaptureTest();
+    totalPass &= testPass;
+    std::cout << "permutationCapture: ";
+    printBool(testPass);
+
+    testPass = reductionCaptureTest();
+    totalPass &= testPass;
+    std::cout << "reductionCapture: ";
+    printBool(testPass);
+
+    testPass = contractionCaptureTest(false);
+    totalPass &= testPass;
+    std::cout << "contractionCapture: ";
+    printBool(testPass);
+
+    testPass = contractionCaptureTest(true);
+    totalPass &= testPass;
+    std::cout << "contractionSummedModeCapture: ";
+    printBool(testPass);
+
+    testPass = unplannedEinsumCaptureTest();
+    totalPass &= testPass;
+    std::cout << "unplannedEinsumCapture: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "contraction/contraction_cpu_reference.hpp"
+#include "unit_test_helpers.hpp"
+
+// D_g[m, n] = alpha * A_g[m, k] * B_g[n, k] + beta * C_g[m, n] for groups g of different
+// extents, each checked against the CPU reference of its own descriptor
+template <typename DataT, typename ScalarT>
+bool groupedTest(hipDataType type, hiptensorComputeType_t computeType)
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    struct Extents
+    {
+        int64_t m, n, k;
+    };
+    std::vector<Extents> extents = {{32, 16, 8}, {8, 64, 24}, {48, 24, 40}};
+    auto                 groups  = extents.size();
+
+    int32_t modeA[] = {'m', 'k'};
+    int32_t modeB[] = {'n', 'k'};
+    int32_t modeD[] = {'m', 'n'};
+
+    std::vector<hiptensorContractionDescriptor_t> descs(groups);
+    std::vector<std::vector<DataT>>               hostA, hostB, hostC, expected;
+    std::vector<DataT*>                           A, B, C, D;
+
+    ScalarT alpha = static_cast<ScalarT>(1.5);
+    ScalarT beta  = static_cast<ScalarT>(-0.5);
+
+    for(std::size_t g = 0; g < groups; g++)
+    {
+        auto [m, n, k] = extents[g];
+
+        int64_t lensA[] = {m, k};
+        int64_t lensB[] = {n, k};
+        int64_t lensD[] = {m, n};
+
+        hiptensorTensorDescriptor_t descA, descB, descD;
+        CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+            handle, &descA, 2, lensA, nullptr, type, HIPTENSOR_OP_IDENTITY));
+        CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+            handle, &descB, 2, lensB, nullptr, type, HIPTENSOR_OP_IDENTITY));
+        CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+            handle, &descD, 2, lensD, nullptr, type, HIPTENSOR_OP_IDENTITY));
+
+        CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(handle,
+                                                                 &descs[g],
+                                                                 &descA,
+                                                                 modeA,
+                                                                 0,
+                                                                 &descB,
+                                                                 modeB,
+                                                                 0,
+                                                                 &descD,
+                                                                 modeD,
+                                                                 0,
+                                                                 &descD,
+                                                                 modeD,
+                                                                 0,
+                                                                 computeType));
+
+        hostA.push_back(values<DataT>(m * k, int(g)));
+        hostB.push_back(values<DataT>(n * k, int(g) + 1));
+        hostC.push_back(values<DataT>(m * n, int(g) + 2));
+        expected.push_back(std::vector<DataT>(m * n));
+
+        A.push_back(toDevice(hostA[g]));
+        B.push_back(toDevice(hostB[g]));
+        C.push_back(toDevice(hostC[g]));
+        D.push_back(toDevice(std::vector<DataT>(m * n, DataT(0))));
+
+        hiptensorContractionPlan_t plan;
+        plan.mContractionDesc = descs[g];
+        plan.mSolution        = nullptr;
+
+        auto const& desc = descs[g];
+        CHECK_HIPTENSOR_ERROR(hiptensorContractionReference(&plan,
+                                                            &alpha,
+                                                            hostA[g].data(),
+                                                            hostB[g].data(),
+                                                            &beta,
+                                                            hostC[g].data(),
+                                                            expected[g].data(),
+                                                            desc.mTensorDesc[0].mLengths,
+                                                            desc.mTensorDesc[0].mStrides,
+                                                            desc.mTensorMode[0],
+                                                            desc.mTensorDesc[1].mLengths,
+                                                            desc.mTensorDesc[1].mStrides,
+                                                            desc.mTensorMode[1],
+                                                            desc.mTensorDesc[3].mLengths,
+                                                            desc.mTensorDesc[3].mStrides,
+                                                            desc.mTensorMode[3],
+                                                            desc.mTensorDesc[3].mLengths,
+                                                            desc.mTensorDesc[3].mStrides,
+                                                            desc.mTensorMode[3],
+                                                            type,
+                                                            type,
+                                                            type,
+                                                            type,
+                                                            nullptr));
+    }
+
+    std::vector<hiptensorContractionDescriptor_t const*> descPtrs;
+    for(auto const& desc : descs)
+    {
+        descPtrs.push_back(&desc);
+    }
+    std::vector<void const*> ptrA(A.begin(), A.end());
+    std::vector<void const*> ptrB(B.begin(), B.end());
+    std::vector<void const*> ptrC(C.begin(), C.end());
+    std::vector<void*>       ptrD(D.begin(), D.end());
+
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionGrouped(handle,
+                                                      descPtrs.data(),
+                                                      &alpha,
+                                                      ptrA.data(),
+                                                      ptrB.data(),
+                                                      &beta,
+                                                      ptrC.data(),
+                                                      ptrD.data(),
+                                                      uint32_t(groups),
+                                                      nullptr,
+                                                      0,
+                                                      stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    bool pass = true;
+    for(std::size_t g = 0; g < groups; g++)
+    {
+        pass &= nearlyEqual(toHost(D[g], expected[g].size()), expected[g], roundingTolerance(type));
+    }
+
+    for(std::size_t g = 0; g < groups; g++)
+    {
+        for(auto* ptr : {A[g], B[g], C[g], D[g]})
+        {
+            CHECK_HIP_ERROR(hipFree(ptr));
+        }
+    }
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    // f32 and f64 groups are contracted by a single grouped launch
+    testPass = groupedTest<float, float>(HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+    totalPass &= testPass;
+    std::cout << "groupedF32: ";
+    printBool(testPass);
+
+    testPass = groupedTest<double, double>(HIP_R_64F, HIPTENSOR_COMPUTE_64F);
+    totalPass &= testPass;
+    std::cout << "groupedF64: ";
+    printBool(testPass);
+
+    // f16 has no grouped kernels: its groups are contracted one by one
+    testPass = groupedTest<_Float16, float>(HIP_R_16F, HIPTENSOR_COMPUTE_32F);
+    totalPass &= testPass;
+    std::cout << "groupedF16: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
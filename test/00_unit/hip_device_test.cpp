@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// hiptensor includes
+#include "hip_device.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool hipDeviceCacheTest()
+{
+    auto const& current = hiptensor::HipDevice::current();
+    hiptensor::HipDevice queried;
+
+    return &current == &hiptensor::HipDevice::instance(current.getDeviceId())
+           && current.getDeviceId() == hiptensor::HipDevice::currentDeviceId()
+           && current.getDeviceId() == queried.getDeviceId()
+           && current.getGcnArch() == queried.getGcnArch()
+           && current.cuCount() == queried.cuCount()
+           && strcmp(current.getDeviceProps().gcnArchName, queried.getDeviceProps().gcnArchName)
+                  == 0;
+}
+
+bool hipDeviceConcurrentTest()
+{
+    auto deviceId = hiptensor::HipDevice::currentDeviceId();
+
+    std::vector<hiptensor::HipDevice const*> devices(8, nullptr);
+    std::vector<std::thread>                 threads;
+    for(size_t i = 0; i < devices.size(); i++)
+    {
+        threads.emplace_back(
+            [&devices, deviceId, i]() { devices[i] = &hiptensor::HipDevice::instance(deviceId); });
+    }
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for(auto* device : devices)
+    {
+        if(device != devices[0])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = hipDeviceCacheTest();
+    totalPass &= testPass;
+    std::cout << "hipDeviceCache: ";
+    printBool(testPass);
+
+    testPass = hipDeviceConcurrentTest();
+    totalPass &= testPass;
+    std::cout << "hipDeviceConcurrent: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
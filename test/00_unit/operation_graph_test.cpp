@@ -0,0 +1,423 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "operation_graph.hpp"
+#include "unit_test_helpers.hpp"
+
+bool scheduleTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    // 16 x 16 floats: 1024 bytes, a multiple of the buffer alignment
+    constexpr int64_t M = 16;
+
+    int32_t modeA[]   = {'m', 'n'};
+    int32_t modeB[]   = {'n', 'm'};
+    int64_t lens[]    = {M, M};
+    int64_t strides[] = {1, M};
+
+    hiptensorTensorDescriptor_t desc;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &desc, 2, lens, strides, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+    // Only the tensor ids matter to the schedule, not the data
+    auto  X     = reinterpret_cast<void*>(0x1000);
+    auto  Y     = reinterpret_cast<void*>(0x2000);
+    float alpha = 1.0f;
+
+    bool pass = true;
+
+    // Two permutations of the same input are independent
+    {
+        hiptensorOperationGraph_t* graph = nullptr;
+        CHECK_HIPTENSOR_ERROR(hiptensorCreateOperationGraph(handle, &graph, 0));
+
+        int32_t x, p0, p1, n0, n1;
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, X, &x));
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, nullptr, &p0));
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, nullptr, &p1));
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddPermutation(
+            graph, &alpha, x, modeA, p0, modeB, HIP_R_32F, &n0));
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddPermutation(
+            graph, &alpha, x, modeA, p1, modeB, HIP_R_32F, &n1));
+
+        auto const& schedule = graph->schedule();
+        pass &= schedule.mStreamCount == 2 && schedule.mStreams[n0] != schedule.mStreams[n1]
+                && schedule.mWaits[n0].empty() && schedule.mWaits[n1].empty();
+
+        // Both intermediates are live at the same time
+        pass &= schedule.mWorkspaceSize == 2 * M * M * sizeof(float)
+                && schedule.mTensorOffsets[p0] != schedule.mTensorOffsets[p1];
+
+        CHECK_HIPTENSOR_ERROR(hiptensorDestroyOperationGraph(graph));
+    }
+
+    // A chain X -> T0 -> T1 -> T2 -> Y stays on one stream, and T2 reuses T0
+    {
+        hiptensorOperationGraph_t* graph = nullptr;
+        CHECK_HIPTENSOR_ERROR(hiptensorCreateOperationGraph(handle, &graph, 0));
+
+        int32_t x, y, t[3], n[4];
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, X, &x));
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, Y, &y));
+        for(auto& id : t)
+        {
+            CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, nullptr, &id));
+        }
+
+        // An intermediate must be written before it is read
+        pass &= hiptensorOperationGraphAddPermutation(
+                    graph, &alpha, t[0], modeA, y, modeB, HIP_R_32F, nullptr)
+                == HIPTENSOR_STATUS_INVALID_VALUE;
+        pass &= hiptensorOperationGraphAddPermutation(
+                    graph, &alpha, x, modeA, 42, modeB, HIP_R_32F, nullptr)
+                == HIPTENSOR_STATUS_INVALID_VALUE;
+
+        int32_t inputs[]  = {x, t[0], t[1], t[2]};
+        int32_t outputs[] = {t[0], t[1], t[2], y};
+        for(int i = 0; i < 4; i++)
+        {
+            CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddPermutation(
+                graph, &alpha, inputs[i], modeA, outputs[i], modeB, HIP_R_32F, &n[i]));
+        }
+
+        auto const& schedule = graph->schedule();
+        pass &= schedule.mStreamCount == 1;
+        for(int i = 0; i < 4; i++)
+        {
+            pass &= schedule.mOrder[i] == n[i] && schedule.mWaits[n[i]].empty();
+        }
+
+        uint64_t workspaceSize = 0;
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphGetWorkspaceSize(graph, &workspaceSize));
+        pass &= workspaceSize == 2 * M * M * sizeof(float)
+                && schedule.mTensorOffsets[t[0]] == schedule.mTensorOffsets[t[2]];
+
+        CHECK_HIPTENSOR_ERROR(hiptensorDestroyOperationGraph(graph));
+    }
+
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+bool executeTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    // T0[n, m] = 2 * X[m, n] and T1[n, m] = 3 * X[m, n] run concurrently. Then
+    // Y[m] = sum_n T0[n, m] and Z[m] = sum_n T1[n, m] + Y[m].
+    constexpr int64_t M = 8, N = 32;
+
+    int32_t modeX[]    = {'m', 'n'};
+    int32_t modeT[]    = {'n', 'm'};
+    int32_t modeY[]    = {'m'};
+    int64_t lensX[]    = {M, N};
+    int64_t lensT[]    = {N, M};
+    int64_t lensY[]    = {M};
+    int64_t stridesX[] = {1, M};
+    int64_t stridesT[] = {1, N};
+    int64_t stridesY[] = {1};
+
+    hiptensorTensorDescriptor_t descX, descT, descY;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descX, 2, lensX, stridesX, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descT, 2, lensT, stridesT, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descY, 1, lensY, stridesY, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+    std::vector<float> hostX(M * N);
+    for(std::size_t i = 0; i < hostX.size(); i++)
+    {
+        hostX[i] = float(i % 9) - 4.0f;
+    }
+    auto X = toDevice(hostX);
+    auto Y = toDevice(std::vector<float>(M, 0.0f));
+    auto Z = toDevice(std::vector<float>(M, 0.0f));
+
+    float two = 2.0f, three = 3.0f, one = 1.0f;
+
+    hiptensorOperationGraph_t* graph = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreateOperationGraph(handle, &graph, 2));
+
+    int32_t x, y, z, t0, t1;
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &descX, X, &x));
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &descY, Y, &y));
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &descY, Z, &z));
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &descT, nullptr, &t0));
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &descT, nullptr, &t1));
+
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddPermutation(
+        graph, &two, x, modeX, t0, modeT, HIP_R_32F, nullptr));
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddPermutation(
+        graph, &three, x, modeX, t1, modeT, HIP_R_32F, nullptr));
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddReduction(graph,
+                                                              &one,
+                                                              t0,
+                                                              modeT,
+                                                              nullptr,
+                                                              -1,
+                                                              nullptr,
+                                                              y,
+                                                              modeY,
+                                                              HIPTENSOR_OP_ADD,
+                                                              HIPTENSOR_COMPUTE_32F,
+                                                              nullptr));
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddReduction(graph,
+                                                              &one,
+                                                              t1,
+                                                              modeT,
+                                                              &one,
+                                                              y,
+                                                              modeY,
+                                                              z,
+                                                              modeY,
+                                                              HIPTENSOR_OP_ADD,
+                                                              HIPTENSOR_COMPUTE_32F,
+                                                              nullptr));
+
+    std::vector<float> expectedY(M), expectedZ(M);
+    for(int64_t m = 0; m < M; m++)
+    {
+        float sum = 0.0f;
+        for(int64_t n = 0; n < N; n++)
+        {
+            sum += hostX[m + n * M];
+        }
+        expectedY[m] = 2.0f * sum;
+        expectedZ[m] = 5.0f * sum;
+    }
+
+    uint64_t workspaceSize = 0;
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphGetWorkspaceSize(graph, &workspaceSize));
+
+    bool pass = workspaceSize > 0;
+
+    // A user workspace that is too small is rejected
+    void* workspace = nullptr;
+    CHECK_HIP_ERROR(hipMalloc(&workspace, workspaceSize));
+    pass &= hiptensorOperationGraphExecute(handle, graph, workspace, workspaceSize - 1, stream)
+            == HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+
+    // The same operations run one after another on the stream, with their own buffers
+    float zero  = 0.0f;
+    auto  seqT0 = toDevice(std::vector<float>(M * N, 0.0f));
+    auto  seqT1 = toDevice(std::vector<float>(M * N, 0.0f));
+    auto  seqY  = toDevice(std::vector<float>(M, 0.0f));
+    auto  seqZ  = toDevice(std::vector<float>(M, 0.0f));
+    CHECK_HIPTENSOR_ERROR(hiptensorPermutation(
+        handle, &two, X, &descX, modeX, seqT0, &descT, modeT, HIP_R_32F, stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorPermutation(
+        handle, &three, X, &descX, modeX, seqT1, &descT, modeT, HIP_R_32F, stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorReduction(handle,
+                                             &one,
+                                             seqT0,
+                                             &descT,
+                                             modeT,
+                                             &zero,
+                                             seqY,
+                                             &descY,
+                                             modeY,
+                                             seqY,
+                                             &descY,
+                                             modeY,
+                                             HIPTENSOR_OP_ADD,
+                                             HIPTENSOR_COMPUTE_32F,
+                                             nullptr,
+                                             0,
+                                             stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorReduction(handle,
+                                             &one,
+                                             seqT1,
+                                             &descT,
+                                             modeT,
+                                             &one,
+                                             seqY,
+                                             &descY,
+                                             modeY,
+                                             seqZ,
+                                             &descY,
+                                             modeY,
+                                             HIPTENSOR_OP_ADD,
+                                             HIPTENSOR_COMPUTE_32F,
+                                             nullptr,
+                                             0,
+                                             stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    auto sequentialY = toHost(seqY, M);
+    auto sequentialZ = toHost(seqZ, M);
+    pass &= nearlyEqual(sequentialY, expectedY) && nearlyEqual(sequentialZ, expectedZ);
+
+    // With the user workspace, then with the library-managed one
+    for(auto ws : {workspace, (void*)nullptr})
+    {
+        CHECK_HIP_ERROR(hipMemsetAsync(Y, 0, M * sizeof(float), stream));
+        CHECK_HIP_ERROR(hipMemsetAsync(Z, 0, M * sizeof(float), stream));
+        CHECK_HIPTENSOR_ERROR(
+            hiptensorOperationGraphExecute(handle, graph, ws, workspaceSize, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        pass &= nearlyEqual(toHost(Y, M), sequentialY) && nearlyEqual(toHost(Z, M), sequentialZ);
+    }
+
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroyOperationGraph(graph));
+    CHECK_HIP_ERROR(hipFree(workspace));
+    for(auto* ptr : {X, Y, Z, seqT0, seqT1, seqY, seqZ})
+    {
+        CHECK_HIP_ERROR(hipFree(ptr));
+    }
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+// A chain X -> T0 -> T1 -> T2 -> Y of scaled transposes, where T2 reuses the buffer of T0,
+// gives the result of the same permutations run one after another
+bool reuseTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    constexpr int64_t M = 16;
+
+    int32_t modeA[]   = {'m', 'n'};
+    int32_t modeB[]   = {'n', 'm'};
+    int64_t lens[]    = {M, M};
+    int64_t strides[] = {1, M};
+
+    hiptensorTensorDescriptor_t desc;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &desc, 2, lens, strides, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+
+    std::vector<float> hostX(M * M);
+    for(std::size_t i = 0; i < hostX.size(); i++)
+    {
+        hostX[i] = float(i % 13) - 6.0f;
+    }
+    auto X = toDevice(hostX);
+    auto Y = toDevice(std::vector<float>(M * M, 0.0f));
+
+    float alphas[] = {2.0f, -0.5f, 3.0f, 1.5f};
+
+    hiptensorOperationGraph_t* graph = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreateOperationGraph(handle, &graph, 2));
+
+    int32_t x, y, t[3];
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, X, &x));
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, Y, &y));
+    for(auto& id : t)
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddTensor(graph, &desc, nullptr, &id));
+    }
+
+    int32_t inputs[]  = {x, t[0], t[1], t[2]};
+    int32_t outputs[] = {t[0], t[1], t[2], y};
+    for(int i = 0; i < 4; i++)
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphAddPermutation(
+            graph, &alphas[i], inputs[i], modeA, outputs[i], modeB, HIP_R_32F, nullptr));
+    }
+
+    auto const& schedule = graph->schedule();
+    bool        pass     = schedule.mStreamCount == 1
+                && schedule.mTensorOffsets[t[0]] == schedule.mTensorOffsets[t[2]];
+
+    // Sequentially, each step has its own buffer
+    std::vector<float*> steps = {X};
+    for(int i = 0; i < 4; i++)
+    {
+        steps.push_back(toDevice(std::vector<float>(M * M, 0.0f)));
+        CHECK_HIPTENSOR_ERROR(hiptensorPermutation(handle,
+                                                   &alphas[i],
+                                                   steps[i],
+                                                   &desc,
+                                                   modeA,
+                                                   steps[i + 1],
+                                                   &desc,
+                                                   modeB,
+                                                   HIP_R_32F,
+                                                   stream));
+    }
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    auto sequential = toHost(steps.back(), M * M);
+
+    CHECK_HIPTENSOR_ERROR(hiptensorOperationGraphExecute(handle, graph, nullptr, 0, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    pass &= nearlyEqual(toHost(Y, M * M), sequential);
+
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroyOperationGraph(graph));
+    for(auto* ptr : steps)
+    {
+        CHECK_HIP_ERROR(hipFree(ptr));
+    }
+    CHECK_HIP_ERROR(hipFree(Y));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = scheduleTest();
+    totalPass &= testPass;
+    std::cout << "schedule: ";
+    printBool(testPass);
+
+    testPass = executeTest();
+    totalPass &= testPass;
+    std::cout << "execute: ";
+    printBool(testPass);
+
+    testPass = reuseTest();
+    totalPass &= testPass;
+    std::cout << "reuse: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
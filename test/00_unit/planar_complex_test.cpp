@@ -0,0 +1,535 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "contraction/contraction_cpu_reference.hpp"
+#include "unit_test_helpers.hpp"
+
+// Interleaved complex values of n elements, as the real plane then the imaginary plane
+// planeStride real elements further
+std::vector<float> toPlanar(std::vector<float> const& interleaved, std::size_t planeStride)
+{
+    auto               n = interleaved.size() / 2;
+    std::vector<float> planar(planeStride + n, 0.0f);
+    for(std::size_t i = 0; i < n; i++)
+    {
+        planar[i]               = interleaved[2 * i];
+        planar[planeStride + i] = interleaved[2 * i + 1];
+    }
+    return planar;
+}
+
+std::vector<float> toInterleaved(std::vector<float> const& planar, std::size_t planeStride)
+{
+    auto               n = planar.size() - planeStride;
+    std::vector<float> interleaved(2 * n);
+    for(std::size_t i = 0; i < n; i++)
+    {
+        interleaved[2 * i]     = planar[i];
+        interleaved[2 * i + 1] = planar[planeStride + i];
+    }
+    return interleaved;
+}
+
+std::vector<float> complexValues(std::size_t n, int seed)
+{
+    std::vector<float> values(2 * n);
+    for(std::size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = float((i * 7 + seed) % 11) * 0.25f - 1.25f;
+    }
+    return values;
+}
+
+// A tensor of n complex elements, on the device either interleaved or planar
+struct ComplexTensor
+{
+    ComplexTensor(std::vector<float> const& interleaved, std::size_t planeStride)
+        : mPlaneStride(planeStride)
+        , mCount(interleaved.size() / 2)
+        , mData(toDevice(planeStride == 0 ? interleaved : toPlanar(interleaved, planeStride)))
+    {
+    }
+
+    ~ComplexTensor()
+    {
+        CHECK_HIP_ERROR(hipFree(mData));
+    }
+
+    std::vector<float> interleaved() const
+    {
+        return mPlaneStride == 0 ? toHost(mData, 2 * mCount)
+                                 : toInterleaved(toHost(mData, mPlaneStride + mCount),
+                                                 mPlaneStride);
+    }
+
+    std::size_t mPlaneStride;
+    std::size_t mCount;
+    float*      mData;
+};
+
+void initComplexDescriptor(hiptensorHandle_t*           handle,
+                           hiptensorTensorDescriptor_t* desc,
+                           uint32_t                     numModes,
+                           int64_t const                lens[],
+                           std::size_t                  planeStride)
+{
+    if(planeStride == 0)
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+            handle, desc, numModes, lens, nullptr, HIP_C_32F, HIPTENSOR_OP_IDENTITY));
+    }
+    else
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorInitPlanarTensorDescriptor(
+            handle, desc, numModes, lens, nullptr, HIP_C_32F, HIPTENSOR_OP_IDENTITY, planeStride));
+    }
+}
+
+bool descriptorTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    int64_t lens[]    = {4, 3};
+    int64_t strides[] = {2, 8};
+
+    hiptensorTensorDescriptor_t desc;
+    bool                        pass = true;
+
+    // By default, the imaginary plane follows the span of the real plane
+    CHECK_HIPTENSOR_ERROR(hiptensorInitPlanarTensorDescriptor(
+        handle, &desc, 2, lens, strides, HIP_C_32F, HIPTENSOR_OP_IDENTITY, 0));
+    pass &= desc.mPlaneStride == 1 + 3 * 2 + 2 * 8;
+
+    CHECK_HIPTENSOR_ERROR(hiptensorInitPlanarTensorDescriptor(
+        handle, &desc, 2, lens, strides, HIP_C_64F, HIPTENSOR_OP_IDENTITY, 100));
+    pass &= desc.mPlaneStride == 100 && desc.mType == HIP_C_64F;
+
+    pass &= hiptensorInitPlanarTensorDescriptor(
+                handle, &desc, 2, lens, strides, HIP_R_32F, HIPTENSOR_OP_IDENTITY, 0)
+            == HIPTENSOR_STATUS_INVALID_VALUE;
+    pass &= hiptensorInitPlanarTensorDescriptor(
+                handle, &desc, 2, lens, strides, HIP_C_32F, HIPTENSOR_OP_IDENTITY, -1)
+            == HIPTENSOR_STATUS_INVALID_VALUE;
+
+    // The imaginary plane may touch the end of the real plane, but not start inside it
+    CHECK_HIPTENSOR_ERROR(hiptensorInitPlanarTensorDescriptor(
+        handle, &desc, 2, lens, strides, HIP_C_32F, HIPTENSOR_OP_IDENTITY, 1 + 3 * 2 + 2 * 8));
+    pass &= hiptensorInitPlanarTensorDescriptor(
+                handle, &desc, 2, lens, strides, HIP_C_32F, HIPTENSOR_OP_IDENTITY, 3 * 2 + 2 * 8)
+            == HIPTENSOR_STATUS_INVALID_VALUE;
+    pass &= hiptensorInitPlanarTensorDescriptor(
+                handle, &desc, 2, lens, strides, HIP_C_32F, HIPTENSOR_OP_IDENTITY, 1)
+            == HIPTENSOR_STATUS_INVALID_VALUE;
+
+    // Interleaved tensors have no planes
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &desc, 2, lens, strides, HIP_C_32F, HIPTENSOR_OP_IDENTITY));
+    pass &= desc.mPlaneStride == 0;
+
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+// D[m, n] = alpha * A[m, k] * B[n, k] + beta * C[m, n], with each of A, B and C/D planar
+// when its plane stride is not zero. Checked against the CPU reference of the same
+// contraction with all operands interleaved.
+bool contractionTest(std::size_t planeStrideA, std::size_t planeStrideB, std::size_t planeStrideD)
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    constexpr int64_t M = 16, N = 16, K = 16;
+
+    int32_t modeA[] = {'m', 'k'};
+    int32_t modeB[] = {'n', 'k'};
+    int32_t modeD[] = {'m', 'n'};
+    int64_t lensA[] = {M, K};
+    int64_t lensB[] = {N, K};
+    int64_t lensD[] = {M, N};
+
+    hiptensorTensorDescriptor_t descA, descB, descD;
+    initComplexDescriptor(handle, &descA, 2, lensA, planeStrideA);
+    initComplexDescriptor(handle, &descB, 2, lensB, planeStrideB);
+    initComplexDescriptor(handle, &descD, 2, lensD, planeStrideD);
+
+    hiptensorContractionDescriptor_t desc;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(handle,
+                                                             &desc,
+                                                             &descA,
+                                                             modeA,
+                                                             0,
+                                                             &descB,
+                                                             modeB,
+                                                             0,
+                                                             &descD,
+                                                             modeD,
+                                                             0,
+                                                             &descD,
+                                                             modeD,
+                                                             0,
+                                                             HIPTENSOR_COMPUTE_C32F));
+
+    hiptensorContractionFind_t find;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT));
+
+    uint64_t workspaceSize = 0;
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionGetWorkspaceSize(
+        handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize));
+
+    hiptensorContractionPlan_t plan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionPlan(handle, &plan, &desc, &find, workspaceSize));
+
+    auto hostA = complexValues(M * K, 1);
+    auto hostB = complexValues(N * K, 2);
+    auto hostC = complexValues(M * N, 3);
+
+    ComplexTensor A(hostA, planeStrideA);
+    ComplexTensor B(hostB, planeStrideB);
+    ComplexTensor C(hostC, planeStrideD);
+    ComplexTensor D(std::vector<float>(2 * M * N, 0.0f), planeStrideD);
+
+    auto alpha = make_hipFloatComplex(1.5f, -0.5f);
+    auto beta  = make_hipFloatComplex(0.5f, 1.0f);
+
+    CHECK_HIPTENSOR_ERROR(hiptensorContraction(handle,
+                                               &plan,
+                                               &alpha,
+                                               A.mData,
+                                               B.mData,
+                                               &beta,
+                                               C.mData,
+                                               D.mData,
+                                               nullptr,
+                                               workspaceSize,
+                                               stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // The same contraction of interleaved operands
+    hiptensorTensorDescriptor_t refA, refB, refD;
+    initComplexDescriptor(handle, &refA, 2, lensA, 0);
+    initComplexDescriptor(handle, &refB, 2, lensB, 0);
+    initComplexDescriptor(handle, &refD, 2, lensD, 0);
+
+    hiptensorContractionPlan_t refPlan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(handle,
+                                                             &refPlan.mContractionDesc,
+                                                             &refA,
+                                                             modeA,
+                                                             0,
+                                                             &refB,
+                                                             modeB,
+                                                             0,
+                                                             &refD,
+                                                             modeD,
+                                                             0,
+                                                             &refD,
+                                                             modeD,
+                                                             0,
+                                                             HIPTENSOR_COMPUTE_C32F));
+    refPlan.mSolution = nullptr;
+
+    std::vector<float> expected(2 * M * N);
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionReference(&refPlan,
+                                                        &alpha,
+                                                        hostA.data(),
+                                                        hostB.data(),
+                                                        &beta,
+                                                        hostC.data(),
+                                                        expected.data(),
+                                                        refA.mLengths,
+                                                        refA.mStrides,
+                                                        {'m', 'k'},
+                                                        refB.mLengths,
+                                                        refB.mStrides,
+                                                        {'n', 'k'},
+                                                        refD.mLengths,
+                                                        refD.mStrides,
+                                                        {'m', 'n'},
+                                                        refD.mLengths,
+                                                        refD.mStrides,
+                                                        {'m', 'n'},
+                                                        HIP_C_32F,
+                                                        HIP_C_32F,
+                                                        HIP_C_32F,
+                                                        HIP_C_32F,
+                                                        nullptr));
+
+    bool pass = nearlyEqual(D.interleaved(), expected);
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+// B[n, m] = alpha * A[m, n] on planar A and B, with a padded plane stride for A
+bool permutationTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    constexpr int64_t M = 8, N = 12;
+
+    int32_t modeA[] = {'m', 'n'};
+    int32_t modeB[] = {'n', 'm'};
+    int64_t lensA[] = {M, N};
+    int64_t lensB[] = {N, M};
+
+    hiptensorTensorDescriptor_t descA, descB;
+    initComplexDescriptor(handle, &descA, 2, lensA, M * N + 32);
+    initComplexDescriptor(handle, &descB, 2, lensB, M * N);
+
+    auto hostA = complexValues(M * N, 4);
+
+    ComplexTensor A(hostA, descA.mPlaneStride);
+    ComplexTensor B(std::vector<float>(2 * M * N, 0.0f), descB.mPlaneStride);
+    float         alpha = 2.0f;
+
+    CHECK_HIPTENSOR_ERROR(hiptensorPermutation(
+        handle, &alpha, A.mData, &descA, modeA, B.mData, &descB, modeB, HIP_R_32F, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // The permutation of the interleaved values
+    std::vector<float> expected(2 * M * N);
+    for(int64_t m = 0; m < M; m++)
+    {
+        for(int64_t n = 0; n < N; n++)
+        {
+            expected[2 * (n + m * N)]     = alpha * hostA[2 * (m + n * M)];
+            expected[2 * (n + m * N) + 1] = alpha * hostA[2 * (m + n * M) + 1];
+        }
+    }
+
+    // Interleaved and planar operands can not be permuted together
+    ComplexTensor interleavedB(std::vector<float>(2 * M * N, 0.0f), 0);
+    hiptensorTensorDescriptor_t descInterleavedB;
+    initComplexDescriptor(handle, &descInterleavedB, 2, lensB, 0);
+
+    bool pass = nearlyEqual(B.interleaved(), expected);
+    pass &= hiptensorPermutation(handle,
+                                 &alpha,
+                                 A.mData,
+                                 &descA,
+                                 modeA,
+                                 interleavedB.mData,
+                                 &descInterleavedB,
+                                 modeB,
+                                 HIP_R_32F,
+                                 stream)
+            == HIPTENSOR_STATUS_NOT_SUPPORTED;
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+// D[m] = alpha * sum_n A[m, n] + beta * C[m] on planar A, C and D
+bool reductionTest()
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    constexpr int64_t M = 8, N = 32;
+
+    int32_t modeA[] = {'m', 'n'};
+    int32_t modeD[] = {'m'};
+    int64_t lensA[] = {M, N};
+    int64_t lensD[] = {M};
+
+    hiptensorTensorDescriptor_t descA, descD;
+    initComplexDescriptor(handle, &descA, 2, lensA, M * N);
+    initComplexDescriptor(handle, &descD, 1, lensD, M + 8);
+
+    auto hostA = complexValues(M * N, 5);
+    auto hostC = complexValues(M, 6);
+
+    ComplexTensor A(hostA, descA.mPlaneStride);
+    ComplexTensor C(hostC, descD.mPlaneStride);
+    ComplexTensor D(std::vector<float>(2 * M, 0.0f), descD.mPlaneStride);
+    float         alpha = 0.5f;
+    float         beta  = -1.0f;
+
+    CHECK_HIPTENSOR_ERROR(hiptensorReduction(handle,
+                                             &alpha,
+                                             A.mData,
+                                             &descA,
+                                             modeA,
+                                             &beta,
+                                             C.mData,
+                                             &descD,
+                                             modeD,
+                                             D.mData,
+                                             &descD,
+                                             modeD,
+                                             HIPTENSOR_OP_ADD,
+                                             HIPTENSOR_COMPUTE_32F,
+                                             nullptr,
+                                             0,
+                                             stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // The sum of the interleaved values, each part on its own
+    std::vector<float> expected(2 * M);
+    for(int64_t m = 0; m < M; m++)
+    {
+        for(int part = 0; part < 2; part++)
+        {
+            float sum = 0.0f;
+            for(int64_t n = 0; n < N; n++)
+            {
+                sum += hostA[2 * (m + n * M) + part];
+            }
+            expected[2 * m + part] = alpha * sum + beta * hostC[2 * m + part];
+        }
+    }
+
+    bool pass = nearlyEqual(D.interleaved(), expected);
+
+    // Other reductions mix the planes
+    pass &= hiptensorReduction(handle,
+                               &alpha,
+                               A.mData,
+                               &descA,
+                               modeA,
+                               &beta,
+                               C.mData,
+                               &descD,
+                               modeD,
+                               D.mData,
+                               &descD,
+                               modeD,
+                               HIPTENSOR_OP_MUL,
+                               HIPTENSOR_COMPUTE_32F,
+                               nullptr,
+                               0,
+                               stream)
+            == HIPTENSOR_STATUS_NOT_SUPPORTED;
+
+    // Complex scalars with zero imaginary parts give the same result at complex compute
+    float complexAlpha[] = {alpha, 0.0f};
+    float complexBeta[]  = {beta, 0.0f};
+    ComplexTensor E(std::vector<float>(2 * M, 0.0f), descD.mPlaneStride);
+    pass &= hiptensorReduction(handle,
+                               complexAlpha,
+                               A.mData,
+                               &descA,
+                               modeA,
+                               complexBeta,
+                               C.mData,
+                               &descD,
+                               modeD,
+                               E.mData,
+                               &descD,
+                               modeD,
+                               HIPTENSOR_OP_ADD,
+                               HIPTENSOR_COMPUTE_C32F,
+                               nullptr,
+                               0,
+                               stream)
+            == HIPTENSOR_STATUS_SUCCESS;
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    pass &= nearlyEqual(E.interleaved(), expected);
+
+    // An imaginary part would mix the planes
+    complexAlpha[1] = 0.25f;
+    pass &= hiptensorReduction(handle,
+                               complexAlpha,
+                               A.mData,
+                               &descA,
+                               modeA,
+                               complexBeta,
+                               C.mData,
+                               &descD,
+                               modeD,
+                               E.mData,
+                               &descD,
+                               modeD,
+                               HIPTENSOR_OP_ADD,
+                               HIPTENSOR_COMPUTE_C32F,
+                               nullptr,
+                               0,
+                               stream)
+            == HIPTENSOR_STATUS_NOT_SUPPORTED;
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = descriptorTest();
+    totalPass &= testPass;
+    std::cout << "descriptor: ";
+    printBool(testPass);
+
+    // All operands planar, with a padded plane for C and D
+    testPass = contractionTest(16 * 16, 16 * 16, 16 * 16 + 64);
+    totalPass &= testPass;
+    std::cout << "planarContraction: ";
+    printBool(testPass);
+
+    // Planar and interleaved operands in one contraction
+    testPass = contractionTest(16 * 16, 0, 0) && contractionTest(0, 16 * 16, 16 * 16);
+    totalPass &= testPass;
+    std::cout << "mixedContraction: ";
+    printBool(testPass);
+
+    testPass = permutationTest();
+    totalPass &= testPass;
+    std::cout << "planarPermutation: ";
+    printBool(testPass);
+
+    testPass = reductionTest();
+    totalPass &= testPass;
+    std::cout << "planarReduction: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include "solution_bitset.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+std::vector<uint32_t> setBits(hiptensor::SolutionBitset const& bits)
+{
+    std::vector<uint32_t> result;
+    bits.forEach([&](uint32_t index) { result.push_back(index); });
+    return result;
+}
+
+bool solutionBitsetBasicTest()
+{
+    hiptensor::SolutionBitset bits;
+    bits.set(3);
+    bits.set(64);
+    bits.set(130);
+
+    hiptensor::SolutionBitset empty;
+    return bits.size() == 131 && bits.count() == 3 && bits.test(64) && !bits.test(65)
+           && !bits.test(1000) && setBits(bits) == std::vector<uint32_t>{3, 64, 130}
+           && !empty.any() && empty.count() == 0;
+}
+
+bool solutionBitsetSetOpsTest(uint32_t size)
+{
+    hiptensor::SolutionBitset all, even, third;
+    all.setAll(size);
+    for(uint32_t i = 0; i < size; i += 2)
+    {
+        even.set(i);
+    }
+    // Shorter than the others: missing bits act as cleared
+    for(uint32_t i = 0; i < size / 2; i += 3)
+    {
+        third.set(i);
+    }
+
+    auto both = all;
+    both &= even;
+    both &= third;
+
+    auto either = even;
+    either |= third;
+
+    uint32_t expectBoth = 0, expectEither = 0;
+    for(uint32_t i = 0; i < size; i++)
+    {
+        bool inEven  = i % 2 == 0;
+        bool inThird = i < size / 2 && i % 3 == 0;
+        expectBoth += (inEven && inThird);
+        expectEither += (inEven || inThird);
+    }
+
+    return all.count() == size && both.count() == expectBoth && both.test(0) && !both.test(3)
+           && either.count() == expectEither && either.test(3) && !either.test(size - 2);
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = solutionBitsetBasicTest();
+    totalPass &= testPass;
+    std::cout << "solutionBitsetBasic: ";
+    printBool(testPass);
+
+    // Inline storage; sizes are odd
+    testPass = solutionBitsetSetOpsTest(1001);
+    totalPass &= testPass;
+    std::cout << "solutionBitsetSetOps (inline): ";
+    printBool(testPass);
+
+    // Heap storage
+    testPass = solutionBitsetSetOpsTest(hiptensor::SolutionBitset::InlineBits * 2 + 7);
+    totalPass &= testPass;
+    std::cout << "solutionBitsetSetOps (heap): ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
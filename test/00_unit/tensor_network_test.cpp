@@ -0,0 +1,322 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "contraction/contraction_cpu_reference.hpp"
+#include "unit_test_helpers.hpp"
+
+using Extents = std::unordered_map<int32_t, int64_t>;
+
+// A packed f32 tensor on the host
+struct HostTensor
+{
+    std::vector<int32_t> mModes;
+    std::vector<float>   mData;
+};
+
+void initDescriptor(hiptensorHandle_t*           handle,
+                    hiptensorTensorDescriptor_t* desc,
+                    std::vector<int32_t> const&  modes,
+                    Extents const&               extents)
+{
+    std::vector<int64_t> lens;
+    for(auto mode : modes)
+    {
+        lens.push_back(extents.at(mode));
+    }
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, desc, modes.size(), lens.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY));
+}
+
+// alpha * X * Y into the given modes, with the CPU reference of a scale contraction
+HostTensor contractPair(hiptensorHandle_t*          handle,
+                        float                       alpha,
+                        HostTensor const&           x,
+                        HostTensor const&           y,
+                        std::vector<int32_t> const& modes,
+                        Extents const&              extents)
+{
+    hiptensorTensorDescriptor_t descX, descY, descZ;
+    initDescriptor(handle, &descX, x.mModes, extents);
+    initDescriptor(handle, &descY, y.mModes, extents);
+    initDescriptor(handle, &descZ, modes, extents);
+
+    hiptensorContractionPlan_t plan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(handle,
+                                                             &plan.mContractionDesc,
+                                                             &descX,
+                                                             x.mModes.data(),
+                                                             0,
+                                                             &descY,
+                                                             y.mModes.data(),
+                                                             0,
+                                                             nullptr,
+                                                             nullptr,
+                                                             0,
+                                                             &descZ,
+                                                             modes.data(),
+                                                             0,
+                                                             HIPTENSOR_COMPUTE_32F));
+    plan.mSolution = nullptr;
+
+    auto const& desc     = plan.mContractionDesc;
+    auto        zero     = 0.0f;
+    auto        elements = std::accumulate(
+        descZ.mLengths.begin(), descZ.mLengths.end(), std::size_t{1}, std::multiplies<>());
+    HostTensor z{modes, std::vector<float>(elements)};
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionReference(&plan,
+                                                        &alpha,
+                                                        x.mData.data(),
+                                                        y.mData.data(),
+                                                        &zero,
+                                                        nullptr,
+                                                        z.mData.data(),
+                                                        desc.mTensorDesc[0].mLengths,
+                                                        desc.mTensorDesc[0].mStrides,
+                                                        desc.mTensorMode[0],
+                                                        desc.mTensorDesc[1].mLengths,
+                                                        desc.mTensorDesc[1].mStrides,
+                                                        desc.mTensorMode[1],
+                                                        desc.mTensorDesc[3].mLengths,
+                                                        desc.mTensorDesc[3].mStrides,
+                                                        desc.mTensorMode.back(),
+                                                        desc.mTensorDesc[3].mLengths,
+                                                        desc.mTensorDesc[3].mStrides,
+                                                        desc.mTensorMode.back(),
+                                                        HIP_R_32F,
+                                                        HIP_R_32F,
+                                                        desc.mTensorDesc[2].mType,
+                                                        HIP_R_32F,
+                                                        nullptr));
+    return z;
+}
+
+// The network contracted from left to right on the CPU, independently of the path of the
+// plan. Each product keeps the modes still used by a later input or by the output.
+HostTensor referenceNetwork(hiptensorHandle_t*             handle,
+                            float                          alpha,
+                            std::vector<HostTensor> const& inputs,
+                            std::vector<int32_t> const&    outputModes,
+                            Extents const&                 extents)
+{
+    auto result = inputs[0];
+    for(std::size_t i = 1; i < inputs.size(); i++)
+    {
+        auto modes = outputModes;
+        if(i + 1 < inputs.size())
+        {
+            modes.clear();
+            for(auto const* operand : {&result, &inputs[i]})
+            {
+                for(auto mode : operand->mModes)
+                {
+                    auto laterUse
+                        = std::find(outputModes.begin(), outputModes.end(), mode)
+                              != outputModes.end()
+                          || std::any_of(inputs.begin() + i + 1, inputs.end(), [mode](auto& t) {
+                                 return std::find(t.mModes.begin(), t.mModes.end(), mode)
+                                        != t.mModes.end();
+                             });
+                    if(laterUse && std::find(modes.begin(), modes.end(), mode) == modes.end())
+                    {
+                        modes.push_back(mode);
+                    }
+                }
+            }
+        }
+        result = contractPair(
+            handle, i + 1 < inputs.size() ? 1.0f : alpha, result, inputs[i], modes, extents);
+    }
+    return result;
+}
+
+// Contracts the network on the device, with a user workspace and with the library-managed
+// one, and compares the output with the pairwise CPU reference
+bool networkTest(std::vector<std::vector<int32_t>> const& inputModes,
+                 std::vector<int32_t> const&              outputModes,
+                 Extents const&                           extents,
+                 hiptensorContractionPathAlgo_t           pathAlgo)
+{
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    auto numInputs = inputModes.size();
+
+    std::vector<HostTensor>                  hostInputs;
+    std::vector<hiptensorTensorDescriptor_t> descInputs(numInputs);
+    std::vector<float*>                      inputs;
+    for(std::size_t i = 0; i < numInputs; i++)
+    {
+        initDescriptor(handle, &descInputs[i], inputModes[i], extents);
+
+        std::size_t elements = 1;
+        for(auto mode : inputModes[i])
+        {
+            elements *= extents.at(mode);
+        }
+        HostTensor tensor{inputModes[i], std::vector<float>(elements)};
+        for(std::size_t e = 0; e < elements; e++)
+        {
+            tensor.mData[e] = float((e * 3 + i) % 7) * 0.25f - 0.75f;
+        }
+        hostInputs.push_back(tensor);
+        inputs.push_back(toDevice(tensor.mData));
+    }
+
+    hiptensorTensorDescriptor_t descOutput;
+    initDescriptor(handle, &descOutput, outputModes, extents);
+
+    std::vector<hiptensorTensorDescriptor_t const*> descPtrs;
+    std::vector<int32_t const*>                     modePtrs;
+    for(std::size_t i = 0; i < numInputs; i++)
+    {
+        descPtrs.push_back(&descInputs[i]);
+        modePtrs.push_back(inputModes[i].data());
+    }
+
+    hiptensorTensorNetworkPlan_t plan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorNetworkPlan(handle,
+                                                         &plan,
+                                                         numInputs,
+                                                         descPtrs.data(),
+                                                         modePtrs.data(),
+                                                         &descOutput,
+                                                         outputModes.data(),
+                                                         HIPTENSOR_COMPUTE_32F,
+                                                         pathAlgo,
+                                                         nullptr));
+
+    bool pass = plan.mSteps.size() == numInputs - 1 && plan.mWorkspaceSize > 0;
+
+    // Intermediates that are live at the same time must not overlap in the workspace
+    auto resultBytes = [&plan](std::size_t s) {
+        auto const& lengths = plan.mSteps[s].mPlan.mContractionDesc.mTensorDesc[3].mLengths;
+        return sizeof(float)
+               * std::accumulate(
+                   lengths.begin(), lengths.end(), std::size_t{1}, std::multiplies<>());
+    };
+    for(std::size_t s = 0; s + 1 < plan.mSteps.size(); s++)
+    {
+        pass &= plan.mSteps[s].mResultOffset + resultBytes(s) <= plan.mIntermediateSize;
+        for(auto operand : plan.mSteps[s].mOperands)
+        {
+            if(operand >= (int32_t)numInputs)
+            {
+                auto r     = std::size_t(operand) - numInputs;
+                auto begin = plan.mSteps[s].mResultOffset;
+                auto other = plan.mSteps[r].mResultOffset;
+                pass &= begin >= other + resultBytes(r) || other >= begin + resultBytes(s);
+            }
+        }
+    }
+
+    float alpha    = 0.5f;
+    auto  expected = referenceNetwork(handle, alpha, hostInputs, outputModes, extents);
+    auto  output   = toDevice(std::vector<float>(expected.mData.size(), 0.0f));
+
+    std::vector<void const*> inputPtrs(inputs.begin(), inputs.end());
+
+    void* workspace = nullptr;
+    CHECK_HIP_ERROR(hipMalloc(&workspace, plan.mWorkspaceSize));
+    pass &= hiptensorTensorNetwork(handle,
+                                   &plan,
+                                   &alpha,
+                                   inputPtrs.data(),
+                                   output,
+                                   workspace,
+                                   plan.mWorkspaceSize - 1,
+                                   stream)
+            == HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+
+    // With the user workspace, then with the library-managed one
+    for(auto ws : {workspace, (void*)nullptr})
+    {
+        CHECK_HIP_ERROR(hipMemsetAsync(output, 0, expected.mData.size() * sizeof(float), stream));
+        CHECK_HIPTENSOR_ERROR(hiptensorTensorNetwork(
+            handle, &plan, &alpha, inputPtrs.data(), output, ws, plan.mWorkspaceSize, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        pass &= nearlyEqual(toHost(output, expected.mData.size()), expected.mData);
+    }
+
+    CHECK_HIP_ERROR(hipFree(workspace));
+    CHECK_HIP_ERROR(hipFree(output));
+    for(auto* input : inputs)
+    {
+        CHECK_HIP_ERROR(hipFree(input));
+    }
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    // D[a, e] = X0[a, b] X1[b, c] X2[c, d] X3[d, e]
+    Extents chainExtents = {{'a', 16}, {'b', 32}, {'c', 8}, {'d', 24}, {'e', 16}};
+    std::vector<std::vector<int32_t>> chain
+        = {{'a', 'b'}, {'b', 'c'}, {'c', 'd'}, {'d', 'e'}};
+
+    testPass = networkTest(chain, {'a', 'e'}, chainExtents, HIPTENSOR_PATH_GREEDY);
+    totalPass &= testPass;
+    std::cout << "chainGreedy: ";
+    printBool(testPass);
+
+    testPass = networkTest(chain, {'a', 'e'}, chainExtents, HIPTENSOR_PATH_OPTIMAL);
+    totalPass &= testPass;
+    std::cout << "chainOptimal: ";
+    printBool(testPass);
+
+    // D[e, a] = X0[a, b, c] X1[c, d] X2[b, d, e], with the output modes in their own order
+    Extents triangleExtents = {{'a', 16}, {'b', 8}, {'c', 12}, {'d', 16}, {'e', 24}};
+    std::vector<std::vector<int32_t>> triangle = {{'a', 'b', 'c'}, {'c', 'd'}, {'b', 'd', 'e'}};
+
+    testPass = networkTest(triangle, {'e', 'a'}, triangleExtents, HIPTENSOR_PATH_OPTIMAL);
+    totalPass &= testPass;
+    std::cout << "triangleOptimal: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
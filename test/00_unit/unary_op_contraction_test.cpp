@@ -0,0 +1,232 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "contraction/contraction_cpu_reference.hpp"
+#include "unit_test_helpers.hpp"
+
+// Non-negative, so that the square root is defined. Complex tensors are stored as
+// interleaved real and imaginary parts, with imaginary parts of both signs.
+std::vector<float> nonNegativeValues(std::size_t n, int components, int seed)
+{
+    std::vector<float> result(n * components);
+    for(std::size_t i = 0; i < result.size(); i++)
+    {
+        result[i] = float((i * 7 + seed) % 11) * 0.25f;
+        if(components == 2 && i % 2 == 1)
+        {
+            result[i] -= 1.25f;
+        }
+    }
+    return result;
+}
+
+// The operand as the contraction loads it through its unary operator
+std::vector<float> applyOp(std::vector<float> data, hiptensorOperator_t op)
+{
+    for(std::size_t i = 0; i < data.size(); i++)
+    {
+        if(op == HIPTENSOR_OP_SQRT)
+        {
+            data[i] = std::sqrt(data[i]);
+        }
+        else if(op == HIPTENSOR_OP_CONJ && i % 2 == 1)
+        {
+            data[i] = -data[i];
+        }
+    }
+    return data;
+}
+
+// D[m, n] = alpha * op(A[m, k]) * op(B[n, k]) + beta * C[m, n], with SQRT on f32 and CONJ on
+// cf32 operands. The result of the device is compared with the CPU reference of the same
+// ops, and with the identity reference of the operands with the ops applied on the host.
+bool unaryOpTest(hipDataType type, hiptensorOperator_t opA, hiptensorOperator_t opB)
+{
+    constexpr int64_t M = 48, N = 32, K = 24;
+
+    bool                   isComplex  = type == HIP_C_32F;
+    int                    components = isComplex ? 2 : 1;
+    hiptensorComputeType_t compute    = isComplex ? HIPTENSOR_COMPUTE_C32F : HIPTENSOR_COMPUTE_32F;
+
+    hiptensorHandle_t* handle = nullptr;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    int64_t lensA[] = {M, K};
+    int64_t lensB[] = {N, K};
+    int64_t lensD[] = {M, N};
+
+    hiptensorTensorDescriptor_t descA, descB, descD;
+    CHECK_HIPTENSOR_ERROR(
+        hiptensorInitTensorDescriptor(handle, &descA, 2, lensA, nullptr, type, opA));
+    CHECK_HIPTENSOR_ERROR(
+        hiptensorInitTensorDescriptor(handle, &descB, 2, lensB, nullptr, type, opB));
+    CHECK_HIPTENSOR_ERROR(hiptensorInitTensorDescriptor(
+        handle, &descD, 2, lensD, nullptr, type, HIPTENSOR_OP_IDENTITY));
+
+    int32_t modeA[] = {'m', 'k'};
+    int32_t modeB[] = {'n', 'k'};
+    int32_t modeD[] = {'m', 'n'};
+
+    auto hostA = nonNegativeValues(M * K, components, 1);
+    auto hostB = nonNegativeValues(N * K, components, 2);
+    auto hostC = nonNegativeValues(M * N, components, 3);
+
+    auto A = toDevice(hostA);
+    auto B = toDevice(hostB);
+    auto C = toDevice(hostC);
+    auto D = toDevice(std::vector<float>(M * N * components, 0.0f));
+
+    hiptensorContractionDescriptor_t desc;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionDescriptor(handle,
+                                                             &desc,
+                                                             &descA,
+                                                             modeA,
+                                                             0,
+                                                             &descB,
+                                                             modeB,
+                                                             0,
+                                                             &descD,
+                                                             modeD,
+                                                             0,
+                                                             &descD,
+                                                             modeD,
+                                                             0,
+                                                             compute));
+
+    hiptensorContractionFind_t find;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT));
+
+    uint64_t workspaceSize = 0;
+    CHECK_HIPTENSOR_ERROR(hiptensorContractionGetWorkspaceSize(
+        handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize));
+
+    hiptensorContractionPlan_t plan;
+    CHECK_HIPTENSOR_ERROR(hiptensorInitContractionPlan(handle, &plan, &desc, &find, workspaceSize));
+
+    // Scalars are read in the compute type
+    float alpha[] = {1.25f, -0.5f};
+    float beta[]  = {0.5f, 0.25f};
+    CHECK_HIPTENSOR_ERROR(
+        hiptensorContraction(handle, &plan, alpha, A, B, beta, C, D, nullptr, 0, 0));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    auto reference = [&](hiptensorContractionPlan_t const& refPlan,
+                         std::vector<float> const&         refA,
+                         std::vector<float> const&         refB) {
+        std::vector<float> result(M * N * components, 0.0f);
+        CHECK_HIPTENSOR_ERROR(hiptensorContractionReference(&refPlan,
+                                                            alpha,
+                                                            refA.data(),
+                                                            refB.data(),
+                                                            beta,
+                                                            hostC.data(),
+                                                            result.data(),
+                                                            desc.mTensorDesc[0].mLengths,
+                                                            desc.mTensorDesc[0].mStrides,
+                                                            desc.mTensorMode[0],
+                                                            desc.mTensorDesc[1].mLengths,
+                                                            desc.mTensorDesc[1].mStrides,
+                                                            desc.mTensorMode[1],
+                                                            desc.mTensorDesc[2].mLengths,
+                                                            desc.mTensorDesc[2].mStrides,
+                                                            desc.mTensorMode[2],
+                                                            desc.mTensorDesc[3].mLengths,
+                                                            desc.mTensorDesc[3].mStrides,
+                                                            desc.mTensorMode[3],
+                                                            type,
+                                                            type,
+                                                            type,
+                                                            type,
+                                                            nullptr));
+        return result;
+    };
+
+    auto identityPlan                                     = plan;
+    identityPlan.mContractionDesc.mTensorDesc[0].mUnaryOp = HIPTENSOR_OP_IDENTITY;
+    identityPlan.mContractionDesc.mTensorDesc[1].mUnaryOp = HIPTENSOR_OP_IDENTITY;
+
+    auto expected = reference(plan, hostA, hostB);
+    auto applied  = reference(identityPlan, applyOp(hostA, opA), applyOp(hostB, opB));
+
+    bool pass = nearlyEqual(toHost(D, M * N * components), expected)
+                && nearlyEqual(expected, applied);
+
+    for(auto* ptr : {A, B, C, D})
+    {
+        CHECK_HIP_ERROR(hipFree(ptr));
+    }
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = unaryOpTest(HIP_R_32F, HIPTENSOR_OP_SQRT, HIPTENSOR_OP_IDENTITY);
+    totalPass &= testPass;
+    std::cout << "sqrtA: ";
+    printBool(testPass);
+
+    testPass = unaryOpTest(HIP_R_32F, HIPTENSOR_OP_IDENTITY, HIPTENSOR_OP_SQRT);
+    totalPass &= testPass;
+    std::cout << "sqrtB: ";
+    printBool(testPass);
+
+    testPass = unaryOpTest(HIP_R_32F, HIPTENSOR_OP_SQRT, HIPTENSOR_OP_SQRT);
+    totalPass &= testPass;
+    std::cout << "sqrtAB: ";
+    printBool(testPass);
+
+    testPass = unaryOpTest(HIP_C_32F, HIPTENSOR_OP_CONJ, HIPTENSOR_OP_IDENTITY);
+    totalPass &= testPass;
+    std::cout << "conjA: ";
+    printBool(testPass);
+
+    testPass = unaryOpTest(HIP_C_32F, HIPTENSOR_OP_IDENTITY, HIPTENSOR_OP_CONJ);
+    totalPass &= testPass;
+    std::cout << "conjB: ";
+    printBool(testPass);
+
+    testPass = unaryOpTest(HIP_C_32F, HIPTENSOR_OP_CONJ, HIPTENSOR_OP_CONJ);
+    totalPass &= testPass;
+    std::cout << "conjAB: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_UNIT_TEST_HELPERS_HPP
+#define HIPTENSOR_UNIT_TEST_HELPERS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// Shared fixtures of the unit tests that run on the device
+
+inline void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+template <typename T>
+T* toDevice(std::vector<T> const& host)
+{
+    T* device = nullptr;
+    CHECK_HIP_ERROR(hipMalloc(&device, host.size() * sizeof(T)));
+    CHECK_HIP_ERROR(
+        hipMemcpy(device, host.data(), host.size() * sizeof(T), hipMemcpyHostToDevice));
+    return device;
+}
+
+template <typename T>
+std::vector<T> toHost(T const* device, std::size_t count)
+{
+    std::vector<T> host(count);
+    CHECK_HIP_ERROR(hipMemcpy(host.data(), device, count * sizeof(T), hipMemcpyDeviceToHost));
+    return host;
+}
+
+// Relative tolerance of results stored in the given type, computed in at least f32. It
+// covers the rounding of the stored result and of f32 accumulation.
+inline double roundingTolerance(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+        return 2.0 * std::pow(2.0, -10);
+    case HIP_R_16BF:
+        return 2.0 * std::pow(2.0, -7);
+    case HIP_R_64F:
+    case HIP_C_64F:
+        return 1.0e-10;
+    default:
+        return 1.0e-4;
+    }
+}
+
+// Complex tensors compare as interleaved real and imaginary parts. NaNs never compare equal.
+template <typename T>
+bool nearlyEqual(std::vector<T> const& a,
+                 std::vector<T> const& b,
+                 double                tolerance = roundingTolerance(HIP_R_32F))
+{
+    if(a.size() != b.size())
+    {
+        return false;
+    }
+    for(std::size_t i = 0; i < a.size(); i++)
+    {
+        auto x = static_cast<double>(a[i]);
+        auto y = static_cast<double>(b[i]);
+        if(std::isnan(x) || std::abs(x - y) > tolerance * std::max(1.0, std::abs(y)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Small values exactly representable in f16 and bf16, in [-1, 1]
+template <typename T = float>
+std::vector<T> values(std::size_t n, int seed)
+{
+    std::vector<T> result(n);
+    for(std::size_t i = 0; i < n; i++)
+    {
+        result[i] = static_cast<T>(float((i * 5 + seed) % 9) * 0.25f - 1.0f);
+    }
+    return result;
+}
+
+#endif // HIPTENSOR_UNIT_TEST_HELPERS_HPP
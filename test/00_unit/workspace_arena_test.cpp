@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+// hiptensor includes
+#include "workspace_arena.hpp"
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool workspaceArenaSizeClassTest()
+{
+    using hiptensor::WorkspaceArena;
+    return WorkspaceArena::sizeClass(1) == 256 && WorkspaceArena::sizeClass(256) == 256
+           && WorkspaceArena::sizeClass(257) == 512 && WorkspaceArena::sizeClass(5000) == 8192
+           && WorkspaceArena::sizeClass((64u << 20) + 1) == (66u << 20);
+}
+
+bool workspaceArenaReuseTest()
+{
+    hiptensor::WorkspaceArena arena;
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    void* first = nullptr;
+    {
+        auto allocation = arena.allocate(1000, stream);
+        first           = allocation.get();
+        if(first == nullptr || allocation.size() != 1024 || arena.usedBytes() != 1024)
+        {
+            return false;
+        }
+    }
+
+    // Released in stream order: the same stream gets the block back without waiting
+    bool pass       = arena.usedBytes() == 0 && arena.reservedBytes() == 1024;
+    auto sameStream = arena.allocate(600, stream);
+    pass &= sameStream.get() == first && arena.reservedBytes() == 1024;
+
+    // A block still in use is never handed out twice
+    auto second = arena.allocate(600, stream);
+    pass &= second.get() != nullptr && second.get() != first && arena.reservedBytes() == 2048;
+
+    sameStream.reset();
+    second.reset();
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Other streams reuse blocks whose pending work has completed
+    auto otherStream = arena.allocate(1024, nullptr);
+    pass &= otherStream.get() != nullptr && arena.reservedBytes() == 2048;
+    otherStream.reset();
+
+    arena.trim();
+    pass &= arena.reservedBytes() == 0 && arena.usedBytes() == 0;
+
+    pass &= arena.allocate(0, stream).get() == nullptr;
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return pass;
+}
+
+int main()
+{
+    bool totalPass = true;
+    bool testPass  = true;
+
+    testPass = workspaceArenaSizeClassTest();
+    totalPass &= testPass;
+    std::cout << "workspaceArenaSizeClass: ";
+    printBool(testPass);
+
+    testPass = workspaceArenaReuseTest();
+    totalPass &= testPass;
+    std::cout << "workspaceArenaReuse: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,510 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+#include "bench_problem.hpp"
+#include "data_types.hpp"
+
+#include "contraction/contraction_cpu_reference.hpp"
+#include "permutation/permutation_cpu_reference.hpp"
+#include "reduction/reduction_cpu_reference.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        hiptensorStatus_t makeDescriptor(hiptensorHandle_t*           handle,
+                                         ApiRecordTensor const&       tensor,
+                                         hiptensorTensorDescriptor_t* desc)
+        {
+            std::vector<int64_t> lengths(tensor.mLengths.begin(), tensor.mLengths.end());
+            std::vector<int64_t> strides(tensor.mStrides.begin(), tensor.mStrides.end());
+
+            if(tensor.mPlaneStride != 0)
+            {
+                return hiptensorInitPlanarTensorDescriptor(handle,
+                                                           desc,
+                                                           lengths.size(),
+                                                           lengths.data(),
+                                                           strides.data(),
+                                                           tensor.mType,
+                                                           tensor.mUnaryOp,
+                                                           tensor.mPlaneStride);
+            }
+
+            return hiptensorInitTensorDescriptor(handle,
+                                                 desc,
+                                                 lengths.size(),
+                                                 lengths.data(),
+                                                 strides.data(),
+                                                 tensor.mType,
+                                                 tensor.mUnaryOp);
+        }
+
+        void makeScalar(double (&storage)[2], double const (&value)[2], hiptensorComputeType_t type)
+        {
+            writeVal(storage, type, ScalarData(type, value[0], value[1]));
+        }
+
+        double packedElements(ApiRecordTensor const& tensor)
+        {
+            return std::accumulate(tensor.mLengths.begin(),
+                                   tensor.mLengths.end(),
+                                   1.0,
+                                   [](double acc, std::size_t len) { return acc * len; });
+        }
+    } // namespace
+
+    BenchTensor::BenchTensor(ApiRecordTensor const& record, bool useDevice, std::mt19937& gen)
+        : mRecord(record)
+        , mDevice(nullptr)
+    {
+        mElements = 1;
+        for(std::size_t i = 0; i < record.mLengths.size(); i++)
+        {
+            mElements += (record.mLengths[i] - 1) * record.mStrides[i];
+        }
+        if(record.mPlaneStride != 0)
+        {
+            // Both planes, in real elements, rounded up to whole complex elements
+            mElements = (record.mPlaneStride + mElements + 1) / 2;
+        }
+        mHost.resize(mElements * hipDataTypeSize(record.mType));
+        fill(gen);
+
+        if(useDevice)
+        {
+            CHECK_HIP_ERROR(hipMalloc(&mDevice, mHost.size()));
+            CHECK_HIP_ERROR(hipMemcpy(mDevice, mHost.data(), mHost.size(), hipMemcpyHostToDevice));
+        }
+    }
+
+    BenchTensor::~BenchTensor()
+    {
+        if(mDevice != nullptr)
+        {
+            CHECK_HIP_ERROR(hipFree(mDevice));
+        }
+    }
+
+    void* BenchTensor::data()
+    {
+        return mDevice != nullptr ? mDevice : mHost.data();
+    }
+
+    std::size_t BenchTensor::packedBytes() const
+    {
+        return static_cast<std::size_t>(packedElements(mRecord)) * hipDataTypeSize(mRecord.mType);
+    }
+
+    void BenchTensor::fill(std::mt19937& gen)
+    {
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        for(std::size_t i = 0; i < mElements; i++)
+        {
+            switch(mRecord.mType)
+            {
+            case HIP_R_16F:
+                ((_Float16*)mHost.data())[i] = static_cast<_Float16>(dist(gen));
+                break;
+            case HIP_R_16BF:
+                ((hip_bfloat16*)mHost.data())[i] = static_cast<hip_bfloat16>(dist(gen));
+                break;
+            case HIP_R_32F:
+                ((float*)mHost.data())[i] = static_cast<float>(dist(gen));
+                break;
+            case HIP_R_64F:
+                ((double*)mHost.data())[i] = dist(gen);
+                break;
+            case HIP_C_32F:
+                ((hipFloatComplex*)mHost.data())[i] = make_hipFloatComplex(
+                    static_cast<float>(dist(gen)), static_cast<float>(dist(gen)));
+                break;
+            case HIP_C_64F:
+                ((hipDoubleComplex*)mHost.data())[i] = make_hipDoubleComplex(dist(gen), dist(gen));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    BenchProblem::BenchProblem(hiptensorHandle_t* handle,
+                               ApiRecord const&   record,
+                               bool               useCpu,
+                               hipStream_t        stream,
+                               std::mt19937&      gen)
+        : mRecord(record)
+        , mUseCpu(useCpu)
+        , mWorkspace(nullptr)
+        , mWorkspaceSize(0)
+        , mStatus(HIPTENSOR_STATUS_SUCCESS)
+    {
+        // Operands reference mRecord, which must not be resized past this point
+        for(auto const& tensor : mRecord.mTensors)
+        {
+            if(tensor.mType == NONE_TYPE)
+            {
+                mTensors.emplace_back(nullptr);
+                mDescs.emplace_back();
+            }
+            else
+            {
+                mTensors.emplace_back(std::make_unique<BenchTensor>(tensor, !mUseCpu, gen));
+                mDescs.emplace_back();
+                mStatus = makeDescriptor(handle, tensor, &mDescs.back());
+            }
+
+            // A problem the library rejects is reported by the replay, which goes on
+            if(mStatus != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return;
+            }
+        }
+
+        switch(mRecord.mKind)
+        {
+        case ApiRecordKind_t::CONTRACTION:
+            initContraction(handle, stream);
+            break;
+        case ApiRecordKind_t::PERMUTATION:
+            initPermutation(handle, stream);
+            break;
+        case ApiRecordKind_t::REDUCTION:
+            initReduction(handle, stream);
+            break;
+        default:
+            mStatus = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            break;
+        }
+    }
+
+    BenchProblem::~BenchProblem()
+    {
+        if(mWorkspace != nullptr)
+        {
+            CHECK_HIP_ERROR(hipFree(mWorkspace));
+        }
+    }
+
+    hiptensorStatus_t BenchProblem::status() const
+    {
+        return mStatus;
+    }
+
+    hiptensorStatus_t BenchProblem::operator()()
+    {
+        return mStatus == HIPTENSOR_STATUS_SUCCESS ? mRun() : mStatus;
+    }
+
+    double BenchProblem::flops() const
+    {
+        auto const& tensors = mRecord.mTensors;
+        if(mRecord.mKind == ApiRecordKind_t::CONTRACTION)
+        {
+            // M * N from D, times every contracted (K) mode of A
+            auto const& tA  = tensors[0];
+            auto const& tD  = tensors[3];
+            double      mnk = packedElements(tD);
+            for(std::size_t i = 0; i < tA.mModes.size(); i++)
+            {
+                if(std::find(tD.mModes.begin(), tD.mModes.end(), tA.mModes[i]) == tD.mModes.end())
+                {
+                    mnk *= tA.mLengths[i];
+                }
+            }
+
+            // A complex multiply-accumulate is four real ones
+            bool isComplex = mRecord.mComputeType == HIPTENSOR_COMPUTE_C32F
+                             || mRecord.mComputeType == HIPTENSOR_COMPUTE_C64F;
+            return 2.0 * mnk * (isComplex ? 4.0 : 1.0);
+        }
+        else if(mRecord.mKind == ApiRecordKind_t::REDUCTION)
+        {
+            return packedElements(tensors[0]);
+        }
+
+        return 0.0;
+    }
+
+    double BenchProblem::bytes() const
+    {
+        double total = 0.0;
+        for(auto const& tensor : mTensors)
+        {
+            total += tensor ? tensor->packedBytes() : 0u;
+        }
+        return total;
+    }
+
+    void BenchProblem::initContraction(hiptensorHandle_t* handle, hipStream_t stream)
+    {
+        auto const& tA = mRecord.mTensors[0];
+        auto const& tB = mRecord.mTensors[1];
+        auto const& tC = mRecord.mTensors[2];
+        auto const& tD = mRecord.mTensors[3];
+
+        bool hasC = tC.mType != NONE_TYPE;
+
+        makeScalar(mAlpha, mRecord.mAlpha, mRecord.mComputeType);
+        makeScalar(mBeta, mRecord.mBeta, mRecord.mComputeType);
+
+        void* A = mTensors[0]->data();
+        void* B = mTensors[1]->data();
+        void* C = hasC ? mTensors[2]->data() : nullptr;
+        void* D = mTensors[3]->data();
+
+        uint32_t alignmentA, alignmentB, alignmentC, alignmentD;
+        mStatus = hiptensorGetAlignmentRequirement(handle, A, &mDescs[0], &alignmentA);
+        if(mStatus == HIPTENSOR_STATUS_SUCCESS)
+        {
+            mStatus = hiptensorGetAlignmentRequirement(handle, B, &mDescs[1], &alignmentB);
+        }
+        if(mStatus == HIPTENSOR_STATUS_SUCCESS)
+        {
+            mStatus = hiptensorGetAlignmentRequirement(handle, D, &mDescs[3], &alignmentD);
+        }
+        alignmentC = alignmentD;
+        if(mStatus == HIPTENSOR_STATUS_SUCCESS && hasC)
+        {
+            mStatus = hiptensorGetAlignmentRequirement(handle, C, &mDescs[2], &alignmentC);
+        }
+        if(mStatus != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return;
+        }
+
+        mStatus = hiptensorInitContractionDescriptor(handle,
+                                                     &mContractionDesc,
+                                                     &mDescs[0],
+                                                     tA.mModes.data(),
+                                                     alignmentA,
+                                                     &mDescs[1],
+                                                     tB.mModes.data(),
+                                                     alignmentB,
+                                                     hasC ? &mDescs[2] : nullptr,
+                                                     hasC ? tC.mModes.data() : nullptr,
+                                                     alignmentC,
+                                                     &mDescs[3],
+                                                     tD.mModes.data(),
+                                                     alignmentD,
+                                                     mRecord.mComputeType);
+        if(mStatus != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return;
+        }
+
+        if(mUseCpu)
+        {
+            mContractionPlan.mContractionDesc = mContractionDesc;
+            mContractionPlan.mSolution        = nullptr;
+
+            mRun = [this, A, B, C, D, hasC]() {
+                auto const& tA = mRecord.mTensors[0];
+                auto const& tB = mRecord.mTensors[1];
+                auto const& tC = mRecord.mTensors[2];
+                auto const& tD = mRecord.mTensors[3];
+                auto const& tE = hasC ? tC : tD;
+                return hiptensorContractionReference(&mContractionPlan,
+                                                     mAlpha,
+                                                     A,
+                                                     B,
+                                                     mBeta,
+                                                     C,
+                                                     D,
+                                                     tA.mLengths,
+                                                     tA.mStrides,
+                                                     tA.mModes,
+                                                     tB.mLengths,
+                                                     tB.mStrides,
+                                                     tB.mModes,
+                                                     tE.mLengths,
+                                                     tE.mStrides,
+                                                     tE.mModes,
+                                                     tD.mLengths,
+                                                     tD.mStrides,
+                                                     tD.mModes,
+                                                     tA.mType,
+                                                     tB.mType,
+                                                     hasC ? tC.mType : NONE_TYPE,
+                                                     tD.mType,
+                                                     nullptr);
+            };
+            return;
+        }
+
+        mStatus = hiptensorInitContractionFind(handle, &mContractionFind, mRecord.mAlgo);
+        if(mStatus != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return;
+        }
+
+        mStatus = hiptensorContractionGetWorkspaceSize(
+            handle, &mContractionDesc, &mContractionFind, mRecord.mWorksizePref, &mWorkspaceSize);
+        if(mStatus != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return;
+        }
+        mWorkspaceSize = std::max(mWorkspaceSize, mRecord.mWorkspaceSize);
+
+        if(mWorkspaceSize > 0)
+        {
+            CHECK_HIP_ERROR(hipMalloc(&mWorkspace, mWorkspaceSize));
+        }
+
+        mStatus = hiptensorInitContractionPlan(
+            handle, &mContractionPlan, &mContractionDesc, &mContractionFind, mWorkspaceSize);
+
+        mRun = [this, handle, stream, A, B, C, D]() {
+            return hiptensorContraction(handle,
+                                        &mContractionPlan,
+                                        mAlpha,
+                                        A,
+                                        B,
+                                        mBeta,
+                                        C,
+                                        D,
+                                        mWorkspace,
+                                        mWorkspaceSize,
+                                        stream);
+        };
+    }
+
+    void BenchProblem::initPermutation(hiptensorHandle_t* handle, hipStream_t stream)
+    {
+        makeScalar(mAlpha, mRecord.mAlpha, convertToComputeType(mRecord.mScalarType));
+
+        auto permute = mUseCpu ? hiptensorPermutationReference : hiptensorPermutation;
+        mRun         = [this, handle, stream, permute]() {
+            return permute(handle,
+                           mAlpha,
+                           mTensors[0]->data(),
+                           &mDescs[0],
+                           mRecord.mTensors[0].mModes.data(),
+                           mTensors[1]->data(),
+                           &mDescs[1],
+                           mRecord.mTensors[1].mModes.data(),
+                           mRecord.mScalarType,
+                           stream);
+        };
+    }
+
+    // C aliases D, which avoids the blocking C -> D copy taken when they differ
+    void BenchProblem::initReduction(hiptensorHandle_t* handle, hipStream_t stream)
+    {
+        makeScalar(mAlpha, mRecord.mAlpha, mRecord.mComputeType);
+        makeScalar(mBeta, mRecord.mBeta, mRecord.mComputeType);
+
+        if(mUseCpu)
+        {
+            mRun = [this, stream]() {
+                return hiptensorReductionReference(mAlpha,
+                                                   mTensors[0]->data(),
+                                                   &mDescs[0],
+                                                   mRecord.mTensors[0].mModes.data(),
+                                                   mBeta,
+                                                   mTensors[2]->data(),
+                                                   &mDescs[1],
+                                                   mRecord.mTensors[1].mModes.data(),
+                                                   mTensors[2]->data(),
+                                                   &mDescs[2],
+                                                   mRecord.mTensors[2].mModes.data(),
+                                                   (hiptensorOperator_t)mRecord.mOpId,
+                                                   mRecord.mComputeType,
+                                                   stream);
+            };
+            return;
+        }
+
+        mWorkspaceSize = mRecord.mWorkspaceSize;
+        if(mWorkspaceSize > 0)
+        {
+            CHECK_HIP_ERROR(hipMalloc(&mWorkspace, mWorkspaceSize));
+        }
+
+        mRun = [this, handle, stream]() {
+            return hiptensorReduction(handle,
+                                      mAlpha,
+                                      mTensors[0]->data(),
+                                      &mDescs[0],
+                                      mRecord.mTensors[0].mModes.data(),
+                                      mBeta,
+                                      mTensors[2]->data(),
+                                      &mDescs[1],
+                                      mRecord.mTensors[1].mModes.data(),
+                                      mTensors[2]->data(),
+                                      &mDescs[2],
+                                      mRecord.mTensors[2].mModes.data(),
+                                      (hiptensorOperator_t)mRecord.mOpId,
+                                      mRecord.mComputeType,
+                                      mWorkspace,
+                                      mWorkspaceSize,
+                                      stream);
+        };
+    }
+
+    std::string kindToString(ApiRecordKind_t kind)
+    {
+        switch(kind)
+        {
+        case ApiRecordKind_t::CONTRACTION:
+            return "contraction";
+        case ApiRecordKind_t::PERMUTATION:
+            return "permutation";
+        case ApiRecordKind_t::REDUCTION:
+            return "reduction";
+        default:
+            return "unknown";
+        }
+    }
+
+    std::string problemKey(ApiRecord const& record)
+    {
+        std::ostringstream key;
+        key << kindToString(record.mKind) << " " << computeTypeToString(record.mComputeType)
+            << " op=" << record.mOpId;
+        for(auto const& tensor : record.mTensors)
+        {
+            key << " " << hipTypeToString(tensor.mType) << "[";
+            for(std::size_t i = 0; i < tensor.mLengths.size(); i++)
+            {
+                key << (i ? "," : "") << (i < tensor.mModes.size() ? tensor.mModes[i] : -1) << ":"
+                    << tensor.mLengths[i] << "/" << tensor.mStrides[i];
+            }
+            key << "]";
+        }
+        key << " alpha=" << record.mAlpha[0] << "," << record.mAlpha[1]
+            << " beta=" << record.mBeta[0] << "," << record.mBeta[1] << " algo=" << record.mAlgo
+            << " pref=" << record.mWorksizePref;
+        return key.str();
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_BENCH_PROBLEM_HPP
+#define HIPTENSOR_BENCH_PROBLEM_HPP
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+
+#include "api_recorder.hpp"
+
+namespace hiptensor
+{
+    // Owns the synthetic host and device storage of a single operand
+    class BenchTensor
+    {
+    public:
+        BenchTensor(ApiRecordTensor const& record, bool useDevice, std::mt19937& gen);
+        ~BenchTensor();
+
+        BenchTensor(BenchTensor const&)            = delete;
+        BenchTensor& operator=(BenchTensor const&) = delete;
+
+        void* data();
+
+        // Bytes of the packed tensor, as moved by a kernel touching every element once
+        std::size_t packedBytes() const;
+
+    private:
+        void fill(std::mt19937& gen);
+
+    private:
+        ApiRecordTensor const& mRecord;
+        std::vector<char>      mHost;
+        void*                  mDevice;
+        std::size_t            mElements;
+    };
+
+    // A problem described by an ApiRecord, with synthetic operands allocated and
+    // every descriptor / plan initialized. Each call executes the operation once,
+    // on the GPU (default) or on the CPU reference path.
+    class BenchProblem
+    {
+    public:
+        BenchProblem(hiptensorHandle_t* handle,
+                     ApiRecord const&   record,
+                     bool               useCpu,
+                     hipStream_t        stream,
+                     std::mt19937&      gen);
+        ~BenchProblem();
+
+        BenchProblem(BenchProblem const&)            = delete;
+        BenchProblem& operator=(BenchProblem const&) = delete;
+
+        // Status of problem setup. The problem cannot be run unless SUCCESS.
+        hiptensorStatus_t status() const;
+
+        hiptensorStatus_t operator()();
+
+        // Nominal work of one execution, used for throughput reporting
+        double flops() const;
+        double bytes() const;
+
+    private:
+        void initContraction(hiptensorHandle_t* handle, hipStream_t stream);
+        void initPermutation(hiptensorHandle_t* handle, hipStream_t stream);
+        void initReduction(hiptensorHandle_t* handle, hipStream_t stream);
+
+    private:
+        ApiRecord mRecord;
+        bool      mUseCpu;
+
+        std::vector<std::unique_ptr<BenchTensor>> mTensors;
+        std::vector<hiptensorTensorDescriptor_t>  mDescs;
+
+        // Scalars are materialized in the compute type, with enough room for complex f64
+        double mAlpha[2];
+        double mBeta[2];
+
+        hiptensorContractionDescriptor_t mContractionDesc;
+        hiptensorContractionFind_t       mContractionFind;
+        hiptensorContractionPlan_t       mContractionPlan;
+
+        void*    mWorkspace;
+        uint64_t mWorkspaceSize;
+
+        hiptensorStatus_t                  mStatus;
+        std::function<hiptensorStatus_t()> mRun;
+    };
+
+    std::string kindToString(ApiRecordKind_t kind);
+
+    // Human readable problem key, also used to fold identical problems together
+    std::string problemKey(ApiRecord const& record);
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_BENCH_PROBLEM_HPP
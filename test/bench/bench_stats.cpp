@@ -0,0 +1,468 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <sstream>
+
+#include "bench_stats.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Column order of both the CSV and JSON outputs
+        const char* const BenchFields[] = {"operation",
+                                           "problem",
+                                           "status",
+                                           "samples",
+                                           "min_ms",
+                                           "median_ms",
+                                           "p90_ms",
+                                           "p99_ms",
+                                           "mean_ms",
+                                           "tflops",
+                                           "gbps",
+                                           "pct_peak_flops",
+                                           "pct_peak_bw"};
+
+        constexpr std::size_t NumBenchFields = sizeof(BenchFields) / sizeof(BenchFields[0]);
+
+        std::vector<std::string> toFields(BenchResult const& result)
+        {
+            auto num = [](double val) {
+                std::ostringstream oss;
+                oss.precision(6);
+                oss << val;
+                return oss.str();
+            };
+
+            return {result.mOperation,
+                    result.mProblem,
+                    result.mStatus,
+                    std::to_string(result.mStats.mSamples),
+                    num(result.mStats.mMinMs),
+                    num(result.mStats.mMedianMs),
+                    num(result.mStats.mP90Ms),
+                    num(result.mStats.mP99Ms),
+                    num(result.mStats.mMeanMs),
+                    num(result.mTflops),
+                    num(result.mGBps),
+                    num(result.mPctPeakFlops),
+                    num(result.mPctPeakBw)};
+        }
+
+        BenchResult fromFields(std::map<std::string, std::string> const& fields)
+        {
+            auto str = [&fields](const char* key) {
+                auto it = fields.find(key);
+                return it != fields.end() ? it->second : std::string();
+            };
+            auto num = [&str](const char* key) { return std::atof(str(key).c_str()); };
+
+            BenchResult result;
+            result.mOperation       = str("operation");
+            result.mProblem         = str("problem");
+            result.mStatus          = str("status");
+            result.mStats.mSamples  = static_cast<std::size_t>(num("samples"));
+            result.mStats.mMinMs    = num("min_ms");
+            result.mStats.mMedianMs = num("median_ms");
+            result.mStats.mP90Ms    = num("p90_ms");
+            result.mStats.mP99Ms    = num("p99_ms");
+            result.mStats.mMeanMs   = num("mean_ms");
+            result.mTflops          = num("tflops");
+            result.mGBps            = num("gbps");
+            result.mPctPeakFlops    = num("pct_peak_flops");
+            result.mPctPeakBw       = num("pct_peak_bw");
+            return result;
+        }
+
+        // Numeric columns are written bare, everything else is quoted
+        bool isNumericField(std::size_t index)
+        {
+            return index >= 3;
+        }
+
+        std::string csvQuote(std::string const& field)
+        {
+            if(field.find_first_of(",\"\n") == std::string::npos)
+            {
+                return field;
+            }
+
+            std::string quoted = "\"";
+            for(auto c : field)
+            {
+                quoted += (c == '"') ? std::string("\"\"") : std::string(1, c);
+            }
+            return quoted + "\"";
+        }
+
+        std::vector<std::string> csvSplit(std::string const& line)
+        {
+            std::vector<std::string> fields(1);
+            bool                     inQuotes = false;
+            for(std::size_t i = 0; i < line.size(); i++)
+            {
+                char c = line[i];
+                if(inQuotes)
+                {
+                    if(c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+                    {
+                        fields.back() += '"';
+                        i++;
+                    }
+                    else if(c == '"')
+                    {
+                        inQuotes = false;
+                    }
+                    else
+                    {
+                        fields.back() += c;
+                    }
+                }
+                else if(c == '"')
+                {
+                    inQuotes = true;
+                }
+                else if(c == ',')
+                {
+                    fields.emplace_back();
+                }
+                else if(c != '\r')
+                {
+                    fields.back() += c;
+                }
+            }
+            return fields;
+        }
+
+        std::string jsonQuote(std::string const& field)
+        {
+            std::string quoted = "\"";
+            for(auto c : field)
+            {
+                if(c == '"' || c == '\\')
+                {
+                    quoted += '\\';
+                }
+                quoted += c;
+            }
+            return quoted + "\"";
+        }
+
+        // Minimal reader for the flat JSON objects written by writeBenchResults
+        bool jsonParseObjects(std::string const&                               text,
+                              std::vector<std::map<std::string, std::string>>& objects)
+        {
+            std::size_t pos = 0;
+
+            auto skipSpace = [&]() {
+                while(pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+                {
+                    pos++;
+                }
+            };
+
+            auto parseString = [&](std::string& out) {
+                if(pos >= text.size() || text[pos] != '"')
+                {
+                    return false;
+                }
+                for(pos++; pos < text.size() && text[pos] != '"'; pos++)
+                {
+                    if(text[pos] == '\\' && pos + 1 < text.size())
+                    {
+                        pos++;
+                    }
+                    out += text[pos];
+                }
+                return pos++ < text.size();
+            };
+
+            skipSpace();
+            if(pos >= text.size() || text[pos++] != '[')
+            {
+                return false;
+            }
+
+            while(true)
+            {
+                skipSpace();
+                if(pos < text.size() && text[pos] == ']')
+                {
+                    return true;
+                }
+                if(pos >= text.size() || text[pos++] != '{')
+                {
+                    return false;
+                }
+
+                std::map<std::string, std::string> object;
+                while(true)
+                {
+                    skipSpace();
+                    std::string key, value;
+                    if(!parseString(key))
+                    {
+                        return false;
+                    }
+                    skipSpace();
+                    if(pos >= text.size() || text[pos++] != ':')
+                    {
+                        return false;
+                    }
+                    skipSpace();
+                    if(pos < text.size() && text[pos] == '"')
+                    {
+                        if(!parseString(value))
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        while(pos < text.size() && text[pos] != ',' && text[pos] != '}'
+                              && !std::isspace(static_cast<unsigned char>(text[pos])))
+                        {
+                            value += text[pos++];
+                        }
+                    }
+                    object[key] = value;
+
+                    skipSpace();
+                    if(pos < text.size() && text[pos] == ',')
+                    {
+                        pos++;
+                        continue;
+                    }
+                    if(pos < text.size() && text[pos] == '}')
+                    {
+                        pos++;
+                        break;
+                    }
+                    return false;
+                }
+                objects.push_back(std::move(object));
+
+                skipSpace();
+                if(pos < text.size() && text[pos] == ',')
+                {
+                    pos++;
+                }
+            }
+        }
+    } // namespace
+
+    double percentile(std::vector<double> sorted, double pct)
+    {
+        if(sorted.empty())
+        {
+            return 0.0;
+        }
+
+        std::sort(sorted.begin(), sorted.end());
+        double rank  = std::clamp(pct, 0.0, 100.0) / 100.0 * (sorted.size() - 1);
+        auto   lower = static_cast<std::size_t>(std::floor(rank));
+        auto   upper = std::min(lower + 1, sorted.size() - 1);
+        return sorted[lower] + (rank - lower) * (sorted[upper] - sorted[lower]);
+    }
+
+    BenchStats computeStats(std::vector<double> const& samplesMs)
+    {
+        BenchStats stats;
+        if(samplesMs.empty())
+        {
+            return stats;
+        }
+
+        std::vector<double> sorted(samplesMs);
+        std::sort(sorted.begin(), sorted.end());
+
+        stats.mSamples  = sorted.size();
+        stats.mMinMs    = sorted.front();
+        stats.mMedianMs = percentile(sorted, 50.0);
+        stats.mP90Ms    = percentile(sorted, 90.0);
+        stats.mP99Ms    = percentile(sorted, 99.0);
+        stats.mMeanMs   = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+        return stats;
+    }
+
+    BenchFormat_t benchFormatFromFileName(std::string const& fileName)
+    {
+        auto dot = fileName.rfind('.');
+        if(dot != std::string::npos && fileName.substr(dot) == ".json")
+        {
+            return BenchFormat_t::JSON;
+        }
+        return BenchFormat_t::CSV;
+    }
+
+    bool writeBenchResults(std::string const&              fileName,
+                           BenchFormat_t                   format,
+                           std::vector<BenchResult> const& results)
+    {
+        std::ofstream out(fileName);
+        if(!out)
+        {
+            return false;
+        }
+
+        if(format == BenchFormat_t::CSV)
+        {
+            for(std::size_t i = 0; i < NumBenchFields; i++)
+            {
+                out << (i ? "," : "") << BenchFields[i];
+            }
+            out << "\n";
+
+            for(auto const& result : results)
+            {
+                auto fields = toFields(result);
+                for(std::size_t i = 0; i < NumBenchFields; i++)
+                {
+                    out << (i ? "," : "") << csvQuote(fields[i]);
+                }
+                out << "\n";
+            }
+        }
+        else
+        {
+            out << "[\n";
+            for(std::size_t r = 0; r < results.size(); r++)
+            {
+                auto fields = toFields(results[r]);
+                out << "  {";
+                for(std::size_t i = 0; i < NumBenchFields; i++)
+                {
+                    out << (i ? ", " : "") << jsonQuote(BenchFields[i]) << ": "
+                        << (isNumericField(i) ? fields[i] : jsonQuote(fields[i]));
+                }
+                out << "}" << (r + 1 < results.size() ? "," : "") << "\n";
+            }
+            out << "]\n";
+        }
+
+        return static_cast<bool>(out);
+    }
+
+    bool readBenchResults(std::string const&        fileName,
+                          BenchFormat_t             format,
+                          std::vector<BenchResult>& results)
+    {
+        std::ifstream in(fileName);
+        if(!in)
+        {
+            return false;
+        }
+
+        std::vector<std::map<std::string, std::string>> objects;
+        if(format == BenchFormat_t::CSV)
+        {
+            std::string line;
+            if(!std::getline(in, line))
+            {
+                return false;
+            }
+
+            auto header = csvSplit(line);
+            while(std::getline(in, line))
+            {
+                if(line.empty())
+                {
+                    continue;
+                }
+
+                auto fields = csvSplit(line);
+                if(fields.size() != header.size())
+                {
+                    return false;
+                }
+
+                std::map<std::string, std::string> object;
+                for(std::size_t i = 0; i < header.size(); i++)
+                {
+                    object[header[i]] = fields[i];
+                }
+                objects.push_back(std::move(object));
+            }
+        }
+        else
+        {
+            std::stringstream text;
+            text << in.rdbuf();
+            if(!jsonParseObjects(text.str(), objects))
+            {
+                return false;
+            }
+        }
+
+        for(auto const& object : objects)
+        {
+            results.push_back(fromFields(object));
+        }
+        return true;
+    }
+
+    std::vector<BenchComparison> compareBenchResults(std::vector<BenchResult> const& base,
+                                                     std::vector<BenchResult> const& current,
+                                                     double                          thresholdPct)
+    {
+        std::map<std::pair<std::string, std::string>, BenchResult const*> baseByProblem;
+        for(auto const& result : base)
+        {
+            baseByProblem[{result.mOperation, result.mProblem}] = &result;
+        }
+
+        std::vector<BenchComparison> comparisons;
+        for(auto const& result : current)
+        {
+            auto it = baseByProblem.find({result.mOperation, result.mProblem});
+            if(it == baseByProblem.end() || it->second->mStats.mMedianMs <= 0.0
+               || result.mStats.mMedianMs <= 0.0)
+            {
+                continue;
+            }
+
+            BenchComparison comparison;
+            comparison.mOperation       = result.mOperation;
+            comparison.mProblem         = result.mProblem;
+            comparison.mBaseMedianMs    = it->second->mStats.mMedianMs;
+            comparison.mCurrentMedianMs = result.mStats.mMedianMs;
+            comparison.mChangePct
+                = (comparison.mCurrentMedianMs / comparison.mBaseMedianMs - 1.0) * 100.0;
+            comparison.mRegression = comparison.mChangePct > thresholdPct;
+            comparisons.push_back(comparison);
+        }
+        return comparisons;
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_BENCH_STATS_HPP
+#define HIPTENSOR_BENCH_STATS_HPP
+
+#include <string>
+#include <vector>
+
+namespace hiptensor
+{
+    // Order statistics of a set of timing samples, in milliseconds
+    struct BenchStats
+    {
+        std::size_t mSamples = 0;
+        double      mMinMs    = 0.0;
+        double      mMedianMs = 0.0;
+        double      mP90Ms    = 0.0;
+        double      mP99Ms    = 0.0;
+        double      mMeanMs   = 0.0;
+    };
+
+    // Percentiles use linear interpolation between closest ranks
+    double     percentile(std::vector<double> sorted, double pct);
+    BenchStats computeStats(std::vector<double> const& samplesMs);
+
+    // One row of benchmark output. Throughput figures are derived from the median.
+    struct BenchResult
+    {
+        std::string mOperation;
+        std::string mProblem;
+        std::string mStatus;
+        BenchStats  mStats;
+        double      mTflops       = 0.0;
+        double      mGBps         = 0.0;
+        double      mPctPeakFlops = 0.0;
+        double      mPctPeakBw    = 0.0;
+    };
+
+    enum struct BenchFormat_t
+    {
+        CSV,
+        JSON,
+    };
+
+    // Picks JSON for *.json file names, CSV otherwise
+    BenchFormat_t benchFormatFromFileName(std::string const& fileName);
+
+    bool writeBenchResults(std::string const&              fileName,
+                           BenchFormat_t                   format,
+                           std::vector<BenchResult> const& results);
+    bool readBenchResults(std::string const&        fileName,
+                          BenchFormat_t             format,
+                          std::vector<BenchResult>& results);
+
+    struct BenchComparison
+    {
+        std::string mOperation;
+        std::string mProblem;
+        double      mBaseMedianMs;
+        double      mCurrentMedianMs;
+        double      mChangePct; // Positive is slower
+        bool        mRegression;
+    };
+
+    // Matches results by operation and problem. A regression is a median slowdown
+    // strictly greater than thresholdPct. Problems missing from either side are skipped.
+    std::vector<BenchComparison> compareBenchResults(std::vector<BenchResult> const& base,
+                                                     std::vector<BenchResult> const& current,
+                                                     double                          thresholdPct);
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_BENCH_STATS_HPP
@@ -0,0 +1,693 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+// hiptensor-bench
+//
+// Benchmarks the contraction, permutation and reduction problems described by the
+// YAML test configs (e.g. test/*/configs/bench/*.yaml). Every parameter combination is
+// warmed up until its median time stabilizes, then timed per iteration, and reported
+// with min / median / p90 / p99, TFLOPs, GB/s and percent of device peak.
+//
+// Usage:
+//   hiptensor-bench [--contraction <yaml>]... [--permutation <yaml>]... [--reduction <yaml>]...
+//                   [--output <file>] [--format csv|json] [--iterations N]
+//                   [--max-warmups N] [--warmup-tolerance PCT]
+//   hiptensor-bench --compare <base> <current> [--threshold PCT]
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+#include "bench_problem.hpp"
+#include "bench_stats.hpp"
+#include "data_types.hpp"
+#include "hip_device.hpp"
+#include "hiptensor_options.hpp"
+#include "util.hpp"
+
+#include "01_contraction/contraction_test_params.hpp"
+#include "02_permutation/permutation_test_params.hpp"
+#include "03_reduction/reduction_test_params.hpp"
+#include "llvm/yaml_parser.hpp"
+
+namespace
+{
+    using hiptensor::ApiRecord;
+    using hiptensor::ApiRecordKind_t;
+    using hiptensor::ApiRecordTensor;
+    using hiptensor::BenchFormat_t;
+    using hiptensor::BenchResult;
+
+    struct BenchOptions
+    {
+        int32_t mIterations      = 100;
+        int32_t mWarmupWindow    = 5;
+        int32_t mMaxWarmups      = 200;
+        double  mWarmupTolerance = 2.0;
+        double  mThreshold       = 5.0;
+
+        std::string   mOutputFile;
+        BenchFormat_t mFormat    = BenchFormat_t::CSV;
+        bool          mFormatSet = false;
+    };
+
+    struct DevicePeak
+    {
+        double mTflops = 0.0;
+        double mGBps   = 0.0;
+    };
+
+    // Dense matrix core throughput, in flops per CU per clock
+    double flopsPerCuPerClock(hiptensor::HipDevice::hipGcnArch_t arch,
+                              hiptensorComputeType_t             computeType)
+    {
+        using Arch = hiptensor::HipDevice;
+
+        bool isMI300 = arch == Arch::GFX940 || arch == Arch::GFX941 || arch == Arch::GFX942;
+        switch(computeType)
+        {
+        case HIPTENSOR_COMPUTE_16F:
+            return isMI300 ? 2048.0 : 1024.0;
+        case HIPTENSOR_COMPUTE_16BF:
+            return isMI300 ? 2048.0 : (arch == Arch::GFX908 ? 512.0 : 1024.0);
+        case HIPTENSOR_COMPUTE_32F:
+        case HIPTENSOR_COMPUTE_C32F:
+            return isMI300 ? 256.0 : (arch == Arch::GFX908 ? 256.0 : 128.0);
+        case HIPTENSOR_COMPUTE_64F:
+        case HIPTENSOR_COMPUTE_C64F:
+            return isMI300 ? 256.0 : (arch == Arch::GFX908 ? 64.0 : 128.0);
+        default:
+            return 0.0;
+        }
+    }
+
+    DevicePeak devicePeak(hiptensor::HipDevice const& device, hiptensorComputeType_t computeType)
+    {
+        auto props = device.getDeviceProps();
+
+        DevicePeak peak;
+        peak.mTflops = device.cuCount() * (device.maxFreqMhz() * 1.0e6)
+                       * flopsPerCuPerClock(device.getGcnArch(), computeType) / 1.0e12;
+
+        // memoryClockRate is in kHz and the memory is double data rate
+        peak.mGBps = 2.0 * (props.memoryClockRate * 1.0e3) * (props.memoryBusWidth / 8.0) / 1.0e9;
+        return peak;
+    }
+
+    ApiRecordTensor makeTensor(hipDataType                 type,
+                               hiptensorOperator_t         op,
+                               std::vector<std::size_t>    lengths,
+                               std::vector<std::size_t>    strides,
+                               std::vector<int32_t> const& modes)
+    {
+        if(strides.empty())
+        {
+            // Packed strides, matching the library default when none are given
+            strides = hiptensor::stridesFromLengths(
+                lengths, hiptensor::HiptensorOptions::instance()->isColMajorStrides());
+        }
+        return ApiRecordTensor{type, op, std::move(lengths), std::move(strides), modes};
+    }
+
+    ApiRecord makeRecord(ApiRecordKind_t kind)
+    {
+        ApiRecord record{};
+        record.mKind         = kind;
+        record.mAlgo         = HIPTENSOR_ALGO_DEFAULT;
+        record.mWorksizePref = HIPTENSOR_WORKSPACE_RECOMMENDED;
+        return record;
+    }
+
+    void setScalar(double (&dst)[2], std::vector<double> const& src)
+    {
+        dst[0] = src.size() > 0 ? src[0] : 0.0;
+        dst[1] = src.size() > 1 ? src[1] : 0.0;
+    }
+
+    ApiRecord makeContraction(std::vector<hipDataType> const&              types,
+                              hiptensorAlgo_t                              algo,
+                              hiptensorOperator_t                          op,
+                              hiptensorWorksizePreference_t                pref,
+                              std::vector<std::vector<std::size_t>> const& lengths,
+                              std::vector<std::vector<std::size_t>> const& strides,
+                              std::vector<std::vector<int32_t>> const&     modes,
+                              std::vector<double> const&                   alpha,
+                              std::vector<double> const&                   beta)
+    {
+        auto strideOf = [&strides](std::size_t i) {
+            return strides.empty() ? std::vector<std::size_t>{} : strides[i];
+        };
+
+        bool hasC = types[2] != hiptensor::NONE_TYPE;
+
+        auto record          = makeRecord(ApiRecordKind_t::CONTRACTION);
+        record.mComputeType  = hiptensor::convertToComputeType(types[4]);
+        record.mScalarType   = types[4];
+        record.mAlgo         = algo;
+        record.mWorksizePref = pref;
+        // ContractionOpId_t BILINEAR / SCALE, whose header requires composable_kernel
+        record.mOpId = hasC ? 1 : 0;
+        setScalar(record.mAlpha, alpha);
+        setScalar(record.mBeta, hasC ? beta : std::vector<double>{});
+
+        // C and D share lengths, strides and modes in the test configs
+        auto tD = makeTensor(types[3], op, lengths[2], strideOf(2), modes[2]);
+        auto tC = tD;
+        tC.mType = types[2];
+
+        record.mTensors = {makeTensor(types[0], op, lengths[0], strideOf(0), modes[0]),
+                           makeTensor(types[1], op, lengths[1], strideOf(1), modes[1]),
+                           tC,
+                           tD};
+        return record;
+    }
+
+    // Cartesian product of the config parameters, as the combined gtest suites do
+    bool loadContractionProblems(std::string const& file, std::vector<ApiRecord>& records)
+    {
+        auto config
+            = hiptensor::YamlConfigLoader<hiptensor::ContractionTestParams>::loadFromFile(file);
+        if(!config)
+        {
+            return false;
+        }
+
+        auto& params  = *config;
+        auto  strides = params.problemStrides();
+        if(strides.empty())
+        {
+            strides.emplace_back();
+        }
+
+        for(auto const& lengths : params.problemLengths())
+        {
+            for(auto const& modes : params.problemModes())
+            {
+                if(lengths.size() != 3 || modes.size() != 3)
+                {
+                    return false;
+                }
+            }
+        }
+
+        for(auto const& types : params.dataTypes())
+        {
+            if(types.size() != 5)
+            {
+                return false;
+            }
+
+            for(auto algo : params.algorithms())
+                for(auto op : params.operators())
+                    for(auto pref : params.workSizePrefrences())
+                        for(auto const& lengths : params.problemLengths())
+                            for(auto const& stride : strides)
+                                for(auto const& modes : params.problemModes())
+                                    for(auto const& alpha : params.alphas())
+                                        for(auto const& beta : params.betas())
+                                            records.push_back(makeContraction(types,
+                                                                              algo,
+                                                                              op,
+                                                                              pref,
+                                                                              lengths,
+                                                                              stride,
+                                                                              modes,
+                                                                              alpha,
+                                                                              beta));
+        }
+        return true;
+    }
+
+    bool loadPermutationProblems(std::string const& file, std::vector<ApiRecord>& records)
+    {
+        auto config
+            = hiptensor::YamlConfigLoader<hiptensor::PermutationTestParams>::loadFromFile(file);
+        if(!config)
+        {
+            return false;
+        }
+
+        auto& params = *config;
+        for(auto const& types : params.dataTypes())
+            for(auto const& lengths : params.problemLengths())
+                for(auto const& permutedDims : params.permutedDims())
+                    for(auto alpha : params.alphas())
+                        for(auto const& ops : params.operators())
+                        {
+                            if(types.size() != 2 || ops.size() != 2
+                               || permutedDims.size() != lengths.size())
+                            {
+                                return false;
+                            }
+
+                            std::vector<int32_t> modeA(lengths.size());
+                            std::iota(modeA.begin(), modeA.end(), 'a');
+
+                            std::vector<int32_t>     modeB;
+                            std::vector<std::size_t> lengthsB;
+                            for(auto dim : permutedDims)
+                            {
+                                modeB.push_back(modeA[dim]);
+                                lengthsB.push_back(lengths[dim]);
+                            }
+
+                            auto record         = makeRecord(ApiRecordKind_t::PERMUTATION);
+                            record.mScalarType  = types[1];
+                            record.mComputeType = hiptensor::convertToComputeType(types[1]);
+                            record.mOpId        = HIPTENSOR_OP_IDENTITY;
+                            record.mAlpha[0]    = alpha;
+                            record.mTensors
+                                = {makeTensor(types[0], ops[0], lengths, {}, modeA),
+                                   makeTensor(types[0], ops[1], lengthsB, {}, modeB)};
+                            records.push_back(std::move(record));
+                        }
+        return true;
+    }
+
+    bool loadReductionProblems(std::string const& file, std::vector<ApiRecord>& records)
+    {
+        auto config
+            = hiptensor::YamlConfigLoader<hiptensor::ReductionTestParams>::loadFromFile(file);
+        if(!config)
+        {
+            return false;
+        }
+
+        auto colMajor = hiptensor::HiptensorOptions::instance()->isColMajorStrides();
+
+        auto& params = *config;
+        for(auto const& types : params.dataTypes())
+            for(auto const& lengths : params.problemLengths())
+                for(auto const& outputDims : params.outputDims())
+                    for(auto alpha : params.alphas())
+                        for(auto beta : params.betas())
+                            for(auto op : params.operators())
+                            {
+                                if(types.size() != 2)
+                                {
+                                    return false;
+                                }
+
+                                std::vector<int32_t> modeA(lengths.size());
+                                std::iota(modeA.begin(), modeA.end(), 'a');
+
+                                std::vector<int32_t> modeC;
+                                for(auto dim : outputDims)
+                                {
+                                    modeC.push_back(modeA[dim]);
+                                }
+
+                                // Output lengths follow the sorted output dims and strides keep
+                                // the packed order of the requested output dims, as in the tests
+                                std::vector<std::size_t> sortedDims(outputDims);
+                                std::sort(sortedDims.begin(), sortedDims.end());
+
+                                std::vector<std::size_t> lengthsC, stridesC(sortedDims.size());
+                                for(auto dim : sortedDims)
+                                {
+                                    lengthsC.push_back(lengths[dim]);
+                                }
+
+                                std::vector<std::size_t> order(outputDims);
+                                if(!colMajor)
+                                {
+                                    std::reverse(order.begin(), order.end());
+                                }
+                                std::size_t stride = 1;
+                                for(auto dim : order)
+                                {
+                                    auto pos = std::find(sortedDims.begin(), sortedDims.end(), dim)
+                                               - sortedDims.begin();
+                                    stridesC[pos] = stride;
+                                    stride *= lengths[dim];
+                                }
+
+                                auto record         = makeRecord(ApiRecordKind_t::REDUCTION);
+                                record.mComputeType = hiptensor::convertToComputeType(types[1]);
+                                record.mScalarType  = types[1];
+                                record.mOpId        = op;
+                                record.mAlpha[0]    = alpha;
+                                record.mBeta[0]     = beta;
+
+                                auto tC = makeTensor(
+                                    types[0], HIPTENSOR_OP_IDENTITY, lengthsC, stridesC, modeC);
+                                record.mTensors = {
+                                    makeTensor(types[0], HIPTENSOR_OP_IDENTITY, lengths, {}, modeA),
+                                    tC,
+                                    tC};
+                                records.push_back(std::move(record));
+                            }
+        return true;
+    }
+
+    // Per-iteration device times of count runs, in milliseconds
+    hiptensorStatus_t sampleRuns(hiptensor::BenchProblem& problem,
+                                 int32_t                  count,
+                                 hipStream_t              stream,
+                                 hipEvent_t               startEvent,
+                                 hipEvent_t               stopEvent,
+                                 std::vector<double>&     samples)
+    {
+        samples.clear();
+        for(int32_t i = 0; i < count; i++)
+        {
+            CHECK_HIP_ERROR(hipEventRecord(startEvent, stream));
+            auto status = problem();
+            CHECK_HIP_ERROR(hipEventRecord(stopEvent, stream));
+            CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+            if(status != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return status;
+            }
+
+            float elapsedMs = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&elapsedMs, startEvent, stopEvent));
+            samples.push_back(elapsedMs);
+        }
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Warms up in windows until the window median moves by no more than the tolerance
+    hiptensorStatus_t warmup(hiptensor::BenchProblem& problem,
+                             BenchOptions const&      options,
+                             hipStream_t              stream,
+                             hipEvent_t               startEvent,
+                             hipEvent_t               stopEvent)
+    {
+        std::vector<double> samples;
+        double              prevMedian = -1.0;
+        for(int32_t runs = 0; runs < options.mMaxWarmups; runs += options.mWarmupWindow)
+        {
+            auto status = sampleRuns(
+                problem, options.mWarmupWindow, stream, startEvent, stopEvent, samples);
+            if(status != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return status;
+            }
+
+            auto median = hiptensor::percentile(samples, 50.0);
+            if(prevMedian > 0.0
+               && std::abs(median - prevMedian) <= options.mWarmupTolerance / 100.0 * prevMedian)
+            {
+                break;
+            }
+            prevMedian = median;
+        }
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    BenchResult benchmark(hiptensorHandle_t*          handle,
+                          ApiRecord const&            record,
+                          BenchOptions const&         options,
+                          hiptensor::HipDevice const& device,
+                          hipStream_t                 stream,
+                          std::mt19937&               gen)
+    {
+        BenchResult result;
+        result.mOperation = hiptensor::kindToString(record.mKind);
+        result.mProblem   = hiptensor::problemKey(record);
+
+        hiptensor::BenchProblem problem(handle, record, false, stream, gen);
+
+        hipEvent_t startEvent, stopEvent;
+        CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+        CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+        std::vector<double> samples;
+        auto                status = problem.status();
+        if(status == HIPTENSOR_STATUS_SUCCESS)
+        {
+            status = warmup(problem, options, stream, startEvent, stopEvent);
+        }
+        if(status == HIPTENSOR_STATUS_SUCCESS)
+        {
+            status = sampleRuns(
+                problem, options.mIterations, stream, startEvent, stopEvent, samples);
+        }
+
+        CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+        CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+        result.mStatus = hiptensorGetErrorString(status);
+        if(status != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return result;
+        }
+
+        result.mStats = hiptensor::computeStats(samples);
+
+        auto seconds   = result.mStats.mMedianMs / 1.0e3;
+        result.mTflops = seconds > 0.0 ? problem.flops() / seconds / 1.0e12 : 0.0;
+        result.mGBps   = seconds > 0.0 ? problem.bytes() / seconds / 1.0e9 : 0.0;
+
+        auto peak            = devicePeak(device, record.mComputeType);
+        result.mPctPeakFlops = peak.mTflops > 0.0 ? result.mTflops / peak.mTflops * 100.0 : 0.0;
+        result.mPctPeakBw    = peak.mGBps > 0.0 ? result.mGBps / peak.mGBps * 100.0 : 0.0;
+        return result;
+    }
+
+    int compare(std::string const& baseFile, std::string const& currentFile, double thresholdPct)
+    {
+        std::vector<BenchResult> base, current;
+        if(!hiptensor::readBenchResults(
+               baseFile, hiptensor::benchFormatFromFileName(baseFile), base))
+        {
+            fprintf(stderr, "Unable to read bench results: %s\n", baseFile.c_str());
+            return EXIT_FAILURE;
+        }
+        if(!hiptensor::readBenchResults(
+               currentFile, hiptensor::benchFormatFromFileName(currentFile), current))
+        {
+            fprintf(stderr, "Unable to read bench results: %s\n", currentFile.c_str());
+            return EXIT_FAILURE;
+        }
+
+        auto comparisons = hiptensor::compareBenchResults(base, current, thresholdPct);
+
+        int regressions = 0;
+        printf("%-12s %-12s %-10s %-12s %s\n",
+               "base_ms",
+               "current_ms",
+               "change",
+               "verdict",
+               "problem");
+        for(auto const& comparison : comparisons)
+        {
+            regressions += comparison.mRegression ? 1 : 0;
+            printf("%-12.4f %-12.4f %+9.2f%% %-12s %s %s\n",
+                   comparison.mBaseMedianMs,
+                   comparison.mCurrentMedianMs,
+                   comparison.mChangePct,
+                   comparison.mRegression ? "REGRESSION" : "ok",
+                   comparison.mOperation.c_str(),
+                   comparison.mProblem.c_str());
+        }
+
+        printf("\nCompared %zu of %zu problems, %d regression(s) above %.2f%%\n",
+               comparisons.size(),
+               current.size(),
+               regressions,
+               thresholdPct);
+        return regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    int printUsage(const char* exe)
+    {
+        fprintf(stderr,
+                "Usage: %s [--contraction <yaml>]... [--permutation <yaml>]... "
+                "[--reduction <yaml>]...\n"
+                "          [--output <file>] [--format csv|json] [--iterations N]\n"
+                "          [--max-warmups N] [--warmup-tolerance PCT]\n"
+                "       %s --compare <base> <current> [--threshold PCT]\n",
+                exe,
+                exe);
+        return EXIT_FAILURE;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+
+    std::vector<std::pair<ApiRecordKind_t, std::string>> configs;
+    std::string                                          baseFile, currentFile;
+
+    for(int i = 1; i < argc; i++)
+    {
+        auto hasValue = [&](int n) { return i + n < argc; };
+        if(strcmp(argv[i], "--contraction") == 0 && hasValue(1))
+        {
+            configs.emplace_back(ApiRecordKind_t::CONTRACTION, argv[++i]);
+        }
+        else if(strcmp(argv[i], "--permutation") == 0 && hasValue(1))
+        {
+            configs.emplace_back(ApiRecordKind_t::PERMUTATION, argv[++i]);
+        }
+        else if(strcmp(argv[i], "--reduction") == 0 && hasValue(1))
+        {
+            configs.emplace_back(ApiRecordKind_t::REDUCTION, argv[++i]);
+        }
+        else if(strcmp(argv[i], "--output") == 0 && hasValue(1))
+        {
+            options.mOutputFile = argv[++i];
+        }
+        else if(strcmp(argv[i], "--format") == 0 && hasValue(1))
+        {
+            std::string format = argv[++i];
+            if(format != "csv" && format != "json")
+            {
+                return printUsage(argv[0]);
+            }
+            options.mFormat    = format == "json" ? BenchFormat_t::JSON : BenchFormat_t::CSV;
+            options.mFormatSet = true;
+        }
+        else if(strcmp(argv[i], "--iterations") == 0 && hasValue(1))
+        {
+            options.mIterations = std::max(1, atoi(argv[++i]));
+        }
+        else if(strcmp(argv[i], "--max-warmups") == 0 && hasValue(1))
+        {
+            options.mMaxWarmups = std::max(0, atoi(argv[++i]));
+        }
+        else if(strcmp(argv[i], "--warmup-tolerance") == 0 && hasValue(1))
+        {
+            options.mWarmupTolerance = std::max(0.0, atof(argv[++i]));
+        }
+        else if(strcmp(argv[i], "--threshold") == 0 && hasValue(1))
+        {
+            options.mThreshold = std::max(0.0, atof(argv[++i]));
+        }
+        else if(strcmp(argv[i], "--compare") == 0 && hasValue(2))
+        {
+            baseFile    = argv[++i];
+            currentFile = argv[++i];
+        }
+        else
+        {
+            return printUsage(argv[0]);
+        }
+    }
+
+    if(!baseFile.empty())
+    {
+        return compare(baseFile, currentFile, options.mThreshold);
+    }
+
+    if(configs.empty())
+    {
+        return printUsage(argv[0]);
+    }
+
+    if(!options.mOutputFile.empty() && !options.mFormatSet)
+    {
+        options.mFormat = hiptensor::benchFormatFromFileName(options.mOutputFile);
+    }
+
+    std::vector<ApiRecord> records;
+    for(auto const& [kind, file] : configs)
+    {
+        bool loaded = false;
+        switch(kind)
+        {
+        case ApiRecordKind_t::CONTRACTION:
+            loaded = loadContractionProblems(file, records);
+            break;
+        case ApiRecordKind_t::PERMUTATION:
+            loaded = loadPermutationProblems(file, records);
+            break;
+        case ApiRecordKind_t::REDUCTION:
+            loaded = loadReductionProblems(file, records);
+            break;
+        }
+        if(!loaded)
+        {
+            fprintf(stderr, "Unable to load bench config: %s\n", file.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+
+    hiptensorHandle_t* handle;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    hiptensor::HipDevice device;
+    std::mt19937         gen(5489u);
+
+    printf("Benchmarking %zu problems on %s\n", records.size(), device.getDeviceProps().name);
+    printf("%-10s %-10s %-10s %-10s %-9s %-9s %-8s %-8s %-28s %s\n",
+           "min_ms",
+           "median_ms",
+           "p90_ms",
+           "p99_ms",
+           "TFLOPs",
+           "GB/s",
+           "%flops",
+           "%bw",
+           "status",
+           "problem");
+
+    std::vector<BenchResult> results;
+    int                      failures = 0;
+    for(auto const& record : records)
+    {
+        auto result = benchmark(handle, record, options, device, stream, gen);
+        printf("%-10.4f %-10.4f %-10.4f %-10.4f %-9.3f %-9.1f %-8.1f %-8.1f %-28s %s\n",
+               result.mStats.mMinMs,
+               result.mStats.mMedianMs,
+               result.mStats.mP90Ms,
+               result.mStats.mP99Ms,
+               result.mTflops,
+               result.mGBps,
+               result.mPctPeakFlops,
+               result.mPctPeakBw,
+               result.mStatus.c_str(),
+               result.mProblem.c_str());
+
+        failures += result.mStats.mSamples == 0 ? 1 : 0;
+        results.push_back(std::move(result));
+    }
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+
+    if(!options.mOutputFile.empty()
+       && !hiptensor::writeBenchResults(options.mOutputFile, options.mFormat, results))
+    {
+        fprintf(stderr, "Unable to write bench results: %s\n", options.mOutputFile.c_str());
+        return EXIT_FAILURE;
+    }
+
+    printf("\n%zu problems, %d not run\n", results.size(), failures);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,358 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+// hiptensor-host-bench
+//
+// Measures the host-side cost of the library layers that run before any kernel is
+// launched. No kernel is launched: kernel arguments are built against null data
+// pointers. The handle is created once with hiptensorCreate, which needs a device: without
+// one, the benchmarks that take the handle are skipped and the others still run.
+// Accepts the usual google-benchmark flags (--benchmark_filter, ...).
+
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+#include "data_types.hpp"
+#include "logger.hpp"
+#include "util.hpp"
+
+#include "contraction/contraction_solution.hpp"
+#include "contraction/contraction_solution_instances.hpp"
+#include "contraction/contraction_solution_registry.hpp"
+#include "permutation/permutation_instance_selection.hpp"
+
+namespace
+{
+    // Rank-2 m/n/k problem per operand, in the layout of the contraction tests
+    struct ContractionProblem
+    {
+        ContractionProblem()
+            : mModesA{'m', 'k'}
+            , mModesB{'n', 'k'}
+            , mModesD{'m', 'n'}
+            , mLengthsA{256, 128}
+            , mLengthsB{512, 128}
+            , mLengthsD{256, 512}
+            , mStridesA{1, 256}
+            , mStridesB{1, 512}
+            , mStridesD{1, 256}
+        {
+        }
+
+        std::vector<int32_t>     mModesA, mModesB, mModesD;
+        std::vector<std::size_t> mLengthsA, mLengthsB, mLengthsD;
+        std::vector<std::size_t> mStridesA, mStridesB, mStridesD;
+    };
+
+    // Created in main() before the benchmarks run if there is a device, destroyed after
+    hiptensorHandle_t* gHandle = nullptr;
+
+    // The handle, or null with the benchmark skipped if there is no device
+    hiptensorHandle_t* hostHandle(benchmark::State& state)
+    {
+        if(gHandle == nullptr)
+        {
+            state.SkipWithMessage("No HIP device to create a handle on");
+        }
+        return gHandle;
+    }
+
+    std::vector<hiptensor::ContractionSolution*> allContractionSolutions()
+    {
+        std::vector<hiptensor::ContractionSolution*> solutions;
+        for(auto const& [uid, solution] :
+            hiptensor::ContractionSolutionInstances::instance()->allSolutions().solutions())
+        {
+            solutions.push_back(solution);
+        }
+        return solutions;
+    }
+
+    void BM_InitTensorDescriptor(benchmark::State& state)
+    {
+        auto                 rank    = state.range(0);
+        std::vector<int64_t> lengths(rank, 16);
+        std::vector<int64_t> strides = hiptensor::stridesFromLengths(lengths);
+
+        auto* handle = hostHandle(state);
+        if(handle == nullptr)
+        {
+            return;
+        }
+
+        hiptensorTensorDescriptor_t desc;
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(hiptensorInitTensorDescriptor(handle,
+                                                                   &desc,
+                                                                   rank,
+                                                                   lengths.data(),
+                                                                   strides.data(),
+                                                                   HIP_R_32F,
+                                                                   HIPTENSOR_OP_IDENTITY));
+            benchmark::ClobberMemory();
+        }
+    }
+    BENCHMARK(BM_InitTensorDescriptor)->DenseRange(2, 6, 2);
+
+    void BM_InitContractionDescriptor(benchmark::State& state)
+    {
+        ContractionProblem problem;
+
+        auto makeDesc = [](std::vector<std::size_t> const& lengths,
+                           std::vector<std::size_t> const& strides) {
+            return hiptensorTensorDescriptor_t{HIP_R_32F, lengths, strides, HIPTENSOR_OP_IDENTITY};
+        };
+        auto descA = makeDesc(problem.mLengthsA, problem.mStridesA);
+        auto descB = makeDesc(problem.mLengthsB, problem.mStridesB);
+        auto descD = makeDesc(problem.mLengthsD, problem.mStridesD);
+
+        bool bilinear = state.range(0) != 0;
+
+        auto* handle = hostHandle(state);
+        if(handle == nullptr)
+        {
+            return;
+        }
+
+        hiptensorContractionDescriptor_t desc;
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                hiptensorInitContractionDescriptor(handle,
+                                                   &desc,
+                                                   &descA,
+                                                   problem.mModesA.data(),
+                                                   16u,
+                                                   &descB,
+                                                   problem.mModesB.data(),
+                                                   16u,
+                                                   bilinear ? &descD : nullptr,
+                                                   bilinear ? problem.mModesD.data() : nullptr,
+                                                   16u,
+                                                   &descD,
+                                                   problem.mModesD.data(),
+                                                   16u,
+                                                   HIPTENSOR_COMPUTE_32F));
+            benchmark::ClobberMemory();
+        }
+    }
+    BENCHMARK(BM_InitContractionDescriptor)->ArgName("bilinear")->Arg(0)->Arg(1);
+
+    // The chain taken by hiptensorInitContractionPlan over the find candidates
+    void BM_ContractionQueryChain(benchmark::State& state)
+    {
+        auto candidates = allContractionSolutions();
+        for(auto _ : state)
+        {
+            auto query
+                = hiptensor::ContractionSolutionRegistry::Query{candidates}
+                      .query(hiptensor::ContractionOpId_t::BILINEAR)
+                      .query(HIP_R_32F, HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+            benchmark::DoNotOptimize(query.solutionCount());
+        }
+        state.counters["candidates"] = candidates.size();
+    }
+    BENCHMARK(BM_ContractionQueryChain);
+
+    // The lookup taken by the CPU reference, directly on the registry
+    void BM_ContractionRegistryQuery(benchmark::State& state)
+    {
+        auto& instances = hiptensor::ContractionSolutionInstances::instance();
+        for(auto _ : state)
+        {
+            auto query = instances->allSolutions().query(
+                HIP_R_32F, HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+            benchmark::DoNotOptimize(query.solutionCount());
+        }
+    }
+    BENCHMARK(BM_ContractionRegistryQuery);
+
+    void BM_NormalizeTensorModes(benchmark::State& state)
+    {
+        ContractionProblem problem;
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(hiptensor::normalizeTensorModes(problem.mLengthsA,
+                                                                     problem.mStridesA,
+                                                                     problem.mModesA,
+                                                                     problem.mLengthsB,
+                                                                     problem.mStridesB,
+                                                                     problem.mModesB,
+                                                                     problem.mLengthsD,
+                                                                     problem.mStridesD,
+                                                                     problem.mModesD));
+        }
+    }
+    BENCHMARK(BM_NormalizeTensorModes);
+
+    // Argument construction for a single solution, as done once per candidate during selection
+    void BM_ContractionInitArgs(benchmark::State& state)
+    {
+        auto candidates = allContractionSolutions();
+        auto query
+            = hiptensor::ContractionSolutionRegistry::Query{candidates}
+                  .query(hiptensor::ContractionOpId_t::BILINEAR)
+                  .query(HIP_R_32F, HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+        if(query.solutionCount() == 0)
+        {
+            state.SkipWithError("No f32 bilinear contraction solutions");
+            return;
+        }
+
+        auto*              solution = query.solutions().begin()->second;
+        ContractionProblem problem;
+        float              alpha = 1.0f, beta = 1.0f;
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(solution->initArgs(&alpha,
+                                                        nullptr,
+                                                        nullptr,
+                                                        &beta,
+                                                        nullptr,
+                                                        nullptr,
+                                                        problem.mLengthsA,
+                                                        problem.mStridesA,
+                                                        problem.mModesA,
+                                                        problem.mLengthsB,
+                                                        problem.mStridesB,
+                                                        problem.mModesB,
+                                                        problem.mLengthsD,
+                                                        problem.mStridesD,
+                                                        problem.mModesD,
+                                                        problem.mLengthsD,
+                                                        problem.mStridesD,
+                                                        problem.mModesD,
+                                                        hiptensor::PlaneStrides{},
+                                                        hiptensor::ContractionEpilogue{},
+                                                        nullptr));
+        }
+    }
+    BENCHMARK(BM_ContractionInitArgs);
+
+    void BM_PermutationSelectInstanceParams(benchmark::State& state)
+    {
+        auto                     rank = state.range(0);
+        std::vector<std::size_t> lengths(rank, 64);
+        std::vector<int32_t>     outputMode(rank);
+        std::iota(outputMode.rbegin(), outputMode.rend(), 0);
+
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                hiptensor::selectInstanceParams(lengths, outputMode, HIP_R_32F, HIP_R_32F, rank));
+        }
+    }
+    BENCHMARK(BM_PermutationSelectInstanceParams)->DenseRange(2, 6, 2);
+
+    // Arg 0: logging masked off, the common case on every API entry.
+    // Arg 1: API trace enabled and written to a scratch stream.
+    void BM_LoggerLogMessage(benchmark::State& state)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        auto  prevMask = logger->getLogMask();
+        FILE* scratch  = state.range(0) ? std::tmpfile() : nullptr;
+        if(scratch != nullptr)
+        {
+            logger->writeToStream(scratch);
+        }
+        logger->setLogMask(state.range(0) ? (int32_t)Logger::LogLevel_t::LOG_LEVEL_API_TRACE : 0);
+
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                logger->logMessage((int32_t)Logger::LogLevel_t::LOG_LEVEL_API_TRACE,
+                                   "hiptensorHostBench",
+                                   "handle=0x0000000000000000, desc=0x0000000000000000"));
+        }
+
+        logger->setLogMask(prevMask);
+        if(scratch != nullptr)
+        {
+            logger->writeToStream(stdout);
+            fclose(scratch);
+        }
+    }
+    BENCHMARK(BM_LoggerLogMessage)->ArgName("enabled")->Arg(0)->Arg(1);
+
+    void BM_ReadVal(benchmark::State& state)
+    {
+        double value = 2.5;
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(hiptensor::readVal<float>(&value, HIPTENSOR_COMPUTE_64F));
+            benchmark::DoNotOptimize(
+                hiptensor::readVal<hiptensor::ScalarData>(&value, HIPTENSOR_COMPUTE_64F));
+        }
+    }
+    BENCHMARK(BM_ReadVal);
+
+    void BM_WriteVal(benchmark::State& state)
+    {
+        double                storage[2];
+        hiptensor::ScalarData value(HIPTENSOR_COMPUTE_C32F, 1.5, -0.5);
+        for(auto _ : state)
+        {
+            hiptensor::writeVal(storage, HIPTENSOR_COMPUTE_C32F, value);
+            benchmark::ClobberMemory();
+        }
+    }
+    BENCHMARK(BM_WriteVal);
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    // GPU-less CI runs the layers that need no handle
+    int deviceCount = 0;
+    if(hipGetDeviceCount(&deviceCount) == hipSuccess && deviceCount > 0)
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorCreate(&gHandle));
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    if(gHandle != nullptr)
+    {
+        CHECK_HIPTENSOR_ERROR(hiptensorDestroy(gHandle));
+    }
+    return 0;
+}
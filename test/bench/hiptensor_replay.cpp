@@ -0,0 +1,392 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+// hiptensor-replay
+//
+// Rebuilds the problems captured in a trace recorded with HIPTENSOR_API_RECORD=<file>,
+// fills them with synthetic data and executes them on the GPU (default) or on the
+// CPU reference path (--cpu). Identical calls are folded together and their timing
+// is weighted by call count in the aggregate report.
+//
+// With --profile, nothing is executed: the kernel instance patterns needed by the
+// recorded calls are printed instead, in the format read by HIPTENSOR_INSTANCE_PROFILE.
+//
+// Usage: hiptensor-replay <trace> [--cpu] [--profile] [--warmups N] [--iterations N]
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/internal/hiptensor_utility.hpp>
+
+#include "api_recorder.hpp"
+#include "bench_problem.hpp"
+#include "data_types.hpp"
+
+namespace
+{
+    using hiptensor::ApiRecord;
+    using hiptensor::ApiRecordKind_t;
+
+    struct ReplayOptions
+    {
+        bool    mCpu        = false;
+        bool    mProfile    = false;
+        int32_t mWarmups    = 2;
+        int32_t mIterations = 10;
+    };
+
+    struct ReplayResult
+    {
+        hiptensorStatus_t mStatus = HIPTENSOR_STATUS_SUCCESS;
+        float             mAvgMs  = 0.0f;
+    };
+
+    ReplayResult
+        timeRuns(hiptensor::BenchProblem& run, ReplayOptions const& options, hipStream_t stream)
+    {
+        ReplayResult result;
+        for(int32_t i = 0; i < options.mWarmups; i++)
+        {
+            if((result.mStatus = run()) != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return result;
+            }
+        }
+
+        if(options.mCpu)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int32_t i = 0; i < options.mIterations; i++)
+            {
+                if((result.mStatus = run()) != HIPTENSOR_STATUS_SUCCESS)
+                {
+                    return result;
+                }
+            }
+            auto elapsed = std::chrono::duration<float, std::milli>(
+                std::chrono::steady_clock::now() - start);
+            result.mAvgMs = elapsed.count() / options.mIterations;
+        }
+        else
+        {
+            hipEvent_t startEvent, stopEvent;
+            CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+            CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+            CHECK_HIP_ERROR(hipEventRecord(startEvent, stream));
+            for(int32_t i = 0; i < options.mIterations; i++)
+            {
+                if((result.mStatus = run()) != HIPTENSOR_STATUS_SUCCESS)
+                {
+                    break;
+                }
+            }
+            CHECK_HIP_ERROR(hipEventRecord(stopEvent, stream));
+            CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+            float elapsedMs = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&elapsedMs, startEvent, stopEvent));
+            CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+            CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+            result.mAvgMs = elapsedMs / options.mIterations;
+        }
+
+        return result;
+    }
+
+    // Type names used in the instance source file names
+    std::string instanceTypeName(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            return "f16";
+        case HIP_R_16BF:
+            return "bf16";
+        case HIP_R_32F:
+            return "f32";
+        case HIP_R_64F:
+            return "f64";
+        case HIP_C_32F:
+            return "cf32";
+        case HIP_C_64F:
+            return "cf64";
+        default:
+            return "unknown";
+        }
+    }
+
+    std::string instanceComputeName(hiptensorComputeType_t computeType)
+    {
+        switch(computeType)
+        {
+        case HIPTENSOR_COMPUTE_16F:
+            return "f16";
+        case HIPTENSOR_COMPUTE_16BF:
+            return "bf16";
+        case HIPTENSOR_COMPUTE_32F:
+            return "f32";
+        case HIPTENSOR_COMPUTE_64F:
+            return "f64";
+        case HIPTENSOR_COMPUTE_C32F:
+            return "cf32";
+        case HIPTENSOR_COMPUTE_C64F:
+            return "cf64";
+        default:
+            return "unknown";
+        }
+    }
+
+    std::string instanceOpName(hiptensorOperator_t op)
+    {
+        return op == HIPTENSOR_OP_SQRT ? "square" : "through";
+    }
+
+    // Pattern matching the instance sources that can serve a recorded call. Contraction
+    // instances are kept for every layout of the family, as layouts are not part of the
+    // recorded problem but of the tensor strides.
+    std::string instancePattern(ApiRecord const& record)
+    {
+        auto const& tensors = record.mTensors;
+        if(record.mKind == ApiRecordKind_t::CONTRACTION)
+        {
+            // Scale contractions are recorded without a C tensor
+            auto scale = tensors[2].mType == hiptensor::NONE_TYPE;
+
+            auto dataType    = instanceTypeName(tensors[0].mType);
+            auto computeType = instanceComputeName(record.mComputeType);
+
+            std::string pattern = std::string("^device_contraction_")
+                                  + (scale ? "scale" : "bilinear") + "_m6_n6_k6_xdl_c_shuffle_"
+                                  + dataType + "_" + instanceTypeName(tensors[1].mType) + "_";
+            if(!scale)
+            {
+                pattern += instanceTypeName(tensors[2].mType) + "_";
+            }
+            pattern += instanceTypeName(tensors[3].mType);
+
+            // Same precision compute is left out of the name for f32 and f64
+            if(computeType != dataType || dataType[0] == 'c')
+            {
+                pattern += "_compute_" + computeType;
+            }
+
+            // Unary ops on A and B have their own instances, for a single layout
+            auto opA = tensors[0].mUnaryOp;
+            auto opB = tensors[1].mUnaryOp;
+            if(opA != HIPTENSOR_OP_IDENTITY || opB != HIPTENSOR_OP_IDENTITY)
+            {
+                auto op = opA != HIPTENSOR_OP_IDENTITY ? opA : opB;
+                return pattern + (op == HIPTENSOR_OP_SQRT ? "_sqrt_" : "_conj_")
+                       + (opA == HIPTENSOR_OP_IDENTITY   ? "b"
+                          : opB == HIPTENSOR_OP_IDENTITY ? "a"
+                                                         : "ab")
+                       + "_instance$";
+            }
+            return pattern + "_[kmn]+_instance$";
+        }
+        else if(record.mKind == ApiRecordKind_t::PERMUTATION)
+        {
+            auto rank     = std::to_string(tensors[0].mLengths.size());
+            auto dataType = tensors[0].mType == HIP_R_16F ? "half" : "float";
+
+            auto opA  = tensors[0].mUnaryOp;
+            auto opB  = tensors[1].mUnaryOp;
+            auto noop = record.mAlpha[0] == 1.0 && opA == HIPTENSOR_OP_IDENTITY
+                        && opB == HIPTENSOR_OP_IDENTITY;
+
+            return "^permutation_solution_rank" + rank + "_" + dataType + "_"
+                   + (noop ? "noop" : instanceOpName(opA) + "_" + instanceOpName(opB))
+                   + "_instances$";
+        }
+        else
+        {
+            auto rankA       = tensors[0].mLengths.size();
+            auto rankD       = tensors[2].mLengths.size();
+            auto dataType    = instanceTypeName(tensors[0].mType);
+            auto computeType = tensors[0].mType == HIP_R_64F ? "f64" : "f32";
+
+            return "^reduction_solution_" + std::to_string(rankA) + "_"
+                   + std::to_string(rankA - rankD) + "_" + dataType + "_" + computeType
+                   + "_instance$";
+        }
+    }
+
+    int printUsage(const char* exe)
+    {
+        fprintf(stderr,
+                "Usage: %s <trace> [--cpu] [--profile] [--warmups N] [--iterations N]\n"
+                "  Replays a trace recorded with HIPTENSOR_API_RECORD=<trace>\n"
+                "  --profile prints the instance profile of the trace instead\n",
+                exe);
+        return EXIT_FAILURE;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    ReplayOptions options;
+    const char*   traceFile = nullptr;
+    for(int i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--cpu") == 0)
+        {
+            options.mCpu = true;
+        }
+        else if(strcmp(argv[i], "--profile") == 0)
+        {
+            options.mProfile = true;
+        }
+        else if(strcmp(argv[i], "--warmups") == 0 && i + 1 < argc)
+        {
+            options.mWarmups = std::max(0, atoi(argv[++i]));
+        }
+        else if(strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+        {
+            options.mIterations = std::max(1, atoi(argv[++i]));
+        }
+        else if(traceFile == nullptr && argv[i][0] != '-')
+        {
+            traceFile = argv[i];
+        }
+        else
+        {
+            return printUsage(argv[0]);
+        }
+    }
+
+    if(traceFile == nullptr)
+    {
+        return printUsage(argv[0]);
+    }
+
+    std::vector<ApiRecord> records;
+    if(!hiptensor::readApiTrace(traceFile, records))
+    {
+        fprintf(stderr, "Unable to read hiptensor trace: %s\n", traceFile);
+        return EXIT_FAILURE;
+    }
+
+    if(options.mProfile)
+    {
+        std::set<std::string> patterns;
+        for(auto const& record : records)
+        {
+            patterns.insert(instancePattern(record));
+        }
+
+        printf("# hiptensor instance profile: %zu calls\n", records.size());
+        for(auto const& pattern : patterns)
+        {
+            printf("%s\n", pattern.c_str());
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // Don't record the replay itself
+    hiptensor::ApiRecorder::instance()->closeTrace();
+
+    // Fold identical calls, keeping first-seen order
+    std::vector<std::pair<std::string, ApiRecord>> problems;
+    std::map<std::string, size_t>                  callCounts;
+    for(auto const& record : records)
+    {
+        auto key = hiptensor::problemKey(record);
+        if(callCounts[key]++ == 0)
+        {
+            problems.emplace_back(key, record);
+        }
+    }
+
+    hiptensorHandle_t* handle;
+    CHECK_HIPTENSOR_ERROR(hiptensorCreate(&handle));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    std::mt19937 gen(5489u);
+
+    std::map<std::string, double> totalMsByKind;
+    double                        totalMs  = 0.0;
+    int                           failures = 0;
+
+    printf("Replaying %zu calls (%zu unique problems) on %s\n",
+           records.size(),
+           problems.size(),
+           options.mCpu ? "CPU" : "GPU");
+    printf("%-6s %-8s %-12s %-28s %s\n", "id", "calls", "avg_ms", "status", "problem");
+
+    for(size_t i = 0; i < problems.size(); i++)
+    {
+        auto const& [key, record] = problems[i];
+
+        ReplayResult            result;
+        hiptensor::BenchProblem problem(handle, record, options.mCpu, stream, gen);
+        if((result.mStatus = problem.status()) == HIPTENSOR_STATUS_SUCCESS)
+        {
+            result = timeRuns(problem, options, stream);
+        }
+
+        auto calls = callCounts[key];
+        printf("%-6zu %-8zu %-12.4f %-28s %s\n",
+               i,
+               calls,
+               result.mAvgMs,
+               hiptensorGetErrorString(result.mStatus),
+               key.c_str());
+
+        if(result.mStatus == HIPTENSOR_STATUS_SUCCESS)
+        {
+            totalMsByKind[hiptensor::kindToString(record.mKind)] += result.mAvgMs * calls;
+            totalMs += result.mAvgMs * calls;
+        }
+        else
+        {
+            failures++;
+        }
+    }
+
+    printf("\nAggregate (weighted by call count):\n");
+    for(auto const& [kind, ms] : totalMsByKind)
+    {
+        printf("  %-12s %12.4f ms\n", kind.c_str(), ms);
+    }
+    printf("  %-12s %12.4f ms\n", "total", totalMs);
+    printf("  %-12s %12d\n", "failures", failures);
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPTENSOR_ERROR(hiptensorDestroy(handle));
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -148,6 +148,7 @@ namespace llvm
             {
                 io.enumCase(value, "HIPTENSOR_OP_IDENTITY", HIPTENSOR_OP_IDENTITY);
                 io.enumCase(value, "HIPTENSOR_OP_SQRT", HIPTENSOR_OP_SQRT);
+                io.enumCase(value, "HIPTENSOR_OP_CONJ", HIPTENSOR_OP_CONJ);
                 io.enumCase(value, "HIPTENSOR_OP_ADD", HIPTENSOR_OP_ADD);
                 io.enumCase(value, "HIPTENSOR_OP_MUL", HIPTENSOR_OP_MUL);
                 io.enumCase(value, "HIPTENSOR_OP_MIN", HIPTENSOR_OP_MIN);